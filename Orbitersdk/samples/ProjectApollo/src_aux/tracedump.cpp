@@ -0,0 +1,96 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Trace log decoder. Converts a binary trace file written by TraceLog into
+  text. It's a plain console program with no Orbiter dependencies:
+
+    cl /EHsc /I..\src_sys tracedump.cpp ..\src_sys\tracelog.cpp
+
+  Usage: tracedump [-r] [-m mask] file.trc [out.txt]
+
+    -r       Print only the text records, without the time/category prefix.
+             "tracedump -r -m 4 file.trc lvlog.txt" gives the old LVDC log.
+    -m mask  Hex mask of the TRACE_* categories to print (default all).
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1300) //Microsoft Visual Studio Version 2003 and higher
+#define _CRT_SECURE_NO_DEPRECATE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tracelog.h"
+
+int main(int argc, char **argv)
+
+{
+	unsigned int mask = TRACE_ALL;
+	bool raw = false;
+	char *inName = NULL, *outName = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-r"))
+			raw = true;
+		else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+			mask = strtoul(argv[++i], NULL, 16);
+		else if (!inName)
+			inName = argv[i];
+		else
+			outName = argv[i];
+	}
+
+	if (!inName)
+	{
+		fprintf(stderr, "Usage: tracedump [-r] [-m mask] file.trc [out.txt]\n");
+		return 1;
+	}
+
+	FILE *in = fopen(inName, "rb");
+	if (!in)
+	{
+		fprintf(stderr, "Can't open %s\n", inName);
+		return 1;
+	}
+
+	FILE *out = stdout;
+	if (outName && !(out = fopen(outName, "wb")))
+	{
+		fprintf(stderr, "Can't create %s\n", outName);
+		fclose(in);
+		return 1;
+	}
+
+	bool ok = TraceLog::Decode(in, out, mask, raw);
+
+	fclose(in);
+	if (out != stdout)
+		fclose(out);
+
+	if (!ok)
+	{
+		fprintf(stderr, "%s is not a trace file, or is truncated\n", inName);
+		return 1;
+	}
+	return 0;
+}
@@ -27,40 +27,39 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
 #include "tracer.h"
 //############################################################################//
 // Tracer class for simple debug output from modules. Feel free to steal
 // this for any code you're working on yourself.
 //############################################################################//
-static int prefix_count = 0;
+static thread_local int prefix_count = 0;
 //############################################################################//
-// Write the strings to a file. Note that we always open and close the
-// file here... this will be slow, but it (almost) guarantees that it's
-// been written to disk if the program later crashes. A hard lock could
-// still potentially leave the data in the disk cach before it's been
-// written, but those seem to be rare with Orbiter.
+// Hand the strings to the trace log. The log's writer thread puts them on
+// disk, so this no longer opens and closes a file per message; the nesting
+// level goes in the record and the decoder indents with it.
 //############################################################################//
-static void DoTrace(char *func,char *str)
+static void DoTrace(int event,char *func,char *str)
 {
-	FILE *fp;
-	static bool FirstTime=true;
-	char *type="at";
+	if(!TraceLog::Enabled(TRACE_FUNC))return;
 
-	//Open for writing the first time, to delete any old data in the file.
-	if(FirstTime){FirstTime=false;type="wt";}
+	char buffer[TRACE_MAX_PAYLOAD];
+	int n=(int)strlen(func);
+	if(n>TRACE_MAX_PAYLOAD/2)n=TRACE_MAX_PAYLOAD/2;
+	memcpy(buffer,func,n);
+	buffer[n++]=0;
 
-	fp=fopen(trace_file,type);
-	if(!fp)return;
+	if(str){
+		int m=(int)strlen(str);
+		if(m>TRACE_MAX_PAYLOAD-n)m=TRACE_MAX_PAYLOAD-n;
+		memcpy(buffer+n,str,m);
+		n+=m;
+	}
 
-	//Prefix with spaces to indent nicely.
-	for(int i=0;i<prefix_count;i++)fputc(' ',fp);
-	
-	//Finally print the string.
-	fprintf(fp,"%s: %s\n",func,str);
-	fclose(fp);
+	TraceLog::Write(TRACE_FUNC,event,buffer,n,prefix_count);
 }
 //############################################################################//
-     Tracer:: Tracer(char *s){prefix_count++;ThisFunc=s;DoTrace(s,"Starting");}
-     Tracer::~Tracer()       {                          DoTrace(ThisFunc,"Done");prefix_count--;}
-void Tracer::print(char *s)  {                          DoTrace(ThisFunc, s);}
+     Tracer:: Tracer(char *s){prefix_count++;ThisFunc=s;DoTrace(TRACEEV_FUNC_ENTER,s,NULL);}
+     Tracer::~Tracer()       {                          DoTrace(TRACEEV_FUNC_EXIT,ThisFunc,NULL);prefix_count--;}
+void Tracer::print(char *s)  {                          DoTrace(TRACEEV_FUNC_MESSAGE,ThisFunc,s);}
 //############################################################################//
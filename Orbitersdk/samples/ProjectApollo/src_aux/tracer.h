@@ -26,6 +26,8 @@
 
   **************************************************************************/
 //############################################################################//
+#include "tracelog.h"
+//############################################################################//
 class Tracer{
 public:
 	Tracer(char *s);
@@ -37,7 +39,8 @@ private:
 };
 //############################################################################//
 // You'll need to define trace_file as a string holding the name of the file
-// that you want to write to.  
+// that you want to write to, and open it with TraceLog::Open(trace_file).
+// Records go to the TRACE_FUNC category of the trace log.
 //############################################################################//
 extern char trace_file[];
 //############################################################################//
@@ -57,5 +60,5 @@ extern char trace_file[];
 #else
 #define TRACESETUP(s)
 #define TRACE(s) {}
-#endif  
+#endif
 //############################################################################//
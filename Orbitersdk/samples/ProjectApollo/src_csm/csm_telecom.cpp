@@ -25,6 +25,7 @@
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "Orbitersdk.h"
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include "soundlib.h"
 #include "resource.h"
@@ -654,23 +655,453 @@ void HGA::SaveState(FILEHANDLE scn) {
 	oapiWriteScenario_string(scn, "HIGHGAINANTENNA", buffer);
 }
 
-// Socket registration method (registers sockets to be deinitialized
-bool PCM::registerSocket(SOCKET sock)
-{
-	HMODULE hpac = GetModuleHandle("modules\\startup\\ProjectApolloConfigurator.dll");
-	if (hpac) {
-		bool (__cdecl *regSocket1)(SOCKET);
-		regSocket1 = (bool (__cdecl *)(SOCKET)) GetProcAddress(hpac,"pacDefineSocket");
-		if (regSocket1)	{
-			if (!regSocket1(sock))
-				return false;
-		} else {
-			return false;
-		}
-	}
-	return true;
-}
 // PCM SYSTEM
+// CSM downlink formats. One entry per word position, or per subframe for words
+// that are subcommutated on the frame count; measure() does the scaling.
+
+const PCMMeasurement CSMPCMFormatLBR[] = {
+	{   0, PCM_ALL_FRAMES, PCMOP_CONST, PCMFLAG_DOWNRUPT_BEFORE, 0, 0, 05, 0 },	// SYNC 1
+	{   1, PCM_ALL_FRAMES, PCMOP_CONST, 0, 0, 0, 0171, 0 },	// SYNC 2
+	{   2, PCM_ALL_FRAMES, PCMOP_CONST, 0, 0, 0, 0267, 0 },	// SYNC 3
+	{   3, PCM_ALL_FRAMES, PCMOP_FRAMECOUNT, 0, 0, 0, 0, 0 },	// SYNC 4 & FRAME COUNT
+	{   4,  0, PCMOP_MEASURE, 0, 11, TLM_A, 1, 0 },	// 11A1 ECS: SUIT MANF ABS PRESS
+	{   4,  1, PCMOP_MEASURE, 0, 11, TLM_A, 109, 0 },	// 11A109 EPS: BAT B CURR
+	{   4,  2, PCMOP_MEASURE, 0, 11, TLM_A, 46, 0 },	// 11A46 RCS: SM HE MANF C PRESS
+	{   4,  3, PCMOP_MEASURE, 0, 11, TLM_A, 154, 0 },	// 11A154 CMI: SCE NEG SUPPLY VOLTS
+	{   4,  4, PCMOP_MEASURE, 0, 11, TLM_A, 91, 0 },	// 11A91 EPS: BAT BUS A VOLTS
+	{   5,  0, PCMOP_MEASURE, 0, 11, TLM_A, 2, 0 },	// 11A2 ECS: SUIT COMP DELTA P
+	{   5,  1, PCMOP_MEASURE, 0, 11, TLM_A, 110, 0 },	// 11A110 EPS: BAT C CURR
+	{   5,  2, PCMOP_MEASURE, 0, 11, TLM_A, 47, 0 },	// 11A47 EPS: LM HEATER CURRENT
+	{   5,  3, PCMOP_MEASURE, 0, 11, TLM_A, 155, 0 },	// 11A155 RCS: CM HE TK A TEMP
+	{   5,  4, PCMOP_MEASURE, 0, 11, TLM_A, 92, 0 },	// 11A92 RCS: SM FU MANF A PRESS
+	{   6,  0, PCMOP_MEASURE, 0, 11, TLM_A, 3, 0 },	// 11A3 ECS: GLY PUMP OUT PRESS
+	{   6,  1, PCMOP_MEASURE, 0, 11, TLM_A, 111, 0 },	// 11A111 ECS: SM FU MANF C PRESS
+	{   6,  2, PCMOP_MEASURE, 0, 11, TLM_A, 48, 0 },	// 11A48 PCM HI LEVEL 85 PCT REF
+	{   6,  3, PCMOP_MEASURE, 0, 11, TLM_A, 156, 0 },	// 11A156 CM HE TK B TEMP
+	{   6,  4, PCMOP_MEASURE, 0, 11, TLM_A, 93, 0 },	// 11A93 BAT BUS B VOLTS
+	{   7,  0, PCMOP_MEASURE, 0, 11, TLM_A, 4, 0 },	// 11A4 ECS SURGE TANK PRESS
+	{   7,  1, PCMOP_MEASURE, 0, 11, TLM_A, 112, 0 },	// 11A112 SM FU MANF D PRESS
+	{   7,  2, PCMOP_MEASURE, 0, 11, TLM_A, 49, 0 },	// 11A49 PC HI LEVEL 15 PCT REF
+	{   7,  3, PCMOP_MEASURE, 0, 11, TLM_A, 157, 0 },	// 11A157 SEC GLY PUMP OUT PRESS
+	{   7,  4, PCMOP_MEASURE, 0, 11, TLM_A, 94, 0 },	// 11A94 SM FU MANF B PRESS
+	{   8, PCM_ALL_FRAMES, PCMOP_CMC_A, 0, 0, 0, 0, 0 },	// 51DS1A COMPUTER DIGITAL DATA
+	{   9, PCM_ALL_FRAMES, PCMOP_CMC_B, 0, 0, 0, 0, 0 },	// 51DS1B COMPUTER DIGITAL DATA
+	{  10, PCM_ALL_FRAMES, PCMOP_CMC_C, 0, 0, 0, 0, 0 },	// 51DS1C COMPUTER DIGITAL DATA
+	{  11, PCM_ALL_FRAMES, PCMOP_CMC_D, 0, 0, 0, 0, 0 },	// 51DS1D COMPUTER DIGITAL DATA
+	{  12, PCM_ALL_FRAMES, PCMOP_CMC_E, 0, 0, 0, 0, 0 },	// 51DS1E COMPUTER DIGITAL DATA
+	{  14,  0, PCMOP_MEASURE, 0, 10, TLM_A, 123, 0 },	// 10A123 FC 2 COND EXH TEMP
+	{  14,  1, PCMOP_MEASURE, 0, 10, TLM_A, 126, 0 },	// 10A126 FC 1 RAD OUT TEMP
+	{  14,  2, PCMOP_MEASURE, 0, 10, TLM_A, 129, 0 },	// 10A129 FC 2 RAD OUT TEMP
+	{  14,  3, PCMOP_MEASURE, 0, 10, TLM_A, 132, 0 },	// 10A132 FC 3 RAD OUT TEMP
+	{  14,  4, PCMOP_MEASURE, 0, 10, TLM_A, 135, 0 },	// 10A135 URINE DUMP NOZZLE TEMP
+	{  15,  0, PCMOP_MEASURE, 0, 10, TLM_A, 138, 0 },	// 10A138 TM BIAS 2.5 VDC
+	{  15,  1, PCMOP_MEASURE, 0, 10, TLM_A, 141, 0 },	// 10A141 EPS: H2 TK 1 QTY
+	{  15,  2, PCMOP_MEASURE, 0, 10, TLM_A, 144, 0 },	// 10A144 H2 TK 2 QTY
+	{  15,  3, PCMOP_MEASURE, 0, 10, TLM_A, 147, 0 },	// 10A147 O2 TK 1 QTY
+	{  15,  4, PCMOP_MEASURE, 0, 10, TLM_A, 150, 0 },	// 10A150 O2 TK 1 PRESS
+	{  16,  0, PCMOP_MEASURE, 0, 10, TLM_A, 3, 0 },	// 10A3
+	{  16,  1, PCMOP_MEASURE, 0, 10, TLM_A, 6, 0 },	// 10A6
+	{  16,  2, PCMOP_MEASURE, 0, 10, TLM_A, 9, 0 },	// 10A9
+	{  16,  3, PCMOP_MEASURE, 0, 10, TLM_A, 12, 0 },	// 10A12
+	{  16,  4, PCMOP_MEASURE, 0, 10, TLM_A, 15, 0 },	// 10A15
+	{  17,  0, PCMOP_MEASURE, 0, 10, TLM_A, 18, 0 },	// 10A18
+	{  17,  1, PCMOP_MEASURE, 0, 10, TLM_A, 21, 0 },	// 10A21
+	{  17,  2, PCMOP_MEASURE, 0, 10, TLM_A, 24, 0 },	// 10A24
+	{  17,  3, PCMOP_MEASURE, 0, 10, TLM_A, 27, 0 },	// 10A27
+	{  17,  4, PCMOP_MEASURE, 0, 10, TLM_A, 30, 0 },	// 10A30
+	{  18,  0, PCMOP_MEASURE, 0, 10, TLM_A, 33, 0 },	// 10A33
+	{  18,  1, PCMOP_MEASURE, 0, 10, TLM_A, 36, 0 },	// 10A36 H2 TK 1 PRESS
+	{  18,  2, PCMOP_MEASURE, 0, 10, TLM_A, 39, 0 },	// 10A39 H2 TK 2 PRESS
+	{  18,  3, PCMOP_MEASURE, 0, 10, TLM_A, 42, 0 },	// 10A42 O2 TK 2 QTY
+	{  18,  4, PCMOP_MEASURE, 0, 10, TLM_A, 45, 0 },	// 10A45
+	{  19,  0, PCMOP_MEASURE, 0, 10, TLM_A, 48, 0 },	// 10A48
+	{  19,  1, PCMOP_MEASURE, 0, 10, TLM_A, 51, 0 },	// 10A51
+	{  19,  2, PCMOP_MEASURE, 0, 10, TLM_A, 54, 0 },	// 10A54 O2 TK 1 TEMP
+	{  19,  3, PCMOP_MEASURE, 0, 10, TLM_A, 57, 0 },	// 10A57 O2 TK 2 TEMP
+	{  19,  4, PCMOP_MEASURE, 0, 10, TLM_A, 60, 0 },	// 10A60 H2 TK 1 TEMP
+	{  20,  0, PCMOP_MEASURE, PCMFLAG_DOWNRUPT_BEFORE, 10, TLM_DP, 1, 0 },	// 10DP1
+	{  20,  1, PCMOP_MEASURE, PCMFLAG_DOWNRUPT_BEFORE, 11, TLM_DP, 6, 0 },	// 11DP6
+	{  20,  2, PCMOP_MEASURE, PCMFLAG_DOWNRUPT_BEFORE, 11, TLM_DP, 27, 0 },	// 11DP27
+	{  20,  3, PCMOP_MEASURE, PCMFLAG_DOWNRUPT_BEFORE, 11, TLM_DP, 17, 0 },	// 11DP17
+	{  20,  4, PCMOP_MEASURE, PCMFLAG_DOWNRUPT_BEFORE, 11, TLM_DP, 20, 0 },	// 11DP20
+	{  20,  5, PCMOP_CONST, PCMFLAG_DOWNRUPT_BEFORE, 0, 0, 0, 0 },	// Not assigned
+	{  21,  0, PCMOP_MEASURE, 0, 0, TLM_SRC, 0, 0 },	// SRC 0
+	{  21,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 7, 0 },	// 11DP7
+	{  21,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 28, 0 },	// 11DP28
+	{  21,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 16, 0 },	// 11DP16
+	{  21,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 21, 0 },	// 11DP21
+	{  22,  0, PCMOP_MEASURE, 0, 11, TLM_A, 39, 0 },	// 11A39
+	{  22,  1, PCMOP_MEASURE, 0, 11, TLM_A, 147, 0 },	// 11A147 AC BUS 1 PH A VOLTS
+	{  22,  2, PCMOP_MEASURE, 0, 11, TLM_A, 84, 0 },	// 11A84
+	{  22,  3, PCMOP_MEASURE, 0, 11, TLM_A, 21, 0 },	// 11A21
+	{  22,  4, PCMOP_MEASURE, 0, 11, TLM_A, 129, 0 },	// 11A129
+	{  23,  0, PCMOP_MEASURE, 0, 11, TLM_A, 40, 0 },	// 11A40
+	{  23,  1, PCMOP_MEASURE, 0, 11, TLM_A, 48, 0 },	// 11A48 PCM HI LEVEL 85 PCT REF
+	{  23,  2, PCMOP_MEASURE, 0, 11, TLM_A, 85, 0 },	// 11A85
+	{  23,  3, PCMOP_MEASURE, 0, 11, TLM_A, 22, 0 },	// 11A22
+	{  23,  4, PCMOP_MEASURE, 0, 11, TLM_A, 130, 0 },	// 11A130
+	{  24,  0, PCMOP_MEASURE, 0, 11, TLM_A, 73, 0 },	// 11A73 BAT CHRGR AMPS
+	{  24,  1, PCMOP_MEASURE, 0, 11, TLM_A, 10, 0 },	// 11A10
+	{  24,  2, PCMOP_MEASURE, 0, 11, TLM_A, 118, 0 },	// 11A118
+	{  24,  3, PCMOP_MEASURE, 0, 11, TLM_A, 55, 0 },	// 11A55
+	{  24,  4, PCMOP_MEASURE, 0, 11, TLM_A, 163, 0 },	// 11A163
+	{  25,  0, PCMOP_MEASURE, 0, 11, TLM_A, 74, 0 },	// 11A74 BAT A CUR
+	{  25,  1, PCMOP_MEASURE, 0, 11, TLM_A, 11, 0 },	// 11A11
+	{  25,  2, PCMOP_MEASURE, 0, 11, TLM_A, 119, 0 },	// 11A119
+	{  25,  3, PCMOP_MEASURE, 0, 11, TLM_A, 56, 0 },	// 11A56 AC BUS 2 PH A VOLTS
+	{  25,  4, PCMOP_MEASURE, 0, 11, TLM_A, 164, 0 },	// 11A164
+	{  26,  0, PCMOP_MEASURE, 0, 11, TLM_A, 75, 0 },	// 11A75
+	{  26,  1, PCMOP_MEASURE, 0, 11, TLM_A, 12, 0 },	// 11A12
+	{  26,  2, PCMOP_MEASURE, 0, 11, TLM_A, 120, 0 },	// 11A120
+	{  26,  3, PCMOP_MEASURE, 0, 11, TLM_A, 57, 0 },	// 11A57
+	{  26,  4, PCMOP_MEASURE, 0, 11, TLM_A, 165, 0 },	// 11A165
+	{  27,  0, PCMOP_MEASURE, 0, 11, TLM_A, 76, 0 },	// 11A76
+	{  27,  1, PCMOP_MEASURE, 0, 11, TLM_A, 13, 0 },	// 11A13
+	{  27,  2, PCMOP_MEASURE, 0, 11, TLM_A, 121, 0 },	// 11A121
+	{  27,  3, PCMOP_MEASURE, 0, 11, TLM_A, 58, 0 },	// 11A58
+	{  27,  4, PCMOP_MEASURE, 0, 11, TLM_A, 166, 0 },	// 11A166
+	{  28, PCM_ALL_FRAMES, PCMOP_CMC_A, 0, 0, 0, 0, 0 },	// 51DS1A COMPUTER DIGITAL DATA
+	{  29, PCM_ALL_FRAMES, PCMOP_CMC_B, 0, 0, 0, 0, 0 },	// 51DS1B COMPUTER DIGITAL DATA
+	{  30, PCM_ALL_FRAMES, PCMOP_CMC_C, 0, 0, 0, 0, 0 },	// 51DS1C COMPUTER DIGITAL DATA
+	{  31, PCM_ALL_FRAMES, PCMOP_CMC_D, 0, 0, 0, 0, 0 },	// 51DS1D COMPUTER DIGITAL DATA
+	{  32, PCM_ALL_FRAMES, PCMOP_CMC_E, 0, 0, 0, 0, 0 },	// 51DS1E COMPUTER DIGITAL DATA
+	{  34,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 3, 0 },	// 11DP3
+	{  34,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 8, 0 },	// 11DP8
+	{  34,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 13, 0 },	// 11DP13
+	{  34,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 29, 0 },	// 11DP29
+	{  34,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 22, 0 },	// 11DP22
+	{  35,  0, PCMOP_MEASURE, 0, 0, TLM_SRC, 1, 0 },	// SRC 1
+	{  35,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 9, 0 },	// 11DP9
+	{  35,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 14, 0 },	// 11DP14
+	{  35,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 17, 0 },	// 11DP17
+	{  35,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 23, 0 },	// 11DP23
+	{  36,  0, PCMOP_MEASURE, 0, 10, TLM_A, 63, 0 },	// 10A63 H2 TK 2 TEMP
+	{  36,  1, PCMOP_MEASURE, 0, 10, TLM_A, 66, 0 },	// 10A66 O2 TK 2 PRESS
+	{  36,  2, PCMOP_MEASURE, 0, 10, TLM_A, 69, 0 },	// 10A69
+	{  36,  3, PCMOP_MEASURE, 0, 10, TLM_A, 72, 0 },	// 10A72
+	{  36,  4, PCMOP_MEASURE, 0, 10, TLM_A, 75, 0 },	// 10A75
+	{  37,  0, PCMOP_MEASURE, 0, 10, TLM_A, 78, 0 },	// 10A78
+	{  37,  1, PCMOP_MEASURE, 0, 10, TLM_A, 81, 0 },	// 10A81
+	{  37,  2, PCMOP_MEASURE, 0, 10, TLM_A, 84, 0 },	// 10A84
+	{  37,  3, PCMOP_MEASURE, 0, 10, TLM_A, 87, 0 },	// 10A87
+	{  37,  4, PCMOP_MEASURE, 0, 10, TLM_A, 90, 0 },	// 10A90
+	{  38,  0, PCMOP_MEASURE, 0, 10, TLM_A, 93, 0 },	// 10A93
+	{  38,  1, PCMOP_MEASURE, 0, 10, TLM_A, 96, 0 },	// 10A96
+	{  38,  2, PCMOP_MEASURE, 0, 10, TLM_A, 99, 0 },	// 10A99
+	{  38,  3, PCMOP_MEASURE, 0, 10, TLM_A, 102, 0 },	// 10A102
+	{  38,  4, PCMOP_MEASURE, 0, 10, TLM_A, 105, 0 },	// 10A105
+	{  39,  0, PCMOP_MEASURE, 0, 10, TLM_A, 108, 0 },	// 10A108
+	{  39,  1, PCMOP_MEASURE, 0, 10, TLM_A, 11, 0 },	// 10A11
+	{  39,  2, PCMOP_MEASURE, 0, 10, TLM_A, 114, 0 },	// 10A114
+	{  39,  3, PCMOP_MEASURE, 0, 10, TLM_A, 117, 0 },	// 10A117
+	{  39,  4, PCMOP_MEASURE, 0, 10, TLM_A, 120, 0 },	// 10A120
+};
+
+const PCMMeasurement CSMPCMFormatHBR[] = {
+	{   0, PCM_ALL_FRAMES, PCMOP_CONST, 0, 0, 0, 05, 0 },	// SYNC 1
+	{   1, PCM_ALL_FRAMES, PCMOP_CONST, 0, 0, 0, 0171, 0 },	// SYNC 2
+	{   2, PCM_ALL_FRAMES, PCMOP_CONST, 0, 0, 0, 0267, 0 },	// SYNC 3
+	{   3, PCM_ALL_FRAMES, PCMOP_FRAMEADDR, 0, 0, 0, 0, 0 },	// SYNC 4 & FRAME COUNT
+	{   4, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 1, 0 },	// 22A1 ASTRO 1 EKG AXIS 2
+	{   5, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 2, 0 },	// 22A2 ASTRO 1 EKG AXIS 3
+	{   6, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 3, 0 },	// 22A3 ASTRO 1 EKG AXIS 1
+	{   7, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 4, 0 },	// 22A4 PITCH DIFF CLUTCH CURRENT
+	{   8,  0, PCMOP_MEASURE, 0, 11, TLM_A, 1, 0 },	// 11A1 ECS: SUIT MANF ABS PRESS
+	{   8,  1, PCMOP_MEASURE, 0, 11, TLM_A, 37, 0 },	// 11A37 SUIT-CABIN DELTA PRESS
+	{   8,  2, PCMOP_MEASURE, 0, 11, TLM_A, 73, 0 },	// 11A73 BAT CHRGR AMPS
+	{   8,  3, PCMOP_MEASURE, 0, 11, TLM_A, 109, 0 },	// 11A109 EPS: BAT B CURR
+	{   8,  4, PCMOP_MEASURE, 0, 11, TLM_A, 145, 0 },	// 11A145
+	{   9,  0, PCMOP_MEASURE, 0, 11, TLM_A, 2, 0 },	// 11A2 ECS: SUIT COMP DELTA P
+	{   9,  1, PCMOP_MEASURE, 0, 11, TLM_A, 38, 0 },	// 11A38 ALPHA CT RATE CHAN 1
+	{   9,  2, PCMOP_MEASURE, 0, 11, TLM_A, 74, 0 },	// 11A74 BAT A CUR
+	{   9,  3, PCMOP_MEASURE, 0, 11, TLM_A, 110, 0 },	// 11A110 EPS: BAT C CURR
+	{   9,  4, PCMOP_MEASURE, 0, 11, TLM_A, 146, 0 },	// 11A146
+	{  10,  0, PCMOP_MEASURE, 0, 11, TLM_A, 3, 0 },	// 11A3 ECS: GLY PUMP OUT PRESS
+	{  10,  1, PCMOP_MEASURE, 0, 11, TLM_A, 39, 0 },	// 11A39
+	{  10,  2, PCMOP_MEASURE, 0, 11, TLM_A, 75, 0 },	// 11A75
+	{  10,  3, PCMOP_MEASURE, 0, 11, TLM_A, 111, 0 },	// 11A111 ECS: SM FU MANF C PRESS
+	{  10,  4, PCMOP_MEASURE, 0, 11, TLM_A, 147, 0 },	// 11A147 AC BUS 1 PH A VOLTS
+	{  11,  0, PCMOP_MEASURE, 0, 11, TLM_A, 4, 0 },	// 11A4 ECS SURGE TANK PRESS
+	{  11,  1, PCMOP_MEASURE, 0, 11, TLM_A, 40, 0 },	// 11A40
+	{  11,  2, PCMOP_MEASURE, 0, 11, TLM_A, 76, 0 },	// 11A76
+	{  11,  3, PCMOP_MEASURE, 0, 11, TLM_A, 112, 0 },	// 11A112 SM FU MANF D PRESS
+	{  11,  4, PCMOP_MEASURE, 0, 11, TLM_A, 148, 0 },	// 11A148 SCE POS SUPPLY VOLTS
+	{  12, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 1, 0 },	// 12A1 MGA SERVO ERR IN PHASE
+	{  13, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 2, 0 },	// 12A2 IGA SERVO ERR IN PHASE
+	{  14, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 3, 0 },	// 12A3 OGA SERVO ERR IN PHASE
+	{  15, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 4, 0 },	// 12A4 ROLL ATT ERR
+	{  16,  0, PCMOP_MEASURE, 0, 11, TLM_A, 5, 0 },	// 11A5 PYRO BUS B VOLTS
+	{  16,  1, PCMOP_MEASURE, 0, 11, TLM_A, 41, 0 },	// 11A41 ALPHA CT RATE CHAN 2
+	{  16,  2, PCMOP_MEASURE, 0, 11, TLM_A, 77, 0 },	// 11A77 FC 1 H2 FLOW
+	{  16,  3, PCMOP_MEASURE, 0, 11, TLM_A, 113, 0 },	// 11A113
+	{  16,  4, PCMOP_MEASURE, 0, 11, TLM_A, 149, 0 },	// 11A149
+	{  17, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 1, 0 },	// 22DP1
+	{  18, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 2, 0 },	// 22DP2
+	{  19,  0, PCMOP_MEASURE, 0, 10, TLM_DP, 1, 0 },	// 10DP1
+	{  19,  1, PCMOP_MEASURE, 0, 0, TLM_SRC, 0, 0 },	// SRC 0
+	{  19,  2, PCMOP_MEASURE, 0, 0, TLM_SRC, 1, 0 },	// SRC 1
+	{  20, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 5, 0 },	// 12A5 SCS PITCH BODY RATE
+	{  21, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 6, 0 },	// 12A6 SCS YAW BODY RATE
+	{  22, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 7, 0 },	// 12A7 SCS ROLL BODY RATE
+	{  23, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 8, 0 },	// 12A8 PITCH GIMBL POS 1 OR 2
+	{  24,  0, PCMOP_MEASURE, 0, 11, TLM_A, 6, 0 },	// 11A6 LES LOGIC BUS B VOLTS
+	{  24,  1, PCMOP_MEASURE, 0, 11, TLM_A, 42, 0 },	// 11A42 ALPHA CT RATE CHAN 3
+	{  24,  2, PCMOP_MEASURE, 0, 11, TLM_A, 78, 0 },	// 11A78 FC 2 H2 FLOW
+	{  24,  3, PCMOP_MEASURE, 0, 11, TLM_A, 114, 0 },	// 11A114
+	{  24,  4, PCMOP_MEASURE, 0, 11, TLM_A, 150, 0 },	// 11A150
+	{  25,  0, PCMOP_MEASURE, 0, 11, TLM_A, 7, 0 },	// 11A7
+	{  25,  1, PCMOP_MEASURE, 0, 11, TLM_A, 43, 0 },	// 11A43 PROTON INTEG CT RATE
+	{  25,  2, PCMOP_MEASURE, 0, 11, TLM_A, 79, 0 },	// 11A79 FC 3 H2 FLOW
+	{  25,  3, PCMOP_MEASURE, 0, 11, TLM_A, 115, 0 },	// 11A115
+	{  25,  4, PCMOP_MEASURE, 0, 11, TLM_A, 151, 0 },	// 11A151
+	{  26,  0, PCMOP_MEASURE, 0, 11, TLM_A, 8, 0 },	// 11A8 LES LOGIC BUS A VOLTS
+	{  26,  1, PCMOP_MEASURE, 0, 11, TLM_A, 44, 0 },	// 11A44
+	{  26,  2, PCMOP_MEASURE, 0, 11, TLM_A, 80, 0 },	// 11A80 FC 1 O2 FLOW
+	{  26,  3, PCMOP_MEASURE, 0, 11, TLM_A, 116, 0 },	// 11A116
+	{  26,  4, PCMOP_MEASURE, 0, 11, TLM_A, 152, 0 },	// 11A152 FUEL SM/ENG INTERFACE P
+	{  27,  0, PCMOP_MEASURE, 0, 11, TLM_A, 9, 0 },	// 11A9 PYRO BUS A VOLTS
+	{  27,  1, PCMOP_MEASURE, 0, 11, TLM_A, 45, 0 },	// 11A45
+	{  27,  2, PCMOP_MEASURE, 0, 11, TLM_A, 81, 0 },	// 11A81 FC 2 O2 FLOW
+	{  27,  3, PCMOP_MEASURE, 0, 11, TLM_A, 117, 0 },	// 11A117
+	{  27,  4, PCMOP_MEASURE, 0, 11, TLM_A, 153, 0 },	// 11A153
+	{  28, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 1, 0 },	// 51A1
+	{  29, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 2, 0 },	// 51A2
+	{  30, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 3, 0 },	// 51A3
+	{  31, PCM_ALL_FRAMES, PCMOP_CMC_A, 0, 0, 0, 0, 0 },	// 51DS1A COMPUTER DIGITAL DATA
+	{  32, PCM_ALL_FRAMES, PCMOP_CMC_B, 0, 0, 0, 0, 0 },	// 51DS1B COMPUTER DIGITAL DATA
+	{  33, PCM_ALL_FRAMES, PCMOP_CMC_C, 0, 0, 0, 0, 0 },	// 51DS1C COMPUTER DIGITAL DATA
+	{  34, PCM_ALL_FRAMES, PCMOP_CMC_D, 0, 0, 0, 0, 0 },	// 51DS1D COMPUTER DIGITAL DATA
+	{  35, PCM_ALL_FRAMES, PCMOP_CMC_E, PCMFLAG_DOWNRUPT_AFTER, 0, 0, 0, 0 },	// 51DS1E COMPUTER DIGITAL DATA
+	{  36, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 1, 0 },	// 22A1 ASTRO 1 EKG AXIS 2
+	{  37, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 2, 0 },	// 22A2 ASTRO 1 EKG AXIS 3
+	{  38, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 3, 0 },	// 22A3 ASTRO 1 EKG AXIS 1
+	{  39, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 4, 0 },	// 22A4 PITCH DIFF CLUTCH CURRENT
+	{  40,  0, PCMOP_MEASURE, 0, 11, TLM_A, 10, 0 },	// 11A10
+	{  40,  1, PCMOP_MEASURE, 0, 11, TLM_A, 46, 0 },	// 11A46 RCS: SM HE MANF C PRESS
+	{  40,  2, PCMOP_MEASURE, 0, 11, TLM_A, 82, 0 },	// 11A82 FC 3 O2 FLOW
+	{  40,  3, PCMOP_MEASURE, 0, 11, TLM_A, 118, 0 },	// 11A118
+	{  40,  4, PCMOP_MEASURE, 0, 11, TLM_A, 154, 0 },	// 11A154 CMI: SCE NEG SUPPLY VOLTS
+	{  41,  0, PCMOP_MEASURE, 0, 11, TLM_A, 11, 0 },	// 11A11
+	{  41,  1, PCMOP_MEASURE, 0, 11, TLM_A, 47, 0 },	// 11A47 EPS: LM HEATER CURRENT
+	{  41,  2, PCMOP_MEASURE, 0, 11, TLM_A, 83, 0 },	// 11A83
+	{  41,  3, PCMOP_MEASURE, 0, 11, TLM_A, 119, 0 },	// 11A119
+	{  41,  4, PCMOP_MEASURE, 0, 11, TLM_A, 155, 0 },	// 11A155 RCS: CM HE TK A TEMP
+	{  42,  0, PCMOP_MEASURE, 0, 11, TLM_A, 12, 0 },	// 11A12
+	{  42,  1, PCMOP_MEASURE, 0, 11, TLM_A, 48, 0 },	// 11A48 PCM HI LEVEL 85 PCT REF
+	{  42,  2, PCMOP_MEASURE, 0, 11, TLM_A, 84, 0 },	// 11A84
+	{  42,  3, PCMOP_MEASURE, 0, 11, TLM_A, 120, 0 },	// 11A120
+	{  42,  4, PCMOP_MEASURE, 0, 11, TLM_A, 156, 0 },	// 11A156 CM HE TK B TEMP
+	{  43,  0, PCMOP_MEASURE, 0, 11, TLM_A, 13, 0 },	// 11A13
+	{  43,  1, PCMOP_MEASURE, 0, 11, TLM_A, 49, 0 },	// 11A49 PC HI LEVEL 15 PCT REF
+	{  43,  2, PCMOP_MEASURE, 0, 11, TLM_A, 85, 0 },	// 11A85
+	{  43,  3, PCMOP_MEASURE, 0, 11, TLM_A, 121, 0 },	// 11A121
+	{  43,  4, PCMOP_MEASURE, 0, 11, TLM_A, 157, 0 },	// 11A157 SEC GLY PUMP OUT PRESS
+	{  44, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 9, 0 },	// 12A9 CM X-AXIS ACCEL
+	{  45, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 10, 0 },	// 12A10 YAW GIMBL POS 1 OR 2
+	{  46, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 11, 0 },	// 12A11 CM Y-AXIS ACCEL
+	{  47, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 12, 0 },	// 12A12 CM Z-AXIS ACCEL
+	{  48,  0, PCMOP_MEASURE, 0, 11, TLM_A, 14, 0 },	// 11A14 ECS O2 FLOW O2 SUPPLY MANF
+	{  48,  1, PCMOP_MEASURE, 0, 11, TLM_A, 50, 0 },	// 11A50 USB RCVR PHASE ERR
+	{  48,  2, PCMOP_MEASURE, 0, 11, TLM_A, 86, 0 },	// 11A86
+	{  48,  3, PCMOP_MEASURE, 0, 11, TLM_A, 122, 0 },	// 11A122
+	{  48,  4, PCMOP_MEASURE, 0, 11, TLM_A, 158, 0 },	// 11A158
+	{  49, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 1, 0 },	// 22DP1
+	{  50, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 2, 0 },	// 22DP2
+	{  51, PCM_ALL_FRAMES, PCMOP_MEASURE_FRAMEADDR, 0, 10, TLM_A, 1, 3 },	// 10A1 + 3 per frame
+	{  52, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 13, 0 },	// 12A13
+	{  53, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 14, 0 },	// 12A14
+	{  54, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 15, 0 },	// 12A15
+	{  55, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 16, 0 },	// 12A16
+	{  56,  0, PCMOP_MEASURE, 0, 11, TLM_A, 15, 0 },	// 11A15
+	{  56,  1, PCMOP_MEASURE, 0, 11, TLM_A, 51, 0 },	// 11A51
+	{  56,  2, PCMOP_MEASURE, 0, 11, TLM_A, 87, 0 },	// 11A87
+	{  56,  3, PCMOP_MEASURE, 0, 11, TLM_A, 123, 0 },	// 11A123
+	{  56,  4, PCMOP_MEASURE, 0, 11, TLM_A, 159, 0 },	// 11A159
+	{  57,  0, PCMOP_MEASURE, 0, 11, TLM_A, 16, 0 },	// 11A16
+	{  57,  1, PCMOP_MEASURE, 0, 11, TLM_A, 52, 0 },	// 11A52
+	{  57,  2, PCMOP_MEASURE, 0, 11, TLM_A, 88, 0 },	// 11A88
+	{  57,  3, PCMOP_MEASURE, 0, 11, TLM_A, 124, 0 },	// 11A124
+	{  57,  4, PCMOP_MEASURE, 0, 11, TLM_A, 160, 0 },	// 11A160
+	{  58,  0, PCMOP_MEASURE, 0, 11, TLM_A, 17, 0 },	// 11A17
+	{  58,  1, PCMOP_MEASURE, 0, 11, TLM_A, 53, 0 },	// 11A53
+	{  58,  2, PCMOP_MEASURE, 0, 11, TLM_A, 89, 0 },	// 11A89
+	{  58,  3, PCMOP_MEASURE, 0, 11, TLM_A, 125, 0 },	// 11A125
+	{  58,  4, PCMOP_MEASURE, 0, 11, TLM_A, 161, 0 },	// 11A161
+	{  59,  0, PCMOP_MEASURE, 0, 11, TLM_A, 18, 0 },	// 11A18
+	{  59,  1, PCMOP_MEASURE, 0, 11, TLM_A, 54, 0 },	// 11A54
+	{  59,  2, PCMOP_MEASURE, 0, 11, TLM_A, 90, 0 },	// 11A90
+	{  59,  3, PCMOP_MEASURE, 0, 11, TLM_A, 126, 0 },	// 11A126
+	{  59,  4, PCMOP_MEASURE, 0, 11, TLM_A, 162, 0 },	// 11A162
+	{  60, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 4, 0 },	// 51A4
+	{  61, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 5, 0 },	// 51A5
+	{  62, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 6, 0 },	// 51A6
+	{  63, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 7, 0 },	// 51A7
+	{  64,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 2, 0 },	// 11DP2A
+	{  64,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 6, 0 },	// 11DP6
+	{  64,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 13, 0 },	// 11DP13
+	{  64,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 20, 0 },	// 11DP20
+	{  64,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 27, 0 },	// 11DP27
+	{  65,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 2, 0 },	// 11DP2A
+	{  65,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 7, 0 },	// 11DP7
+	{  65,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 14, 0 },	// 11DP14
+	{  65,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 21, 0 },	// 11DP21
+	{  65,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 28, 0 },	// 11DP28
+	{  66,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 2, 0 },	// 11DP2A
+	{  66,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 8, 0 },	// 11DP8
+	{  66,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 15, 0 },	// 11DP15
+	{  66,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 22, 0 },	// 11DP22
+	{  66,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 29, 0 },	// 11DP29
+	{  67,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 2, 0 },	// 11DP2A
+	{  67,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 9, 0 },	// 11DP9
+	{  67,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 16, 0 },	// 11DP16
+	{  67,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 23, 0 },	// 11DP23
+	{  67,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 30, 0 },	// 11DP30
+	{  68, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 1, 0 },	// 22A1 ASTRO 1 EKG AXIS 2
+	{  69, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 2, 0 },	// 22A2 ASTRO 1 EKG AXIS 3
+	{  70, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 3, 0 },	// 22A3 ASTRO 1 EKG AXIS 1
+	{  71, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 4, 0 },	// 22A4 PITCH DIFF CLUTCH CURRENT
+	{  72,  0, PCMOP_MEASURE, 0, 11, TLM_A, 19, 0 },	// 11A19
+	{  72,  1, PCMOP_MEASURE, 0, 11, TLM_A, 55, 0 },	// 11A55
+	{  72,  2, PCMOP_MEASURE, 0, 11, TLM_A, 91, 0 },	// 11A91 EPS: BAT BUS A VOLTS
+	{  72,  3, PCMOP_MEASURE, 0, 11, TLM_A, 127, 0 },	// 11A127
+	{  72,  4, PCMOP_MEASURE, 0, 11, TLM_A, 163, 0 },	// 11A163
+	{  73,  0, PCMOP_MEASURE, 0, 11, TLM_A, 20, 0 },	// 11A20
+	{  73,  1, PCMOP_MEASURE, 0, 11, TLM_A, 56, 0 },	// 11A56 AC BUS 2 PH A VOLTS
+	{  73,  2, PCMOP_MEASURE, 0, 11, TLM_A, 92, 0 },	// 11A92 RCS: SM FU MANF A PRESS
+	{  73,  3, PCMOP_MEASURE, 0, 11, TLM_A, 128, 0 },	// 11A128
+	{  73,  4, PCMOP_MEASURE, 0, 11, TLM_A, 164, 0 },	// 11A164
+	{  74,  0, PCMOP_MEASURE, 0, 11, TLM_A, 21, 0 },	// 11A21
+	{  74,  1, PCMOP_MEASURE, 0, 11, TLM_A, 57, 0 },	// 11A57
+	{  74,  2, PCMOP_MEASURE, 0, 11, TLM_A, 93, 0 },	// 11A93 BAT BUS B VOLTS
+	{  74,  3, PCMOP_MEASURE, 0, 11, TLM_A, 129, 0 },	// 11A129
+	{  74,  4, PCMOP_MEASURE, 0, 11, TLM_A, 165, 0 },	// 11A165
+	{  75,  0, PCMOP_MEASURE, 0, 11, TLM_A, 22, 0 },	// 11A22
+	{  75,  1, PCMOP_MEASURE, 0, 11, TLM_A, 58, 0 },	// 11A58
+	{  75,  2, PCMOP_MEASURE, 0, 11, TLM_A, 94, 0 },	// 11A94 SM FU MANF B PRESS
+	{  75,  3, PCMOP_MEASURE, 0, 11, TLM_A, 130, 0 },	// 11A130
+	{  75,  4, PCMOP_MEASURE, 0, 11, TLM_A, 166, 0 },	// 11A166
+	{  76, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 1, 0 },	// 12A1 MGA SERVO ERR IN PHASE
+	{  77, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 2, 0 },	// 12A2 IGA SERVO ERR IN PHASE
+	{  78, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 3, 0 },	// 12A3 OGA SERVO ERR IN PHASE
+	{  79, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 4, 0 },	// 12A4 ROLL ATT ERR
+	{  80,  0, PCMOP_MEASURE, 0, 11, TLM_A, 23, 0 },	// 11A23
+	{  80,  1, PCMOP_MEASURE, 0, 11, TLM_A, 59, 0 },	// 11A59
+	{  80,  2, PCMOP_MEASURE, 0, 11, TLM_A, 95, 0 },	// 11A95
+	{  80,  3, PCMOP_MEASURE, 0, 11, TLM_A, 131, 0 },	// 11A131
+	{  80,  4, PCMOP_MEASURE, 0, 11, TLM_A, 167, 0 },	// 11A167
+	{  81, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 1, 0 },	// 22DP1
+	{  82, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 2, 0 },	// 22DP2
+	{  83, PCM_ALL_FRAMES, PCMOP_MEASURE_FRAMEADDR, 0, 10, TLM_A, 2, 3 },	// 10A2 + 3 per frame
+	{  84, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 5, 0 },	// 12A5 SCS PITCH BODY RATE
+	{  85, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 6, 0 },	// 12A6 SCS YAW BODY RATE
+	{  86, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 7, 0 },	// 12A7 SCS ROLL BODY RATE
+	{  87, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 8, 0 },	// 12A8 PITCH GIMBL POS 1 OR 2
+	{  88,  0, PCMOP_MEASURE, 0, 11, TLM_A, 24, 0 },	// 11A24
+	{  88,  1, PCMOP_MEASURE, 0, 11, TLM_A, 60, 0 },	// 11A60
+	{  88,  2, PCMOP_MEASURE, 0, 11, TLM_A, 96, 0 },	// 11A96
+	{  88,  3, PCMOP_MEASURE, 0, 11, TLM_A, 132, 0 },	// 11A132
+	{  88,  4, PCMOP_MEASURE, 0, 11, TLM_A, 168, 0 },	// 11A168
+	{  89,  0, PCMOP_MEASURE, 0, 11, TLM_A, 25, 0 },	// 11A25
+	{  89,  1, PCMOP_MEASURE, 0, 11, TLM_A, 61, 0 },	// 11A61
+	{  89,  2, PCMOP_MEASURE, 0, 11, TLM_A, 97, 0 },	// 11A97
+	{  89,  3, PCMOP_MEASURE, 0, 11, TLM_A, 133, 0 },	// 11A133
+	{  89,  4, PCMOP_MEASURE, 0, 11, TLM_A, 169, 0 },	// 11A169
+	{  90,  0, PCMOP_MEASURE, 0, 11, TLM_A, 26, 0 },	// 11A26
+	{  90,  1, PCMOP_MEASURE, 0, 11, TLM_A, 62, 0 },	// 11A62
+	{  90,  2, PCMOP_MEASURE, 0, 11, TLM_A, 98, 0 },	// 11A98
+	{  90,  3, PCMOP_MEASURE, 0, 11, TLM_A, 134, 0 },	// 11A134
+	{  90,  4, PCMOP_MEASURE, 0, 11, TLM_A, 170, 0 },	// 11A170
+	{  91,  0, PCMOP_MEASURE, 0, 11, TLM_A, 27, 0 },	// 11A27
+	{  91,  1, PCMOP_MEASURE, 0, 11, TLM_A, 63, 0 },	// 11A63
+	{  91,  2, PCMOP_MEASURE, 0, 11, TLM_A, 99, 0 },	// 11A99
+	{  91,  3, PCMOP_MEASURE, 0, 11, TLM_A, 135, 0 },	// 11A135
+	{  91,  4, PCMOP_MEASURE, 0, 11, TLM_A, 171, 0 },	// 11A171
+	{  92, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 8, 0 },	// 51A8
+	{  93, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 9, 0 },	// 51A9
+	{  94, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 10, 0 },	// 51A10
+	{  95, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 11, 0 },	// 51A11
+	{  96,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 3, 0 },	// 11DP3
+	{  96,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 10, 0 },	// 11DP10
+	{  96,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 17, 0 },	// 11DP17
+	{  96,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 24, 0 },	// 11DP24
+	{  96,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 31, 0 },	// 11DP31
+	{  97,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 4, 0 },	// 11DP4
+	{  97,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 11, 0 },	// 11DP11
+	{  97,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 18, 0 },	// 11DP18
+	{  97,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 25, 0 },	// 11DP25
+	{  97,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 32, 0 },	// 11DP32
+	{  98,  0, PCMOP_MEASURE, 0, 11, TLM_DP, 5, 0 },	// 11DP5
+	{  98,  1, PCMOP_MEASURE, 0, 11, TLM_DP, 12, 0 },	// 11DP12
+	{  98,  2, PCMOP_MEASURE, 0, 11, TLM_DP, 19, 0 },	// 11DP19
+	{  98,  3, PCMOP_MEASURE, 0, 11, TLM_DP, 26, 0 },	// 11DP26
+	{  98,  4, PCMOP_MEASURE, 0, 11, TLM_DP, 33, 0 },	// 11DP33
+	{  99, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_DP, 2, 0 },	// 51DP2
+	{ 100, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 1, 0 },	// 22A1 ASTRO 1 EKG AXIS 2
+	{ 101, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 2, 0 },	// 22A2 ASTRO 1 EKG AXIS 3
+	{ 102, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 3, 0 },	// 22A3 ASTRO 1 EKG AXIS 1
+	{ 103, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_A, 4, 0 },	// 22A4 PITCH DIFF CLUTCH CURRENT
+	{ 104,  0, PCMOP_MEASURE, 0, 11, TLM_A, 28, 0 },	// 11A28
+	{ 104,  1, PCMOP_MEASURE, 0, 11, TLM_A, 64, 0 },	// 11A64
+	{ 104,  2, PCMOP_MEASURE, 0, 11, TLM_A, 100, 0 },	// 11A100
+	{ 104,  3, PCMOP_MEASURE, 0, 11, TLM_A, 136, 0 },	// 11A136
+	{ 104,  4, PCMOP_MEASURE, 0, 11, TLM_A, 172, 0 },	// 11A172
+	{ 105,  0, PCMOP_MEASURE, 0, 11, TLM_A, 29, 0 },	// 11A29 FC1 N2 PRESS
+	{ 105,  1, PCMOP_MEASURE, 0, 11, TLM_A, 65, 0 },	// 11A65
+	{ 105,  2, PCMOP_MEASURE, 0, 11, TLM_A, 101, 0 },	// 11A101
+	{ 105,  3, PCMOP_MEASURE, 0, 11, TLM_A, 137, 0 },	// 11A137
+	{ 105,  4, PCMOP_MEASURE, 0, 11, TLM_A, 173, 0 },	// 11A173
+	{ 106,  0, PCMOP_MEASURE, 0, 11, TLM_A, 30, 0 },	// 11A30 FC2 N2 PRESS
+	{ 106,  1, PCMOP_MEASURE, 0, 11, TLM_A, 66, 0 },	// 11A66
+	{ 106,  2, PCMOP_MEASURE, 0, 11, TLM_A, 102, 0 },	// 11A102
+	{ 106,  3, PCMOP_MEASURE, 0, 11, TLM_A, 138, 0 },	// 11A138
+	{ 106,  4, PCMOP_MEASURE, 0, 11, TLM_A, 174, 0 },	// 11A174
+	{ 107,  0, PCMOP_MEASURE, 0, 11, TLM_A, 31, 0 },	// 11A31
+	{ 107,  1, PCMOP_MEASURE, 0, 11, TLM_A, 67, 0 },	// 11A67 FC1 O2 PRESS
+	{ 107,  2, PCMOP_MEASURE, 0, 11, TLM_A, 103, 0 },	// 11A103
+	{ 107,  3, PCMOP_MEASURE, 0, 11, TLM_A, 139, 0 },	// 11A139
+	{ 107,  4, PCMOP_MEASURE, 0, 11, TLM_A, 175, 0 },	// 11A175
+	{ 108, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 9, 0 },	// 12A9 CM X-AXIS ACCEL
+	{ 109, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 10, 0 },	// 12A10 YAW GIMBL POS 1 OR 2
+	{ 110, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 11, 0 },	// 12A11 CM Y-AXIS ACCEL
+	{ 111, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 12, 0 },	// 12A12 CM Z-AXIS ACCEL
+	{ 112,  0, PCMOP_MEASURE, 0, 11, TLM_A, 32, 0 },	// 11A32
+	{ 112,  1, PCMOP_MEASURE, 0, 11, TLM_A, 68, 0 },	// 11A68 FC2 O2 PRESS
+	{ 112,  2, PCMOP_MEASURE, 0, 11, TLM_A, 104, 0 },	// 11A104
+	{ 112,  3, PCMOP_MEASURE, 0, 11, TLM_A, 140, 0 },	// 11A140
+	{ 112,  4, PCMOP_MEASURE, 0, 11, TLM_A, 176, 0 },	// 11A176
+	{ 113, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 1, 0 },	// 22DP1
+	{ 114, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 22, TLM_DP, 2, 0 },	// 22DP2
+	{ 115, PCM_ALL_FRAMES, PCMOP_MEASURE_FRAMEADDR, 0, 10, TLM_A, 3, 3 },	// 10A3 + 3 per frame
+	{ 116, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 13, 0 },	// 12A13
+	{ 117, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 14, 0 },	// 12A14
+	{ 118, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 15, 0 },	// 12A15
+	{ 119, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 12, TLM_A, 16, 0 },	// 12A16
+	{ 120,  0, PCMOP_MEASURE, 0, 11, TLM_A, 33, 0 },	// 11A33
+	{ 120,  1, PCMOP_MEASURE, 0, 11, TLM_A, 69, 0 },	// 11A69
+	{ 120,  2, PCMOP_MEASURE, 0, 11, TLM_A, 105, 0 },	// 11A105
+	{ 120,  3, PCMOP_MEASURE, 0, 11, TLM_A, 141, 0 },	// 11A141
+	{ 120,  4, PCMOP_MEASURE, 0, 11, TLM_A, 177, 0 },	// 11A177
+	{ 121,  0, PCMOP_MEASURE, 0, 11, TLM_A, 34, 0 },	// 11A34
+	{ 121,  1, PCMOP_MEASURE, 0, 11, TLM_A, 70, 0 },	// 11A70
+	{ 121,  2, PCMOP_MEASURE, 0, 11, TLM_A, 106, 0 },	// 11A106
+	{ 121,  3, PCMOP_MEASURE, 0, 11, TLM_A, 142, 0 },	// 11A142
+	{ 121,  4, PCMOP_MEASURE, 0, 11, TLM_A, 178, 0 },	// 11A178
+	{ 122,  0, PCMOP_MEASURE, 0, 11, TLM_A, 35, 0 },	// 11A35 FC3 N2 PRESS
+	{ 122,  1, PCMOP_MEASURE, 0, 11, TLM_A, 71, 0 },	// 11A71
+	{ 122,  2, PCMOP_MEASURE, 0, 11, TLM_A, 107, 0 },	// 11A107
+	{ 122,  3, PCMOP_MEASURE, 0, 11, TLM_A, 143, 0 },	// 11A143
+	{ 122,  4, PCMOP_MEASURE, 0, 11, TLM_A, 179, 0 },	// 11A179
+	{ 123,  0, PCMOP_MEASURE, 0, 11, TLM_A, 36, 0 },	// 11A36
+	{ 123,  1, PCMOP_MEASURE, 0, 11, TLM_A, 72, 0 },	// 11A72
+	{ 123,  2, PCMOP_MEASURE, 0, 11, TLM_A, 108, 0 },	// 11A108
+	{ 123,  3, PCMOP_MEASURE, 0, 11, TLM_A, 143, 0 },	// 11A143
+	{ 123,  4, PCMOP_MEASURE, 0, 11, TLM_A, 180, 0 },	// 11A180
+	{ 124, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 12, 0 },	// 51A12
+	{ 125, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 13, 0 },	// 51A13
+	{ 126, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 14, 0 },	// 51A14
+	{ 127, PCM_ALL_FRAMES, PCMOP_MEASURE, 0, 51, TLM_A, 15, 0 },	// 51A15
+};
+
 PCM::PCM(){
 	sat = NULL;
 	conn_state = 0;
@@ -692,53 +1123,14 @@ void PCM::Init(Saturn *vessel){
 	last_rx = 0;
 	word_addr = 0;
 	pcm_rate_override = 0;
-	int iResult = WSAStartup( MAKEWORD(2,2), &wsaData );
-	if ( iResult != NO_ERROR ){
-		sprintf(wsk_emsg,"TELECOM: Error at WSAStartup()");
-		wsk_error = 1;
-		return;
-	}
-	m_socket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
-	if ( m_socket == INVALID_SOCKET ) {
-		sprintf(wsk_emsg,"TELECOM: Error at socket(): %ld", WSAGetLastError());
-		WSACleanup();
-		wsk_error = 1;
-		return;
-	}
-	// Be nonblocking
-	int iMode = 1; // 0 = BLOCKING, 1 = NONBLOCKING
-	if(ioctlsocket(m_socket, FIONBIO, (u_long FAR*) &iMode) != 0){
-		sprintf(wsk_emsg,"TELECOM: ioctlsocket() failed: %ld", WSAGetLastError());
-		wsk_error = 1;
-		closesocket(m_socket);
-		WSACleanup();
-		return;
-	}
-
-	// Set up incoming options
-	service.sin_family = AF_INET;
-	service.sin_addr.s_addr = htonl(INADDR_ANY);
-	service.sin_port = htons( 14242 );
-
-	if ( ::bind( m_socket, (SOCKADDR*) &service, sizeof(service) ) == SOCKET_ERROR ) {
-		sprintf(wsk_emsg,"TELECOM: bind() failed: %ld", WSAGetLastError());
-		wsk_error = 1;
-		closesocket(m_socket);
-		WSACleanup();
-		return;
-	}
-	if ( listen( m_socket, 1 ) == SOCKET_ERROR ){
+	lbrProgram.Build(CSMPCMFormatLBR, sizeof(CSMPCMFormatLBR) / sizeof(PCMMeasurement), 40, 6);
+	hbrProgram.Build(CSMPCMFormatHBR, sizeof(CSMPCMFormatHBR) / sizeof(PCMMeasurement), 128, 5);
+	// Ground stations connect here; the server does the socket I/O on its own thread
+	if(!server.Start(14242)){
+		server.GetError(wsk_emsg, sizeof(wsk_emsg));
 		wsk_error = 1;
-		sprintf(wsk_emsg,"TELECOM: listen() failed: %ld", WSAGetLastError());
-		closesocket(m_socket);
-		WSACleanup();
 		return;
 	}
-	if(!registerSocket(m_socket))
-	{
-		sprintf(wsk_emsg,"TELECOM: Failed to register socket %i for cleanup",m_socket);
-		wsk_error = 1;
-	}
 	conn_state = 1; // INITIALIZED, LISTENING
 	uplink_state = 0; rx_offset = 0;
 }
@@ -804,9 +1196,11 @@ void PCM::TimeStep(double simt){
 			last_update = simt;
 			if(tx_size < 1024){
 				tx_offset = 0;
-				while(tx_offset < tx_size){
-					generate_stream_lbr();
-					tx_offset++;
+				generate_stream_lbr(simt);
+				sat->dataRecorder.RecordData(tx_data, tx_size, false);
+				// Replace the live downlink with the recording, if we play one
+				if(replay.IsOpen()){
+					tx_size = replay.Read(tx_data, tx_size);
 				}
 				perform_io(simt);
 			}
@@ -820,16 +1214,29 @@ void PCM::TimeStep(double simt){
 			last_update = simt;
 			if(tx_size < 1024){
 				tx_offset = 0;
-				while(tx_offset < tx_size){
-					generate_stream_hbr();
-					tx_offset++;
-				}			
+				generate_stream_hbr(simt);
+				sat->dataRecorder.RecordData(tx_data, tx_size, true);
+				// Replace the live downlink with the recording, if we play one
+				if(replay.IsOpen()){
+					tx_size = replay.Read(tx_data, tx_size);
+				}
 				perform_io(simt);
 			}
 		}
 	}
 }
 
+// Record the word just generated. The generators move word_addr on after each word,
+// so it is back to zero when a frame is complete.
+
+void PCM::record_word(double simt, int rate){
+	if(!recorder.IsOpen()){ return; }
+	recorder.AddWord(tx_data[tx_offset]);
+	if(word_addr == 0){
+		recorder.EndFrame(simt, rate);
+	}
+}
+
 // Scale data to 255 steps for transmission in the PCM datastream.
 // This function will be called lots of times inside a timestep, so it should go
 // as fast as possible!
@@ -876,14 +1283,14 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 2:			// UNKNOWN - HBR ONLY
 							return(0);
 						case 3:			// CO2 PARTIAL PRESS
-							sat->GetAtmosStatus(atm);
+							sat->SampleAtmosStatus(atm);
 							return(scale_data(atm.CabinCO2MMHG,0,30));
 						case 4:			// GLY EVAP BACK PRESS
 							return(scale_data(0,0.05,0.25));
 						case 5:			// UNKNOWN - HBR ONLY
 							return(0);
 						case 6:			// CABIN PRESS
-							sat->GetAtmosStatus(atm);
+							sat->SampleAtmosStatus(atm);
 							return(scale_data(atm.CabinPressurePSI,0,17));
 						case 7:			// UNKNOWN - HBR ONLY
 							return(0);
@@ -912,20 +1319,20 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 16:		// HE TK TEMP
 							return(scale_data(0,-100,200));
 						case 17:		// SM ENG PKG B TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 						case 18:		// CM HE TK A PRESS
-							sat->GetRCSStatus( RCS_CM_RING_1, rcsStatus );
+							sat->SampleRCSStatus( RCS_CM_RING_1, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 19:		// SM ENG PKG C TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 
 						case 20:		// SM ENG PKG D TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 						case 21:		// CM HE TK B PRESS
-							sat->GetRCSStatus( RCS_CM_RING_2, rcsStatus );
+							sat->SampleRCSStatus( RCS_CM_RING_2, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 
 						case 22:		// DOCKING PROBE TEMP
@@ -933,7 +1340,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 23:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 24:		// SM HE TK A PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 
 						case 25:		// UNKNOWN - HBR ONLY
@@ -941,7 +1348,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 26:		// OX TK 1 QTY -TOTAL AUX
 							return(scale_data(0,0,50));
 						case 27:		// SM HE TK B PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 
 						case 28:		// OX TK 2 QTY
@@ -950,7 +1357,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							return(scale_data(0,0,50));
 
 						case 30:		// SM HE TK C PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 
 						case 31:		// FU TK 2 QTY
@@ -958,7 +1365,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 32:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 33:		// SM HE TK D PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 
 						case 34:		// UNKNOWN - HBR ONLY
@@ -966,14 +1373,14 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 35:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 36:		// H2 TK 1 PRESS
-							sat->GetTankPressures( smTankPress );
+							sat->SampleTankPressures( smTankPress );
 							return(scale_data(smTankPress.H2Tank1PressurePSI, 0, 350));
 						case 37:		// SPS VLV BODY TEMP
 							return(scale_data(0,0,200));
 						case 38:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 39:		// H2 TK 2 PRESS
-							sat->GetTankPressures( smTankPress );
+							sat->SampleTankPressures( smTankPress );
 							return(scale_data(smTankPress.H2Tank2PressurePSI, 0, 350));
 
 						case 40:		// UNKNOWN - HBR ONLY
@@ -981,14 +1388,14 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 41:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 42:		// O2 TK 2 QTY
-							sat->GetTankQuantities( tankQuantities );
+							sat->SampleTankQuantities( tankQuantities );
 							return(scale_data(tankQuantities.O2Tank2Quantity * 100.0, 0, 100));
 						case 43:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 44:		// OX LINE 1 TEMP
 							return(scale_data(0,0,200));
 						case 45:		// SUIT AIR HX OUT TEMP
-							sat->GetAtmosStatus( atm );
+							sat->SampleAtmosStatus( atm );
 							return(scale_data(atm.SuitTempF, 20, 95));
 						case 46:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -1002,7 +1409,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 50:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 51:		// FC 1 COND EXH TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data( fcStatus.CondenserTempF, 145, 250));
 						case 52:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -1034,14 +1441,14 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 65:		// SIDE HS BOND LOC 1 TEMP
 							return(scale_data(0,-260,600));
 						case 66:		// O2 TK 2 PRESS
-							sat->GetTankPressures( smTankPress );
+							sat->SampleTankPressures( smTankPress );
 							return(scale_data(smTankPress.O2Tank2PressurePSI, 50, 1050));
 						case 67:		// FC 3 RAD IN TEMP
 							return(scale_data(0,-50,300));
 						case 68:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 69:		// FC 3 COND EXH TEMP
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.CondenserTempF, 145, 250));
 
 						case 70:		// SIDE HS BOND LOC 2 TEMP
@@ -1049,21 +1456,21 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 71:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 72:		// FC 1 SKIN TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.TempF, 80, 550));
 						case 73:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 74:		// SIDE HS BOND LOC 3 TEMP
 							return(scale_data(0,-260,600));
 						case 75:		// FC 2 SKIN TEMP
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.TempF, 80, 550));
 						case 76:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 77:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 78:		// FC 3 SKIN TEMP
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.TempF, 80, 550));
 						case 79:		// SIDE HS BOND LOC 4 TEMP
 							return(scale_data(0,-260,600));
@@ -1077,7 +1484,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 83:		// PIPA +120 VDC
 							return(scale_data(0,85,135));
 						case 84:		// CABIN TEMP
-							sat->GetAtmosStatus(atm);
+							sat->SampleAtmosStatus(atm);
 							return(scale_data(atm.CabinTempF, 40, 125));
 						case 85:		// 3.2 KHz 28V SUPPLY
 							return(scale_data(0,0,31.1));
@@ -1170,24 +1577,24 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 125:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 126:		// FC 1 RAD OUT TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempOutF, -50, 300));
 						case 127:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 128:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 129:		// FC 2 RAD OUT TEMP
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempOutF, -50, 300));
 
 						case 130:		// FC 1 RAD IN TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempInF, -50, 300));
 						case 131:		// FC 1 RAD IN TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempInF, -50, 300));
 						case 132:		// FC 3 RAD OUT TEMP
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempOutF, -50, 300));
 						case 133:		// GLY EVAP OUT STEAM TEMP
 							sat->GetPrimECSCoolingStatus(pcs);
@@ -1197,7 +1604,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 135:		// URINE DUMP NOZZLE TEMP
 							return(scale_data(0,0,100));
 						case 136:		// SM ENG PKG A TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 
 						case 137:		// BAY 3 OX TK SURFACE TEMP
@@ -1216,14 +1623,14 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 143:		// OX LINE ENTRY SUMP TK TEMP
 							return(scale_data(0,-100,200));
 						case 144:		// H2 TK 2 QTY
-							sat->GetTankQuantities( tankQuantities );
+							sat->SampleTankQuantities( tankQuantities );
 							return(scale_data(tankQuantities.H2Tank2Quantity * 100.0, 0, 100));
 						case 145:		// FU LINE ENTRY SUMP TK TEMP
 							return(scale_data(0,-100,200));
 						case 146:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 147:		// O2 TK 1 QTY
-							sat->GetTankQuantities( tankQuantities );
+							sat->SampleTankQuantities( tankQuantities );
 							return(scale_data(tankQuantities.O2Tank1Quantity * 100.0, 0, 100));
 						case 148:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -1231,7 +1638,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							return(scale_data(0,0,5));
 
 						case 150:		// O2 TK 1 PRESS
-							sat->GetTankPressures( smTankPress );
+							sat->SampleTankPressures( smTankPress );
 							return(scale_data(smTankPress.O2Tank1PressurePSI, 50, 1050));
 
 						default:
@@ -1242,16 +1649,16 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 				case 11: // S11A
 					switch(ccode){
 						case 1:			// SUIT MANF ABS PRESS
-							sat->GetAtmosStatus(atm);
+							sat->SampleAtmosStatus(atm);
 							return(scale_data(atm.SuitPressurePSI, 0, 17));
 						case 2:			// SUIT COMP DELTA P
-							sat->GetAtmosStatus(atm);
+							sat->SampleAtmosStatus(atm);
 							// Suit compressor pressure difference
 							return(scale_data(atm.SuitPressurePSI - atm.SuitReturnPressurePSI, 0, 1));
 						case 3:			// GLY PUMP OUT PRESS
 							return(scale_data(0,0,60));
 						case 4:			// ECS SURGE TANK PRESS
-							sat->GetTankPressures( smTankPress );
+							sat->SampleTankPressures( smTankPress );
 							return(scale_data(smTankPress.O2SurgeTankPressurePSI, 50, 1050));
 						case 5:			// PYRO BUS B VOLTS
 							sat->GetPyroStatus( pyroStatus );
@@ -1296,20 +1703,20 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 22:		// CM HE MANIF 2 PRESS
 							return(scale_data(0,0,400));
 						case 23:		// SM OX MANF A PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI, 0, 300));
 						case 24:		// SM OX MANF B PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI, 0, 300));
 						case 25:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 26:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 27:		// SM OX MANF C PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI,0,300));
 						case 28:		// SM OX MANF D PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI, 0, 300));
 						case 29:		// FC 1 N2 PRESS
 							return(scale_data(0,0,75));
@@ -1329,7 +1736,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 36:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 37:		// SUIT-CABIN DELTA PRESS
-							sat->GetAtmosStatus( atm );
+							sat->SampleAtmosStatus( atm );
 							return(scale_data((atm.SuitPressureMMHG - atm.CabinPressureMMHG) / 25.4, -5, 5));
 						case 38:		// ALPHA CT RATE CHAN 1
 							return(scale_data(0,0.1,10000));
@@ -1396,23 +1803,23 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 66:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 67:		// FC 1 O2 PRESS
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.O2PressurePSI, 0, 75));
 						case 68:		// FC 2 O2 PRESS
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.O2PressurePSI, 0, 75));
 						case 69:		// FC 3 O2 PRESS
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.O2PressurePSI, 0, 75));
 
 						case 70:		// FC 1 H2 PRESS
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.H2PressurePSI, 0, 75));
 						case 71:		// FC 2 H2 PRESS
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.H2PressurePSI, 0, 75));
 						case 72:		// FC 3 H2 PRESS
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.H2PressurePSI, 0, 75));
 						case 73:		// BAT CHARGER AMPS
 							sat->GetBatteryStatus( batteryStatus );
@@ -1424,34 +1831,34 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							sat->GetBatteryBusStatus(batBusStat);
 							return(scale_data(batBusStat.BatteryRelayBusVoltage,0,45));
 						case 76:		// FC 1 CUR
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.Current, 0, 100));
 						case 77:		// FC 1 H2 FLOW
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.H2FlowLBH, 0, 0.2));
 						case 78:		// FC 2 H2 FLOW
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.H2FlowLBH, 0, 0.2));
 						case 79:		// FC 3 H2 FLOW
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.H2FlowLBH, 0, 0.2));
 
 						case 80:		// FC 1 O2 FLOW
-							sat->GetFuelCellStatus( 1, fcStatus );
+							sat->SampleFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.O2FlowLBH, 0, 1.6));
 						case 81:		// FC 2 O2 FLOW
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.O2FlowLBH, 0, 1.6));
 						case 82:		// FC 3 O2 FLOW
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.O2FlowLBH, 0, 1.6));
 						case 83:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 84:		// FC 2 CUR
-							sat->GetFuelCellStatus( 2, fcStatus );
+							sat->SampleFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.Current, 0, 100));
 						case 85:		// FC 3 CUR
-							sat->GetFuelCellStatus( 3, fcStatus );
+							sat->SampleFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.Current, 0, 100));
 						case 86:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -1606,11 +2013,11 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 154:		// SCE NEG SUPPLY VOLTS
 							return(scale_data(0, -30, 0));
 						case 155:		// CM HE TK A TEMP
-							sat->GetRCSStatus( RCS_CM_RING_1, rcsStatus );
+							sat->SampleRCSStatus( RCS_CM_RING_1, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 300));
 
 						case 156:		// CM HE TK B TEMP
-							sat->GetRCSStatus( RCS_CM_RING_2, rcsStatus );
+							sat->SampleRCSStatus( RCS_CM_RING_2, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 300));
 
 						case 157:		// SEC GLY PUMP OUT PRESS
@@ -1627,16 +2034,16 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 162:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 163:		// SM HE TK A TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 164:		// SM HE TK B TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 165:		// SM HE TK C TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 166:		// SM HE TK D TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							sat->SampleRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 167:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -2029,1802 +2436,193 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 	return (0);
 }
 
-void PCM::generate_stream_lbr(){
-	unsigned char data=0;
-	// 40 words per frame, 5 frames, 1 frame per second
-	switch(word_addr){
-		case 0: // SYNC 1
-			// Trigger telemetry END PULSE
-			sat->agc.GenerateDownrupt();
-			// And continue
-			tx_data[tx_offset] = 05;
-			break;
-		case 1: // SYNC 2
-			tx_data[tx_offset] = 0171;
-			break;
-		case 2: // SYNC 3
-			tx_data[tx_offset] = 0267;
+// Generate one word from the compiled format
+
+unsigned char PCM::generate_word(const PCMMeasurement &m){
+	unsigned char data = 0;
+
+	if(m.flags & PCMFLAG_DOWNRUPT_BEFORE){
+		// Trigger telemetry END PULSE
+		sat->agc.GenerateDownrupt();
+	}
+	switch(m.op){
+		case PCMOP_CONST:
+			data = (unsigned char)m.ccode;
 			break;
-		case 3: // SYNC 4 & FRAME COUNT
-			tx_data[tx_offset] = (0300|frame_count);
+		case PCMOP_FRAMECOUNT:
+			data = (0300|frame_count);
 			break;
-		case 4: 
-			switch(frame_count){
-				case 0: // 11A1 ECS: SUIT MANF ABS PRESS					
-					tx_data[tx_offset] = measure(11,TLM_A,1);
-					break;
-				case 1: // 11A109 EPS: BAT B CURR
-					tx_data[tx_offset] = measure(11,TLM_A,109);
-					break;
-				case 2: // 11A46 RCS: SM HE MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,46);
-					break;
-				case 3: // 11A154 CMI: SCE NEG SUPPLY VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,154);
-					break;
-				case 4: // 11A91 EPS: BAT BUS A VOLTS					
-					tx_data[tx_offset] = measure(11,TLM_A,91);
-					break;
-			}
+		case PCMOP_FRAMEADDR:
+			data = (0300|frame_addr);
 			break;
-		case 5:
-			switch(frame_count){
-				case 0: // 11A2 ECS: SUIT COMP DELTA P
-					tx_data[tx_offset] = measure(11,TLM_A,2);
-					break;
-				case 1: // 11A110 EPS: BAT C CURR
-					tx_data[tx_offset] = measure(11,TLM_A,110);
-					break;
-				case 2: // 11A47 EPS: LM HEATER CURRENT
-					tx_data[tx_offset] = measure(11,TLM_A,47);
-					break;
-				case 3: // 11A155 RCS: CM HE TK A TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,155);
-					break;
-				case 4: // 11A92 RCS: SM FU MANF A PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,92);
-					break;
-			}
+		case PCMOP_MEASURE:
+			data = measure(m.channel, m.type, m.ccode);
 			break;
-		case 6:
-			switch(frame_count){
-				case 0: // 11A3 ECS: GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,3);
-					break;
-				case 1: // 11A111 ECS: SM FU MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,111);
-					break;
-				case 2: // 11A48 PCM HI LEVEL 85 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,48);
-					break;
-				case 3: // 11A156 CM HE TK B TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,156);
-					break;
-				case 4: // 11A93 BAT BUS B VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,93);
-					break;
-			}
+		case PCMOP_MEASURE_FRAMEADDR:
+			data = measure(m.channel, m.type, m.ccode + m.step*frame_addr);
 			break;
-		case 7:
-			switch(frame_count){
-				case 0: // 11A4 ECS SURGE TANK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,4);
-					break;
-				case 1: // 11A112 SM FU MANF D PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,112);
-					break;
-				case 2: // 11A49 PC HI LEVEL 15 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,49);
-					break;
-				case 3: // 11A157 SEC GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,157);
-					break;
-				case 4: // 11A94 SM FU MANF B PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,94);
-					break;
+		case PCMOP_CMC_A:
+			{
+				ChannelValue ch13 = sat->agc.GetOutputChannel(013);
+				data = (sat->agc.GetOutputChannel(034)&077400)>>8;
+				if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
 			}
 			break;
-		case 8: // 51DS1A COMPUTER DIGITAL DATA (40 BITS) 
-		case 28:
-		{
-			unsigned char data;
-			ChannelValue ch13;
-			ch13 = sat->agc.GetOutputChannel(013);
-			data = (sat->agc.GetOutputChannel(034) & 077400) >> 8;
-			if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
-			/*
-			sprintf(oapiDebugString(),"CMC DATA: %o (%lo %lo)",data,sat->agc.GetOutputChannel(034),
-				sat->agc.GetOutputChannel(035));
-				*/
-			tx_data[tx_offset] = data;
-			break;
-		}
-		case 9: // 51DS1B COMPUTER DIGITAL DATA (40 BITS)
-		case 29:
+		case PCMOP_CMC_B:
 			data = (sat->agc.GetOutputChannel(034)&0377);
-			tx_data[tx_offset] = data; 
 			break;
-		case 10: // 51DS1C COMPUTER DIGITAL DATA (40 BITS) 
-		case 30:
-			// PARITY OF CH 34 GOES IN TOP BIT HERE!
+		case PCMOP_CMC_C:
 			data = (sat->agc.GetOutputChannel(035)&077400)>>8;
-			tx_data[tx_offset] = data; 
 			break;
-		case 11: // 51DS1D COMPUTER DIGITAL DATA (40 BITS) 
-		case 31:
+		case PCMOP_CMC_D:
 			data = (sat->agc.GetOutputChannel(035)&0377);
-			tx_data[tx_offset] = data; 
 			break;
-		case 12: // 51DS1E COMPUTER DIGITAL DATA (40 BITS) 
-		case 32:
-			// PARITY OF CH 35 GOES IN TOP BIT HERE!
+		case PCMOP_CMC_E:
 			data = (sat->agc.GetOutputChannel(034)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			break;
-		case 13: // 51DP2 UP-DATA-LINK VALIDITY BITS (4 BITS)
-		case 33:
-			tx_data[tx_offset] = 0; 
-			break;
-		case 14:
-			switch(frame_count){
-				case 0: // 10A123 FC 2 COND EXH TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,123);
-					break;
-				case 1: // 10A126 FC 1 RAD OUT TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,126);
-					break;
-				case 2: // 10A129 FC 2 RAD OUT TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,129);
-					break;
-				case 3: // 10A132 FC 3 RAD OUT TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,132);
-					break;
-				case 4: // 10A135 URINE DUMP NOZZLE TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,135);
-					break;
-			}
-			break;
-		case 15:
-			switch(frame_count){
-				case 0: // 10A138 TM BIAS 2.5 VDC
-					tx_data[tx_offset] = measure(10,TLM_A,138);
-					break;
-				case 1: // 10A141 EPS: H2 TK 1 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,141);
-					break;
-				case 2: // 10A144 H2 TK 2 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,144);
-					break;
-				case 3: // 10A147 O2 TK 1 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,147);
-					break;
-				case 4: // 10A150 O2 TK 1 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,150);
-					break;
-			}
-			break;
-		case 16:
-			switch(frame_count){
-				case 0: // 10A3
-					tx_data[tx_offset] = measure(10,TLM_A,3);
-					break;
-				case 1: // 10A6
-					tx_data[tx_offset] = measure(10,TLM_A,6);
-					break;
-				case 2: // 10A9
-					tx_data[tx_offset] = measure(10,TLM_A,9);
-					break;
-				case 3: // 10A12
-					tx_data[tx_offset] = measure(10,TLM_A,12);
-					break;
-				case 4: // 10A15
-					tx_data[tx_offset] = measure(10,TLM_A,15);
-					break;
-			}
-			break;
-		case 17:
-			switch(frame_count){
-				case 0: // 10A18
-					tx_data[tx_offset] = measure(10,TLM_A,18);
-					break;
-				case 1: // 10A21
-					tx_data[tx_offset] = measure(10,TLM_A,21);
-					break;
-				case 2: // 10A24
-					tx_data[tx_offset] = measure(10,TLM_A,24);
-					break;
-				case 3: // 10A27
-					tx_data[tx_offset] = measure(10,TLM_A,27);
-					break;
-				case 4: // 10A30
-					tx_data[tx_offset] = measure(10,TLM_A,30);
-					break;
-			}
-			break;
-		case 18:
-			switch(frame_count){
-				case 0: // 10A33 
-					tx_data[tx_offset] = measure(10,TLM_A,33);
-					break;
-				case 1: // 10A36 H2 TK 1 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,36);
-					break;
-				case 2: // 10A39 H2 TK 2 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,39);
-					break;
-				case 3: // 10A42 O2 TK 2 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,42);
-					break;
-				case 4: // 10A45
-					tx_data[tx_offset] = measure(10,TLM_A,45);
-					break;
-			}
-			break;
-		case 19:
-			switch(frame_count){
-				case 0: // 10A48 
-					tx_data[tx_offset] = measure(10,TLM_A,48);
-					break;
-				case 1: // 10A51
-					tx_data[tx_offset] = measure(10,TLM_A,51);
-					break;
-				case 2: // 10A54 O2 TK 1 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,54);
-					break;
-				case 3: // 10A57 O2 TK 2 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,57);
-					break;
-				case 4: // 10A60 H2 TK 1 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,60);
-					break;
-			}
-			break;
-		case 20:
-			// Trigger telemetry END PULSE
-			sat->agc.GenerateDownrupt();
-			// and continue
-			switch(frame_count){
-				case 0: // 10DP1 
-					tx_data[tx_offset] = measure(10,TLM_DP,1);
-					break;
-				case 1: // 11DP6
-					tx_data[tx_offset] = measure(11,TLM_DP,6); 
-					break;
-				case 2: // 11DP27
-					tx_data[tx_offset] = measure(11,TLM_DP,27); 
-					break;
-				case 3: // 11DP15
-					tx_data[tx_offset] = measure(11,TLM_DP,17); 
-					break;
-				case 4: // 11DP20
-					tx_data[tx_offset] = measure(11,TLM_DP,20); 
-					break;
-			}
-			break;
-		case 21:
-			switch(frame_count){
-				case 0: // SRC 0
-					tx_data[tx_offset] = measure(0,TLM_SRC,0); 
-					break;
-				case 1: // 11DP7
-					tx_data[tx_offset] = measure(11,TLM_DP,7); 
-					break;
-				case 2: // 11DP28
-					tx_data[tx_offset] = measure(11,TLM_DP,28); 
-					break;
-				case 3: // 11DP16
-					tx_data[tx_offset] = measure(11,TLM_DP,16); 
-					break;
-				case 4: // 11DP21
-					tx_data[tx_offset] = measure(11,TLM_DP,21); 
-					break;
-			}
-			break;
-		case 22:
-			switch(frame_count){
-				case 0: // 11A39
-					tx_data[tx_offset] = measure(11,TLM_A,39); 
-					break;
-				case 1: // 11A147 AC BUS 1 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,147); 
-					break;
-				case 2: // 11A84
-					tx_data[tx_offset] = measure(11,TLM_A,84); 
-					break;
-				case 3: // 11A21
-					tx_data[tx_offset] = measure(11,TLM_A,21); 
-					break;
-				case 4: // 11A129
-					tx_data[tx_offset] = measure(11,TLM_A,129); 
-					break;
-			}
-			break;
-		case 23:
-			switch(frame_count){
-				case 0: // 11A40
-					tx_data[tx_offset] = measure(11,TLM_A,40); 
-					break;
-				case 1: // 11A48
-					tx_data[tx_offset] = measure(11,TLM_A,48); 
-					break;
-				case 2: // 11A85
-					tx_data[tx_offset] = measure(11,TLM_A,85); 
-					break;
-				case 3: // 11A22
-					tx_data[tx_offset] = measure(11,TLM_A,22); 
-					break;
-				case 4: // 11A130
-					tx_data[tx_offset] = measure(11,TLM_A,130); 
-					break;
-			}
-			break;
-		case 24:
-			switch(frame_count){
-				case 0: // 11A73 BAT CHRGR AMPS
-					tx_data[tx_offset] = measure(11,TLM_A,73); 
-					break;
-				case 1: // 11A10
-					tx_data[tx_offset] = measure(11,TLM_A,10); 
-					break;
-				case 2: // 11A118
-					tx_data[tx_offset] = measure(11,TLM_A,118); 
-					break;
-				case 3: // 11A55
-					tx_data[tx_offset] = measure(11,TLM_A,55); 
-					break;
-				case 4: // 11A163
-					tx_data[tx_offset] = measure(11,TLM_A,163); 
-					break;
-			}
-			break;
-		case 25:
-			switch(frame_count){
-				case 0: // 11A74 BAT A CUR
-					tx_data[tx_offset] = measure(11,TLM_A,74); 
-					break;
-				case 1: // 11A11
-					tx_data[tx_offset] = measure(11,TLM_A,11); 
-					break;
-				case 2: // 11A119
-					tx_data[tx_offset] = measure(11,TLM_A,119); 
-					break;
-				case 3: // 11A56 AC BUS 2 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,56); 
-					break;
-				case 4: // 11A164
-					tx_data[tx_offset] = measure(11,TLM_A,164); 
-					break;
-			}
-			break;
-		case 26:
-			switch(frame_count){
-				case 0: // 11A75
-					tx_data[tx_offset] = measure(11,TLM_A,75); 
-					break;
-				case 1: // 11A12
-					tx_data[tx_offset] = measure(11,TLM_A,12); 
-					break;
-				case 2: // 11A120
-					tx_data[tx_offset] = measure(11,TLM_A,120); 
-					break;
-				case 3: // 11A57
-					tx_data[tx_offset] = measure(11,TLM_A,57); 
-					break;
-				case 4: // 11A165
-					tx_data[tx_offset] = measure(11,TLM_A,165); 
-					break;
-			}
-			break;
-		case 27:
-			switch(frame_count){
-				case 0: // 11A76
-					tx_data[tx_offset] = measure(11,TLM_A,76); 
-					break;
-				case 1: // 11A13
-					tx_data[tx_offset] = measure(11,TLM_A,13); 
-					break;
-				case 2: // 11A121
-					tx_data[tx_offset] = measure(11,TLM_A,121); 
-					break;
-				case 3: // 11A58
-					tx_data[tx_offset] = measure(11,TLM_A,58); 
-					break;
-				case 4: // 11A166
-					tx_data[tx_offset] = measure(11,TLM_A,166); 
-					break;
-			}
-			break;
-		case 34:
-			switch(frame_count){
-				case 0: // 11DP3
-					tx_data[tx_offset] = measure(11,TLM_DP,3); 
-					break;
-				case 1: // 11DP8
-					tx_data[tx_offset] = measure(11,TLM_DP,8); 
-					break;
-				case 2: // 11DP13
-					tx_data[tx_offset] = measure(11,TLM_DP,13); 
-					break;
-				case 3: // 11DP29
-					tx_data[tx_offset] = measure(11,TLM_DP,29); 
-					break;
-				case 4: // 11DP22
-					tx_data[tx_offset] = measure(11,TLM_DP,22); 
-					break;
-			}
-			break;
-		case 35:
-			switch(frame_count){
-				case 0: // SRC 1
-					tx_data[tx_offset] = measure(0,TLM_SRC,1); 
-					break;
-				case 1: // 11DP9
-					tx_data[tx_offset] = measure(11,TLM_DP,9); 
-					break;
-				case 2: // 11DP14
-					tx_data[tx_offset] = measure(11,TLM_DP,14); 
-					break;
-				case 3: // 11DP17
-					tx_data[tx_offset] = measure(11,TLM_DP,17); 
-					break;
-				case 4: // 11DP23
-					tx_data[tx_offset] = measure(11,TLM_DP,23); 
-					break;
-			}
-			break;
-		case 36:
-			switch(frame_count){
-				case 0: // 10A63 H2 TK 2 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,63); 
-					break;
-				case 1: // 10A66 O2 TK 2 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,66); 
-					break;
-				case 2: // 10A69
-					tx_data[tx_offset] = measure(10,TLM_A,69); 
-					break;
-				case 3: // 10A72
-					tx_data[tx_offset] = measure(10,TLM_A,72); 
-					break;
-				case 4: // 10A75
-					tx_data[tx_offset] = measure(10,TLM_A,75); 
-					break;
-			}
-			break;
-		case 37:
-			switch(frame_count){
-				case 0: // 10A78
-					tx_data[tx_offset] = measure(10,TLM_A,78); 
-					break;
-				case 1: // 10A81
-					tx_data[tx_offset] = measure(10,TLM_A,81); 
-					break;
-				case 2: // 10A84
-					tx_data[tx_offset] = measure(10,TLM_A,84); 
-					break;
-				case 3: // 10A87
-					tx_data[tx_offset] = measure(10,TLM_A,87); 
-					break;
-				case 4: // 10A90
-					tx_data[tx_offset] = measure(10,TLM_A,90); 
-					break;
-			}
-			break;
-		case 38:
-			switch(frame_count){
-				case 0: // 10A93
-					tx_data[tx_offset] = measure(10,TLM_A,93); 
-					break;
-				case 1: // 10A96
-					tx_data[tx_offset] = measure(10,TLM_A,96); 
-					break;
-				case 2: // 10A99
-					tx_data[tx_offset] = measure(10,TLM_A,99); 
-					break;
-				case 3: // 10A102
-					tx_data[tx_offset] = measure(10,TLM_A,102); 
-					break;
-				case 4: // 10A105
-					tx_data[tx_offset] = measure(10,TLM_A,105); 
-					break;
-			}
-			break;
-		case 39:
-			switch(frame_count){
-				case 0: // 10A108
-					tx_data[tx_offset] = measure(10,TLM_A,108); 
-					break;
-				case 1: // 10A111
-					tx_data[tx_offset] = measure(10,TLM_A,11);  
-					break;
-				case 2: // 10A114
-					tx_data[tx_offset] = measure(10,TLM_A,114); 
-					break;
-				case 3: // 10A117
-					tx_data[tx_offset] = measure(10,TLM_A,117); 
-					break;
-				case 4: // 10A120
-					tx_data[tx_offset] = measure(10,TLM_A,120); 
-					break;
-			}
-			break;
-		// JUST IN CASE
-		default:
-			tx_data[tx_offset] = 0;
 			break;
 	}
-	word_addr++;
-	if(word_addr > 39){
-		word_addr = 0;
-		frame_addr++;
-		if(frame_addr > 4){
-			frame_addr = 0;
-		}
-		frame_count++;
-		if(frame_count > 5){
-			frame_count = 0;
+	if(m.flags & PCMFLAG_DOWNRUPT_AFTER){
+		sat->agc.GenerateDownrupt();
+	}
+	return data;
+}
+
+// Generate tx_size words of the LBR datastream
+
+void PCM::generate_stream_lbr(double simt){
+	// 40 words per frame, 5 frames, 1 frame per second
+	const PCMMeasurement *frame = lbrProgram.Frame(frame_count);
+	while(tx_offset < tx_size){
+		tx_data[tx_offset] = generate_word(frame[word_addr]);
+		word_addr++;
+		if(word_addr > 39){
+			word_addr = 0;
+			frame_addr++;
+			if(frame_addr > 4){
+				frame_addr = 0;
+			}
+			frame_count++;
+			if(frame_count > 5){
+				frame_count = 0;
+			}
+			frame = lbrProgram.Frame(frame_count);
 		}
+		record_word(simt, PCMREC_LBR);
+		tx_offset++;
 	}
 }
 
-void PCM::generate_stream_hbr(){
-	unsigned char data=0;
+// Same for HBR
+
+void PCM::generate_stream_hbr(double simt){
 	// 128 words per frame, 50 frames pre second
-	switch(word_addr){
-		case 0: // SYNC 1
-			tx_data[tx_offset] = 05;
-			break;
-		case 1: // SYNC 2
-			tx_data[tx_offset] = 0171;
-			break;
-		case 2: // SYNC 3
-			tx_data[tx_offset] = 0267;
+	const PCMMeasurement *frame = hbrProgram.Frame(frame_count);
+	while(tx_offset < tx_size){
+		tx_data[tx_offset] = generate_word(frame[word_addr]);
+		word_addr++;
+		if(word_addr > 127){
+			word_addr = 0;
+			frame_addr++;
+			if(frame_addr > 49){
+				frame_addr = 0;
+			}
+			frame_count++;
+			if(frame_count > 4){
+				frame_count = 0;
+			}
+			frame = hbrProgram.Frame(frame_count);
+		}
+		record_word(simt, PCMREC_HBR);
+		tx_offset++;
+	}
+}
+
+void PCM::perform_io(double simt){
+	if(conn_state == 0){ return; } // UNINITIALIZED
+	// Hand the downlink to the server; it goes out to every connected ground station
+	server.Send(tx_data, tx_size);
+	int clients = server.Clients();
+	if(clients > 0 && conn_state != 2){
+		wsk_error = 0; // Connected, for now
+	}
+	if(clients == 0 && conn_state == 2){
+		uplink_state = 0; rx_offset = 0; // Lost the ground, drop any partial command
+	}
+	conn_state = (clients > 0) ? 2 : 1; // CONNECTED or LISTENING
+	if(server.GetError(wsk_emsg, sizeof(wsk_emsg))){
+		wsk_error = 1;
+	}
+	// Should we recieve?
+	if(sat->agc.IsUpruptActive()){
+		return; // No
+	}
+	// Take the ground uplink in one go, as far as the computer keeps up with it
+	unsigned char byte;
+	bool uplinked = false;
+	while(!sat->agc.IsUpruptActive() && server.Receive(&byte, 1) > 0){
+		uplinked = true;
+		last_rx = simt;
+		// If the telemetry data-path is disconnected, discard the data
+		if(sat->UPTLMSwitch1.GetState() == TOGGLESWITCH_DOWN){
+			continue;
+		}
+		rx_data[rx_offset] = byte;
+		handle_uplink();
+	}
+	if(uplinked){
+		return;
+	}
+	// Do we have data from MCC instead?
+	if(mcc_size > 0){
+		// (Using 0.005 went too fast when nobody is connected?)
+		double interval = (conn_state == 2) ? 0.005 : 0.05;
+		if((fabs(simt - last_rx) / interval) < 1){
+			return;
+		}
+		last_rx = simt;
+		// Yes. Take a byte
+		rx_data[rx_offset] = mcc_data[mcc_offset];
+		mcc_offset++;
+		// If uplink isn't blocked
+		if(sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN){
+			// Handle it
+			handle_uplink();
+		}
+		// Are we done?
+		if(mcc_offset >= mcc_size){
+			// We reached the end of the MCC buffer.
+			mcc_offset = mcc_size = 0;
+		}
+	}
+}
+
+// Handle data moved to buffer from either the socket or mcc buffer
+void PCM::handle_uplink() {
+	switch (uplink_state) {
+	case 0: // NEW COMMAND START
+		int va, sa;
+		va = ((rx_data[rx_offset] & 070) >> 3);
+		sa = rx_data[rx_offset] & 07;
+		// *** VEHICLE ADDRESS HARDCODED HERE *** (NASA DID THIS TOO)
+		if (va != 04) { break; }
+		switch (sa) {
+		case 0: // TEST
+			rx_offset++; uplink_state = 10;
 			break;
-		case 3: // SYNC 4 & FRAME COUNT
-			tx_data[tx_offset] = (0300|frame_addr);
+		case 3: // CMC-UPDATA
+			rx_offset++; uplink_state = 20;
 			break;
-		case 4: // 22A1 ASTRO 1 EKG AXIS 2
-		case 36:
-		case 68:
-		case 100:
-			tx_data[tx_offset] = measure(22,TLM_A,1);
+		case 4: // CTE-UPDATE
+			rx_offset++; uplink_state = 30;
 			break;
-		case 5: // 22A2 ASTRO 1 EKG AXIS 3
-		case 37:
-		case 69:
-		case 101:
-			tx_data[tx_offset] = measure(22,TLM_A,2);
+		case 5: // RTC-SALVO
+			rx_offset++; uplink_state = 40;
 			break;
-		case 6: // 22A3 ASTRO 1 EKG AXIS 1
-		case 38:
-		case 70:
-		case 102:
-			tx_data[tx_offset] = measure(22,TLM_A,3);
+		case 6: // RTC-COMMAND
+			rx_offset++; uplink_state = 50;
 			break;
-		case 7: // 22A4 PITCH DIFF CLUTCH CURRENT
-		case 39:
-		case 71:
-		case 103:
-			tx_data[tx_offset] = measure(22,TLM_A,4);
-			break;
-		case 8:
-			switch(frame_count){
-				case 0: // 11A1 SUIT MANF ABS PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,1); 
-					break;
-				case 1: // 11A37 SUIT-CABIN DELTA PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,37); 
-					break;
-				case 2: // 11A73 BAT CHARGER AMPS
-					tx_data[tx_offset] = measure(11,TLM_A,73); 
-					break;
-				case 3: // 11A109 BAT B CUR
-					tx_data[tx_offset] = measure(11,TLM_A,109); 
-					break;
-				case 4: // 11A145
-					tx_data[tx_offset] = measure(11,TLM_A,145); 
-					break;
-			}
-			break;
-		case 9: 
-			switch(frame_count){
-				case 0: // 11A2 SUIT COMP DELTA P
-					tx_data[tx_offset] = measure(11,TLM_A,2); 
-					break;
-				case 1: // 11A38 ALPHA CT RATE CHAN 1
-					tx_data[tx_offset] = measure(11,TLM_A,38); 
-					break;
-				case 2: // 11A74 BAT A CUR
-					tx_data[tx_offset] = measure(11,TLM_A,74); 
-					break;
-				case 3: // 11A110 BAT C CUR
-					tx_data[tx_offset] = measure(11,TLM_A,110); 
-					break;
-				case 4: // 11A146
-					tx_data[tx_offset] = measure(11,TLM_A,146); 
-					break;
-			}
-			break;
-		case 10:
-			switch(frame_count){
-				case 0: // 11A3 GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,3); 
-					break;
-				case 1: // 11A39 SM HE MANF A PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,39); 
-					break;
-				case 2: // 11A75 BAT RELAY BUS VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,75); 
-					break;
-				case 3: // 11A111 SM FU MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,111); 
-					break;
-				case 4: // 11A147 AC BUS 1 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,147); 
-					break;
-			}
-			break;
-		case 11:
-			switch(frame_count){
-				case 0: // 11A4 ECS SURGE TANK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,4); 
-					break;
-				case 1: // 11A40 SM HE MANF B PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,40); 
-					break;
-				case 2: // 11A76 FC 1 CUR
-					tx_data[tx_offset] = measure(11,TLM_A,76); 
-					break;
-				case 3: // 11A112 SM FU MANF D PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,112); 
-					break;
-				case 4: // 11A148 SCE POS SUPPLY VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,148); 
-					break;
-			}
-			break;
-		case 12: // 12A1 MGA SERVO ERR IN PHASE
-		case 76:
-			tx_data[tx_offset] = measure(12,TLM_A,1); 
-			break;
-		case 13: // 12A2 IGA SERVO ERR IN PHASE
-		case 77:
-			tx_data[tx_offset] = measure(12,TLM_A,2); 
-			break;
-		case 14: // 12A3 OGA SERVO ERR IN PHASE
-		case 78:
-			tx_data[tx_offset] = measure(12,TLM_A,3); 
-			break;
-		case 15: // 12A4 ROLL ATT ERR
-		case 79:
-			tx_data[tx_offset] = measure(12,TLM_A,4); 
-			break;
-		case 16:
-			switch(frame_count){
-				case 0: // 11A5 PYRO BUS B VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,5); 
-					break;
-				case 1: // 11A41 ALPHA CT RATE CHAN 2
-					tx_data[tx_offset] = measure(11,TLM_A,41); 
-					break;
-				case 2: // 11A77 FC 1 H2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,77); 
-					break;
-				case 3: // 11A113
-					tx_data[tx_offset] = measure(11,TLM_A,113); 
-					break;
-				case 4: // 11A149
-					tx_data[tx_offset] = measure(11,TLM_A,149); 
-					break;
-			}
-			break;
-		case 17: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 18: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 19: 
-			switch(frame_count){
-				case 0: // 10DP1
-					tx_data[tx_offset] = measure(10,TLM_DP,1); 
-					break;
-				case 1: // SRC-0
-					tx_data[tx_offset] = measure(0,TLM_SRC,0); 
-					break;
-				case 2: // SRC-1
-					tx_data[tx_offset] = measure(0,TLM_SRC,1); 
-					break;
-				case 3: // (Zeroes?)
-					tx_data[tx_offset] = 0;
-					break;
-				case 4: // (Zeroes?)
-					tx_data[tx_offset] = 0;
-					break;
-			}
-			break;
-		case 20: // 12A5 SCS PITCH BODY RATE
-		case 84:
-			tx_data[tx_offset] = measure(12,TLM_A,5); 
-			break;
-		case 21: // 12A6 SCS YAW BODY RATE
-		case 85:
-			tx_data[tx_offset] = measure(12,TLM_A,6); 
-			break;
-		case 22: // 12A7 SCS ROLL BODY RATE
-		case 86:
-			tx_data[tx_offset] = measure(12,TLM_A,7); 
-			break;
-		case 23: // 12A8 PITCH GIMBL POS 1 OR 2
-		case 87:
-			tx_data[tx_offset] = measure(12,TLM_A,8); 
-			break;
-		case 24:
-			switch(frame_count){
-				case 0: // 11A6 LES LOGIC BUS B VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,6); 
-					break;
-				case 1: // 11A42 ALPHA CT RATE CHAN 3
-					tx_data[tx_offset] = measure(11,TLM_A,42); 
-					break;
-				case 2: // 11A78 FC 2 H2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,78); 
-					break;
-				case 3: // 11A114
-					tx_data[tx_offset] = measure(11,TLM_A,114); 
-					break;
-				case 4: // 11A150
-					tx_data[tx_offset] = measure(11,TLM_A,150); 
-					break;
-			}
-			break;
-		case 25:
-			switch(frame_count){
-				case 0: // 11A7
-					tx_data[tx_offset] = measure(11,TLM_A,7); 
-					break;
-				case 1: // 11A43 PROTON INTEG CT RATE
-					tx_data[tx_offset] = measure(11,TLM_A,43); 
-					break;
-				case 2: // 11A79 FC 3 H2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,79); 
-					break;
-				case 3: // 11A115
-					tx_data[tx_offset] = measure(11,TLM_A,115); 
-					break;
-				case 4: // 11A151
-					tx_data[tx_offset] = measure(11,TLM_A,151); 
-					break;
-			}
-			break;
-		case 26:
-			switch(frame_count){
-				case 0: // 11A8 LES LOGIC BUS A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,8); 
-					break;
-				case 1: // 11A44
-					tx_data[tx_offset] = measure(11,TLM_A,44);  
-					break;
-				case 2: // 11A80 FC 1 O2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,80); 
-					break;
-				case 3: // 11A116
-					tx_data[tx_offset] = measure(11,TLM_A,116); 
-					break;
-				case 4: // 11A152 FUEL SM/ENG INTERFACE P
-					tx_data[tx_offset] = measure(11,TLM_A,152); 
-					break;
-			}
-			break;
-		case 27:
-			switch(frame_count){
-				case 0: // 11A9 PYRO BUS A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,9); 
-					break;
-				case 1: // 11A45
-					tx_data[tx_offset] = measure(11,TLM_A,45); 
-					break;
-				case 2: // 11A81 FC 2 O2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,81); 
-					break;
-				case 3: // 11A117
-					tx_data[tx_offset] = measure(11,TLM_A,117); 
-					break;
-				case 4: // 11A153
-					tx_data[tx_offset] = measure(11,TLM_A,153); 
-					break;
-			}
-			break;
-		case 28: // 51A1
-			tx_data[tx_offset] = measure(51,TLM_A,1); 
-			break;
-		case 29: // 51A2
-			tx_data[tx_offset] = measure(51,TLM_A,2); 
-			break;
-		case 30: // 51A3
-			tx_data[tx_offset] = measure(51,TLM_A,3); 
-			break;
-		case 31: // 51DS1A COMPUTER DIGITAL DATA (40 BITS)
-			// The very first pass through this loop will get garbage data because there was no downrupt.
-			// Generating a downrupt at 0 doesn't give the CMC enough time to get data on the busses.
-		{
-			ChannelValue ch13;
-			ch13 = sat->agc.GetOutputChannel(013);
-			data = (sat->agc.GetOutputChannel(034) & 077400) >> 8;
-			if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
-			/*
-			sprintf(oapiDebugString(),"CMC DATA: %o (%lo %lo)",data,sat->agc.GetOutputChannel(034),
-				sat->agc.GetOutputChannel(035));
-			*/
-			tx_data[tx_offset] = data;
-			break;
-		}
-		case 32: // 51DS1B COMPUTER DIGITAL DATA (40 BITS)
-			data = (sat->agc.GetOutputChannel(034)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-		case 33: // 51DS1C COMPUTER DIGITAL DATA (40 BITS)
-			// PARITY OF CH 34 GOES IN TOP BIT HERE!
-			data = (sat->agc.GetOutputChannel(035)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			break;
-		case 34: // 51DS1C COMPUTER DIGITAL DATA (40 BITS)
-			data = (sat->agc.GetOutputChannel(035)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-		case 35: // 51DS1E COMPUTER DIGITAL DATA (40 BITS)
-			// PARITY OF CH 35 GOES IN TOP BIT HERE!
-			data = (sat->agc.GetOutputChannel(034)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			// Trigger telemetry END PULSE
-			sat->agc.GenerateDownrupt();			
-			break;
-		case 40:
-			switch(frame_count){
-				case 0: // 11A10 HE TK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,10); 
-					break;
-				case 1: // 11A46 SM HE MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,46); 
-					break;
-				case 2: // 11A82 FC 3 O2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,82); 
-					break;
-				case 3: // 11A118 SEC EVAP OUT LIQ TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,118); 
-					break;
-				case 4: // 11A154 SCE NEG SUPPLY VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,154); 
-					break;
-			}
-			break;
-		case 41:
-			switch(frame_count){
-				case 0: // 11A11 OX TK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,11); 
-					break;
-				case 1: // 11A47 LM HEATER CURRENT
-					tx_data[tx_offset] = measure(11,TLM_A,47); 
-					break;
-				case 2: // 11A83
-					tx_data[tx_offset] = measure(11,TLM_A,83); 
-					break;
-				case 3: // 11A119 SENSOR EXCITATION 5V
-					tx_data[tx_offset] = measure(11,TLM_A,119); 
-					break;
-				case 4: // 11A155 CM HE TK A TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,155); 
-					break;
-			}
-			break;
-		case 42:
-			switch(frame_count){
-				case 0: // 11A12 SPS FU TK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,12); 
-					break;
-				case 1: // 11A48 PCM HI LEVEL 85 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,48); 
-					break;
-				case 2: // 11A84 FC 2 CUR
-					tx_data[tx_offset] = measure(11,TLM_A,84); 
-					break;
-				case 3: // 11A120 SENSOR EXCITATION 10V
-					tx_data[tx_offset] = measure(11,TLM_A,120); 
-					break;
-				case 4: // 11A156 CM HE TK B TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,156); 
-					break;
-			}
-			break;
-		case 43:
-			switch(frame_count){
-				case 0: // 11A13 GLY ACCUM QTY
-					tx_data[tx_offset] = measure(11,TLM_A,13); 
-					break;
-				case 1: // 11A49 PCM LO LEVEL 15 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,49); 
-					break;
-				case 2: // 11A85 FC 3 CUR
-					tx_data[tx_offset] = measure(11,TLM_A,85); 
-					break;
-				case 3: // 11A121 USB RCVR AGC VOLTAGE
-					tx_data[tx_offset] = measure(11,TLM_A,121); 
-					break;
-				case 4: // 11A157 SEC GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,157); 
-					break;
-			}
-			break;
-		case 44: // 12A9 CM X-AXIS ACCEL
-		case 108:
-			tx_data[tx_offset] = measure(12,TLM_A,9); 
-			break;
-		case 45: // 12A10 YAW GIMBL POS 1 OR 2
-		case 109:
-			tx_data[tx_offset] = measure(12,TLM_A,10); 
-			break;
-		case 46: // 12A11 CM Y-AXIS ACCEL
-		case 110:
-			tx_data[tx_offset] = measure(12,TLM_A,11); 
-			break;
-		case 47: // 12A12 CM Z-AXIS ACCEL
-		case 111:
-			tx_data[tx_offset] = measure(12,TLM_A,12); 
-			break;
-		case 48:
-			switch(frame_count){
-				case 0: // 11A14 ECS O2 FLOW O2 SUPPLY MANF
-					tx_data[tx_offset] = measure(11,TLM_A,14);  
-					break;
-				case 1: // 11A50 USB RCVR PHASE ERR
-					tx_data[tx_offset] = measure(11,TLM_A,50); 
-					break;
-				case 2: // 11A86
-					tx_data[tx_offset] = measure(11,TLM_A,86); 
-					break;
-				case 3: // 11A122
-					tx_data[tx_offset] = measure(11,TLM_A,122); 
-					break;
-				case 4: // 11A158
-					tx_data[tx_offset] = measure(11,TLM_A,158); 
-					break;
-			}
-			break;
-		case 49: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 50: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 51: // MAGICAL WORD 1
-			// 10A1
-			// 10A4
-			// 10A7
-			// ...
-			// 10A148
-			tx_data[tx_offset] = measure(10,TLM_A,1+(frame_addr*3));
-			break;
-		case 52: // 12A13
-		case 116:
-			tx_data[tx_offset] = measure(12,TLM_A,13); 
-			break;
-		case 53: // 12A14
-		case 117:
-			tx_data[tx_offset] = measure(12,TLM_A,14); 
-			break;
-		case 54: // 12A15
-		case 118:
-			tx_data[tx_offset] = measure(12,TLM_A,15); 
-			break;
-		case 55: // 12A16
-		case 119:
-			tx_data[tx_offset] = measure(12,TLM_A,16); 
-			break;
-		case 56:
-			switch(frame_count){
-				case 0: // 11A15
-					tx_data[tx_offset] = measure(11,TLM_A,15); 
-					break;
-				case 1: // 11A51
-					tx_data[tx_offset] = measure(11,TLM_A,51); 
-					break;
-				case 2: // 11A87
-					tx_data[tx_offset] = measure(11,TLM_A,87); 
-					break;
-				case 3: // 11A123
-					tx_data[tx_offset] = measure(11,TLM_A,123); 
-					break;
-				case 4: // 11A159
-					tx_data[tx_offset] = measure(11,TLM_A,159); 
-					break;
-			}
-			break;
-		case 57:
-			switch(frame_count){
-				case 0: // 11A16
-					tx_data[tx_offset] = measure(11,TLM_A,16); 
-					break;
-				case 1: // 11A52
-					tx_data[tx_offset] = measure(11,TLM_A,52); 
-					break;
-				case 2: // 11A88
-					tx_data[tx_offset] = measure(11,TLM_A,88); 
-					break;
-				case 3: // 11A124
-					tx_data[tx_offset] = measure(11,TLM_A,124); 
-					break;
-				case 4: // 11A160
-					tx_data[tx_offset] = measure(11,TLM_A,160); 
-					break;
-			}
-			break;
-		case 58:
-			switch(frame_count){
-				case 0: // 11A17
-					tx_data[tx_offset] = measure(11,TLM_A,17); 
-					break;
-				case 1: // 11A53
-					tx_data[tx_offset] = measure(11,TLM_A,53); 
-					break;
-				case 2: // 11A89
-					tx_data[tx_offset] = measure(11,TLM_A,89); 
-					break;
-				case 3: // 11A125
-					tx_data[tx_offset] = measure(11,TLM_A,125); 
-					break;
-				case 4: // 11A161
-					tx_data[tx_offset] = measure(11,TLM_A,161); 
-					break;
-			}
-			break;
-		case 59:
-			switch(frame_count){
-				case 0: // 11A18
-					tx_data[tx_offset] = measure(11,TLM_A,18); 
-					break;
-				case 1: // 11A54
-					tx_data[tx_offset] = measure(11,TLM_A,54); 
-					break;
-				case 2: // 11A90
-					tx_data[tx_offset] = measure(11,TLM_A,90); 
-					break;
-				case 3: // 11A126
-					tx_data[tx_offset] = measure(11,TLM_A,126); 
-					break;
-				case 4: // 11A162
-					tx_data[tx_offset] = measure(11,TLM_A,162); 
-					break;
-			}
-			break;
-		case 60: // 51A4
-			tx_data[tx_offset] = measure(51,TLM_A,4); 
-			break;
-		case 61: // 51A5
-			tx_data[tx_offset] = measure(51,TLM_A,5); 
-			break;
-		case 62: // 51A6
-			tx_data[tx_offset] = measure(51,TLM_A,6); 
-			break;
-		case 63: // 51A7
-			tx_data[tx_offset] = measure(51,TLM_A,7); 
-			break;
-		case 64:
-			switch(frame_count){
-				case 0: // 11DP2A
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP6
-					tx_data[tx_offset] = measure(11,TLM_DP,6); 
-					break;
-				case 2: // 11DP13
-					tx_data[tx_offset] = measure(11,TLM_DP,13); 
-					break;
-				case 3: // 11DP20
-					tx_data[tx_offset] = measure(11,TLM_DP,20); 
-					break;
-				case 4: // 11DP27
-					tx_data[tx_offset] = measure(11,TLM_DP,27); 
-					break;
-			}
-			break;
-		case 65:
-			switch(frame_count){
-				case 0: // 11DP2B
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP7
-					tx_data[tx_offset] = measure(11,TLM_DP,7); 
-					break;
-				case 2: // 11DP14
-					tx_data[tx_offset] = measure(11,TLM_DP,14); 
-					break;
-				case 3: // 11DP21
-					tx_data[tx_offset] = measure(11,TLM_DP,21); 
-					break;
-				case 4: // 11DP28
-					tx_data[tx_offset] = measure(11,TLM_DP,28); 
-					break;
-			}
-			break;
-		case 66:
-			switch(frame_count){
-				case 0: // 11DP2C
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP8
-					tx_data[tx_offset] = measure(11,TLM_DP,8); 
-					break;
-				case 2: // 11DP15
-					tx_data[tx_offset] = measure(11,TLM_DP,15); 
-					break;
-				case 3: // 11DP22
-					tx_data[tx_offset] = measure(11,TLM_DP,22); 
-					break;
-				case 4: // 11DP29
-					tx_data[tx_offset] = measure(11,TLM_DP,29); 
-					break;
-			}
-			break;
-		case 67:
-			switch(frame_count){
-				case 0: // 11DP2D
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP9
-					tx_data[tx_offset] = measure(11,TLM_DP,9); 
-					break;
-				case 2: // 11DP16
-					tx_data[tx_offset] = measure(11,TLM_DP,16); 
-					break;
-				case 3: // 11DP23
-					tx_data[tx_offset] = measure(11,TLM_DP,23); 
-					break;
-				case 4: // 11DP30
-					tx_data[tx_offset] = measure(11,TLM_DP,30); 
-					break;
-			}
-			break;
-		case 72: 
-			switch(frame_count){
-				case 0: // 11A19
-					tx_data[tx_offset] = measure(11,TLM_A,19); 
-					break;
-				case 1: // 11A55
-					tx_data[tx_offset] = measure(11,TLM_A,55);  
-					break;
-				case 2: // 11A91
-					tx_data[tx_offset] = measure(11,TLM_A,91); 
-					break;
-				case 3: // 11A127
-					tx_data[tx_offset] = measure(11,TLM_A,127); 
-					break;
-				case 4: // 11A163
-					tx_data[tx_offset] = measure(11,TLM_A,163); 
-					break;
-			}
-			break;
-		case 73:
-			switch(frame_count){
-				case 0: // 11A20
-					tx_data[tx_offset] = measure(11,TLM_A,20); 
-					break;
-				case 1: // 11A56 AC BUS 2 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,56); 
-					break;
-				case 2: // 11A92
-					tx_data[tx_offset] = measure(11,TLM_A,92); 
-					break;
-				case 3: // 11A128
-					tx_data[tx_offset] = measure(11,TLM_A,128); 
-					break;
-				case 4: // 11A164
-					tx_data[tx_offset] = measure(11,TLM_A,164); 
-					break;
-			}
-			break;
-		case 74:
-			switch(frame_count){
-				case 0: // 11A21
-					tx_data[tx_offset] = measure(11,TLM_A,21); 
-					break;
-				case 1: // 11A57 MNA VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,57); 
-					break;
-				case 2: // 11A93
-					tx_data[tx_offset] = measure(11,TLM_A,93); 
-					break;
-				case 3: // 11A129
-					tx_data[tx_offset] = measure(11,TLM_A,129); 
-					break;
-				case 4: // 11A165
-					tx_data[tx_offset] = measure(11,TLM_A,165); 
-					break;
-			}
-			break;
-		case 75:
-			switch(frame_count){
-				case 0: // 11A22
-					tx_data[tx_offset] = measure(11,TLM_A,22); 
-					break;
-				case 1: // 11A58 MNB VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,58); 
-					break;
-				case 2: // 11A94
-					tx_data[tx_offset] = measure(11,TLM_A,94); 
-					break;
-				case 3: // 11A130
-					tx_data[tx_offset] = measure(11,TLM_A,130); 
-					break;
-				case 4: // 11A166
-					tx_data[tx_offset] = measure(11,TLM_A,166); 
-					break;
-			}
-			break;
-		case 80:
-			switch(frame_count){
-				case 0: // 11A23
-					tx_data[tx_offset] = measure(11,TLM_A,23); 
-					break;
-				case 1: // 11A59
-					tx_data[tx_offset] = measure(11,TLM_A,59); 
-					break;
-				case 2: // 11A95
-					tx_data[tx_offset] = measure(11,TLM_A,95); 
-					break;
-				case 3: // 11A131
-					tx_data[tx_offset] = measure(11,TLM_A,131); 
-					break;
-				case 4: // 11A167
-					tx_data[tx_offset] = measure(11,TLM_A,167); 
-					break;
-			}
-			break;
-		case 81: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 82: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 83: // MAGICAL WORD 2
-			// 10A2
-			// 10A5
-			// 10A8
-			// ...
-			// 10A149
-			tx_data[tx_offset] = measure(10,TLM_A,2+(frame_addr*3));
-			break;
-		case 88:
-			switch(frame_count){
-				case 0: // 11A24
-					tx_data[tx_offset] = measure(11,TLM_A,24); 
-					break;
-				case 1: // 11A60
-					tx_data[tx_offset] = measure(11,TLM_A,60); 
-					break;
-				case 2: // 11A96
-					tx_data[tx_offset] = measure(11,TLM_A,96); 
-					break;
-				case 3: // 11A132
-					tx_data[tx_offset] = measure(11,TLM_A,132); 
-					break;
-				case 4: // 11A168
-					tx_data[tx_offset] = measure(11,TLM_A,168); 
-					break;
-			}
-			break;
-		case 89:
-			switch(frame_count){
-				case 0: // 11A25
-					tx_data[tx_offset] = measure(11,TLM_A,25); 
-					break;
-				case 1: // 11A61
-					tx_data[tx_offset] = measure(11,TLM_A,61); 
-					break;
-				case 2: // 11A97
-					tx_data[tx_offset] = measure(11,TLM_A,97); 
-					break;
-				case 3: // 11A133
-					tx_data[tx_offset] = measure(11,TLM_A,133); 
-					break;
-				case 4: // 11A169
-					tx_data[tx_offset] = measure(11,TLM_A,169); 
-					break;
-			}
-			break;
-		case 90:
-			switch(frame_count){
-				case 0: // 11A26
-					tx_data[tx_offset] = measure(11,TLM_A,26); 
-					break;
-				case 1: // 11A62
-					tx_data[tx_offset] = measure(11,TLM_A,62); 
-					break;
-				case 2: // 11A98
-					tx_data[tx_offset] = measure(11,TLM_A,98); 
-					break;
-				case 3: // 11A134
-					tx_data[tx_offset] = measure(11,TLM_A,134); 
-					break;
-				case 4: // 11A170
-					tx_data[tx_offset] = measure(11,TLM_A,170); 
-					break;
-			}
-			break;
-		case 91:
-			switch(frame_count){
-				case 0: // 11A27
-					tx_data[tx_offset] = measure(11,TLM_A,27); 
-					break;
-				case 1: // 11A63
-					tx_data[tx_offset] = measure(11,TLM_A,63); 
-					break;
-				case 2: // 11A99
-					tx_data[tx_offset] = measure(11,TLM_A,99); 
-					break;
-				case 3: // 11A135
-					tx_data[tx_offset] = measure(11,TLM_A,135); 
-					break;
-				case 4: // 11A171
-					tx_data[tx_offset] = measure(11,TLM_A,171); 
-					break;
-			}
-			break;
-		case 92: // 51A8
-			tx_data[tx_offset] = measure(51,TLM_A,8); 
-			break;
-		case 93: // 51A9
-			tx_data[tx_offset] = measure(51,TLM_A,9); 
-			break;
-		case 94: // 51A10
-			tx_data[tx_offset] = measure(51,TLM_A,10); 
-			break;
-		case 95: // 51A11
-			tx_data[tx_offset] = measure(51,TLM_A,11); 
-			break;
-		case 96:
-			switch(frame_count){
-				case 0: // 11DP3
-					tx_data[tx_offset] = measure(11,TLM_DP,3); 
-					break;
-				case 1: // 11DP10
-					tx_data[tx_offset] = measure(11,TLM_DP,10); 
-					break;
-				case 2: // 11DP17
-					tx_data[tx_offset] = measure(11,TLM_DP,17); 
-					break;
-				case 3: // 11DP24
-					tx_data[tx_offset] = measure(11,TLM_DP,24); 
-					break;
-				case 4: // 11DP31
-					tx_data[tx_offset] = measure(11,TLM_DP,31); 
-					break;
-			}
-			break;
-		case 97:
-			switch(frame_count){
-				case 0: // 11DP4
-					tx_data[tx_offset] = measure(11,TLM_DP,4); 
-					break;
-				case 1: // 11DP11
-					tx_data[tx_offset] = measure(11,TLM_DP,11); 
-					break;
-				case 2: // 11DP18
-					tx_data[tx_offset] = measure(11,TLM_DP,18); 
-					break;
-				case 3: // 11DP25
-					tx_data[tx_offset] = measure(11,TLM_DP,25); 
-					break;
-				case 4: // 11DP32
-					tx_data[tx_offset] = measure(11,TLM_DP,32); 
-					break;
-			}
-			break;
-		case 98:
-			switch(frame_count){
-				case 0: // 11DP5
-					tx_data[tx_offset] = measure(11,TLM_DP,5); 
-					break;
-				case 1: // 11DP12
-					tx_data[tx_offset] = measure(11,TLM_DP,12); 
-					break;
-				case 2: // 11DP19
-					tx_data[tx_offset] = measure(11,TLM_DP,19); 
-					break;
-				case 3: // 11DP26
-					tx_data[tx_offset] = measure(11,TLM_DP,26); 
-					break;
-				case 4: // 11DP33
-					tx_data[tx_offset] = measure(11,TLM_DP,33); 
-					break;
-			}
-			break;
-		case 99: // 51DP2
-			tx_data[tx_offset] = measure(51,TLM_DP,2); 
-			break;
-		case 104:
-			switch(frame_count){
-				case 0: // 11A28
-					tx_data[tx_offset] = measure(11,TLM_A,28); 
-					break;
-				case 1: // 11A64
-					tx_data[tx_offset] = measure(11,TLM_A,64); 
-					break;
-				case 2: // 11A100
-					tx_data[tx_offset] = measure(11,TLM_A,100); 
-					break;
-				case 3: // 11A136
-					tx_data[tx_offset] = measure(11,TLM_A,136); 
-					break;
-				case 4: // 11A172
-					tx_data[tx_offset] = measure(11,TLM_A,172); 
-					break;
-			}
-			break;
-		case 105:
-			switch(frame_count){
-				case 0: // 11A29 FC1 N2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,29); 
-					break;
-				case 1: // 11A65
-					tx_data[tx_offset] = measure(11,TLM_A,65); 
-					break;
-				case 2: // 11A101
-					tx_data[tx_offset] = measure(11,TLM_A,101); 
-					break;
-				case 3: // 11A137
-					tx_data[tx_offset] = measure(11,TLM_A,137); 
-					break;
-				case 4: // 11A173
-					tx_data[tx_offset] = measure(11,TLM_A,173); 
-					break;
-			}
-			break;
-		case 106:
-			switch(frame_count){
-				case 0: // 11A30 FC2 N2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,30); 
-					break;
-				case 1: // 11A66
-					tx_data[tx_offset] = measure(11,TLM_A,66); 
-					break;
-				case 2: // 11A102
-					tx_data[tx_offset] = measure(11,TLM_A,102); 
-					break;
-				case 3: // 11A138
-					tx_data[tx_offset] = measure(11,TLM_A,138); 
-					break;
-				case 4: // 11A174
-					tx_data[tx_offset] = measure(11,TLM_A,174); 
-					break;
-			}
-			break;
-		case 107:
-			switch(frame_count){
-				case 0: // 11A31
-					tx_data[tx_offset] = measure(11,TLM_A,31); 
-					break;
-				case 1: // 11A67 FC1 O2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,67); 
-					break;
-				case 2: // 11A103
-					tx_data[tx_offset] = measure(11,TLM_A,103); 
-					break;
-				case 3: // 11A139
-					tx_data[tx_offset] = measure(11,TLM_A,139); 
-					break;
-				case 4: // 11A175
-					tx_data[tx_offset] = measure(11,TLM_A,175); 
-					break;
-			}
-			break;
-		case 112:
-			switch(frame_count){
-				case 0: // 11A32 
-					tx_data[tx_offset] = measure(11,TLM_A,32); 
-					break;
-				case 1: // 11A68 FC2 O2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,68); 
-					break;
-				case 2: // 11A104
-					tx_data[tx_offset] = measure(11,TLM_A,104); 
-					break;
-				case 3: // 11A140
-					tx_data[tx_offset] = measure(11,TLM_A,140); 
-					break;
-				case 4: // 11A176
-					tx_data[tx_offset] = measure(11,TLM_A,176); 
-					break;
-			}
-			break;
-		case 113: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 114: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 115: // MAGICAL WORD 3
-			// 10A3
-			// 10A6
-			// 10A9
-			// ...
-			// 10A150
-			tx_data[tx_offset] = measure(10,TLM_A,3+(frame_addr*3));
-			break;
-		case 120:
-			switch(frame_count){
-				case 0: // 11A33 
-					tx_data[tx_offset] = measure(11,TLM_A,33); 
-					break;
-				case 1: // 11A69
-					tx_data[tx_offset] = measure(11,TLM_A,69); 
-					break;
-				case 2: // 11A105
-					tx_data[tx_offset] = measure(11,TLM_A,105); 
-					break;
-				case 3: // 11A141
-					tx_data[tx_offset] = measure(11,TLM_A,141); 
-					break;
-				case 4: // 11A177
-					tx_data[tx_offset] = measure(11,TLM_A,177); 
-					break;
-			}
-			break;
-		case 121:
-			switch(frame_count){
-				case 0: // 11A34
-					tx_data[tx_offset] = measure(11,TLM_A,34); 
-					break;
-				case 1: // 11A70
-					tx_data[tx_offset] = measure(11,TLM_A,70); 
-					break;
-				case 2: // 11A106
-					tx_data[tx_offset] = measure(11,TLM_A,106); 
-					break;
-				case 3: // 11A142
-					tx_data[tx_offset] = measure(11,TLM_A,142); 
-					break;
-				case 4: // 11A178
-					tx_data[tx_offset] = measure(11,TLM_A,178); 
-					break;
-			}
-			break;
-		case 122:
-			switch(frame_count){
-				case 0: // 11A35 FC3 N2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,35); 
-					break;
-				case 1: // 11A71
-					tx_data[tx_offset] = measure(11,TLM_A,71); 
-					break;
-				case 2: // 11A107
-					tx_data[tx_offset] = measure(11,TLM_A,107); 
-					break;
-				case 3: // 11A143
-					tx_data[tx_offset] = measure(11,TLM_A,143); 
-					break;
-				case 4: // 11A179
-					tx_data[tx_offset] = measure(11,TLM_A,179); 
-					break;
-			}
-			break;
-		case 123:
-			switch(frame_count){
-				case 0: // 11A36
-					tx_data[tx_offset] = measure(11,TLM_A,36); 
-					break;
-				case 1: // 11A72
-					tx_data[tx_offset] = measure(11,TLM_A,72); 
-					break;
-				case 2: // 11A108
-					tx_data[tx_offset] = measure(11,TLM_A,108); 
-					break;
-				case 3: // 11A143
-					tx_data[tx_offset] = measure(11,TLM_A,143); 
-					break;
-				case 4: // 11A180
-					tx_data[tx_offset] = measure(11,TLM_A,180); 
-					break;
-			}
-			break;
-		case 124: // 51A12
-			tx_data[tx_offset] = measure(51,TLM_A,12); 
-			break;
-		case 125: // 51A13
-			tx_data[tx_offset] = measure(51,TLM_A,13); 
-			break;
-		case 126: // 51A14
-			tx_data[tx_offset] = measure(51,TLM_A,14); 
-			break;
-		case 127: // 51A15
-			tx_data[tx_offset] = measure(51,TLM_A,15); 
-			break;
-
-		// JUST IN CASE
-		default:
-			tx_data[tx_offset] = 0;
-			break;
-	}
-	word_addr++;
-	if(word_addr > 127){
-		word_addr = 0;
-		frame_addr++;
-		if(frame_addr > 49){
-			frame_addr = 0;
-		}
-		frame_count++;
-		if(frame_count > 4){
-			frame_count = 0;
-		}
-	}
-}
-
-void PCM::perform_io(double simt){
-	// Do TCP IO	
-	switch(conn_state){
-		case 0: // UNINITIALIZED
-			break;
-		case 1: // INITALIZED, LISTENING
-			// Do we have data from MCC?
-			if (mcc_size > 0) {
-				// sprintf(oapiDebugString(), "MCCSIZE %d LRX %f LRXINT %f", mcc_size, last_rx, ((simt - last_rx) / 0.005));
-				// Should we recieve?
-				// (Using 0.005 went too fast?)
-				if ((fabs(simt - last_rx) / 0.05) < 1 || sat->agc.IsUpruptActive()) {
-					return; // No
-				}
-				last_rx = simt;
-				// Yes. Take a byte
-				rx_data[rx_offset] = mcc_data[mcc_offset];
-				mcc_offset++;
-				// If uplink isn't blocked
-				if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
-					// Handle it
-					handle_uplink();
-				}
-				// Are we done?
-				if (mcc_offset >= mcc_size) {
-					// We reached the end of the MCC buffer.
-					mcc_offset = mcc_size = 0;
-				}
-			}else{
-				// Try to accept
-				AcceptSocket = accept( m_socket, NULL, NULL );
-				if(AcceptSocket != INVALID_SOCKET){
-					conn_state = 2; // Accept this!
-					wsk_error = 0; // For now
-				}
-			}
-			// Otherwise loop and try again.
-			break;
-		case 2: // CONNECTED			
-			int bytesSent,bytesRecv;
-
-			bytesSent = send(AcceptSocket, (char *)tx_data, tx_size, 0 );
-			if(bytesSent == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
-				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
-					case 10038: // Socket isn't a socket
-					case 10053: // Software caused connection abort
-					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;
-
-					default:           // If unknown
-						wsk_error = 1; // do this
-						sprintf(wsk_emsg,"TELECOM: send() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
-				}
-			}
-			// Should we recieve?
-			if ((fabs(simt - last_rx) / 0.005) < 1 || sat->agc.IsUpruptActive()) {			
-				return; // No
-			}
-			last_rx = simt;
-			bytesRecv = recv( AcceptSocket, (char *)(rx_data+rx_offset), 1, 0 );
-			if(bytesRecv == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
-				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
-					case 10053: // Software caused connection abort
-					case 10038: // Socket isn't a socket
-					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;
-
-					default:           // If unknown
-						wsk_error = 1; // do this
-						sprintf(wsk_emsg,"TELECOM: recv() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
-				}
-				// Do we have data from MCC instead?
-				if (mcc_size > 0) {
-					// Yes. Take a byte
-					rx_data[rx_offset] = mcc_data[mcc_offset];
-					mcc_offset++;
-					// If the telemetry data-path is disconnected, discard the data
-					if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
-						// otherwise handle it
-						handle_uplink();
-					}
-					// Are we done?
-					if (mcc_offset >= mcc_size) {
-						// We reached the end of the MCC buffer.
-						mcc_offset = mcc_size = 0;
-					}
-				}
-			}else{
-				// If the telemetry data-path is disconnected
-				if(sat->UPTLMSwitch1.GetState() == TOGGLESWITCH_DOWN){
-					return; // Discard the data
-				}
-				if(bytesRecv > 0){
-					handle_uplink();
-				} else {
-					// Do we have data from MCC instead?
-					if (mcc_size > 0) {
-						// Yes. Take a byte
-						rx_data[rx_offset] = mcc_data[mcc_offset];
-						mcc_offset++;
-						// Handle it
-						handle_uplink();
-						// Are we done?
-						if (mcc_offset >= mcc_size) {
-							// We reached the end of the MCC buffer.
-							mcc_offset = mcc_size = 0;
-						}
-					}
-				}
-			}
-			break;			
-	}
-}
-
-// Handle data moved to buffer from either the socket or mcc buffer
-void PCM::handle_uplink() {
-	switch (uplink_state) {
-	case 0: // NEW COMMAND START
-		int va, sa;
-		va = ((rx_data[rx_offset] & 070) >> 3);
-		sa = rx_data[rx_offset] & 07;
-		// *** VEHICLE ADDRESS HARDCODED HERE *** (NASA DID THIS TOO)
-		if (va != 04) { break; }
-		switch (sa) {
-		case 0: // TEST
-			rx_offset++; uplink_state = 10;
-			break;
-		case 3: // CMC-UPDATA
-			rx_offset++; uplink_state = 20;
-			break;
-		case 4: // CTE-UPDATE
-			rx_offset++; uplink_state = 30;
-			break;
-		case 5: // RTC-SALVO
-			rx_offset++; uplink_state = 40;
-			break;
-		case 6: // RTC-COMMAND
-			rx_offset++; uplink_state = 50;
-			break;
-		default:
-			sprintf(sat->debugString(), "UPLINK: UNKNOWN SYSTEM-ADDRESS %o", sa);
+		default:
+			sprintf(sat->debugString(), "UPLINK: UNKNOWN SYSTEM-ADDRESS %o", sa);
 			break;
 		}
 		break;
@@ -4003,6 +2801,7 @@ DSEChunk::DSEChunk() :
 	chunkData( 0 ),
 	chunkSize( 0 ),
 	chunkValidBytes( 0 ),
+	chunkPackedBytes( 0 ),
 	chunkType( DSEEMPTY )
 {
 	// Nothing to do.
@@ -4023,6 +2822,7 @@ void DSEChunk::deleteData()
 	chunkData = 0;
 	chunkSize = 0;
 	chunkValidBytes = 0;
+	chunkPackedBytes = 0;
 	chunkType = DSEEMPTY;
 }
 
@@ -4055,13 +2855,172 @@ void DSEChunk::Erase( const DSEChunkType dataType )
 
 	chunkType = dataType;
 	chunkValidBytes = 0;
+	chunkPackedBytes = 0;
+}
+
+bool DSEChunk::IsFull()
+{
+	switch ( chunkType )
+	{
+	case DSEHBR:
+		return chunkPackedBytes > 0 || chunkValidBytes >= dseChunkSizeHBR;
+
+	case DSELBR:
+		return chunkPackedBytes > 0 || chunkValidBytes >= dseChunkSizeLBR;
+
+	default:
+		return true;
+	}
+}
+
+unsigned int DSEChunk::Write( const unsigned char *data, unsigned int size )
+{
+	unsigned int capacity = ( chunkType == DSEHBR ) ? dseChunkSizeHBR : dseChunkSizeLBR;
+
+	if ( chunkType == DSEEMPTY || chunkPackedBytes > 0 )
+		return 0;
+
+	if ( size > capacity - chunkValidBytes )
+		size = capacity - chunkValidBytes;
+
+	memcpy( chunkData + chunkValidBytes, data, size );
+	chunkValidBytes += size;
+
+	return size;
+}
+
+//
+// PCM data has plenty of repeated words (spares, sync, idle channels), so the chunks
+// are run length encoded (PackBits) once they're recorded: a header byte 0-127 is
+// followed by that many plus one literal bytes, 129-255 repeats the next byte
+// 257 - header times.
+//
+// Only runs of three or more are repeated. A two byte run costs as much either
+// way, and splitting a literal for it is what makes PackBits grow its input.
+//
+
+static bool DSEIsRun( const unsigned char *in, unsigned int i, unsigned int n )
+{
+	return i + 2 < n && in[i] == in[i + 1] && in[i] == in[i + 2];
+}
+
+//
+// Returns the packed size, or 0 if it would need more than max bytes.
+//
+
+static unsigned int DSEPackBits( const unsigned char *in, unsigned int n, unsigned char *out, unsigned int max )
+{
+	unsigned int i = 0, o = 0;
+
+	while ( i < n )
+	{
+		if ( DSEIsRun( in, i, n ) )
+		{
+			unsigned int run = 3;
+			while ( i + run < n && run < 128 && in[i + run] == in[i] )
+				run++;
+
+			if ( o + 2 > max )
+				return 0;
+
+			out[o++] = (unsigned char) ( 257 - run );
+			out[o++] = in[i];
+			i += run;
+		}
+		else
+		{
+			unsigned int start = i, len = 0;
+			while ( i < n && len < 128 && !DSEIsRun( in, i, n ) )
+			{
+				i++;
+				len++;
+			}
+
+			if ( o + 1 + len > max )
+				return 0;
+
+			out[o++] = (unsigned char) ( len - 1 );
+			memcpy( out + o, in + start, len );
+			o += len;
+		}
+	}
+
+	return o;
+}
+
+static unsigned int DSEUnpackBits( const unsigned char *in, unsigned int n, unsigned char *out, unsigned int max )
+{
+	unsigned int i = 0, o = 0;
+
+	while ( i < n )
+	{
+		unsigned int header = in[i++];
+
+		if ( header < 128 )
+		{
+			unsigned int len = header + 1;
+			if ( len > n - i ) len = n - i;
+			if ( len > max - o ) len = max - o;
+			memcpy( out + o, in + i, len );
+			i += header + 1;
+			o += len;
+		}
+		else if ( header > 128 && i < n )
+		{
+			unsigned int len = 257 - header;
+			if ( len > max - o ) len = max - o;
+			memset( out + o, in[i], len );
+			i++;
+			o += len;
+		}
+	}
+
+	return o;
+}
+
+void DSEChunk::Seal()
+{
+	unsigned char packed[dseChunkSizeHBR];
+
+	if ( chunkType == DSEEMPTY || chunkPackedBytes > 0 || chunkValidBytes == 0 )
+		return;
+
+	//
+	// Only worth keeping if it saves something, so the packer gives up once
+	// it reaches the unpacked size.
+	//
+	unsigned int n = DSEPackBits( chunkData, chunkValidBytes, packed, chunkValidBytes - 1 );
+	if ( n == 0 )
+		return;
+
+	delete[] chunkData;
+	chunkData = new unsigned char[n];
+	memcpy( chunkData, packed, n );
+	chunkSize = n;
+	chunkPackedBytes = n;
+}
+
+unsigned int DSEChunk::Read( unsigned char *data )
+{
+	if ( chunkType == DSEEMPTY )
+		return 0;
+
+	if ( chunkPackedBytes > 0 )
+		return DSEUnpackBits( chunkData, chunkPackedBytes, data, dseChunkSizeHBR );
+
+	memcpy( data, chunkData, chunkValidBytes );
+	return chunkValidBytes;
 }
 
 DSE::DSE() :
 	tapeSpeedInchesPerSecond( 0.0 ),
 	desiredTapeSpeed( 0.0 ),
 	tapeMotion( 0.0 ),
-	state( STOPPED )
+	state( STOPPED ),
+	tapePosition( 0.0 ),
+	tapeDirection( 1.0 ),
+	recordingHBR( true ),
+	recordChunk( -1 )
 {
 	lastEventTime = 0;
 }
@@ -4073,6 +3032,9 @@ DSE::~DSE()
 void DSE::Init(Saturn *vessel)
 {
 	sat = vessel;
+
+	// Tape dumps go to their own port, like the FM downlink they used
+	dump.Start(14244);
 }
 
 bool DSE::TapeMotion()
@@ -4116,6 +3078,8 @@ void DSE::Stop()
 void DSE::Record( bool hbr )
 {
 	double tapeSpeed = hbr ? hbrRecord : lbrRecord;
+	recordingHBR = hbr;
+	tapeDirection = 1.0;
 	if ( state != RECORDING || tapeSpeedInchesPerSecond != tapeSpeed )
 	{
 		desiredTapeSpeed = tapeSpeed;
@@ -4138,19 +3102,116 @@ void DSE::Record( bool hbr )
 
 const double tapeAccel = 30.0;
 
-void DSE::TimeStep( double simt, double simdt )
+void DSE::RecordData( const unsigned char *data, int size, bool hbr )
+{
+	if ( state != RECORDING )
+		return;
+
+	//
+	// PCM rate changed; the data is lost while the tape changes speed.
+	//
+	if ( hbr != recordingHBR )
+	{
+		Record( hbr );
+		return;
+	}
+
+	unsigned int capacity = hbr ? dseChunkSizeHBR : dseChunkSizeLBR;
+
+	while ( size > 0 )
+	{
+		int chunk = (int) ( tapePosition / dseChunkLength );
+
+		if ( chunk >= (int) tapeSize )
+		{
+			// End of tape.
+			Stop();
+			return;
+		}
+
+		//
+		// Recording over a chunk erases what was there. Recording that stopped
+		// part way through a chunk carries on in it, unless the rate changed.
+		//
+		if ( chunk != recordChunk || tape[chunk].IsHBR() != hbr )
+		{
+			if ( recordChunk >= 0 && recordChunk != chunk )
+				tape[recordChunk].Seal();
+
+			tape[chunk].Erase( hbr ? DSEChunk::DSEHBR : DSEChunk::DSELBR );
+			recordChunk = chunk;
+		}
+
+		unsigned int n = tape[chunk].Write( data, size );
+		data += n;
+		size -= n;
+
+		//
+		// The head moves with the data.
+		//
+		if ( tape[chunk].IsFull() )
+		{
+			tape[chunk].Seal();
+			recordChunk = -1;
+			tapePosition = ( chunk + 1 ) * dseChunkLength;
+		}
+		else
+		{
+			tapePosition += n * dseChunkLength / capacity;
+		}
+	}
+}
+
+void DSE::PlayChunk( int chunk )
+{
+	unsigned char data[dseChunkSizeHBR];
+
+	if ( chunk < 0 || chunk >= (int) tapeSize || tape[chunk].IsEmpty() )
+		return;
+
+	unsigned int n = tape[chunk].Read( data );
+	dump.Send( data, n );
+}
+
+void DSE::MoveTape( double inches )
 {
-	/// \todo forward/backward motion
-	/// \todo high/low bitrate
+	double tapeLength = tapeSize * dseChunkLength;
+	double oldPosition = tapePosition;
+
+	tapePosition += inches;
+	if ( tapePosition <= 0.0 || tapePosition >= tapeLength )
+	{
+		tapePosition = ( tapePosition <= 0.0 ) ? 0.0 : tapeLength;
+		Stop();
+	}
+
+	if ( state != PLAYING )
+		return;
 
+	//
+	// Play every chunk the head went past. Going backwards they come out in reverse
+	// order, each one forwards.
+	//
+	int from = (int) ( oldPosition / dseChunkLength );
+	int to = ( tapePosition > 0.0 ) ? (int) ( tapePosition / dseChunkLength ) : -1;
+
+	for ( int c = from; c < to; c++ )
+		PlayChunk( c );
+	for ( int c = from; c > to; c-- )
+		PlayChunk( c );
+}
+
+void DSE::TimeStep( double simt, double simdt )
+{
 	switch ( state )
 	{
 	case STOPPED:
 		if (!sat->TapeRecorderForwardSwitch.IsCenter()) {
 			if (sat->TapeRecorderRecordSwitch.IsUp()) {
-				Record(true);
+				Record(recordingHBR);
 			} else if (sat->TapeRecorderRecordSwitch.IsDown()) {
 				Play();
+				tapeDirection = sat->TapeRecorderForwardSwitch.IsDown() ? -1.0 : 1.0;
 			}
 		}
 		break;
@@ -4168,6 +3229,7 @@ void DSE::TimeStep( double simt, double simdt )
 			Stop();
 		} else if (sat->TapeRecorderRecordSwitch.IsDown()) {
 			Play();
+			tapeDirection = sat->TapeRecorderForwardSwitch.IsDown() ? -1.0 : 1.0;
 		}
 		break;
 
@@ -4210,6 +3272,15 @@ void DSE::TimeStep( double simt, double simdt )
 	default:
 		break;
 	}
+
+	//
+	// When recording the data moves the head, otherwise the tape speed does.
+	//
+	if ( state != RECORDING && tapeSpeedInchesPerSecond > 0.0 )
+	{
+		MoveTape( tapeDirection * tapeSpeedInchesPerSecond * simdt );
+	}
+
 	lastEventTime = simt;
 	//sprintf(oapiDebugString(), "DSE tapeSpeedips %lf desired %lf tapeMotion %lf state %i", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state);
 }
@@ -4217,13 +3288,15 @@ void DSE::TimeStep( double simt, double simdt )
 void DSE::LoadState(char *line) {
 	
 	/// \todo DSE Chunks
+	int hbr = recordingHBR ? 1 : 0;
 
-	sscanf(line + 12, "%lf %lf %lf %i %lf", &tapeSpeedInchesPerSecond, &desiredTapeSpeed, &tapeMotion, &state, &lastEventTime);
+	sscanf(line + 12, "%lf %lf %lf %i %lf %lf %lf %i", &tapeSpeedInchesPerSecond, &desiredTapeSpeed, &tapeMotion, &state, &lastEventTime, &tapePosition, &tapeDirection, &hbr);
+	recordingHBR = (hbr != 0);
 }
 
 void DSE::SaveState(FILEHANDLE scn) {
 	char buffer[256];
 
-	sprintf(buffer, "%lf %lf %lf %i %lf", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state, lastEventTime); 
+	sprintf(buffer, "%lf %lf %lf %i %lf %lf %lf %i", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state, lastEventTime, tapePosition, tapeDirection, recordingHBR ? 1 : 0); 
 	oapiWriteScenario_string(scn, "DATARECORDER", buffer);
 }
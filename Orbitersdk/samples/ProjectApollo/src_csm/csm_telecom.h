@@ -185,17 +185,21 @@ class Saturn;
 // Note that Apollo 15 and later used upgraded recorders which ran at half the speed with double the data density.
 //
 
-/// High-bit-rate chunk holds 160 bytes.
-const unsigned int dseChunkSizeHBR = 160;
+/// High-bit-rate chunk holds 640 bytes (51200bps at 15ips).
+const unsigned int dseChunkSizeHBR = 640;
 
-/// Low-bit-rate chunk holds 80 bytes.
+/// Low-bit-rate chunk holds 80 bytes (1600bps at 3.75ips).
 const unsigned int dseChunkSizeLBR = 80;
 
+/// Length of tape in a chunk, inches.
+const double dseChunkLength = 1.5;
+
 ///
 /// Data storage chunk. Represents 1.5 inches of tape.
 ///
 class DSEChunk
 {
+public:
 
 enum DSEChunkType
 {
@@ -209,6 +213,27 @@ public:
 	virtual ~DSEChunk();
 	void Erase( const DSEChunkType dataType );
 
+	///
+	/// \brief Record data into the chunk.
+	/// \return Number of bytes that fitted.
+	///
+	unsigned int Write( const unsigned char *data, unsigned int size );
+
+	///
+	/// \brief Compress a full chunk. Nothing more can be written to it.
+	///
+	void Seal();
+
+	///
+	/// \brief Play back the chunk.
+	/// \return Number of bytes copied to data, which must hold dseChunkSizeHBR.
+	///
+	unsigned int Read( unsigned char *data );
+
+	bool IsEmpty() { return chunkType == DSEEMPTY; };
+	bool IsFull();
+	bool IsHBR() { return chunkType == DSEHBR; };
+
 private:
 
 	void deleteData();
@@ -217,6 +242,7 @@ private:
 	unsigned char *chunkData;		/// Pointer to chunk data.
 	unsigned int chunkSize;			/// Size of chunk.
 	unsigned int chunkValidBytes;	/// Number of valid bytes in the chunk.
+	unsigned int chunkPackedBytes;	/// Size of the compressed data, 0 if not sealed.
 };
 
 const unsigned int tapeSize = 18000;
@@ -263,6 +289,11 @@ public:
 	///
 	void Record( bool hbr );
 
+	///
+	/// \brief Record PCM data, if the tape is recording at the right speed.
+	///
+	void RecordData( const unsigned char *data, int size, bool hbr );
+
 	///
 	/// \brief Timestep processing.
 	///
@@ -278,8 +309,16 @@ protected:
 	double desiredTapeSpeed;			/// Desired tape speed in inches per second.
 	double tapeMotion;					/// Tape motion from 0.0 to 1.0.
 	DSEState state;						/// Tape state.
+	double tapePosition;				/// Head position in inches from the start of the tape.
+	double tapeDirection;				/// 1.0 forward, -1.0 rewinding.
+	bool recordingHBR;					/// Recording speed is HBR.
+	int recordChunk;					/// Chunk last recorded into and not yet sealed, or -1.
+	TelemetryServer dump;				/// Tape playback to the ground.
 
 	double lastEventTime;				/// Last event time.
+
+	void MoveTape( double inches );
+	void PlayChunk( int chunk );
 };
 
 // PCM system
@@ -290,17 +329,16 @@ public:
 	void TimeStep(double simt);     // TimeStep
 	void SystemTimestep(double simdt); // System Timestep (consume power)
 
-	// Winsock2
-	WSADATA wsaData;				// Winsock subsystem data
-	SOCKET m_socket;				// TCP socket
-	sockaddr_in service;			// SOCKADDR_IN
-	SOCKET AcceptSocket;			// Accept Socket
+	// Ground station link
+	TelemetryServer server;			// Downlink/uplink TCP server
 	int conn_state;                 // Connection State
 	int uplink_state;               // Uplink State
 	void perform_io(double simt);   // Get data from here to there
 	void handle_uplink();	// Handle incoming data
-	void generate_stream_lbr();     // Generate LBR datastream
-	void generate_stream_hbr();     // Same for HBR datastream
+	void generate_stream_lbr(double simt); // Generate LBR datastream
+	void generate_stream_hbr(double simt); // Same for HBR datastream
+	unsigned char generate_word(const PCMMeasurement &m); // Generate one word of the format
+	void record_word(double simt, int rate); // Pass the word just generated to the recorder
 	unsigned char scale_data(double data, double low, double high); // Scale data for PCM transmission
 	unsigned char measure(int channel, int type, int ccode);
 
@@ -323,8 +361,12 @@ public:
 	unsigned char tx_data[1024];    // Characters to be transmitted
 	unsigned char rx_data[1024];    // Characters recieved
 	unsigned char mcc_data[1024];	// MCC-provided incoming data
+	PCMFrameProgram lbrProgram;		// Compiled LBR format
+	PCMFrameProgram hbrProgram;		// Compiled HBR format
 
-	bool registerSocket(SOCKET sock);
+	// Telemetry recording
+	PCMRecorder recorder;			// Flight recorder for the downlink
+	PCMReplay replay;				// Recorded downlink to send instead of the live one
 
 	Saturn *sat;					// Ship we're installed in
 	friend class MCC;				// Allow MCC to write directly to buffer
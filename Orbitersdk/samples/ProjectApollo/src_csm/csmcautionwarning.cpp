@@ -308,9 +308,9 @@ void CSMCautionWarningSystem::TimeStep(double simt)
 			//
 			FuelCellStatus fc1, fc2, fc3;
 
-			sat->GetFuelCellStatus(1, fc1);
-			sat->GetFuelCellStatus(2, fc2);
-			sat->GetFuelCellStatus(3, fc3);
+			sat->SampleFuelCellStatus(1, fc1);
+			sat->SampleFuelCellStatus(2, fc2);
+			sat->SampleFuelCellStatus(3, fc3);
 
 			SetLight(CSM_CWS_FC1_LIGHT, FuelCellBad(fc1, 1));
 			SetLight(CSM_CWS_FC2_LIGHT, FuelCellBad(fc2, 2));
@@ -324,7 +324,7 @@ void CSMCautionWarningSystem::TimeStep(double simt)
 
 			bool LightCryo = false;
 			TankPressures press;
-			sat->GetTankPressures(press);
+			sat->SampleTankPressures(press);
 
 			if (press.H2Tank1PressurePSI < 220.0 || press.H2Tank2PressurePSI < 220.0) {
 				LightCryo = true;
@@ -413,7 +413,7 @@ void CSMCautionWarningSystem::TimeStep(double simt)
 
 		AtmosStatus atm;
 		DisplayedAtmosStatus datm;
-		sat->GetAtmosStatus(atm);
+		sat->SampleAtmosStatus(atm);
 		sat->GetDisplayedAtmosStatus(datm);
 
 		//
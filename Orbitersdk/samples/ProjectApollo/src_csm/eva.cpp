@@ -37,7 +37,7 @@
 // Set the file name for the tracer code.
 //
 
-char trace_file[] = "ProjectApollo EVA.log";
+char trace_file[] = "ProjectApollo EVA.trc";
 
 const VECTOR3 OFS_STAGE1 =  { 0, 0, -8.935};
 const VECTOR3 OFS_STAGE2 =  { 0, 0, 9.25-12.25};
@@ -205,6 +205,16 @@ void EVA::clbkPreStep (double simt, double SimDT, double mjd)
 	}
 }
 
+DLLCLBK void InitModule (HINSTANCE hModule)
+{
+	TraceLog::Open(trace_file);
+}
+
+DLLCLBK void ExitModule (HINSTANCE hModule)
+{
+	TraceLog::Close();
+}
+
 DLLCLBK VESSEL *ovcInit (OBJHANDLE hvessel, int flightmodel)
 {
 	if (!refcount++)
@@ -2053,6 +2053,13 @@ void SaturnCabinPressureReliefLever::DrawSwitch(SURFHANDLE drawSurface) {
 	ThumbwheelSwitch::DrawSwitch(drawSurface);
 }
 
+bool SaturnCabinPressureReliefLever::GetDrawState(unsigned int &drawState) {
+
+	ThumbwheelSwitch::GetDrawState(drawState);
+	drawState = MixDrawState(drawState, (unsigned int)guardState);
+	return true;
+}
+
 bool SaturnCabinPressureReliefLever::CheckMouseClick(int event, int mx, int my) {
 
 	if (event & PANEL_MOUSE_RBDOWN) {
@@ -2301,6 +2308,18 @@ bool CSMLMPowerSwitch::SwitchTo(int newState)
 	return false;
 }
 
+bool OrdealRotationalSwitch::GetDrawState(unsigned int &drawState) {
+
+	//
+	// The value is only shown while the mouse is down.
+	//
+	RotationalSwitch::GetDrawState(drawState);
+	drawState = MixDrawState(drawState, (unsigned int)mouseDown);
+	if (mouseDown)
+		drawState = MixDrawState(drawState, (unsigned int)value);
+	return true;
+}
+
 void OrdealRotationalSwitch::DrawSwitch(SURFHANDLE drawSurface) {
 
 	RotationalSwitch::DrawSwitch(drawSurface);
@@ -826,6 +826,7 @@ public:
 
 	void InitGuard(SURFHANDLE surf, SoundLib *soundlib);
 	void DrawSwitch(SURFHANDLE drawSurface);
+	bool GetDrawState(unsigned int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
@@ -899,6 +900,7 @@ class OrdealRotationalSwitch: public RotationalSwitch {
 public:
 	OrdealRotationalSwitch() { value = 100; lastX = 0; mouseDown = false; };
 	virtual void DrawSwitch(SURFHANDLE drawSurface);
+	virtual bool GetDrawState(unsigned int &drawState);
 	virtual bool CheckMouseClick(int event, int mx, int my);
 	virtual void SaveState(FILEHANDLE scn);
 	virtual void LoadState(char *line);
@@ -2376,6 +2376,21 @@ void Saturn::ClearPanelSDKPointers()
 	pSecECSAccumulatorQuantity = 0;
 	pPotableH2oTankQuantity = 0;
 	pWasteH2oTankQuantity = 0;
+
+	//
+	// And anything sampled through them.
+	//
+
+	sampledAtmos.Invalidate();
+	sampledTankPressures.Invalidate();
+	sampledTankQuantities.Invalidate();
+
+	for (i = 0; i < 3; i++) {
+		sampledFuelCells[i].Invalidate();
+	}
+	for (i = 0; i < 6; i++) {
+		sampledRCS[i].Invalidate();
+	}
 }
 
 //
@@ -2758,6 +2773,68 @@ void Saturn::GetTankQuantities(TankQuantities &q)
 	}
 }
 
+//
+// Sampled systems status. Each call rebuilds the status only if the last sample
+// is older than the sample interval.
+//
+
+void Saturn::SampleAtmosStatus(AtmosStatus &atm)
+
+{
+	if (sampledAtmos.Due(oapiGetSimTime())) {
+		GetAtmosStatus(sampledAtmos.value);
+	}
+	atm = sampledAtmos.value;
+}
+
+void Saturn::SampleTankPressures(TankPressures &press)
+
+{
+	if (sampledTankPressures.Due(oapiGetSimTime())) {
+		GetTankPressures(sampledTankPressures.value);
+	}
+	press = sampledTankPressures.value;
+}
+
+void Saturn::SampleTankQuantities(TankQuantities &q)
+
+{
+	if (sampledTankQuantities.Due(oapiGetSimTime())) {
+		GetTankQuantities(sampledTankQuantities.value);
+	}
+	q = sampledTankQuantities.value;
+}
+
+void Saturn::SampleFuelCellStatus(int index, FuelCellStatus &fc)
+
+{
+	if (index < 1 || index > 3) {
+		GetFuelCellStatus(index, fc);
+		return;
+	}
+
+	SensorSample<FuelCellStatus> &s = sampledFuelCells[index - 1];
+	if (s.Due(oapiGetSimTime())) {
+		GetFuelCellStatus(index, s.value);
+	}
+	fc = s.value;
+}
+
+void Saturn::SampleRCSStatus(int index, RCSStatus &rs)
+
+{
+	if (index < RCS_SM_QUAD_A || index > RCS_CM_RING_2) {
+		GetRCSStatus(index, rs);
+		return;
+	}
+
+	SensorSample<RCSStatus> &s = sampledRCS[index - RCS_SM_QUAD_A];
+	if (s.Due(oapiGetSimTime())) {
+		GetRCSStatus(index, s.value);
+	}
+	rs = s.value;
+}
+
 //
 // Set O2 tank quantities. For now, just use one fixed input.
 //
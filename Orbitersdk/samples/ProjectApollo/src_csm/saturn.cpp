@@ -212,6 +212,8 @@ Saturn::Saturn(OBJHANDLE hObj, int fmodel) : ProjectApolloConnectorVessel (hObj,
 
 {	
 	//_CrtSetDbgFlag ( _CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF|_CRTDBG_CHECK_ALWAYS_DF );
+	TraceLog::Open(trace_file);
+
 	InitSaturnCalled = false;
 	autopilot = false;
 	LastTimestep = 0;
@@ -270,6 +272,8 @@ Saturn::~Saturn()
 	}
 
 	//fclose(PanelsdkLogFile);
+
+	TraceLog::Close();
 }
 
 void Saturn::initSaturn()
@@ -1488,6 +1492,9 @@ void Saturn::clbkSaveState(FILEHANDLE scn)
 	}
 	if (use_lvdc){oapiWriteScenario_string(scn,"USE_LVDC","PLEASE");};
 	oapiWriteScenario_string (scn, "LANG", AudioLanguage);
+
+	if (pcm.recorder.IsOpen())
+		oapiWriteScenario_string (scn, "PCMRECORD", (char *) pcm.recorder.GetFileName());
 	
 	if (PayloadName[0])
 		oapiWriteScenario_string (scn, "PAYN", PayloadName);
@@ -1846,6 +1853,11 @@ bool Saturn::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 	else if (!strnicmp (line, "NASSPVER", 8)) {
 		sscanf (line + 8, "%d", &nasspver);
 	}
+	else if (!strnicmp (line, "TRACEMASK", 9)) {
+		unsigned int tracemask;
+		if (sscanf (line + 9, "%x", &tracemask) == 1)
+			TraceLog::SetMask(tracemask);
+	}
 	else if (!strnicmp (line, "TOALT", 5)) {
         int toalt;
 		sscanf (line+5, "%d", &toalt);
@@ -2217,6 +2229,12 @@ bool Saturn::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 	else if (!strnicmp(line, "LANG", 4)) {
 		strncpy (AudioLanguage, line + 5, 64);
 	}
+	else if (!strnicmp(line, "PCMRECORD", 9)) {
+		pcm.recorder.Open(line + 10);
+	}
+	else if (!strnicmp(line, "PCMREPLAY", 9)) {
+		pcm.replay.Open(line + 10);
+	}
 	else if (!strnicmp(line, "LEMN", 4)) {
 		//
 		// LEMN (LEM name) is a synonym for PAYN (Payload name) for old scenarios.
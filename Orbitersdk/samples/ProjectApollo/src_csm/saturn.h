@@ -47,6 +47,10 @@
 #include "pyro.h"
 #include "secs.h"
 #include "scs.h"
+#include "pcmrecorder.h"
+#include "pcmformat.h"
+#include "telemetryserver.h"
+#include "sensorsample.h"
 #include "csm_telecom.h"
 #include "sps.h"
 #include "mcc.h"
@@ -66,6 +70,8 @@
 
 #include "IMFD/IMFD_Client.h"
 
+class StageConfig;
+
 
 #define RCS_SM_QUAD_A		0
 #define RCS_SM_QUAD_B		1
@@ -1007,6 +1013,18 @@ public:
 	void EPSTimestep();
 	void GetAGCWarningStatus(AGCWarningStatus &aws);
 	void GetRCSStatus(int index, RCSStatus &rs);
+
+	///
+	/// Sampled versions of the calls above for consumers that poll them many times
+	/// a second (telemetry, caution and warning). The status is only rebuilt from
+	/// the systems once per sample interval and shared between them.
+	///
+	void SampleAtmosStatus(AtmosStatus &atm);
+	void SampleTankPressures(TankPressures &press);
+	void SampleTankQuantities(TankQuantities &q);
+	void SampleFuelCellStatus(int index, FuelCellStatus &fc);
+	void SampleRCSStatus(int index, RCSStatus &rs);
+
 	double GetAccelG() { return aZAcc / G; };
 	virtual void GetECSStatus(ECSStatus &ecs);
 	virtual void SetCrewNumber(int number);
@@ -4077,7 +4095,7 @@ protected:
 	void StartAbort();
 	void GetPayloadName(char *s);
 	void GetApolloName(char *s);
-	void AddSM(double offet, bool showSPS);
+	void AddSM(StageConfig &config, double offset, bool showSPS);
 
 	//
 	// Systems functions.
@@ -4460,6 +4478,16 @@ protected:
 	double *pPotableH2oTankQuantity;
 	double *pWasteH2oTankQuantity;
 
+	//
+	// Sampled systems status, 10 samples per second.
+	//
+
+	SensorSample<AtmosStatus> sampledAtmos;
+	SensorSample<TankPressures> sampledTankPressures;
+	SensorSample<TankQuantities> sampledTankQuantities;
+	SensorSample<FuelCellStatus> sampledFuelCells[3];
+	SensorSample<RCSStatus> sampledRCS[6];
+
 	// InitSaturn is called twice, but some things must run only once
 	bool InitSaturnCalled;
 
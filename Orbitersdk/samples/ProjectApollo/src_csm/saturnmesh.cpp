@@ -48,6 +48,7 @@
 #include "sivb.h"
 
 #include "LES.h"
+#include "stagemesh.h"
 
 MESHHANDLE hSM;
 MESHHANDLE hSMRCS;
@@ -205,34 +206,34 @@ void SaturnInitMeshes()
 	let_exhaust.tex = contrail_tex;
 }
 
-void Saturn::AddSM(double offset, bool showSPS)
+void Saturn::AddSM(StageConfig &config, double offset, bool showSPS)
 
 {
 	VECTOR3 mesh_dir=_V(0, SMVO, offset);
 
-	AddMesh (hSM, &mesh_dir);
+	config.AddMesh (hSM, mesh_dir);
 
 	if (LowRes)
-		AddMesh(hSMRCSLow, &mesh_dir);
+		config.AddMesh (hSMRCSLow, mesh_dir);
 	else
-		AddMesh (hSMRCS, &mesh_dir);
+		config.AddMesh (hSMRCS, mesh_dir);
 
-	AddMesh (hSMPanel1, &mesh_dir);
-	AddMesh (hSMPanel2, &mesh_dir);
-	AddMesh (hSMPanel3, &mesh_dir);
+	config.AddMesh (hSMPanel1, mesh_dir);
+	config.AddMesh (hSMPanel2, mesh_dir);
+	config.AddMesh (hSMPanel3, mesh_dir);
 
 	if (!ApolloExploded)
-		AddMesh (hSMPanel4, &mesh_dir);
+		config.AddMesh (hSMPanel4, mesh_dir);
 	else
-		AddMesh (hSMCRYO, &mesh_dir);
+		config.AddMesh (hSMCRYO, mesh_dir);
 
-	AddMesh (hSMPanel5, &mesh_dir);
-	AddMesh (hSMPanel6, &mesh_dir);
-	AddMesh (hSMSIMBAY, &mesh_dir);
+	config.AddMesh (hSMPanel5, mesh_dir);
+	config.AddMesh (hSMPanel6, mesh_dir);
+	config.AddMesh (hSMSIMBAY, mesh_dir);
 
 	if (showSPS) {
 		mesh_dir = _V(0, SMVO, offset - 1.654);
-		SPSidx = AddMesh(hSMSPS, &mesh_dir);
+		SPSidx = config.AddMesh (hSMSPS, mesh_dir);
 	}
 }
 
@@ -433,7 +434,6 @@ void Saturn::SetupEVA()
 void Saturn::SetCSMStage ()
 
 {
-	ClearMeshes();
     ClearThrusterDefinitions();
 
 	//
@@ -519,7 +519,9 @@ void Saturn::SetCSMStage ()
 	SetLiftCoeffFunc(0);
 
 	const double CGOffset = 12.25+21.5-1.8+0.35;
-	AddSM(30.25 - CGOffset, true);
+	StageConfig config;
+
+	AddSM(config, 30.25 - CGOffset, true);
 
 	VECTOR3 mesh_dir;
 
@@ -528,49 +530,48 @@ void Saturn::SetCSMStage ()
 	//
 	if (!NoHGA) {
 		mesh_dir=_V(-1.308,-1.18,29.042-CGOffset);
-		AddMesh (hSMhga, &mesh_dir);
+		config.AddMesh (hSMhga, mesh_dir);
 	}
 
 	mesh_dir=_V(0, 0, 34.4 - CGOffset);
 
-	UINT meshidx;
-	meshidx = AddMesh (hCM, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+	config.AddMesh (hCM, mesh_dir, MESHVIS_VCEXTERNAL);
 
 	// And the Crew
 	if (Crewed) {
-		cmpidx = AddMesh (hCMP, &mesh_dir);
-		crewidx = AddMesh (hCREW, &mesh_dir);
-		SetCrewMesh();
+		cmpidx = config.AddMesh (hCMP, mesh_dir);
+		crewidx = config.AddMesh (hCREW, mesh_dir);
 	} else {
 		cmpidx = -1;
 		crewidx = -1;
 	}
 
-	meshidx = AddMesh (hCMInt, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_EXTERNAL);
+	config.AddMesh (hCMInt, mesh_dir, MESHVIS_EXTERNAL);
 
 	//Don't Forget the Hatch
-	sidehatchidx = AddMesh (hFHC, &mesh_dir);
-	sidehatchopenidx = AddMesh (hFHO, &mesh_dir);
-	SetSideHatchMesh();
+	sidehatchidx = config.AddMesh (hFHC, mesh_dir);
+	sidehatchopenidx = config.AddMesh (hFHO, mesh_dir);
 
-	meshidx = AddMesh (hCMVC, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_VC);
+	config.AddMesh (hCMVC, mesh_dir, MESHVIS_VC);
 	VCMeshOffset = mesh_dir;
 
 	// Docking probe
 	if (HasProbe) {
-		probeidx = AddMesh(hprobe, &mesh_dir);
-		probeextidx = AddMesh(hprobeext, &mesh_dir);
-		SetDockingProbeMesh();
+		probeidx = config.AddMesh (hprobe, mesh_dir);
+		probeextidx = config.AddMesh (hprobeext, mesh_dir);
 	} else {
 		probeidx = -1;
 		probeextidx = -1;
 	}
 
 	// Optics Cover
-	opticscoveridx = AddMesh (hopticscover, &mesh_dir);
+	opticscoveridx = config.AddMesh (hopticscover, mesh_dir);
+
+	config.ApplyMeshes(this);
+
+	SetCrewMesh();
+	SetSideHatchMesh();
+	SetDockingProbeMesh();
 	SetOpticsCoverMesh();
 
 	// Docking port
@@ -881,57 +882,56 @@ void Saturn::SetReentryStage ()
 
 void Saturn::SetReentryMeshes() {
 
-	ClearMeshes();
+	//
+	// The chute stages all come through here, so only apply what changes
+	// rather than clearing and reloading the whole CM every time.
+	//
+	StageConfig config;
 
 	UINT meshidx;
 	VECTOR3 mesh_dir=_V(0,0,0);
 	if (Burned)	{
 		if (ApexCoverAttached) {
-			meshidx = AddMesh (hCMB, &mesh_dir);
+			meshidx = config.AddMesh (hCMB, mesh_dir);
 		} else {
 			mesh_dir=_V(0, 0, -1.2);
-			meshidx = AddMesh (hCM2B, &mesh_dir);
+			meshidx = config.AddMesh (hCM2B, mesh_dir);
 		}
 	} else {
 		if (ApexCoverAttached) {
-			meshidx = AddMesh (hCM, &mesh_dir);
+			meshidx = config.AddMesh (hCM, mesh_dir);
 		} else {
 			mesh_dir=_V(0, 0, -1.2);
-			meshidx = AddMesh (hCM2, &mesh_dir);
+			meshidx = config.AddMesh (hCM2, mesh_dir);
 		}
 	}
-	SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+	config.SetMeshVisibility (meshidx, MESHVIS_VCEXTERNAL);
 
 	if (LESAttached) {
 		TowerOffset = 4.95;
 		VECTOR3 mesh_dir_tower = mesh_dir + _V(0, 0, TowerOffset);
 
-		meshidx = AddMesh (hsat5tower, &mesh_dir_tower);
-		SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+		config.AddMesh (hsat5tower, mesh_dir_tower, MESHVIS_VCEXTERNAL);
 	}
 
 	// And the Crew
 	if (Crewed) {		
-		cmpidx = AddMesh (hCMP, &mesh_dir);
-		crewidx = AddMesh (hCREW, &mesh_dir);
-		SetCrewMesh();
+		cmpidx = config.AddMesh (hCMP, mesh_dir);
+		crewidx = config.AddMesh (hCREW, mesh_dir);
 	} else {
 		cmpidx = -1;
 		crewidx = -1;
 	}
 
-	meshidx = AddMesh (hCMInt, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_EXTERNAL);
+	config.AddMesh (hCMInt, mesh_dir, MESHVIS_EXTERNAL);
 
 	// Hatch
-	sidehatchidx = AddMesh (hFHC, &mesh_dir);
-	sidehatchopenidx = AddMesh (hFHO, &mesh_dir);
-	sidehatchburnedidx = AddMesh (hFHC2, &mesh_dir);
-	sidehatchburnedopenidx = AddMesh (hFHO2, &mesh_dir);
-	SetSideHatchMesh();
+	sidehatchidx = config.AddMesh (hFHC, mesh_dir);
+	sidehatchopenidx = config.AddMesh (hFHO, mesh_dir);
+	sidehatchburnedidx = config.AddMesh (hFHC2, mesh_dir);
+	sidehatchburnedopenidx = config.AddMesh (hFHO2, mesh_dir);
 
-	meshidx = AddMesh (hCMVC, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_VC);
+	config.AddMesh (hCMVC, mesh_dir, MESHVIS_VC);
 
 	//
 	// Docking probe
@@ -939,14 +939,22 @@ void Saturn::SetReentryMeshes() {
 
 	if (HasProbe)
 	{
-		probeidx = AddMesh(hprobe, &mesh_dir);
-		probeextidx = AddMesh(hprobeext, &mesh_dir);
-		SetDockingProbeMesh();
+		probeidx = config.AddMesh(hprobe, mesh_dir);
+		probeextidx = config.AddMesh(hprobeext, mesh_dir);
 	} else
 	{
 		probeidx = -1;
 		probeextidx = -1;
 	}
+
+	config.ApplyMeshes(this);
+
+	if (Crewed)
+		SetCrewMesh();
+	SetSideHatchMesh();
+	if (HasProbe)
+		SetDockingProbeMesh();
+
 	VCMeshOffset = mesh_dir;
 }
 
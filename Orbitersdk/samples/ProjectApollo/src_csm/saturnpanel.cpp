@@ -4114,6 +4114,14 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 	HGDIOBJ brush = NULL;
 	HGDIOBJ pen = NULL;
 
+	//
+	// Switch rows are only redrawn every frame if they've changed. Anything else
+	// redraws them, and so do the special cases below that draw into the surface
+	// before the switches.
+	//
+	bool redrawn;
+	bool force = (event != PANEL_REDRAW_ALWAYS);
+
 	// Enable this to trace the redraws, but then it's running horrible slow!
 	// char tracebuffer[100];
 	// sprintf(tracebuffer, "Saturn::clbkPanelRedrawEvent id %i", id);
@@ -4143,6 +4151,7 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 	//
 
 	if (id == AID_SM_RCS_MODE) {
+		force = true;
 		if (PanelId == SATPANEL_LEFT_RNDZ_WINDOW) {
 			if (oapiGetMFDMode(MFD_RIGHT) != MFD_NONE) {	// MFD_USER1
 				oapiBlt(surf, srf[SRF_SM_RCS_MODE], 0, 0, 0, 0, 75, 73, SURF_PREDEF_CK);
@@ -4173,6 +4182,7 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 			}
 			return false;
 		}
+		force = true;
 		oapiBlt(surf, srf[SRF_CSM_PANEL_600], 0, 0,   130, 0, 149, 302, SURF_PREDEF_CK);
 		oapiBlt(surf, srf[SRF_CSM_PANEL_600], 0, 304,   0, 0, 129, 410, SURF_PREDEF_CK);
 		if (Panel600.IsFlashing()) {
@@ -4195,6 +4205,7 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 			}
 			return false;
 		}
+		force = true;
 		oapiBlt(surf, srf[SRF_CSM_PANEL_600], 0, 0, 280, 0, 149, 302, SURF_PREDEF_CK);
 		if (Panel600.IsFlashing()) {
 			if (PanelFlashOn) {
@@ -4217,6 +4228,7 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 			}
 			return true;
 		} else {
+			force = true;
 			if (Panel382Cover.IsFlashing()) {
 				if (PanelFlashOn) {
 					oapiBlt(surf, srf[SRF_BORDER_673x80], 0, 0, 0, 0, 673, 80, SURF_PREDEF_CK);
@@ -4237,6 +4249,7 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 		if (opticsDskyEnabled == 0) {
 			return false;
 		}
+		force = true;
 		oapiBlt(surf, srf[SRF_OPTICS_DSKY], 0, 0, 0, 0, 303, 349);
 		dsky2.RenderLights(surf, srf[SRF_DSKY], 27, 28, false);
 		dsky2.RenderData(surf, srf[SRF_DIGITAL], srf[SRF_DSKYDISP], 171, 23);
@@ -4260,6 +4273,7 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 			}
 			return false;
 		}
+		force = true;
 		oapiBlt(surf, srf[SRF_ORDEAL_PANEL], 0, 0, 0, 0, 477, 202, SURF_PREDEF_CK);
 		if (PanelOrdeal.IsFlashing()) {
 			if (PanelFlashOn) {
@@ -4272,8 +4286,8 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 	// Process all the generic switches.
 	//
 
-	if (MainPanel.DrawRow(id, surf, PanelFlashOn))
-		return true;
+	if (MainPanel.DrawRow(id, surf, PanelFlashOn, redrawn, force))
+		return redrawn;
 
 	//
 	// Now special case the rest.
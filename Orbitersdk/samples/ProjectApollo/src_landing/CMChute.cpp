@@ -32,7 +32,7 @@
 #include "tracer.h"
 #include "CMChute.h"
 #include "papi.h"
-char trace_file[]="ProjectApollo CMChute.log";
+char trace_file[]="ProjectApollo CMChute.trc";
 
 const double timprc[3]={1,6,5};
 // States
@@ -46,7 +46,8 @@ const double timprc[3]={1,6,5};
 #define CH_MAIN   1
 #define CH_DROGUE 2
 //############################################################################//
-DLLCLBK void InitModule(HINSTANCE hModule)               {}
+DLLCLBK void InitModule(HINSTANCE hModule)               {TraceLog::Open(trace_file);}
+DLLCLBK void ExitModule(HINSTANCE hModule)               {TraceLog::Close();}
 DLLCLBK VESSEL *ovcInit(OBJHANDLE hvessel,int flightmodel){return new CMChute(hvessel,flightmodel);}
 DLLCLBK void    ovcExit(VESSEL *vessel)                  {if(vessel)delete(CMChute*)vessel;}
 //############################################################################//
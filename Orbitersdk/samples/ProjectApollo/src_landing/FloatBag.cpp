@@ -35,12 +35,18 @@
 #include "papi.h"
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo FloatBag.log";
+char trace_file[] = "ProjectApollo FloatBag.trc";
 
 
 DLLCLBK void InitModule(HINSTANCE hModule) {
 
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
+}
+
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+
+	TraceLog::Close();
 }
 
 
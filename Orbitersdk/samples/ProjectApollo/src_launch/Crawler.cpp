@@ -60,14 +60,20 @@
 #define VIEWPOS_RIGHTREARGANGWAY		6
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo Crawler.log";
+char trace_file[] = "ProjectApollo Crawler.trc";
 
 DLLCLBK void InitModule(HINSTANCE hModule) {
 
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
 	InitCollisionSDK();
 }
 
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+
+	TraceLog::Close();
+}
+
 DLLCLBK VESSEL *ovcInit(OBJHANDLE hvessel, int flightmodel) {
 
 	return new Crawler(hvessel, flightmodel);
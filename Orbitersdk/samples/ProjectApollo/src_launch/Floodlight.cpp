@@ -36,12 +36,18 @@
 #include "papi.h"
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo Floodlight.log";
+char trace_file[] = "ProjectApollo Floodlight.trc";
  
 
 DLLCLBK void InitModule(HINSTANCE hModule) {
 
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
+}
+
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+
+	TraceLog::Close();
 }
 
 
@@ -45,7 +45,7 @@
 #include "papi.h"
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo LC34.log";
+char trace_file[] = "ProjectApollo LC34.trc";
 
 
 // States
@@ -75,6 +75,12 @@ PARTICLESTREAMSPEC liftoffStreamSpec = {
 DLLCLBK void InitModule(HINSTANCE hModule) {
 
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
+}
+
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+
+	TraceLog::Close();
 }
 
 
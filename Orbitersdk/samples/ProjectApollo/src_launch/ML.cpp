@@ -45,7 +45,7 @@
 #include "papi.h"
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo ML.log";
+char trace_file[] = "ProjectApollo ML.trc";
 
 // States
 #define STATE_VABBUILD		   -2
@@ -89,6 +89,12 @@ PARTICLESTREAMSPEC liftoffStreamSpec = {
 DLLCLBK void InitModule(HINSTANCE hModule) {
 
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
+}
+
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+
+	TraceLog::Close();
 }
 
 
@@ -45,7 +45,7 @@
 #include "papi.h"
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo MSS.log";
+char trace_file[] = "ProjectApollo MSS.trc";
 
 // Pad and park coordinates
 #define PARK_LON -80.6199329
@@ -58,6 +58,12 @@ char trace_file[] = "ProjectApollo MSS.log";
 DLLCLBK void InitModule(HINSTANCE hModule) {
 
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
+}
+
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+
+	TraceLog::Close();
 }
 
 
@@ -48,14 +48,19 @@
 #include "CollisionSDK/CollisionSDK.h"
 
 HINSTANCE g_hDLL;
-char trace_file[] = "ProjectApollo VAB.log";
+char trace_file[] = "ProjectApollo VAB.trc";
 
 
 DLLCLBK void InitModule(HINSTANCE hModule) {
 	g_hDLL = hModule;
+	TraceLog::Open(trace_file);
 	InitCollisionSDK();
 }
 
+DLLCLBK void ExitModule(HINSTANCE hModule) {
+	TraceLog::Close();
+}
+
 
 DLLCLBK VESSEL *ovcInit(OBJHANDLE hvessel, int flightmodel) {
 
@@ -42,15 +42,10 @@
 #include "tracer.h"
 #include "saturnv.h"
 #include "../src_rtccmfd/OrbMech.h"
+#include "jobscheduler.h"
 #include "mcc.h"
 #include "rtcc.h"
 
-// This is a threadenwerfer. It werfs threaden.
-static DWORD WINAPI MCC_Trampoline(LPVOID ptr){	
-	MCC *mcc = (MCC *)ptr;
-	return(mcc->subThread());
-}
-
 // SCENARIO FILE MACROLOGY
 #define SAVE_BOOL(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
 #define SAVE_INT(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
@@ -69,6 +64,9 @@ static DWORD WINAPI MCC_Trampoline(LPVOID ptr){
 MCC::MCC(){
 	// Reset data
 	rtcc = NULL;
+	jobs = NULL;
+	subThreadMode = 0;
+	subThreadStatus = 0;
 	cm = NULL;
 	Earth = NULL;
 	Moon = NULL;
@@ -119,11 +117,19 @@ MCC::MCC(){
 	upString[0] = 0;
 }
 
+// DES
+MCC::~MCC(){
+	// Waits for a running calculation, which still refers to our RTCC and PAD.
+	if (jobs != NULL) { delete jobs; jobs = NULL; }
+}
+
 void MCC::Init(Saturn *vs){
 	// Set CM pointer
 	cm = vs;
 	// Make a new RTCC if we don't have one already
 	if (rtcc == NULL) { rtcc = new RTCC; rtcc->Init(this); }
+	// Likewise the worker that runs RTCC calculations for us
+	if (jobs == NULL) { jobs = new JobScheduler(1); }
 
 	// Obtain Earth and Moon pointers
 	Earth = oapiGetGbodyByName("Earth");
@@ -1658,8 +1664,9 @@ int MCC::CM_uplink_buffer() {
 }
 
 // Subthread Entry Point
-int MCC::subThread(){
+int MCC::subThread(int mode){
 	int Result = 0;
+	subThreadMode = mode;
 	subThreadStatus = 2; // Running
 	if (MissionType == MTP_C_PRIME)
 	{
@@ -1902,13 +1909,11 @@ int MCC::subThread(){
 
 // Subthread initiation
 int MCC::startSubthread(int fcn){
-	if(subThreadStatus < 1){
-		// Punt thread
+	if(subThreadStatus < 1 && jobs != NULL){
+		// Hand the calculation to the worker
 		subThreadMode = fcn;
 		subThreadStatus = 1; // Busy
-		DWORD id = 0;
-		HANDLE h = CreateThread(NULL, 0, MCC_Trampoline, this, 0, &id);
-		if(h != NULL){ CloseHandle(h); }
+		jobs->Submit(fcn, JOB_PRIORITY_NORMAL, [this, fcn](JobState &job) { return subThread(fcn); });
 		addMessage("Thread Started");
 	}else{
 		addMessage("Thread Busy");
@@ -595,6 +595,7 @@ struct AP11PDIPAD {
 class MCC {	
 public:
 	MCC();													// Cons
+	~MCC();													// Des
 	void Init(Saturn *vs);									// Initialization
 	void TimeStep(double simdt);					        // Timestep
 	void keyDown(DWORD key);								// Notification of keypress	
@@ -611,7 +612,7 @@ public:
 	void allocPad(int Number);								// Allocate memory for PAD form
 	void freePad();											// Free memory occupied by PAD form
 	void UpdateMacro(int type, bool condition, int updatenumber, int nextupdate);
-	int  subThread();										// Subthread entry point
+	int  subThread(int mode);								// Subthread entry point
 	int startSubthread(int fcn);							// Subthread start request
 	void subThreadMacro(int type, int updatenumber);
 	void enableMissionTracking(){ MT_Enabled = true; GT_Enabled = true; }
@@ -624,6 +625,7 @@ public:
 	OBJHANDLE Moon;											// Handle for the moon
 
 	// SUBTHREAD MANAGEMENT
+	class JobScheduler *jobs;								// Persistent worker running the subthread jobs
 	int subThreadMode;										// What should the subthread do?
 	int subThreadStatus;									// 0 = done/not busy, 1 = busy, negative = done with error
 
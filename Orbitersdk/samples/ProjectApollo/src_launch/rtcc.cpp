@@ -44,6 +44,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "../src_rtccmfd/OrbMech.h"
 #include "../src_rtccmfd/EntryCalculations.h"
 #include "rtcc.h"
+#include "igm.h"
 
 // SCENARIO FILE MACROLOGY
 #define SAVE_BOOL(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
@@ -71,6 +72,7 @@ RTCC::RTCC()
 	calcParams.TLI = 0.0;
 	calcParams.R_TLI = _V(0,0,0);
 	calcParams.V_TLI = _V(0,0,0);
+	padCoastNext = 0;
 }
 
 void RTCC::Init(MCC *ptr)
@@ -1450,6 +1452,7 @@ bool RTCC::CalculationMTP_C(int fcn, LPVOID &pad, char * upString, char * upDesc
 		cdhopt.TIG = 28 * 60 * 60;
 		cdhopt.target = calcParams.tgt;
 		cdhopt.vessel = calcParams.src;
+		cdhopt.propagator = COAST_AUTO;
 
 		CDHcalc(&cdhopt, dV_LVLH, P30TIG);
 
@@ -3075,7 +3078,7 @@ void RTCC::AP11ManeuverPAD(AP11ManPADOpt *opt, AP11MNV &pad)
 {
 	MATRIX3 Q_Xx, M_R, M, M_RTM;
 	VECTOR3 V_G, X_B, UX, UY, UZ, IMUangles, GDCangles;
-	double dt, LMmass, F, v_e, headsswitch, mu, apo, peri, ManPADApo, ManPADPeri, ManPADPTrim, ManPADYTrim, p_T, y_T, ManPADDVC, ManPADBurnTime;
+	double LMmass, F, v_e, headsswitch, mu, apo, peri, ManPADApo, ManPADPeri, ManPADPTrim, ManPADYTrim, p_T, y_T, ManPADDVC, ManPADBurnTime;
 	double Mantrunnion, Manshaft, ManBSSpitch, ManBSSXPos;
 	int GDCset, Manstaroct, ManCOASstaroct;
 	SV sv, sv1, sv2;
@@ -3089,9 +3092,7 @@ void RTCC::AP11ManeuverPAD(AP11ManPADOpt *opt, AP11MNV &pad)
 		sv = StateVectorCalc(opt->vessel);
 	}
 
-	dt = opt->TIG - (sv.MJD - opt->GETbase) * 24.0 * 60.0 * 60.0;
-
-	sv1 = coast(sv, dt);
+	sv1 = PADCoast(sv, opt->GETbase + opt->TIG / 24.0 / 3600.0);
 
 	if (opt->vesseltype == 1)
 	{
@@ -3114,7 +3115,7 @@ void RTCC::AP11ManeuverPAD(AP11ManPADOpt *opt, AP11MNV &pad)
 	}
 
 	//Execute maneuver, output state vector at cutoff
-	sv2 = ExecuteManeuver(opt->vessel, opt->GETbase, opt->TIG, opt->dV_LVLH, sv1, LMmass, Q_Xx, V_G, F, v_e);
+	sv2 = PADExecuteManeuver(opt->vessel, opt->GETbase, opt->TIG, opt->dV_LVLH, sv1, LMmass, Q_Xx, V_G, F, v_e);
 
 	mu = GGRAV*oapiGetMass(sv1.gravref);
 
@@ -3183,13 +3184,11 @@ void RTCC::AP11ManeuverPAD(AP11ManPADOpt *opt, AP11MNV &pad)
 
 	GDCangles = OrbMech::backupgdcalignment(opt->REFSMMAT, sv1.R, oapiGetSize(sv1.gravref), GDCset);
 
-	VECTOR3 Rsxt, Vsxt;
+	SV svSxtCheck;
 
-	OrbMech::oneclickcoast(sv1.R, sv1.V, sv1.MJD, opt->sxtstardtime*60.0, Rsxt, Vsxt, sv1.gravref, sv1.gravref);
-
-	OrbMech::checkstar(opt->REFSMMAT, _V(OrbMech::round(IMUangles.x*DEG)*RAD, OrbMech::round(IMUangles.y*DEG)*RAD, OrbMech::round(IMUangles.z*DEG)*RAD), Rsxt, oapiGetSize(sv1.gravref), Manstaroct, Mantrunnion, Manshaft);
+	svSxtCheck = PADCoast(sv1, sv1.MJD + opt->sxtstardtime*60.0 / 24.0 / 3600.0, sv1.gravref);
 
-	OrbMech::coascheckstar(opt->REFSMMAT, _V(OrbMech::round(IMUangles.x*DEG)*RAD, OrbMech::round(IMUangles.y*DEG)*RAD, OrbMech::round(IMUangles.z*DEG)*RAD), Rsxt, oapiGetSize(sv1.gravref), ManCOASstaroct, ManBSSpitch, ManBSSXPos);
+	PADStarCheck(opt->REFSMMAT, _V(OrbMech::round(IMUangles.x*DEG)*RAD, OrbMech::round(IMUangles.y*DEG)*RAD, OrbMech::round(IMUangles.z*DEG)*RAD), svSxtCheck.R, oapiGetSize(sv1.gravref), Manstaroct, Mantrunnion, Manshaft, ManCOASstaroct, ManBSSpitch, ManBSSXPos);
 
 	pad.Att = _V(OrbMech::imulimit(IMUangles.x*DEG), OrbMech::imulimit(IMUangles.y*DEG), OrbMech::imulimit(IMUangles.z*DEG));
 	pad.BSSStar = ManCOASstaroct;
@@ -3251,7 +3250,7 @@ void RTCC::AP7ManeuverPAD(AP7ManPADOpt *opt, AP7MNV &pad)
 {
 	MATRIX3 Q_Xx, M, M_R, M_RTM;
 	VECTOR3 V_G, X_B, UX, UY, UZ, Att;
-	double dt, LMmass, v_e, F, mu, headsswitch, apo, peri, ManPADApo, ManPADPeri, ManPADPTrim, ManPADYTrim, y_T, p_T;
+	double LMmass, v_e, F, mu, headsswitch, apo, peri, ManPADApo, ManPADPeri, ManPADPTrim, ManPADYTrim, y_T, p_T;
 	SV sv, sv1, sv2;
 
 	if (opt->useSV)
@@ -3263,8 +3262,7 @@ void RTCC::AP7ManeuverPAD(AP7ManPADOpt *opt, AP7MNV &pad)
 		sv = StateVectorCalc(opt->vessel);
 	}
 
-	dt = opt->TIG - (sv.MJD - opt->GETbase) * 24.0 * 60.0 * 60.0;
-	sv1 = coast(sv, dt);
+	sv1 = PADCoast(sv, opt->GETbase + opt->TIG / 24.0 / 3600.0);
 
 	if (opt->vesseltype == 1)
 	{
@@ -3287,7 +3285,7 @@ void RTCC::AP7ManeuverPAD(AP7ManPADOpt *opt, AP7MNV &pad)
 	}
 
 	//Execute maneuver, output state vector at cutoff
-	sv2 = ExecuteManeuver(opt->vessel, opt->GETbase, opt->TIG, opt->dV_LVLH, sv1, LMmass, Q_Xx, V_G, F, v_e);
+	sv2 = PADExecuteManeuver(opt->vessel, opt->GETbase, opt->TIG, opt->dV_LVLH, sv1, LMmass, Q_Xx, V_G, F, v_e);
 
 	mu = GGRAV*oapiGetMass(sv1.gravref);
 
@@ -3356,11 +3354,11 @@ void RTCC::AP7ManeuverPAD(AP7ManPADOpt *opt, AP7MNV &pad)
 
 	//GDCangles = OrbMech::backupgdcalignment(REFSMMAT, R1B, oapiGetSize(gravref), GDCset);
 
-	VECTOR3 Rsxt, Vsxt;
+	SV svSxtCheck;
 
-	OrbMech::oneclickcoast(sv1.R, sv1.V, sv1.MJD, opt->sxtstardtime, Rsxt, Vsxt, sv1.gravref, sv1.gravref);
+	svSxtCheck = PADCoast(sv1, sv1.MJD + opt->sxtstardtime / 24.0 / 3600.0, sv1.gravref);
 
-	OrbMech::checkstar(opt->REFSMMAT, _V(round(Att.x*DEG)*RAD, round(Att.y*DEG)*RAD, round(Att.z*DEG)*RAD), Rsxt, oapiGetSize(sv1.gravref), pad.Star, pad.Trun, pad.Shaft);
+	PADStarCheck(opt->REFSMMAT, _V(round(Att.x*DEG)*RAD, round(Att.y*DEG)*RAD, round(Att.z*DEG)*RAD), svSxtCheck.R, oapiGetSize(sv1.gravref), pad.Star, pad.Trun, pad.Shaft);
 
 	if (opt->navcheckGET != 0.0)
 	{
@@ -3505,7 +3503,7 @@ void RTCC::EarthOrbitEntry(EarthEntryPADOpt *opt, AP7ENT &pad)
 	double dt2; //from shutdown to EI
 	double dt3; //from EI to 300k
 	double dt4; //from 300k to 0.05g
-	VECTOR3 R_A, V_A, R0B, V0B, R1B, V1B, UX, UY, UZ, DV_P, DV_C, V_G, R2B, V2B, R05G, V05G, EIangles, REI, VEI, R300K, V300K;
+	VECTOR3 R_A, V_A, R0B, V0B, R1B, V1B, UX, UY, UZ, DV_P, DV_C, V_G, R2B, V2B, R05G, V05G, EIangles, REI, VEI;
 	MATRIX3 M_R;
 	OBJHANDLE gravref;
 	Entry* entry;
@@ -3531,8 +3529,18 @@ void RTCC::EarthOrbitEntry(EarthEntryPADOpt *opt, AP7ENT &pad)
 		F = opt->vessel->GetThrusterMax0(opt->vessel->GetGroupThruster(THGROUP_MAIN, 0));
 		v_e = opt->vessel->GetThrusterIsp0(opt->vessel->GetGroupThruster(THGROUP_MAIN, 0));
 
+		SV sv0, sv1, sv2, svEI, sv300K, sv05G;
+
+		sv0.R = R0B;
+		sv0.V = V0B;
+		sv0.MJD = SVMJD;
+		sv0.gravref = gravref;
+		sv0.mass = opt->vessel->GetMass();
+
 		dt = opt->P30TIG - (SVMJD - opt->GETbase) * 24.0 * 60.0 * 60.0;
-		OrbMech::oneclickcoast(R0B, V0B, SVMJD, dt, R1B, V1B, gravref, gravref);
+		sv1 = PADCoast(sv0, opt->GETbase + opt->P30TIG / 24.0 / 3600.0, gravref);
+		R1B = sv1.R;
+		V1B = sv1.V;
 
 		UY = unit(crossp(V1B, R1B));
 		UZ = unit(-R1B);
@@ -3545,12 +3553,23 @@ void RTCC::EarthOrbitEntry(EarthEntryPADOpt *opt, AP7ENT &pad)
 		//opt->vessel->GetGroupThruster(THGROUP_MAIN, 0),
 		OrbMech::poweredflight(R1B, V1B, SVMJD + dt / 24.0 / 3600.0, gravref, F, v_e, opt->vessel->GetMass(), V_G, R2B, V2B, m_cut, t_go);
 
-		dt2 = OrbMech::time_radius_integ(R2B, V2B, SVMJD + (dt + t_go) / 3600.0 / 24.0, oapiGetSize(gravref) + EIAlt, -1, gravref, gravref, REI, VEI);
-		dt3 = OrbMech::time_radius_integ(REI, VEI, SVMJD + (dt + t_go + dt2) / 3600.0 / 24.0, oapiGetSize(gravref) + 300000.0*0.3048, -1, gravref, gravref, R300K, V300K);
-		dt4 = OrbMech::time_radius_integ(R300K, V300K, SVMJD + (dt + t_go + dt2 + dt3) / 3600.0 / 24.0, oapiGetSize(gravref) + EMSAlt, -1, gravref, gravref, R05G, V05G);
+		sv2.R = R2B;
+		sv2.V = V2B;
+		sv2.MJD = SVMJD + (dt + t_go) / 3600.0 / 24.0;
+		sv2.gravref = gravref;
+		sv2.mass = m_cut;
+
+		PADEntryStates(sv2, gravref, EIAlt, 300000.0*0.3048, EMSAlt, svEI, sv300K, sv05G);
+		REI = svEI.R;
+		VEI = svEI.V;
+		R05G = sv05G.R;
+		V05G = sv05G.V;
+		dt2 = (svEI.MJD - sv2.MJD)*24.0*3600.0;
+		dt3 = (sv300K.MJD - svEI.MJD)*24.0*3600.0;
+		dt4 = (sv05G.MJD - sv300K.MJD)*24.0*3600.0;
 
 		entry = new Entry(gravref, 0);
-		entry->Reentry(REI, VEI, SVMJD + (dt + t_go + dt2) / 3600.0 / 24.0);
+		entry->Reentry(REI, VEI, svEI.MJD);
 
 		lat = entry->EntryLatPred;
 		lng = entry->EntryLngPred;
@@ -3608,17 +3627,29 @@ void RTCC::EarthOrbitEntry(EarthEntryPADOpt *opt, AP7ENT &pad)
 		pad.Ret05[0] = t_go + dt2 + dt3 + dt4;
 		pad.RTGO[0] = theta_rad*3437.7468;//entry->EntryRTGO;
 		pad.VIO[0] = entry->EntryVIO / 0.3048;
+
+		delete entry;
 	}
 	else
 	{
 		double EMSTime, LSMJD, dt5, theta_rad, theta_nm;
 		VECTOR3 R_P, R_LS;
 		MATRIX3 Rot2;
+		SV sv0, svEI, sv300K, sv05G;
+
+		sv0.R = R0B;
+		sv0.V = V0B;
+		sv0.MJD = SVMJD;
+		sv0.gravref = gravref;
+		sv0.mass = opt->vessel->GetMass();
 
 		dt = opt->P30TIG - (SVMJD - opt->GETbase) * 24.0 * 60.0 * 60.0;
-		dt2 = OrbMech::time_radius_integ(R0B, V0B, SVMJD, oapiGetSize(gravref) + EIAlt, -1, gravref, gravref, REI, VEI);
-		dt3 = OrbMech::time_radius_integ(REI, VEI, SVMJD + dt2 / 24.0 / 3600.0, oapiGetSize(gravref) + 300000.0*0.3048, -1, gravref, gravref, R300K, V300K);
-		dt4 = OrbMech::time_radius_integ(R300K, V300K, SVMJD + (dt2 + dt3) / 24.0 / 3600.0, oapiGetSize(gravref) + EMSAlt, -1, gravref, gravref, R05G, V05G);
+		PADEntryStates(sv0, gravref, EIAlt, 300000.0*0.3048, EMSAlt, svEI, sv300K, sv05G);
+		R05G = sv05G.R;
+		V05G = sv05G.V;
+		dt2 = (svEI.MJD - sv0.MJD)*24.0*3600.0;
+		dt3 = (sv300K.MJD - svEI.MJD)*24.0*3600.0;
+		dt4 = (sv05G.MJD - sv300K.MJD)*24.0*3600.0;
 
 		UX = unit(V05G);
 		UY = unit(crossp(UX, R05G));
@@ -3688,7 +3719,7 @@ void RTCC::LunarEntryPAD(LunarEntryPADOpt *opt, AP11ENT &pad)
 {
 	VECTOR3 R_A, V_A, R0B, V0B, R_P, R_LS, URT0, UUZ, RTE, UTR, urh, URT, UX, UY, UZ, EIangles, UREI;
 	MATRIX3 M_R, Rot2;
-	double SVMJD, dt, dt2, dt3, EIAlt, Alt300K, EMSAlt, S_FPA, g_T, V_T, v_BAR, RET05, liftline, EntryPADV400k, EntryPADVIO;
+	double SVMJD, EIAlt, Alt300K, EMSAlt, S_FPA, g_T, V_T, v_BAR, RET05, liftline, EntryPADV400k, EntryPADVIO;
 	double WIE, WT, LSMJD, theta_rad, theta_nm, EntryPADDO, EntryPADGMax, EntryPADgamma400k, EntryPADHorChkGET, EIGET, EntryPADHorChkPit;
 	OBJHANDLE gravref, hEarth;
 	SV sv0;		// "Now"
@@ -3719,21 +3750,17 @@ void RTCC::LunarEntryPAD(LunarEntryPADOpt *opt, AP11ENT &pad)
 
 	if (opt->direct)
 	{
-		dt = OrbMech::time_radius_integ(sv0.R, sv0.V, sv0.MJD, oapiGetSize(hEarth) + EIAlt, -1, sv0.gravref, hEarth, svEI.R, svEI.V);
-		svEI.gravref = hEarth;
-		svEI.mass = sv0.mass;
-		svEI.MJD = sv0.MJD + dt / 24.0 / 3600.0;
+		PADEntryStates(sv0, hEarth, EIAlt, Alt300K, EMSAlt, svEI, sv300K, sv05G);
 	}
 	else
 	{
 		SV sv1;
+		MATRIX3 Q_Xx;
+		VECTOR3 V_G;
 
-		sv1 = ExecuteManeuver(opt->vessel, opt->GETbase, opt->P30TIG, opt->dV_LVLH, sv0, 0);
+		sv1 = PADExecuteManeuver(opt->vessel, opt->GETbase, opt->P30TIG, opt->dV_LVLH, sv0, 0, Q_Xx, V_G);
 
-		dt = OrbMech::time_radius_integ(sv1.R, sv1.V, sv1.MJD, oapiGetSize(hEarth) + EIAlt, -1, sv1.gravref, hEarth, svEI.R, svEI.V);
-		svEI.gravref = hEarth;
-		svEI.mass = sv1.mass;
-		svEI.MJD = sv1.MJD + dt / 24.0 / 3600.0;
+		PADEntryStates(sv1, hEarth, EIAlt, Alt300K, EMSAlt, svEI, sv300K, sv05G);
 	}
 
 	entry = new Entry(gravref, 1);
@@ -3743,16 +3770,6 @@ void RTCC::LunarEntryPAD(LunarEntryPADOpt *opt, AP11ENT &pad)
 
 	delete entry;
 
-	dt2 = OrbMech::time_radius_integ(svEI.R, svEI.V, svEI.MJD, oapiGetSize(hEarth) + Alt300K, -1, hEarth, hEarth, sv300K.R, sv300K.V);
-	sv300K.gravref = hEarth;
-	sv300K.mass = svEI.mass;
-	sv300K.MJD = svEI.MJD + dt2 / 24.0 / 3600.0;
-
-	dt3 = OrbMech::time_radius_integ(sv300K.R, sv300K.V, sv300K.MJD, oapiGetSize(hEarth) + EMSAlt, -1, hEarth, hEarth, sv05G.R, sv05G.V);
-	sv05G.gravref = hEarth;
-	sv05G.mass = sv300K.mass;
-	sv05G.MJD = sv300K.MJD + dt3 / 24.0 / 3600.0;
-
 	EntryPADVIO = length(sv05G.V);
 
 	R_P = unit(_V(cos(opt->lng)*cos(opt->lat), sin(opt->lat), sin(opt->lng)*cos(opt->lat)));
@@ -3817,15 +3834,14 @@ void RTCC::LunarEntryPAD(LunarEntryPADOpt *opt, AP11ENT &pad)
 	}
 
 	SV svHorCheck, svSxtCheck;
-	svHorCheck = coast(svEI, -17.0*60.0);
-	svSxtCheck = coast(svEI, -60.0*60.0);
+	svHorCheck = PADCoast(svEI, svEI.MJD - 17.0*60.0 / 24.0 / 3600.0);
+	svSxtCheck = PADCoast(svEI, svEI.MJD - 60.0*60.0 / 24.0 / 3600.0);
 
 	EntryPADHorChkGET = EIGET - 17.0*60.0;
 
 	double Entrytrunnion, Entryshaft, EntryBSSpitch, EntryBSSXPos;
 	int Entrystaroct, EntryCOASstaroct;
-	OrbMech::checkstar(opt->REFSMMAT, _V(OrbMech::round(EIangles.x*DEG)*RAD, OrbMech::round(EIangles.y*DEG)*RAD, OrbMech::round(EIangles.z*DEG)*RAD), svSxtCheck.R, oapiGetSize(hEarth), Entrystaroct, Entrytrunnion, Entryshaft);
-	OrbMech::coascheckstar(opt->REFSMMAT, _V(OrbMech::round(EIangles.x*DEG)*RAD, OrbMech::round(EIangles.y*DEG)*RAD, OrbMech::round(EIangles.z*DEG)*RAD), svSxtCheck.R, oapiGetSize(hEarth), EntryCOASstaroct, EntryBSSpitch, EntryBSSXPos);
+	PADStarCheck(opt->REFSMMAT, _V(OrbMech::round(EIangles.x*DEG)*RAD, OrbMech::round(EIangles.y*DEG)*RAD, OrbMech::round(EIangles.z*DEG)*RAD), svSxtCheck.R, oapiGetSize(hEarth), Entrystaroct, Entrytrunnion, Entryshaft, EntryCOASstaroct, EntryBSSpitch, EntryBSSXPos);
 
 	double horang, coastang, IGA, cosIGA, sinIGA;
 	VECTOR3 X_NB, Y_NB, Z_NB, X_SM, Y_SM, Z_SM, A_MG;
@@ -4315,14 +4331,16 @@ double RTCC::CDHcalc(CDHOpt *opt, VECTOR3 &dV_LVLH, double &P30TIG)			//Calculat
 	}
 	else
 	{
+		CoastPropagator prop(opt->propagator);
+
 		dt = opt->TIG - (SVMJD - opt->GETbase) * 24 * 60 * 60;
 
 		dt2 = dt + 10.0;							//A secant search method is used to find the time, when the desired delta height is reached. Other values might work better.
 
 		while (abs(dt2 - dt) > 0.1)					//0.1 seconds accuracy should be enough
 		{
-			c1 = OrbMech::NSRsecant(RA0, VA0, RP0, VP0, SVMJD, dt, opt->DH, gravref);		//c is the difference between desired and actual DH
-			c2 = OrbMech::NSRsecant(RA0, VA0, RP0, VP0, SVMJD, dt2, opt->DH, gravref);
+			c1 = OrbMech::NSRsecant(RA0, VA0, RP0, VP0, SVMJD, dt, opt->DH, gravref, &prop);		//c is the difference between desired and actual DH
+			c2 = OrbMech::NSRsecant(RA0, VA0, RP0, VP0, SVMJD, dt2, opt->DH, gravref, &prop);
 
 			dt2_apo = dt2 - (dt2 - dt) / (c2 - c1)*c2;						//secant method
 			dt = dt2;
@@ -4449,7 +4467,8 @@ double RTCC::lambertelev(VESSEL* vessel, VESSEL* target, double GETbase, double
 	RP0 = _V(RP0_orb.x, RP0_orb.z, RP0_orb.y);
 	VP0 = _V(VP0_orb.x, VP0_orb.z, VP0_orb.y);
 
-	dt1 = OrbMech::findelev(RA0, VA0, RP0, VP0, SVMJD, elev, gravref);
+	CoastPropagator prop(COAST_AUTO);
+	dt1 = OrbMech::findelev(RA0, VA0, RP0, VP0, SVMJD, elev, gravref, &prop);
 
 	return dt1 + (SVMJD - GETbase) * 24.0 * 60.0 * 60.0;
 }
@@ -5711,6 +5730,193 @@ SV RTCC::coast(SV sv0, double dt)
 	return sv1;
 }
 
+bool RTCC::PADSameStateVector(SV sv_cache, SV sv)
+{
+	//Same state vector, e.g. the MCC state vector or the one saved on the MFD
+	return (sv_cache.gravref == sv.gravref && sv_cache.mass == sv.mass && sv_cache.MJD == sv.MJD &&
+		sv_cache.R.x == sv.R.x && sv_cache.R.y == sv.R.y && sv_cache.R.z == sv.R.z && sv_cache.V.x == sv.V.x && sv_cache.V.y == sv.V.y && sv_cache.V.z == sv.V.z);
+}
+
+SV RTCC::PADCoast(SV sv0, double MJD, OBJHANDLE gravout)
+{
+	PADCoastCache cache[PAD_CACHE_COAST_SLOTS];
+	SV sv1;
+
+	{
+		std::lock_guard<std::mutex> guard(padCacheLock);
+		for (int i = 0;i < PAD_CACHE_COAST_SLOTS;i++)
+		{
+			cache[i] = padCoast[i];
+		}
+	}
+
+	for (int i = 0;i < PAD_CACHE_COAST_SLOTS;i++)
+	{
+		if (cache[i].valid && cache[i].MJD == MJD && cache[i].gravout == gravout && PADSameStateVector(cache[i].sv_in, sv0))
+		{
+			return cache[i].sv_out;
+		}
+	}
+
+	sv1.gravref = gravout;
+	OrbMech::oneclickcoast(sv0.R, sv0.V, sv0.MJD, (MJD - sv0.MJD)*24.0*3600.0, sv1.R, sv1.V, sv0.gravref, sv1.gravref);
+	sv1.mass = sv0.mass;
+	sv1.MJD = MJD;
+
+	std::lock_guard<std::mutex> guard(padCacheLock);
+	padCoast[padCoastNext].valid = true;
+	padCoast[padCoastNext].sv_in = sv0;
+	padCoast[padCoastNext].MJD = MJD;
+	padCoast[padCoastNext].gravout = gravout;
+	padCoast[padCoastNext].sv_out = sv1;
+	padCoastNext = (padCoastNext + 1) % PAD_CACHE_COAST_SLOTS;
+
+	return sv1;
+}
+
+SV RTCC::PADExecuteManeuver(VESSEL* vessel, double GETbase, double P30TIG, VECTOR3 dV_LVLH, SV sv, double attachedMass, MATRIX3 &Q_Xx, VECTOR3 &V_G, double F, double isp)
+{
+	PADBurnCache cache;
+
+	{
+		std::lock_guard<std::mutex> guard(padCacheLock);
+		cache = padBurn;
+	}
+
+	if (cache.valid && cache.vessel == vessel && cache.GETbase == GETbase && cache.P30TIG == P30TIG && cache.attachedMass == attachedMass && cache.F == F && cache.isp == isp &&
+		cache.dV_LVLH.x == dV_LVLH.x && cache.dV_LVLH.y == dV_LVLH.y && cache.dV_LVLH.z == dV_LVLH.z && PADSameStateVector(cache.sv_in, sv))
+	{
+		Q_Xx = cache.Q_Xx;
+		V_G = cache.V_G;
+		return cache.sv_out;
+	}
+
+	cache.sv_out = ExecuteManeuver(vessel, GETbase, P30TIG, dV_LVLH, sv, attachedMass, cache.Q_Xx, cache.V_G, F, isp);
+	cache.valid = true;
+	cache.vessel = vessel;
+	cache.sv_in = sv;
+	cache.GETbase = GETbase;
+	cache.P30TIG = P30TIG;
+	cache.attachedMass = attachedMass;
+	cache.F = F;
+	cache.isp = isp;
+	cache.dV_LVLH = dV_LVLH;
+
+	Q_Xx = cache.Q_Xx;
+	V_G = cache.V_G;
+
+	std::lock_guard<std::mutex> guard(padCacheLock);
+	padBurn = cache;
+
+	return cache.sv_out;
+}
+
+PADStarCheckCache RTCC::PADStarCheckRun(MATRIX3 REFSMMAT, VECTOR3 IMUangles, VECTOR3 R, double R_E, bool coas)
+{
+	PADStarCheckCache cache;
+	bool hit;
+
+	{
+		std::lock_guard<std::mutex> guard(padCacheLock);
+		cache = padStarCheck;
+	}
+
+	hit = cache.valid && (cache.coas || !coas) && cache.R_E == R_E && cache.IMUangles.x == IMUangles.x && cache.IMUangles.y == IMUangles.y && cache.IMUangles.z == IMUangles.z &&
+		cache.R.x == R.x && cache.R.y == R.y && cache.R.z == R.z && memcmp(&cache.REFSMMAT, &REFSMMAT, sizeof(MATRIX3)) == 0;
+
+	if (!hit)
+	{
+		OrbMech::checkstar(REFSMMAT, IMUangles, R, R_E, cache.staroct, cache.trunnion, cache.shaft);
+		if (coas)
+		{
+			OrbMech::coascheckstar(REFSMMAT, IMUangles, R, R_E, cache.COASstaroct, cache.BSSpitch, cache.BSSXPos);
+		}
+		cache.valid = true;
+		cache.coas = coas;
+		cache.REFSMMAT = REFSMMAT;
+		cache.IMUangles = IMUangles;
+		cache.R = R;
+		cache.R_E = R_E;
+
+		std::lock_guard<std::mutex> guard(padCacheLock);
+		padStarCheck = cache;
+	}
+
+	return cache;
+}
+
+void RTCC::PADStarCheck(MATRIX3 REFSMMAT, VECTOR3 IMUangles, VECTOR3 R, double R_E, int &staroct, double &trunnion, double &shaft)
+{
+	PADStarCheckCache cache = PADStarCheckRun(REFSMMAT, IMUangles, R, R_E, false);
+
+	staroct = cache.staroct;
+	trunnion = cache.trunnion;
+	shaft = cache.shaft;
+}
+
+void RTCC::PADStarCheck(MATRIX3 REFSMMAT, VECTOR3 IMUangles, VECTOR3 R, double R_E, int &staroct, double &trunnion, double &shaft, int &COASstaroct, double &BSSpitch, double &BSSXPos)
+{
+	PADStarCheckCache cache = PADStarCheckRun(REFSMMAT, IMUangles, R, R_E, true);
+
+	staroct = cache.staroct;
+	trunnion = cache.trunnion;
+	shaft = cache.shaft;
+	COASstaroct = cache.COASstaroct;
+	BSSpitch = cache.BSSpitch;
+	BSSXPos = cache.BSSXPos;
+}
+
+void RTCC::PADEntryStates(SV sv0, OBJHANDLE hEarth, double EIAlt, double Alt300K, double EMSAlt, SV &svEI, SV &sv300K, SV &sv05G)
+{
+	//sv0: state vector after the last maneuver
+	//hEarth: reference for the entry states
+	//EIAlt, Alt300K, EMSAlt: altitudes of the entry interface, 300K and EMS/0.05G states
+
+	PADEntryCache cache;
+	double dt;
+
+	{
+		std::lock_guard<std::mutex> guard(padCacheLock);
+		cache = padEntry;
+	}
+
+	if (cache.valid && cache.hEarth == hEarth && cache.EIAlt == EIAlt && cache.Alt300K == Alt300K && cache.EMSAlt == EMSAlt && PADSameStateVector(cache.sv_in, sv0))
+	{
+		svEI = cache.svEI;
+		sv300K = cache.sv300K;
+		sv05G = cache.sv05G;
+		return;
+	}
+
+	dt = OrbMech::time_radius_integ(sv0.R, sv0.V, sv0.MJD, oapiGetSize(hEarth) + EIAlt, -1, sv0.gravref, hEarth, svEI.R, svEI.V);
+	svEI.gravref = hEarth;
+	svEI.mass = sv0.mass;
+	svEI.MJD = sv0.MJD + dt / 24.0 / 3600.0;
+
+	dt = OrbMech::time_radius_integ(svEI.R, svEI.V, svEI.MJD, oapiGetSize(hEarth) + Alt300K, -1, hEarth, hEarth, sv300K.R, sv300K.V);
+	sv300K.gravref = hEarth;
+	sv300K.mass = svEI.mass;
+	sv300K.MJD = svEI.MJD + dt / 24.0 / 3600.0;
+
+	dt = OrbMech::time_radius_integ(sv300K.R, sv300K.V, sv300K.MJD, oapiGetSize(hEarth) + EMSAlt, -1, hEarth, hEarth, sv05G.R, sv05G.V);
+	sv05G.gravref = hEarth;
+	sv05G.mass = sv300K.mass;
+	sv05G.MJD = sv300K.MJD + dt / 24.0 / 3600.0;
+
+	cache.valid = true;
+	cache.sv_in = sv0;
+	cache.hEarth = hEarth;
+	cache.EIAlt = EIAlt;
+	cache.Alt300K = Alt300K;
+	cache.EMSAlt = EMSAlt;
+	cache.svEI = svEI;
+	cache.sv300K = sv300K;
+	cache.sv05G = sv05G;
+
+	std::lock_guard<std::mutex> guard(padCacheLock);
+	padEntry = cache;
+}
+
 void RTCC::GetTLIParameters(VECTOR3 &RIgn_global, VECTOR3 &VIgn_global, VECTOR3 &dV_LVLH, double &IgnMJD)
 {
 	VECTOR3 RIgn, VIgn;
@@ -5804,27 +6010,47 @@ void RTCC::LVDCTLIPredict(LVDCTLIparam lvdc, VESSEL* vessel, double GETbase, VEC
 	MJD_TST = MJD_GRR + (lvdc.TB5 + lvdc.T_ST) / 24.0 / 3600.0;
 	OrbMech::oneclickcoast(R0, V0, SVMJD, (MJD_TST - SVMJD) * 24.0 * 3600.0, R1, V1, gravref, gravref);
 
+	//Search the restart window in coarse steps, carrying the state along instead of coasting
+	//from R1 again for every second. The TB6 condition holds for much longer than one coarse
+	//step once it's met, so the first second that passes it lies in the last coarse step.
+	VECTOR3 R_last, V_last;
+	double step = 10.0;
+
 	dt = 0;
+	R2 = R1;
+	V2 = V1;
 
-	do
+	while (true)
 	{
-		OrbMech::oneclickcoast(R1, V1, MJD_TST, dt, R2, V2, gravref, gravref);
-		//R2 = tmul(Rot, R2);
-		//V2 = tmul(Rot, V2);
-		R2 = _V(R2.x, R2.z, R2.y);
-		V2 = _V(V2.x, V2.z, V2.y);
-		PosS = mul(mat, R2);
-		DotS = mul(mat, V2);
-		//OrbMech::rv_from_r0v0(R1, V1, dt, PosS, DotS, mu_E);
+		PosS = mul(mat, _V(R2.x, R2.z, R2.y));
+		DotS = mul(mat, _V(V2.x, V2.z, V2.y));
 		N = unit(crossp(PosS, DotS));
 		PosP = crossp(N, unit(PosS));
 		Sbar = unit(PosS)*cos(lvdc.beta) + PosP*sin(lvdc.beta);
 		DotP = crossp(N, DotS / Mag(PosS));
 
 		Sbardot = DotS / Mag(PosS)*cos(lvdc.beta) + DotP*sin(lvdc.beta);
-		dt += 1.0;
 
-	} while (!((dotp(Sbardot, T_P) < 0 && dotp(Sbar, T_P) <= cos(lvdc.alpha_TS))));
+		if (dotp(Sbardot, T_P) < 0 && dotp(Sbar, T_P) <= cos(lvdc.alpha_TS))
+		{
+			if (step == 1.0 || dt == 0.0)
+			{
+				break;
+			}
+			//Back up and go through the last coarse step one second at a time
+			dt -= step;
+			R2 = R_last;
+			V2 = V_last;
+			step = 1.0;
+		}
+
+		R_last = R2;
+		V_last = V2;
+		OrbMech::oneclickcoast(R_last, V_last, MJD_TST + dt / 24.0 / 3600.0, step, R2, V2, gravref, gravref);
+		dt += step;
+	}
+	//The old one second search counted one past the matching state
+	dt += 1.0;
 
 	//Advance to Ignition State
 	OrbMech::rv_from_r0v0(PosS, DotS, lvdc.T_RG, PosS, DotS, mu_E);
@@ -5859,6 +6085,7 @@ void RTCC::LVDCTLIPredict(LVDCTLIparam lvdc, VESSEL* vessel, double GETbase, VEC
 
 	double Fs, V_ex, mass, a_T, tau, t_go, V, sin_gam, cos_gam, dot_phi_1, dot_phi_T, phi_T, xi_T, dot_zeta_T, dot_xi_T, ddot_zeta_GT, ddot_xi_GT, m0, m1, dt1;
 	double dot_dxit, dot_detat, dot_dzetat, dV, dT, f, L, dL;
+	IGMIntegrals I;
 	VECTOR3 Pos4, PosXEZ, DotXEZ, ddotG_act, DDotXEZ_G;
 	MATRIX3 MX_phi_T, MX_K;
 
@@ -5881,7 +6108,8 @@ void RTCC::LVDCTLIPredict(LVDCTLIparam lvdc, VESSEL* vessel, double GETbase, VEC
 		Pos4 = mul(MX_G, PosS);
 
 
-		L = V_ex * log(tau / (tau - t_go));
+		IGMStageIntegrals(V_ex, tau, t_go, I);
+		L = I.L;
 
 		V = length(DotS);
 		R = length(PosS);
@@ -26,6 +26,8 @@ See http://nassp.sourceforge.net/license/ for more details.
 #define RTCC_START_STRING	"RTCC_BEGIN"
 #define RTCC_END_STRING	    "RTCC_END"
 
+#include <mutex>
+
 #define RTCC_LAMBERT_MULTIAXIS 0
 #define RTCC_LAMBERT_XAXIS 1
 
@@ -204,6 +206,7 @@ struct CDHOpt
 	int CDHtimemode; //0 = Fixed Time, 1 = Find GETI
 	double TIG; // (Estimated) Time of Ignition
 	int impulsive; //Calculated with nonimpulsive maneuver compensation or without
+	int propagator; //Coasting during the GETI search: COAST_NUMERICAL, COAST_ANALYTIC or COAST_AUTO
 };
 
 struct AP7BLKOpt
@@ -358,6 +361,54 @@ struct LVDCTLIparam
 	double T_ST;
 };
 
+//PAD calculation cache. The PADs are usually recalculated with only one input changed (TIG, DV,
+//REFSMMAT, ...), so every expensive stage remembers the inputs it was last run with and is only
+//run again when one of them changes.
+
+#define PAD_CACHE_COAST_SLOTS 4
+
+struct PADCoastCache
+{
+	bool valid = false;
+	SV sv_in;
+	double MJD;				//Epoch coasted to
+	OBJHANDLE gravout;		//Requested output reference, NULL = automatic
+	SV sv_out;
+};
+
+struct PADBurnCache
+{
+	bool valid = false;
+	VESSEL *vessel;
+	SV sv_in;
+	double GETbase, P30TIG, attachedMass, F, isp;
+	VECTOR3 dV_LVLH;
+	SV sv_out;
+	MATRIX3 Q_Xx;
+	VECTOR3 V_G;
+};
+
+struct PADStarCheckCache
+{
+	bool valid = false;
+	MATRIX3 REFSMMAT;
+	VECTOR3 IMUangles;
+	VECTOR3 R;
+	double R_E;
+	bool coas;				//COAS star check results are valid too
+	int staroct, COASstaroct;
+	double trunnion, shaft, BSSpitch, BSSXPos;
+};
+
+struct PADEntryCache
+{
+	bool valid = false;
+	SV sv_in;
+	OBJHANDLE hEarth;
+	double EIAlt, Alt300K, EMSAlt;
+	SV svEI, sv300K, sv05G;
+};
+
 class RTCC {
 
 	friend class MCC;
@@ -423,6 +474,14 @@ private:
 	SV ExecuteManeuver(VESSEL* vessel, double GETbase, double P30TIG, VECTOR3 dV_LVLH, SV sv, double attachedMass, MATRIX3 &Q_Xx, VECTOR3 &V_G, double F = 0.0, double isp = 0.0);
 	SV coast(SV sv0, double dt);
 
+	//Memoized PAD stages
+	bool PADSameStateVector(SV sv_cache, SV sv);
+	SV PADCoast(SV sv0, double MJD, OBJHANDLE gravout = NULL);
+	SV PADExecuteManeuver(VESSEL* vessel, double GETbase, double P30TIG, VECTOR3 dV_LVLH, SV sv, double attachedMass, MATRIX3 &Q_Xx, VECTOR3 &V_G, double F = 0.0, double isp = 0.0);
+	void PADStarCheck(MATRIX3 REFSMMAT, VECTOR3 IMUangles, VECTOR3 R, double R_E, int &staroct, double &trunnion, double &shaft);
+	void PADStarCheck(MATRIX3 REFSMMAT, VECTOR3 IMUangles, VECTOR3 R, double R_E, int &staroct, double &trunnion, double &shaft, int &COASstaroct, double &BSSpitch, double &BSSXPos);
+	void PADEntryStates(SV sv0, OBJHANDLE hEarth, double EIAlt, double Alt300K, double EMSAlt, SV &svEI, SV &sv300K, SV &sv05G);
+
 	bool CalculationMTP_C(int fcn, LPVOID &pad, char * upString = NULL, char * upDesc = NULL);
 	bool CalculationMTP_C_PRIME(int fcn, LPVOID &pad, char * upString = NULL, char * upDesc = NULL);
 
@@ -430,6 +489,15 @@ protected:
 	double TimeofIgnition;
 	double SplashLatitude, SplashLongitude;
 	VECTOR3 DeltaV_LVLH;
+
+	std::mutex padCacheLock;
+	PADCoastCache padCoast[PAD_CACHE_COAST_SLOTS];
+	int padCoastNext;
+	PADBurnCache padBurn;
+	PADStarCheckCache padStarCheck;
+	PADEntryCache padEntry;
+
+	PADStarCheckCache PADStarCheckRun(MATRIX3 REFSMMAT, VECTOR3 IMUangles, VECTOR3 R, double R_E, bool coas);
 };
 
 
@@ -47,7 +47,7 @@
 
 #include "connector.h"
 
-char trace_file[] = "ProjectApollo LM.log";
+char trace_file[] = "ProjectApollo LM.trc";
 
 
 // ==============================================================
@@ -216,6 +216,8 @@ LEM::LEM(OBJHANDLE hObj, int fmodel) : Payload (hObj, fmodel),
 	DPS(th_hover)
 {
 	dllhandle = g_Param.hDLL; // DS20060413 Save for later
+	TraceLog::Open(trace_file);
+
 	InitLEMCalled = false;
 	SystemsInitialized = 0;
 
@@ -253,6 +255,7 @@ LEM::~LEM()
 		dx8ppv = NULL;
 	}
 
+	TraceLog::Close();
 }
 
 void LEM::Init()
@@ -1218,6 +1221,12 @@ void LEM::clbkLoadStateEx (FILEHANDLE scn, void *vs)
 		else if (!strnicmp (line, "LANG", 4)) {
 			strncpy (AudioLanguage, line + 5, 64);
 		}
+		else if (!strnicmp (line, "PCMRECORD", 9)) {
+			VHF.recorder.Open(line + 10);
+		}
+		else if (!strnicmp (line, "PCMREPLAY", 9)) {
+			VHF.replay.Open(line + 10);
+		}
 		else if (!strnicmp (line, "REALISM", 7)) {
 			sscanf (line+7, "%d", &Realism);
 		}
@@ -1320,6 +1329,11 @@ void LEM::clbkLoadStateEx (FILEHANDLE scn, void *vs)
 		else if (!strnicmp(line, "DECA_BEGIN", sizeof("DECA_BEGIN"))) {
 			deca.LoadState(scn);
 		}
+		else if (!strnicmp (line, "TRACEMASK", 9)) {
+			unsigned int tracemask;
+			if (sscanf (line + 9, "%x", &tracemask) == 1)
+				TraceLog::SetMask(tracemask);
+		}
         else if (!strnicmp (line, "<INTERNALS>", 11)) { //INTERNALS signals the PanelSDK part of the scenario
 			Panelsdk.Load(scn);			//send the loading to the Panelsdk
 		}
@@ -1510,6 +1524,11 @@ bool LEM::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 		sscanf (line+11, "%d", &value);
 		isMultiThread=(value>0)?true:false;
 	}
+	else if (!strnicmp (line, "TRACEMASK", 9)) {
+		unsigned int tracemask;
+		if (sscanf (line + 9, "%x", &tracemask) == 1)
+			TraceLog::SetMask(tracemask);
+	}
 	else if (!strnicmp (line, "JOYSTICK_RHC", 12)) {
 		sscanf (line + 12, "%i", &rhc_id);
 		if(rhc_id > 1){ rhc_id = 1; } // Be paranoid
@@ -1599,6 +1618,8 @@ void LEM::clbkSaveState (FILEHANDLE scn)
 	oapiWriteScenario_float (scn, "MTD", MissionTimerDisplay.GetTime());
 	oapiWriteScenario_float (scn, "ETD", EventTimerDisplay.GetTime());
 	oapiWriteScenario_string (scn, "LANG", AudioLanguage);
+	if (VHF.recorder.IsOpen())
+		oapiWriteScenario_string (scn, "PCMRECORD", (char *) VHF.recorder.GetFileName());
 	oapiWriteScenario_int (scn, "PANEL_ID", PanelId);	
 
 	if (Realism != REALISM_DEFAULT) {
@@ -34,6 +34,8 @@
 #include "lmscs.h"
 // DS20090905 Include LM AGS and telecom
 #include "lm_ags.h"
+#include "pcmrecorder.h"
+#include "telemetryserver.h"
 #include "lm_telecom.h"
 
 // Cosmic background temperature in degrees F
@@ -3402,11 +3402,13 @@ bool LEM::clbkPanelRedrawEvent (int id, int event, SURFHANDLE surf)
 	}
 
 	//
-	// Process all the generic switches.
+	// Process all the generic switches. Rows are only redrawn every frame if
+	// they've changed.
 	//
 
-	if (MainPanel.DrawRow(id, surf, PanelFlashOn))
-		return true;
+	bool redrawn;
+	if (MainPanel.DrawRow(id, surf, PanelFlashOn, redrawn, event != PANEL_REDRAW_ALWAYS))
+		return redrawn;
 
 	//
 	// Now special case the rest.
@@ -58,21 +58,6 @@ LM_VHF::LM_VHF(){
 	pcm_rate_override = 0;
 }
 
-bool LM_VHF::registerSocket(SOCKET sock)
-{
-	HMODULE hpac = GetModuleHandle("modules\\startup\\ProjectApolloConfigurator.dll");
-	if (hpac) {
-		bool (__cdecl *regSocket1)(SOCKET);
-		regSocket1 = (bool (__cdecl *)(SOCKET)) GetProcAddress(hpac,"pacDefineSocket");
-		if (regSocket1)	{
-			if (!regSocket1(sock))
-				return false;
-		} else {
-			return false;
-		}
-	}
-	return true;
-}
 void LM_VHF::Init(LEM *vessel){
 	lem = vessel;
 	conn_state = 0;
@@ -82,53 +67,12 @@ void LM_VHF::Init(LEM *vessel){
 	last_rx = 0;
 	word_addr = 0;
 	pcm_rate_override = 0;
-	int iResult = WSAStartup( MAKEWORD(2,2), &wsaData );
-	if ( iResult != NO_ERROR ){
-		sprintf(wsk_emsg,"LM-TELECOM: Error at WSAStartup()");
-		wsk_error = 1;
-		return;
-	}
-	m_socket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
-	if ( m_socket == INVALID_SOCKET ) {
-		sprintf(wsk_emsg,"LM-TELECOM: Error at socket(): %ld", WSAGetLastError());
-		WSACleanup();
-		wsk_error = 1;
-		return;
-	}
-	// Be nonblocking
-	int iMode = 1; // 0 = BLOCKING, 1 = NONBLOCKING
-	if(ioctlsocket(m_socket, FIONBIO, (u_long FAR*) &iMode) != 0){
-		sprintf(wsk_emsg,"LM-TELECOM: ioctlsocket() failed: %ld", WSAGetLastError());
-		wsk_error = 1;
-		closesocket(m_socket);
-		WSACleanup();
-		return;
-	}
-
-	// Set up incoming options
-	service.sin_family = AF_INET;
-	service.sin_addr.s_addr = htonl(INADDR_ANY);
-	service.sin_port = htons( 14243 ); // CM on 14242, LM on 14243
-
-	if ( ::bind( m_socket, (SOCKADDR*) &service, sizeof(service) ) == SOCKET_ERROR ) {
-		sprintf(wsk_emsg,"LM-TELECOM: bind() failed: %ld", WSAGetLastError());
+	// Ground stations connect here, CM on 14242, LM on 14243
+	if(!server.Start(14243)){
+		server.GetError(wsk_emsg, sizeof(wsk_emsg));
 		wsk_error = 1;
-		closesocket(m_socket);
-		WSACleanup();
 		return;
 	}
-	if ( listen( m_socket, 1 ) == SOCKET_ERROR ){
-		wsk_error = 1;
-		sprintf(wsk_emsg,"LM-TELECOM: listen() failed: %ld", WSAGetLastError());
-		closesocket(m_socket);
-		WSACleanup();
-		return;
-	}
-	if(!registerSocket(m_socket))
-	{
-		sprintf(wsk_emsg,"LM-TELECOM: Failed to register socket %i for cleanup",m_socket);
-		wsk_error = 1;
-	}
 	conn_state = 1; // INITIALIZED, LISTENING
 	uplink_state = 0; rx_offset = 0;
 }
@@ -207,8 +151,13 @@ void LM_VHF::TimeStep(double simt){
 				tx_offset = 0;
 				while(tx_offset < tx_size){
 					generate_stream_lbr();
+					record_word(simt, PCMREC_LBR);
 					tx_offset++;
 				}
+				// Replace the live downlink with the recording, if we play one
+				if(replay.IsOpen()){
+					tx_size = replay.Read(tx_data, tx_size);
+				}
 				perform_io(simt);
 			}
 		}
@@ -223,14 +172,30 @@ void LM_VHF::TimeStep(double simt){
 				tx_offset = 0;
 				while(tx_offset < tx_size){
 					generate_stream_hbr();
+					record_word(simt, PCMREC_HBR);
 					tx_offset++;
 				}			
+				// Replace the live downlink with the recording, if we play one
+				if(replay.IsOpen()){
+					tx_size = replay.Read(tx_data, tx_size);
+				}
 				perform_io(simt);
 			}
 		}
 	}
 }
 
+// Record the word just generated. The generators move word_addr on after each word,
+// so it is back to zero when a frame is complete.
+
+void LM_VHF::record_word(double simt, int rate){
+	if(!recorder.IsOpen()){ return; }
+	recorder.AddWord(tx_data[tx_offset]);
+	if(word_addr == 0){
+		recorder.EndFrame(simt, rate);
+	}
+}
+
 // Scale data to 255 steps for transmission in the PCM datastream.
 // This function will be called lots of times inside a timestep, so it should go
 // as fast as possible!
@@ -249,132 +214,78 @@ unsigned char LM_VHF::scale_data(double data, double low, double high){
 }
 
 void LM_VHF::perform_io(double simt){
-	// Do TCP IO
-	switch(conn_state){
-		case 0: // UNINITIALIZED
-			break;
-		case 1: // INITALIZED, LISTENING
-			// Try to accept
-			AcceptSocket = accept( m_socket, NULL, NULL );
-			if(AcceptSocket != INVALID_SOCKET){
-				conn_state = 2; // Accept this!
-				wsk_error = 0; // For now
-			}
-			// Otherwise loop and try again.
-			break;
-		case 2: // CONNECTED			
-			int bytesSent,bytesRecv;
-
-			bytesSent = send(AcceptSocket, (char *)tx_data, tx_size, 0 );
-			if(bytesSent == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
-				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
-					case 10038: // Socket isn't a socket
-					case 10053: // Software caused connection abort
-					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;
+	if(conn_state == 0){ return; } // UNINITIALIZED
+	// Hand the downlink to the server; it goes out to every connected ground station
+	server.Send(tx_data, tx_size);
+	int clients = server.Clients();
+	if(clients > 0 && conn_state != 2){
+		wsk_error = 0; // Connected, for now
+	}
+	if(clients == 0 && conn_state == 2){
+		uplink_state = 0; rx_offset = 0; // Lost the ground, drop any partial command
+	}
+	conn_state = (clients > 0) ? 2 : 1; // CONNECTED or LISTENING
+	if(server.GetError(wsk_emsg, sizeof(wsk_emsg))){
+		wsk_error = 1;
+	}
+	// Take the ground uplink in one go, as far as the computer keeps up with it
+	unsigned char byte;
+	while(!lem->agc.IsUpruptActive() && server.Receive(&byte, 1) > 0){
+		last_rx = simt;
+		// FIXME: Check to make sure the up-data equipment is powered
+		// Reject uplink if switch is not down.
+		if(lem->Panel12UpdataLinkSwitch.GetState() != THREEPOSSWITCH_DOWN){
+			continue; // Discard the data
+		}
+		rx_data[rx_offset] = byte;
+		handle_uplink();
+	}
+}
 
-					default:           // If unknown
-						wsk_error = 1; // do this
-						sprintf(wsk_emsg,"LM-TELECOM: send() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
-				}
-			}
-			// Should we recieve?
-			if (((simt - last_rx) / 0.005) < 1 || lem->agc.IsUpruptActive()) {			
-				return; // No
+// Handle a byte moved to the uplink buffer
+void LM_VHF::handle_uplink(){
+	switch(uplink_state){
+		case 0: // NEW COMMAND START
+			int va,sa;
+			va = ((rx_data[rx_offset]&070)>>3);
+			sa = rx_data[rx_offset]&07;
+			// *** VEHICLE ADDRESS HARDCODED HERE *** (NASA DID THIS TOO)
+			if(va != 03){ break; }
+			switch(sa){
+				case 0: // TEST
+					rx_offset++; uplink_state=10;
+					break;
+				case 1: // LGC-UPDATA
+					rx_offset++; uplink_state=20;
+					break;
+				default:
+					sprintf(oapiDebugString(),"LM-UPLINK: UNKNOWN SYSTEM-ADDRESS %o",sa);
+					break;
 			}
-			last_rx = simt;
-			bytesRecv = recv( AcceptSocket, (char *)(rx_data+rx_offset), 1, 0 );
-			if(bytesRecv == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
-				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
-					case 10053: // Software caused connection abort
-					case 10038: // Socket isn't a socket
-					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;
-
-					default:           // If unknown
-						wsk_error = 1; // do this
-						sprintf(wsk_emsg,"LM-TELECOM: recv() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
-				}
-			}else{
-				// FIXME: Check to make sure the up-data equipment is powered
-				// Reject uplink if switch is not down.
-				if(lem->Panel12UpdataLinkSwitch.GetState() != THREEPOSSWITCH_DOWN){
-					return; // Discard the data
-				}
-				if(bytesRecv > 0){
-					// Have Data
-					switch(uplink_state){
-						case 0: // NEW COMMAND START
-							int va,sa;
-							va = ((rx_data[rx_offset]&070)>>3);
-							sa = rx_data[rx_offset]&07;
-							// *** VEHICLE ADDRESS HARDCODED HERE *** (NASA DID THIS TOO)
-							if(va != 03){ break; }
-							switch(sa){
-								case 0: // TEST
-									rx_offset++; uplink_state=10;
-									break;
-								case 1: // LGC-UPDATA
-									rx_offset++; uplink_state=20;
-									break;
-								default:
-									sprintf(oapiDebugString(),"LM-UPLINK: UNKNOWN SYSTEM-ADDRESS %o",sa);
-									break;
-							}
-							break;
-						case 10: // TEST CMD
-							rx_offset = 0; uplink_state = 0; break;
+			break;
+		case 10: // TEST CMD
+			rx_offset = 0; uplink_state = 0; break;
 
-						case 20: // LGC UPLINK CMD
-							// Expect another byte
-							rx_offset++; uplink_state++; break;
-						case 21: // LGC UPLINK
-							{
-								int lgc_uplink_wd = rx_data[rx_offset-1];
-								lgc_uplink_wd <<= 8;
-								lgc_uplink_wd |= rx_data[rx_offset];
-								// Must be in vAGC mode
-								if(lem->agc.Yaagc){
-									// Move to INLINK
-									lem->agc.vagc.Erasable[0][045] = lgc_uplink_wd;
-									// Cause UPRUPT
-									lem->agc.GenerateUprupt();
+		case 20: // LGC UPLINK CMD
+			// Expect another byte
+			rx_offset++; uplink_state++; break;
+		case 21: // LGC UPLINK
+			{
+				int lgc_uplink_wd = rx_data[rx_offset-1];
+				lgc_uplink_wd <<= 8;
+				lgc_uplink_wd |= rx_data[rx_offset];
+				// Must be in vAGC mode
+				if(lem->agc.Yaagc){
+					// Move to INLINK
+					lem->agc.vagc.Erasable[0][045] = lgc_uplink_wd;
+					// Cause UPRUPT
+					lem->agc.GenerateUprupt();
 
-								}
-								//sprintf(oapiDebugString(),"LGC UPLINK DATA %05o",cmc_uplink_wd);
-								rx_offset = 0; uplink_state = 0;
-							}
-							break;
-					}
 				}
+				//sprintf(oapiDebugString(),"LGC UPLINK DATA %05o",cmc_uplink_wd);
+				rx_offset = 0; uplink_state = 0;
 			}
-			break;			
+			break;
 	}
 }
 
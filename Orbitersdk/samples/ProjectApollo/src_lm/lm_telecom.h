@@ -179,16 +179,15 @@ public:
 	void TimeStep(double simt);        // TimeStep
 	void SystemTimestep(double simdt); // System Timestep
 	LEM *lem;					   // Ship we're installed in
-	// Winsock2
-	WSADATA wsaData;				// Winsock subsystem data
-	SOCKET m_socket;				// TCP socket
-	sockaddr_in service;			// SOCKADDR_IN
-	SOCKET AcceptSocket;			// Accept Socket
+	// Ground station link
+	TelemetryServer server;			// Downlink/uplink TCP server
 	int conn_state;                 // Connection State
 	int uplink_state;               // Uplink State
 	void perform_io(double simt);   // Get data from here to there
+	void handle_uplink();			// Handle incoming data
 	void generate_stream_lbr();     // Generate LBR datastream
 	void generate_stream_hbr();     // Same for HBR datastream
+	void record_word(double simt, int rate); // Pass the word just generated to the recorder
 	unsigned char scale_data(double data, double low, double high); // Scale data for PCM transmission
 	unsigned char measure(int channel, int type, int ccode);
 	// Error control
@@ -206,7 +205,9 @@ public:
 	int pcm_rate_override;          // Downtelemetry rate override
 	unsigned char tx_data[1024];    // Characters to be transmitted
 	unsigned char rx_data[1024];    // Characters recieved
-	bool registerSocket(SOCKET sock);
+	// Telemetry recording
+	PCMRecorder recorder;			// Flight recorder for the downlink
+	PCMReplay replay;				// Recorded downlink to send instead of the live one
 };
 
 // S-Band system
@@ -52,7 +52,7 @@
 // Set the file name for the tracer code.
 //
 
-char trace_file[] = "ProjectApollo LRV.log";
+char trace_file[] = "ProjectApollo LRV.trc";
 
 const VECTOR3 OFS_STAGE1 =  { 0, 0, -8.935};
 const VECTOR3 OFS_STAGE2 =  { 0, 0, 9.25-12.25};
@@ -1111,9 +1111,15 @@ DLLCLBK void ovcExit (VESSEL *vessel)
 
 DLLCLBK void InitModule (HINSTANCE hModule)
 {
+	TraceLog::Open(trace_file);
 	InitCollisionSDK();
 }
 
+DLLCLBK void ExitModule (HINSTANCE hModule)
+{
+	TraceLog::Close();
+}
+
 /* just some handy code for debugging purposes ...
 char test[200];
 sprintf(test, "DBG:%f, %f", steering, outer_deflect);
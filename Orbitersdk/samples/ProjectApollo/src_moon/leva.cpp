@@ -53,7 +53,7 @@
 // Set the file name for the tracer code.
 //
 
-char trace_file[] = "ProjectApollo LEVA.log";
+char trace_file[] = "ProjectApollo LEVA.trc";
 
 const VECTOR3 OFS_STAGE1 =  { 0, 0, -8.935};
 const VECTOR3 OFS_STAGE2 =  { 0, 0, 9.25-12.25};
@@ -777,5 +777,11 @@ DLLCLBK void ovcExit (VESSEL *vessel)
 
 DLLCLBK void InitModule (HINSTANCE hModule)
 {
+	TraceLog::Open(trace_file);
 	InitCollisionSDK();
 }
+
+DLLCLBK void ExitModule (HINSTANCE hModule)
+{
+	TraceLog::Close();
+}
@@ -17,9 +17,25 @@ static char debugString[100];
 static char debugStringBuffer[100];
 static char debugWinsock[100];
 
-static DWORD WINAPI RTCCMFD_Trampoline(LPVOID ptr) {
-	ARCore *core = (ARCore *)ptr;
-	return(core->subThread());
+// Calculations share their results (P30TIG and dV_LVLH are written by several
+// and read by others), so they run one at a time in priority order.
+#define RTCCMFD_WORKER_THREADS 1
+
+//
+// Entry and abort calculations and the PADs built from them go ahead of routine
+// targeting when several requests are waiting.
+//
+static int SubthreadPriority(int fcn)
+{
+	switch (fcn) {
+	case 7:  // Entry
+	case 11: // TEI
+		return JOB_PRIORITY_HIGH;
+	case 4:  // REFSMMAT
+		return JOB_PRIORITY_LOW;
+	default:
+		return JOB_PRIORITY_NORMAL;
+	}
 }
 
 ARCore::ARCore(VESSEL* v)
@@ -309,7 +325,7 @@ ARCore::ARCore(VESSEL* v)
 	tlipad.SepATT = _V(0.0, 0.0, 0.0);
 	tlipad.IgnATT = _V(0.0, 0.0, 0.0);
 
-	subThreadMode = 0;
+	jobs = new JobScheduler(RTCCMFD_WORKER_THREADS);
 	subThreadStatus = 0;
 
 	LmkLat = 0;
@@ -348,8 +364,18 @@ ARCore::ARCore(VESSEL* v)
 	earthentrypad.VIO[0] = 0;
 }
 
+ARCore::~ARCore()
+{
+	// Queued calculations are dropped, and deleting the scheduler waits for the
+	// one that is running, since it writes into this object.
+	CancelSubthreads();
+	delete jobs;
+}
+
 void ARCore::MinorCycle(double SimT, double SimDT, double mjd)
 {
+	UpdateSubthreadStatus();
+
 	if (g_Data.connStatus > 0 && g_Data.uplinkBuffer.size() > 0) {
 		if (SimT > g_Data.uplinkBufferSimt + 0.05) {
 			unsigned char data = g_Data.uplinkBuffer.front();
@@ -1078,25 +1104,54 @@ VECTOR3 ARCore::finealignLMtoCSM(VECTOR3 lmn20, VECTOR3 csmn20) //LM noun 20 and
 }
 
 int ARCore::startSubthread(int fcn) {
+	// The same calculation can only be pending once.
+	JobHandle &job = subThreadJobs[fcn];
+	if (job && !job->IsDone()) {
+		return(-1);
+	}
+
+	job = jobs->Submit(fcn, SubthreadPriority(fcn), [this, fcn](JobState &state) { return subThread(fcn); });
 	if (subThreadStatus < 1) {
-		// Punt thread
-		subThreadMode = fcn;
 		subThreadStatus = 1; // Busy
-		DWORD id = 0;
-		HANDLE h = CreateThread(NULL, 0, RTCCMFD_Trampoline, this, 0, &id);
-		if (h != NULL) { CloseHandle(h); }
-	}
-	else {
-		return(-1);
 	}
 	return(0);
 }
 
-int ARCore::subThread()
+void ARCore::UpdateSubthreadStatus()
+{
+	int status = 0;
+
+	for (std::map<int, JobHandle>::iterator it = subThreadJobs.begin(); it != subThreadJobs.end(); ++it)
+	{
+		JobHandle job = it->second;
+
+		if (!job) continue;
+
+		if (!job->IsDone())
+		{
+			if (job->GetStatus() == JOB_RUNNING)
+				status = 2;
+			else if (status < 1)
+				status = 1;
+		}
+		else if (status < 1 && job->GetResult() < status)
+		{
+			status = job->GetResult();
+		}
+	}
+
+	subThreadStatus = status;
+}
+
+void ARCore::CancelSubthreads()
+{
+	jobs->CancelAll();
+}
+
+int ARCore::subThread(int mode)
 {
 	int Result = 0;
-	subThreadStatus = 2; // Running
-	switch (subThreadMode) {
+	switch (mode) {
 	case 0: // Test
 		Sleep(5000); // Waste 5 seconds
 		Result = 0;  // Success (negative = error)
@@ -1141,6 +1196,7 @@ int ARCore::subThread()
 		opt.target = target;
 		opt.vessel = vessel;
 		opt.TIG = CDHtime;
+		opt.propagator = COAST_AUTO;
 
 		dH_CDH = rtcc->CDHcalc(&opt, CDHdeltaV, CDHtime_cor);
 
@@ -1553,9 +1609,7 @@ int ARCore::subThread()
 	}
 	break;
 	}
-	subThreadStatus = Result;
-	// Printing messages from the subthread is not safe, but this is just for testing.
-	return(0);
+	return(Result);
 }
 
 void ARCore::StartIMFDRequest() {
@@ -15,7 +15,9 @@
 #include "saturn.h"
 #include "mcc.h"
 #include "rtcc.h"
+#include "jobscheduler.h"
 #include <queue>
+#include <map>
 
 struct ApolloRTCCMFDData {  // global data storage
 	int connStatus;
@@ -32,6 +34,7 @@ struct ApolloRTCCMFDData {  // global data storage
 class ARCore {
 public:
 	ARCore(VESSEL* v);
+	~ARCore();
 	void lambertcalc();
 	void CDHcalc();
 	void OrbitAdjustCalc();
@@ -64,13 +67,16 @@ public:
 	void MapUpdate();
 
 	int startSubthread(int fcn);
-	int subThread();
+	int subThread(int mode);
+	void UpdateSubthreadStatus();
+	void CancelSubthreads();
 	void StartIMFDRequest();
 	void StopIMFDRequest();
 
 	// SUBTHREAD MANAGEMENT
-	int subThreadMode;										// What should the subthread do?
-	int subThreadStatus;									// 0 = done/not busy, 1 = busy, negative = done with error
+	JobScheduler *jobs;										// Worker pool shared by all calculations of this core
+	std::map<int, JobHandle> subThreadJobs;					// Last job submitted for each calculation
+	int subThreadStatus;									// 0 = done/not busy, 1 = queued, 2 = running, negative = done with error
 
 	RTCC* rtcc;
 	ApolloRTCCMFDData g_Data;
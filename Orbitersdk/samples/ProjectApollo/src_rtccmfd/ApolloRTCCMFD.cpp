@@ -49,6 +49,13 @@ DLLCLBK void ExitModule (HINSTANCE hDLL)
 {
 	// Unregister the custom MFD mode when the module is unloaded
 	oapiUnregisterMFDMode (g_MFDmode);
+
+	// Stop the calculation workers before the module goes away
+	for (int i = 0; i < nGutsUsed; i++)
+	{
+		delete GCoreData[i];
+	}
+	nGutsUsed = 0;
 }
 
 // ==============================================================
@@ -2557,7 +2564,8 @@ void ApolloRTCCMFD::set_lambertelev(double elev)
 	RP0 = _V(RP0_orb.x, RP0_orb.z, RP0_orb.y);
 	VP0 = _V(VP0_orb.x, VP0_orb.z, VP0_orb.y);
 
-	dt1 = OrbMech::findelev(RA0, VA0, RP0, VP0, SVMJD, G->lambertelev, G->gravref);
+	CoastPropagator prop(COAST_AUTO);
+	dt1 = OrbMech::findelev(RA0, VA0, RP0, VP0, SVMJD, G->lambertelev, G->gravref, &prop);
 	G->T1 = dt1 + (SVMJD - G->GETbase) * 24.0 * 60.0 * 60.0;
 }
 
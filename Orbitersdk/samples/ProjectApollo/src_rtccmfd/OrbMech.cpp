@@ -307,9 +307,10 @@ void rv_from_r0v0(VECTOR3 R0, VECTOR3 V0, double t, VECTOR3 &R1, VECTOR3 &V1, do
 
 double kepler_U(double dt, double ro, double vro, double a, double mu, double x0) //This function uses Newton's method to solve the universal Kepler equation for the universal anomaly.
 {
-	double error2, ratio, C, S, F, dFdx, x;
+	double error2, ratio, C, S, F, dFdx, x, x2, sqrt_mu;
 	int n, nMax;
 
+	sqrt_mu = sqrt(mu);
 	error2 = 1e-8;
 	nMax = 1000;
 	n = 0;
@@ -321,10 +322,10 @@ double kepler_U(double dt, double ro, double vro, double a, double mu, double x0
 	x = x0;
 	while ((abs(ratio) > error2) && (n <= nMax)) {
 		n = n + 1;
-		C = stumpC(a*x*x);
-		S = stumpS(a*x*x);
-		F = ro*vro / sqrt(mu)*x*x*C + (1.0 - a*ro)*OrbMech::power(x, 3.0)*S + ro*x - sqrt(mu)*dt;
-		dFdx = ro*vro / sqrt(mu)*x*(1.0 - a*x*x*S) + (1.0 - a*ro)*x*x*C + ro;
+		x2 = x*x;
+		stumpCS(a*x2, C, S);
+		F = ro*vro / sqrt_mu*x2*C + (1.0 - a*ro)*x2*x*S + ro*x - sqrt_mu*dt;
+		dFdx = ro*vro / sqrt_mu*x*(1.0 - a*x2*S) + (1.0 - a*ro)*x2*C + ro;
 		ratio = F / dFdx;
 		x = x - ratio;
 	}
@@ -333,40 +334,62 @@ double kepler_U(double dt, double ro, double vro, double a, double mu, double x0
 
 double stumpS(double z)
 {
-	double s;
+	double c, s;
 
-	s = 0;
-	if (z > 0) {
-		s = (sqrt(z) - sin(sqrt(z))) / OrbMech::power(sqrt(z), 3);
-	}
-	else if (z < 0) {
-		s = (sinh(sqrt(-z)) - sqrt(-z)) / OrbMech::power(sqrt(-z), 3);
-	}
-	else {
-		s = 1.0 / 6.0;
-	}
+	stumpCS(z, c, s);
 	return s;
 }
 
 double stumpC(double z)
 {
-	double c;
-	c = 0;
-	if (z > 0) {
-		c = (1.0 - cos(sqrt(z))) / z;
+	double c, s;
+
+	stumpCS(z, c, s);
+	return c;
+}
+
+void stumpCS(double z, double &c, double &s)	//Both Stumpff functions with a single square root and trig/hyperbolic evaluation
+{
+	double sz;
+
+	if (z > STUMPFF_SERIES_LIMIT) {
+		sz = sqrt(z);
+		c = (1.0 - cos(sz)) / z;
+		s = (sz - sin(sz)) / (z*sz);
 	}
-	else if (z < 0) {
-		c = (cosh(sqrt(-z)) - 1.0) / (-z);
+	else if (z < -STUMPFF_SERIES_LIMIT) {
+		sz = sqrt(-z);
+		c = (cosh(sz) - 1.0) / (-z);
+		s = (sinh(sz) - sz) / (-z*sz);
 	}
 	else {
-		c = 0.5;
+		//Near-parabolic: the closed forms above lose precision, use the power series instead
+		c = 1.0 / 2.0 - z*(1.0 / 24.0 - z*(1.0 / 720.0 - z*(1.0 / 40320.0 - z*(1.0 / 3628800.0 - z / 479001600.0))));
+		s = 1.0 / 6.0 - z*(1.0 / 120.0 - z*(1.0 / 5040.0 - z*(1.0 / 362880.0 - z*(1.0 / 39916800.0 - z / 6227020800.0))));
 	}
-	return c;
 }
 
 double power(double b, double e)
 {
-	double res;
+	double res, ab;
+	int n;
+
+	//Integer and half-integer exponents (squares, cubes, r^1.5, a^3.5 etc.) are by far
+	//the most common, evaluate those by multiplication instead of the generic pow()
+	if (fabs(e) <= POWER_FAST_MAX)
+	{
+		if (e == floor(e))
+		{
+			return ipow(b, (int)e);
+		}
+		if (2.0*e == floor(2.0*e))
+		{
+			ab = fabs(b);
+			n = (int)floor(e);
+			res = ipow(ab, n)*sqrt(ab);
+			return b < 0 ? -res : res;
+		}
+	}
 
 	res = 0;
 	if (b < 0 && e != ceil(e)) {
@@ -378,21 +401,39 @@ double power(double b, double e)
 	return res;
 }
 
+double ipow(double b, int n)
+{
+	double res = 1.0;
+	bool neg = n < 0;
+
+	if (neg) n = -n;
+	while (n)
+	{
+		if (n & 1) res *= b;
+		b *= b;
+		n >>= 1;
+	}
+	return neg ? 1.0 / res : res;
+}
+
 void f_and_g(double x, double t, double ro, double a, double &f, double &g, double mu)	//calculates the Lagrange f and g coefficients
 {
-	double z;
+	double z, C, S;
 
 	z = a*x*x;
-	f = 1 - x*x / ro*stumpC(z);
-	g = t - 1 / sqrt(mu)*OrbMech::power(x, 3)*stumpS(z);
+	stumpCS(z, C, S);
+	f = 1 - x*x / ro*C;
+	g = t - 1 / sqrt(mu)*x*x*x*S;
 }
 
 void fDot_and_gDot(double x, double r, double ro, double a, double &fdot, double &gdot, double mu)	//calculates the time derivatives of the Lagrange f and g coefficients
 {
-	double z;
+	double z, C, S;
+
 	z = a*x*x;
-	fdot = sqrt(mu) / r / ro*(z*stumpS(z) - 1.0)*x;
-	gdot = 1.0 - x*x / r*stumpC(z);
+	stumpCS(z, C, S);
+	fdot = sqrt(mu) / r / ro*(z*S - 1.0)*x;
+	gdot = 1.0 - x*x / r*C;
 }
 
 double kepler_E(double e, double M)
@@ -1251,43 +1292,26 @@ void planeinter(VECTOR3 n1, double h1, VECTOR3 n2, double h2, VECTOR3 &m1, VECTO
 	m2 = crossp(n1, n2);
 }
 
-double NSRsecant(VECTOR3 RA, VECTOR3 VA, VECTOR3 RP, VECTOR3 VP, double mjd0, double x, double DH, OBJHANDLE gravref)
+double NSRsecant(VECTOR3 RA, VECTOR3 VA, VECTOR3 RP, VECTOR3 VP, double mjd0, double x, double DH, OBJHANDLE gravref, CoastPropagator *prop)
 {
 	double theta, SW, dh_CDH, mu;
 	VECTOR3 RA2, VA2, RP2, VP2, u, RA2_alt, VA2_alt, RPC, VPC;
-	bool stop;
-
-	stop = false;
 
 	mu = GGRAV*oapiGetMass(gravref);
 
 	//rv_from_r0v0(RA, VA, x, RA2, VA2, mu);
 	//rv_from_r0v0(RP, VP, x, RP2, VP2, mu);
 
-	CoastIntegrator *coast;
-	coast = new CoastIntegrator(RA, VA, mjd0, x, gravref, gravref);
-
-	while (stop == false)
+	if (prop)
 	{
-		stop = coast->iteration();
+		prop->coast(RA, VA, mjd0, x, RA2, VA2, gravref);
+		prop->coast(RP, VP, mjd0, x, RP2, VP2, gravref);
 	}
-	RA2 = coast->R2;
-	VA2 = coast->V2;
-
-	stop = false;
-
-	delete coast;
-
-	coast = new CoastIntegrator(RP, VP, mjd0, x, gravref, gravref);
-
-	while (stop == false)
+	else
 	{
-		stop = coast->iteration();
+		oneclickcoast(RA, VA, mjd0, x, RA2, VA2, gravref, gravref);
+		oneclickcoast(RP, VP, mjd0, x, RP2, VP2, gravref, gravref);
 	}
-	RP2 = coast->R2;
-	VP2 = coast->V2;
-
-	delete coast;
 
 	u = unit(crossp(RP2, VP2));
 	RA2_alt = RA2;
@@ -1427,7 +1451,7 @@ double GetPlanetCurrentRotation(OBJHANDLE plan, double t)
 	return r;
 }
 
-double findelev(VECTOR3 R_A0, VECTOR3 V_A0, VECTOR3 R_P0, VECTOR3 V_P0, double mjd0, double E, OBJHANDLE gravref)
+double findelev(VECTOR3 R_A0, VECTOR3 V_A0, VECTOR3 R_P0, VECTOR3 V_P0, double mjd0, double E, OBJHANDLE gravref, CoastPropagator *prop)
 {
 	double w_A, w_P, r_A, v_A, r_P, v_P, alpha, t, dt, E_err, E_A;
 	VECTOR3 u, R_A, V_A, R_P, V_P, U_L, U_P;
@@ -1453,8 +1477,16 @@ double findelev(VECTOR3 R_A0, VECTOR3 V_A0, VECTOR3 R_P0, VECTOR3 V_P0, double m
 		alpha = E + sign(dotp(crossp(R_A, R_P), u))*acos(dotp(R_A / r_A, R_P / r_P));
 		dt = (alpha - PI + sign(r_P - r_A)*(PI - acos(r_A*cos(E) / r_P))) / (w_A - w_P);
 
-		oneclickcoast(R_A, V_A, mjd0+t/24.0/3600.0, dt, R_A, V_A, gravref, gravref);
-		oneclickcoast(R_P, V_P, mjd0+t/24.0/3600.0, dt, R_P, V_P, gravref, gravref);
+		if (prop)
+		{
+			prop->coast(R_A, V_A, mjd0 + t / 24.0 / 3600.0, dt, R_A, V_A, gravref);
+			prop->coast(R_P, V_P, mjd0 + t / 24.0 / 3600.0, dt, R_P, V_P, gravref);
+		}
+		else
+		{
+			oneclickcoast(R_A, V_A, mjd0 + t / 24.0 / 3600.0, dt, R_A, V_A, gravref, gravref);
+			oneclickcoast(R_P, V_P, mjd0 + t / 24.0 / 3600.0, dt, R_P, V_P, gravref, gravref);
+		}
 		t += dt;
 		r_A = length(R_A);
 		v_A = length(V_A);
@@ -3988,8 +4020,7 @@ CoastIntegrator::CoastIntegrator(VECTOR3 R00, VECTOR3 V00, double mjd0, double d
 
 	B = 1;
 
-	double *EarthPos;
-	EarthPos = new double[12];
+	double EarthPos[12];
 	VECTOR3 EarthVec, EarthVecVel;
 
 	cEarth->clbkEphemeris(mjd0 + t_F/2.0/24.0/3600.0, EPHEM_TRUEPOS | EPHEM_TRUEVEL, EarthPos);
@@ -4001,6 +4032,11 @@ CoastIntegrator::CoastIntegrator(VECTOR3 R00, VECTOR3 V00, double mjd0, double d
 	W_ES = length(crossp(R_ES0, V_ES0) / OrbMech::power(length(R_ES0), 2.0));
 }
 
+CoastIntegrator::~CoastIntegrator()
+{
+	delete[] JCoeff;
+}
+
 bool CoastIntegrator::iteration()
 {
 	double rr, dt_max, dt, h, x_apo, gamma, s, alpha_N, x_t, Y, r_qc;
@@ -4228,7 +4264,7 @@ double CoastIntegrator::fq(double q)
 
 VECTOR3 CoastIntegrator::adfunc(VECTOR3 R)
 {
-	double r, costheta, P2, P3, P4, P5;
+	double r, costheta, P2, P3, P4, P5, rr;
 	VECTOR3 U_R, U_Z, a_dP, a_d, a_dQ, a_dS;
 	a_dP = _V(0, 0, 0);
 	r = length(R);
@@ -4244,27 +4280,27 @@ VECTOR3 CoastIntegrator::adfunc(VECTOR3 R)
 			U_Z = U_Z_M;//_V(obli.m12, obli.m22, obli.m32);
 		}
 		costheta = dotp(U_R, U_Z);
+		rr = R_E / r;
 		P2 = 3.0 * costheta;
 		P3 = 0.5*(15.0*costheta*costheta - 3.0);
-		a_dP += (U_R*P3 - U_Z*P2)*JCoeff[0] * OrbMech::power(R_E / r, 2.0);
+		a_dP += (U_R*P3 - U_Z*P2)*JCoeff[0] * rr*rr;
 		if (jcount > 1)
 		{
 			P4 = 1.0 / 3.0*(7.0*costheta*P3 - 4.0*P2);
-			a_dP += (U_R*P4 - U_Z*P3)*JCoeff[1] * OrbMech::power(R_E / r, 3.0);
+			a_dP += (U_R*P4 - U_Z*P3)*JCoeff[1] * rr*rr*rr;
 			if (jcount > 2)
 			{
 				P5 = 0.25*(9.0*costheta*P4 - 5.0 * P3);
-				a_dP += (U_R*P5 - U_Z*P4)*JCoeff[2] * OrbMech::power(R_E / r, 4.0);
+				a_dP += (U_R*P5 - U_Z*P4)*JCoeff[2] * rr*rr*rr*rr;
 			}
 		}
-		a_dP *= mu / OrbMech::power(r, 2.0);
+		a_dP *= mu / (r*r);
 	}
 	if (M == 1)
 	{
-		double q_Q, q_S, MJD;
+		double q_Q, q_S, MJD, r_PQ, r_PS, r_QC, r_SC;
 		VECTOR3 R_SC, R_PS, R_EM, R_ES, V_ES;
-		double *MoonPos;
-		MoonPos = new double[12];
+		double MoonPos[12];
 
 		MJD = mjd0 + t / 86400.0;
 
@@ -4285,10 +4321,14 @@ VECTOR3 CoastIntegrator::adfunc(VECTOR3 R)
 		R_QC = R - R_PQ;
 		R_SC = R - R_PS;
 
-		q_Q = dotp(R - R_PQ*2.0, R) / OrbMech::power(length(R_PQ), 2.0);
-		q_S = dotp(R - R_PS*2.0, R) / OrbMech::power(length(R_PS), 2.0);
-		a_dQ = -(R_PQ*fq(q_Q) + R)*mu_Q / OrbMech::power(length(R_QC), 3.0);
-		a_dS = -(R_PS*fq(q_S) + R)*mu_S / OrbMech::power(length(R_SC), 3.0);
+		r_PQ = length(R_PQ);
+		r_PS = length(R_PS);
+		r_QC = length(R_QC);
+		r_SC = length(R_SC);
+		q_Q = dotp(R - R_PQ*2.0, R) / (r_PQ*r_PQ);
+		q_S = dotp(R - R_PS*2.0, R) / (r_PS*r_PS);
+		a_dQ = -(R_PQ*fq(q_Q) + R)*mu_Q / (r_QC*r_QC*r_QC);
+		a_dS = -(R_PS*fq(q_S) + R)*mu_S / (r_SC*r_SC*r_SC);
 		B = 0;
 		a_d = a_dP + a_dQ + a_dS;
 	}
@@ -4299,23 +4339,174 @@ VECTOR3 CoastIntegrator::adfunc(VECTOR3 R)
 	return a_d;
 }
 
-MATRIX3 operator+(MATRIX3 a, MATRIX3 b)
+CoastPropagator::CoastPropagator(int mode, double tol, double span)
 {
-	return _M(a.m11 + b.m11, a.m12 + b.m12, a.m13 + b.m13, a.m21 + b.m21, a.m22 + b.m22, a.m23 + b.m23, a.m31 + b.m31, a.m32 + b.m32, a.m33 + b.m33);
+	this->mode = mode;
+	this->tol = tol;
+	this->span = span;
+	checkinterval = 10;
+
+	n_analytic = 0;
+	n_numerical = 0;
+	n_checks = 0;
+	maxerr = 0.0;
+	fellback = false;
+
+	nextanchor = 0;
+	hEarth = oapiGetObjectByName("Earth");
+	mu = GGRAV*oapiGetMass(hEarth);
+	R_E = oapiGetSize(hEarth);
+	J2 = 0.0;
+	if (oapiGetPlanetJCoeffCount(hEarth) > 0)
+	{
+		J2 = oapiGetPlanetJCoeff(hEarth, 0);
+	}
+	U_Z = _V(0, 0, 1);
+	U_Z_mjd = -1.0;
 }
 
-VECTOR3 rhmul(const MATRIX3 &A, const VECTOR3 &b)	//For the left handed Orbiter matrizes, A is left handed, b is right handed, result is right handed
+static bool samestate(const VECTOR3 &a, const VECTOR3 &b)
 {
-	return _V(
-		A.m11*b.x + A.m12*b.z + A.m13*b.y,
-		A.m31*b.x + A.m32*b.z + A.m33*b.y,
-		A.m21*b.x + A.m22*b.z + A.m23*b.y);
+	return a.x == b.x && a.y == b.y && a.z == b.z;
 }
 
-VECTOR3 rhtmul(const MATRIX3 &A, const VECTOR3 &b)
+void CoastPropagator::coast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, OBJHANDLE gravref)
 {
-	return _V(
-		A.m11*b.x + A.m21*b.z + A.m31*b.y,
-		A.m13*b.x + A.m23*b.z + A.m33*b.y,
-		A.m12*b.x + A.m22*b.z + A.m32*b.y);
-}
\ No newline at end of file
+	VECTOR3 RS, VS, R_num, V_num;
+	double mjds, dts, err;
+	bool anchored;
+
+	if (mode == COAST_NUMERICAL || gravref != hEarth)
+	{
+		numerical(R0, V0, mjd0, dt, R1, V1, gravref);
+		return;
+	}
+
+	//The Earth's pole moves slowly enough to be updated daily
+	if (abs(mjd0 - U_Z_mjd) > 1.0)
+	{
+		MATRIX3 obli_E = OrbMech::GetObliquityMatrix(hEarth, mjd0);
+		U_Z = mul(obli_E, _V(0, 1, 0));
+		U_Z = _V(U_Z.x, U_Z.z, U_Z.y);
+		U_Z_mjd = mjd0;
+	}
+
+	if (mode == COAST_ANALYTIC)
+	{
+		analytic(R0, V0, mjd0, dt, R1, V1);
+		n_analytic++;
+		return;
+	}
+
+	//Start from the integrated state closest in time to the requested one. Only states produced by the
+	//integrator are used as anchors, so analytic errors never chain from one solution to the next.
+	RS = R0;
+	VS = V0;
+	mjds = mjd0;
+	dts = dt;
+	anchored = false;
+
+	for (unsigned i = 0; i < anchors.size(); i++)
+	{
+		Anchor &a = anchors[i];
+
+		if (a.gravref == gravref && a.mjd0 == mjd0 && samestate(a.R0, R0) && samestate(a.V0, V0) && abs(dt - a.dt) < abs(dts))
+		{
+			RS = a.R1;
+			VS = a.V1;
+			mjds = mjd0 + a.dt / 24.0 / 3600.0;
+			dts = dt - a.dt;
+			anchored = true;
+		}
+	}
+
+	if (dts == 0.0)
+	{
+		R1 = RS;
+		V1 = VS;
+		return;
+	}
+
+	//A state the integrator hasn't seen yet, or one too far from it, is integrated and becomes a new anchor
+	if (!anchored || abs(dts) > span)
+	{
+		numerical(R0, V0, mjd0, dt, R1, V1, gravref);
+		return;
+	}
+
+	analytic(RS, VS, mjds, dts, R1, V1);
+
+	if (n_analytic % checkinterval == 0)
+	{
+		numerical(R0, V0, mjd0, dt, R_num, V_num, gravref);
+		n_checks++;
+
+		err = length(R_num - R1);
+		if (err > maxerr)
+		{
+			maxerr = err;
+		}
+		if (err > tol)
+		{
+			mode = COAST_NUMERICAL;
+			fellback = true;
+		}
+
+		R1 = R_num;
+		V1 = V_num;
+	}
+	n_analytic++;
+}
+
+void CoastPropagator::analytic(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1)
+{
+	VECTOR3 R_K, V_K, a0, a1;
+
+	//Two body solution, plus the J2 perturbation integrated with the trapezoidal rule
+	OrbMech::rv_from_r0v0(R0, V0, dt, R_K, V_K, mu);
+	a0 = J2accel(R0);
+	a1 = J2accel(R_K);
+
+	R1 = R_K + (a0 / 3.0 + a1 / 6.0)*dt*dt;
+	V1 = V_K + (a0 + a1)*0.5*dt;
+}
+
+void CoastPropagator::numerical(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, OBJHANDLE gravref)
+{
+	Anchor a;
+
+	OrbMech::oneclickcoast(R0, V0, mjd0, dt, R1, V1, gravref, gravref);
+	n_numerical++;
+
+	a.R0 = R0;
+	a.V0 = V0;
+	a.mjd0 = mjd0;
+	a.gravref = gravref;
+	a.dt = dt;
+	a.R1 = R1;
+	a.V1 = V1;
+
+	//Small ring of recent integrations, iterative searches only ever revisit the last few
+	if (anchors.size() < 16)
+	{
+		anchors.push_back(a);
+	}
+	else
+	{
+		anchors[nextanchor] = a;
+		nextanchor = (nextanchor + 1) % anchors.size();
+	}
+}
+
+VECTOR3 CoastPropagator::J2accel(VECTOR3 R)
+{
+	double r, costheta, rr;
+	VECTOR3 U_R;
+
+	r = length(R);
+	U_R = R / r;
+	costheta = dotp(U_R, U_Z);
+	rr = R_E / r;
+
+	return (U_R*(7.5*costheta*costheta - 1.5) - U_Z*3.0*costheta)*J2*rr*rr*mu / (r*r);
+}
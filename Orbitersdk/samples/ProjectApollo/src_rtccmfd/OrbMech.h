@@ -2,6 +2,12 @@
 #define _ORBMECH_H
 
 #include "Orbitersdk.h"
+#include <vector>
+
+//Largest exponent magnitude for which OrbMech::power uses repeated multiplication
+#define POWER_FAST_MAX 8.0
+//Stumpff function arguments closer to zero than this are evaluated by series expansion
+#define STUMPFF_SERIES_LIMIT 0.1
 
 const VECTOR3 navstars[37] = { _V(0.87325707, 0.222717753, 0.433380771),
 _V(0.933983515, 0.0421048982, -0.354826677),
@@ -102,6 +108,7 @@ class CoastIntegrator
 {
 public:
 	CoastIntegrator(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, OBJHANDLE planet, OBJHANDLE outplanet);
+	~CoastIntegrator();
 	bool iteration();
 
 	VECTOR3 R2, V2;
@@ -131,6 +138,53 @@ private:
 	double W_ES;
 };
 
+//Propagator selection for CoastPropagator
+#define COAST_NUMERICAL 0	//Always use the CoastIntegrator
+#define COAST_ANALYTIC 1	//Always use the analytic oblate-Earth step
+#define COAST_AUTO 2		//Analytic close to a numerically integrated state, checked against the integrator
+
+//Earth orbit coasting for iterative targeting, which propagates the same few state vectors many times.
+//The analytic step is a Kepler solution with a J2 correction and is only used for Earth, over at most
+//'span' seconds from a state the numerical integrator has produced. Every 'checkinterval' analytic
+//solutions are verified against the integrator; if the error exceeds 'tol' the propagator falls back
+//to numerical integration for the rest of its lifetime.
+class CoastPropagator
+{
+public:
+	CoastPropagator(int mode = COAST_AUTO, double tol = 100.0, double span = 180.0);
+	void coast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, OBJHANDLE gravref);
+
+	int mode;
+	double tol;				//Allowed position error of an analytic solution in meters
+	double span;			//Longest analytic coast in seconds
+	int checkinterval;		//Number of analytic solutions between checks
+
+	//Statistics
+	int n_analytic, n_numerical, n_checks;
+	double maxerr;
+	bool fellback;
+private:
+	struct Anchor
+	{
+		VECTOR3 R0, V0;
+		double mjd0;
+		OBJHANDLE gravref;
+		double dt;
+		VECTOR3 R1, V1;
+	};
+
+	void analytic(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1);
+	void numerical(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, OBJHANDLE gravref);
+	VECTOR3 J2accel(VECTOR3 R);
+
+	std::vector<Anchor> anchors;
+	unsigned nextanchor;
+	OBJHANDLE hEarth;
+	double mu, R_E, J2;
+	VECTOR3 U_Z;
+	double U_Z_mjd;
+};
+
 namespace OrbMech {
 
 	//public:
@@ -140,6 +194,7 @@ namespace OrbMech {
 	double kepler_E(double e, double M);
 	double kepler_H(double e, double M);
 	double power(double b, double e);
+	double ipow(double b, int n);
 	void sv_from_coe(OELEMENTS el, double mu, VECTOR3 &R, VECTOR3 &V);
 	OELEMENTS coe_from_sv(VECTOR3 R, VECTOR3 V, double mu);
 	VECTOR3 elegant_lambert(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double dt, int N, bool prog, double mu);
@@ -147,7 +202,7 @@ namespace OrbMech {
 	void INRFV(VECTOR3 R_1, VECTOR3 V_2, double r_2, bool direct, double mu, VECTOR3 &V_1, VECTOR3 &R_2, double &dt_2);
 	void SolveQuartic(double *A, double *R, int &N);
 	VECTOR3 Vinti(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double mjd0, double dt, int N, bool prog, OBJHANDLE gravref, OBJHANDLE gravin, OBJHANDLE gravout, VECTOR3 V_guess);
-	double NSRsecant(VECTOR3 RA, VECTOR3 VA, VECTOR3 RP, VECTOR3 VP, double mjd0, double x, double DH, OBJHANDLE gravref);
+	double NSRsecant(VECTOR3 RA, VECTOR3 VA, VECTOR3 RP, VECTOR3 VP, double mjd0, double x, double DH, OBJHANDLE gravref, CoastPropagator *prop = NULL);
 	void rv_from_r0v0_ta(VECTOR3 R0, VECTOR3 V0, double dt, VECTOR3 &R1, VECTOR3 &V1, double mu);
 	double time_theta(VECTOR3 R, VECTOR3 V, double dtheta, double mu);
 	void f_and_g_ta(VECTOR3 R0, VECTOR3 V0, double dt, double &f, double &g, double mu);
@@ -165,7 +220,7 @@ namespace OrbMech {
 	void PACSS4_from_coe(OELEMENTS coe, double mu, VECTOR3 &R, VECTOR3 &V);
 	OELEMENTS coe_from_PACSS4(VECTOR3 R, VECTOR3 V, double mu);
 	double GetPlanetCurrentRotation(OBJHANDLE plan, double t);
-	double findelev(VECTOR3 R_A0, VECTOR3 V_A0, VECTOR3 R_P0, VECTOR3 V_P0, double mjd0, double E, OBJHANDLE gravref);
+	double findelev(VECTOR3 R_A0, VECTOR3 V_A0, VECTOR3 R_P0, VECTOR3 V_P0, double mjd0, double E, OBJHANDLE gravref, CoastPropagator *prop = NULL);
 	double findelev_gs(VECTOR3 R_A0, VECTOR3 V_A0, VECTOR3 R_gs, double mjd0, double E, OBJHANDLE gravref, double &range);
 	VECTOR3 ULOS(MATRIX3 REFSMMAT, MATRIX3 SMNB, double TA, double SA);
 	int FindNearestStar(VECTOR3 U_LOS, VECTOR3 R_C, double R_E, double ang_max);
@@ -237,6 +292,7 @@ namespace OrbMech {
 	double kepler_U(double dt, double ro, double vro, double a, double mu, double x0);
 	double stumpC(double z);
 	double stumpS(double z);
+	void stumpCS(double z, double &c, double &s);
 	void f_and_g(double x, double t, double ro, double a, double &f, double &g, double mu);
 	void fDot_and_gDot(double x, double r, double ro, double a, double &fdot, double &gdot, double mu);
 	double atan3(double x, double y);
@@ -265,9 +321,26 @@ namespace OrbMech {
 	void planeinter(VECTOR3 n1, double h1, VECTOR3 n2, double h2, VECTOR3 &m1, VECTOR3 &m2);
 }
 
-MATRIX3 operator+(MATRIX3 a, MATRIX3 b);
-VECTOR3 rhmul(const MATRIX3 &A, const VECTOR3 &b);
-VECTOR3 rhtmul(const MATRIX3 &A, const VECTOR3 &b);
+inline MATRIX3 operator+(const MATRIX3 &a, const MATRIX3 &b)
+{
+	return _M(a.m11 + b.m11, a.m12 + b.m12, a.m13 + b.m13, a.m21 + b.m21, a.m22 + b.m22, a.m23 + b.m23, a.m31 + b.m31, a.m32 + b.m32, a.m33 + b.m33);
+}
+
+inline VECTOR3 rhmul(const MATRIX3 &A, const VECTOR3 &b)	//For the left handed Orbiter matrizes, A is left handed, b is right handed, result is right handed
+{
+	return _V(
+		A.m11*b.x + A.m12*b.z + A.m13*b.y,
+		A.m31*b.x + A.m32*b.z + A.m33*b.y,
+		A.m21*b.x + A.m22*b.z + A.m23*b.y);
+}
+
+inline VECTOR3 rhtmul(const MATRIX3 &A, const VECTOR3 &b)
+{
+	return _V(
+		A.m11*b.x + A.m21*b.z + A.m31*b.y,
+		A.m13*b.x + A.m23*b.z + A.m33*b.y,
+		A.m12*b.x + A.m22*b.z + A.m32*b.y);
+}
 
 //void(*)(double*, double, double*)
 #endif
\ No newline at end of file
@@ -28,6 +28,7 @@
 
 #include "nasspdefs.h"
 #include "LES.h"
+#include "stagemesh.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -159,14 +160,16 @@ void LES::InitLES()
 void LES::SetLES()
 
 {
-	ClearMeshes();
-	VECTOR3 mesh_dir=_V(0,0,0);
-	
-	SetSize (4);
-	SetPMI (_V(20, 20, 10));
-	SetCrossSections (_V(8.5, 8.5, 12.5));
-
-	SetCOG_elev (2.0);
+	StageConfig &config = StageConfigRegistry::Get(ProbeAttached ? "LES/Probe" : "LES");
+	if (config.IsEmpty())
+	{
+		config.AddMesh(hLES, _V(0, 0, 0));
+		if (ProbeAttached)
+			config.AddMesh(hPROBE, _V(0, 0, -4.95));
+		config.SetFigures(4, _V(20, 20, 10), _V(8.5, 8.5, 12.5), 2.0);
+	}
+
+	config.ApplyFigures(this);
 	SetCW (5.5, 0.1, 3.4, 3.4);
 	SetRotDrag (_V(0.07,0.07,0.003));
 
@@ -174,17 +177,10 @@ void LES::SetLES()
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
 
-    ClearMeshes();
     ClearExhaustRefs();
     ClearAttExhaustRefs();
 
-	AddMesh (hLES, &mesh_dir);
-
-	if (ProbeAttached)
-	{
-		mesh_dir = _V(0, 0, -4.95);
-		AddMesh(hPROBE, &mesh_dir);
-	}
+	config.ApplyMeshes(this);
 
 	SetEmptyMass (EmptyMass);
 
@@ -524,11 +520,7 @@ DLLCLBK void ovcExit (VESSEL *vessel)
 	--refcount;
 
 	if (!refcount) {
-
-		//
-		// This code could tidy up allocations when refcount == 0
-		//
-
+		StageConfigRegistry::Clear();
 	}
 
 	if (vessel) 
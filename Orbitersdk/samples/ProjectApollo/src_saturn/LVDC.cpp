@@ -46,11 +46,18 @@
 #include "s1b.h"
 #include "../src_rtccmfd/OrbMech.h"
 #include "LVDC.h"
+#include "igm.h"
+#include "scenariofields.h"
+#include "tracelog.h"
+
+// Scenario field tables, filled by the first instance that loads or saves
+static ScenarioFieldTable LVDC1BScenarioFields;
+static ScenarioFieldTable LVDCScenarioFields;
 
 //#define _CRT_SECURE_CPP_OVERLOAD_STANDARD_NAMES 1
 
 // Constructor
-LVDC1B::LVDC1B(){
+LVDC1B::LVDC1B() : cycleTimer("LVDC1B") {
 	int x=0;
 	Initialized = false;					// Reset cloberness flag
 	// Zeroize
@@ -229,6 +236,9 @@ LVDC1B::LVDC1B(){
 	S_2 = 0;
 	S_P = 0;
 	S_Y = 0;
+	minorLoopTime = 0;
+	guidanceTime = 0;
+	padForce = 0;
 	sinceLastIGM = 0;
 	sin_chi_Yit = 0;
 	sin_chi_Zit = 0;
@@ -333,12 +343,10 @@ LVDC1B::LVDC1B(){
 void LVDC1B::init(Saturn* own){
 	if(Initialized == true){ 
 		if(owner == own){
-			fprintf(lvlog,"init called after init, ignored\r\n");
-			fflush(lvlog);
+			TraceLog::Printf(TRACE_LVDC, "init called after init, ignored\r\n");
 			return;
 		}else{
-			fprintf(lvlog,"init called after init with new owner, proceeding\r\n");
-			fflush(lvlog);
+			TraceLog::Printf(TRACE_LVDC, "init called after init with new owner, proceeding\r\n");
 		}
 	}
 	owner = own;
@@ -550,14 +558,15 @@ void LVDC1B::init(Saturn* own){
 	LVDC_TB_ETime = 0;
 	LVDC_Stop = false;
 	IGMCycle = 0;
+	minorLoopTime = 0;
+	guidanceTime = 0;
+	padForce = 0;
 	sinceLastIGM = 0;
 	// INTERNAL (NON-REAL-LVDC) FLAGS
 	LVDC_EI_On = false;
 	S1B_Sep_Time = 0;
 	CountPIPA = false;
-	if(!Initialized){ lvlog = fopen("lvlog1b.txt","w+"); } // Don't reopen the log if it's already open
-	fprintf(lvlog,"init complete\r\n");
-	fflush(lvlog);
+	TraceLog::Printf(TRACE_LVDC, "init complete\r\n");
 	Initialized = true;
 }
 	
@@ -565,6 +574,41 @@ void LVDC1B::init(Saturn* own){
 void LVDC1B::TimeStep(double simt, double simdt) {
 	// Bail if uninitialized
 	if(owner == NULL){ return; }
+
+	// Frames shorter than a minor loop run no cycle
+	minorLoopTime += simdt;
+	int loops = (int)(minorLoopTime / LVDC_MINOR_LOOP_PERIOD);
+	double dt = LVDC_MINOR_LOOP_PERIOD;
+	if (loops > LVDC_MAX_MINOR_LOOPS) {
+		loops = LVDC_MAX_MINOR_LOOPS;
+		dt = minorLoopTime / loops;
+	}
+
+	// Each cycle runs the event sequencing at its own mission time. The vehicle only moves
+	// once per frame, so only the last cycle samples the IMU and runs guidance.
+	// Staging or a stop ends the frame; what's left runs on the next one.
+	int stage = owner->stage;
+	bool stop = LVDC_Stop;
+	int run = 0;
+	cycleTimer.Start();
+	while (run < loops) {
+		minorLoopTime -= dt;
+		run++;
+		Cycle(simt, dt, owner->MissionTime - minorLoopTime, run == loops);
+		if (owner->stage != stage || LVDC_Stop != stop) { break; }
+	}
+	cycleTimer.Stop(simdt, run);
+
+	// An added force only acts for one frame, so the hold-down and release pin force
+	// is added on every frame, whether a cycle ran or not.
+	if (padForce != 0.0) {
+		owner->AddForce(_V(0, 0, padForce), _V(0, 0, 0));
+	}
+}
+
+void LVDC1B::Cycle(double simt, double simdt, double mt, bool sample) {
+	IGMIntegrals I_1;										// IGM stage integrals
+	padForce = 0.0;
 	// Update timebase ET
 	LVDC_TB_ETime += simdt;
 	
@@ -578,7 +622,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 
 				// Prelaunch tank venting between -3:00h and engine ignition
 				// No clue if the venting start time is correct
-				if (owner->MissionTime < -10800){
+				if (mt < -10800){
 					owner->DeactivatePrelaunchVenting();
 				}else{
 					owner->ActivatePrelaunchVenting();
@@ -586,12 +630,12 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 
 				// BEFORE PTL COMMAND (T-00:20:00) STOPS HERE
 				{
-					double Source  = fabs(owner->MissionTime);
+					double Source  = fabs(mt);
 					double Minutes = Source/60;
 					double Hours   = (int)Minutes/60;				
 					double Seconds = Source - ((int)Minutes*60);
 					Minutes       -= Hours*60;
-					if (owner->MissionTime < -1200){
+					if (mt < -1200){
 						//sprintf(oapiDebugString(),"LVDC: T - %d:%d:%.2f | AWAITING PTL INTERRUPT",(int)Hours,(int)Minutes,Seconds);
 						lvimu.ZeroIMUCDUFlag = true;					// Zero IMU CDUs
 						break;
@@ -602,13 +646,13 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 			
 				// WAIT FOR GRR
 				// Engine lights on at T-00:04:10
-				if (owner->MissionTime >= -250 && LVDC_EI_On == false) { LVDC_EI_On = true; }
+				if (mt >= -250 && LVDC_EI_On == false) { LVDC_EI_On = true; }
 
 				// Between PTL signal and GRR, we monitor the IMU for any failure signals and do vehicle self-tests.
 				// At GRR we transfer control to the flight program and start TB0.
 
 				// BEFORE GRR (T-00:00:17) STOPS HERE
-				if (owner->MissionTime >= -17){
+				if (mt >= -17){
 					lvimu.ZeroIMUCDUFlag = false;					// Release IMU CDUs
 					if (owner->ApolloNo == 5)
 					{
@@ -640,7 +684,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				double thrst[4];	// Thrust Settings for 2-2-2-2 start (see below)
 
 				// At 10 seconds, play the countdown sound.
-				if (owner->MissionTime >= -10.3) { // Was -10.9
+				if (mt >= -10.3) { // Was -10.9
 					if (!owner->UseATC && owner->Scount.isValid()) {
 						owner->Scount.play();
 						owner->Scount.done();
@@ -648,7 +692,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				}
 
 				// Shut down venting at T - 9
-				if(owner->MissionTime > -9 && owner->prelaunchvent[0] != NULL) { owner->DeactivatePrelaunchVenting(); }
+				if(mt > -9 && owner->prelaunchvent[0] != NULL) { owner->DeactivatePrelaunchVenting(); }
 
 				// Engine startup was staggered 2-2-2-2, with engine 7+5 starting first, then 6+8, then 2+4, then 3+1
 			
@@ -661,7 +705,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				// Source: Apollo 7 LV Flight Evaluation
 
 				// Transition from seperate throttles to single throttle
-				if(owner->MissionTime < -0.715){ 
+				if(mt < -0.715){ 
 					int x=0; // Start Sequence Index
 					double tm_1,tm_2,tm_3,tm_4; // CC light, 1st rise start, and 2nd rise start, and 100% thrust times.
 					double SumThrust=0;
@@ -681,19 +725,19 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 						tm_2 = tm_1 + 0.3;  // Start of 1st rise
 						tm_3 = tm_2 + 0.085; // Start of 2nd rise
 						tm_4 = tm_3 + 0.75; // End of 2nd rise
-						if(owner->MissionTime >= tm_1){
+						if(mt >= tm_1){
 							// Light CC
-							if(owner->MissionTime < tm_2){
+							if(mt < tm_2){
 								// Idle at 2.5% thrust
 								thrst[x] = 0.025;
 							}else{
-								if(owner->MissionTime < tm_3){
+								if(mt < tm_3){
 									// the actual rise is so fast that any 'smoothing' is pointless
 									thrst[x] = 0.93;
 								}else{
-									if(owner->MissionTime < tm_4){
+									if(mt < tm_4){
 										// Rise to 100% at a rate of 9 percent per second.
-										thrst[x] = 0.93+(0.09*(owner->MissionTime-tm_3));
+										thrst[x] = 0.93+(0.09*(mt-tm_3));
 									}else{
 										// Hold 100%
 										thrst[x] = 1;
@@ -717,17 +761,17 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 						owner->SetThrusterLevel(owner->th_main[7],thrst[1]); // Engine 8
 
 						owner->contrailLevel = SumThrust/8;
-						owner->AddForce(_V(0, 0, -10. * owner->THRUST_FIRST_VAC), _V(0, 0, 0)); // Maintain hold-down lock
+						padForce = -10. * owner->THRUST_FIRST_VAC; // Maintain hold-down lock
 					}
 				}else{
 					// Get 100% thrust on all engines.
 					//sprintf(oapiDebugString(),"LVDC: T %f | TB0 + %f | TH = 100%%",owner->MissionTime,LVDC_TB_ETime);
 					owner->SetThrusterGroupLevel(owner->thg_main,1);
 					owner->contrailLevel = 1;				
-					owner->AddForce(_V(0, 0, -10. * owner->THRUST_FIRST_VAC), _V(0, 0, 0));
+					padForce = -10. * owner->THRUST_FIRST_VAC;
 				}
 
-				if(owner->MissionTime >= 0){
+				if(mt >= 0){
 					LVDC_Timebase = 1;
 					LVDC_TB_ETime = 0;	
 				}
@@ -755,9 +799,9 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				}
 
 				// Soft-Release Pin Dragging
-				if(owner->MissionTime < 0.5){
-					double PinDragFactor = 1 - (owner->MissionTime*2);
-					owner->AddForce(_V(0, 0, -(owner->THRUST_FIRST_VAC * PinDragFactor)), _V(0, 0, 0));
+				if(mt < 0.5){
+					double PinDragFactor = 1 - (mt*2);
+					padForce = -(owner->THRUST_FIRST_VAC * PinDragFactor);
 				}
 
 				// Below here are timed events that must not be dependent on the iteration delay.
@@ -771,7 +815,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				*/
 
 				// S1B CECO TRIGGER:
-				if(owner->MissionTime > 140.86){ // Apollo 7
+				if(mt > 140.86){ // Apollo 7
 					owner->SetThrusterResource(owner->th_main[4], NULL);
 					owner->SetThrusterResource(owner->th_main[5], NULL);
 					owner->SetThrusterResource(owner->th_main[6], NULL);
@@ -792,8 +836,8 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				// Done by low-level sensor.
 				if (owner->stage == LAUNCH_STAGE_ONE && owner->GetFuelMass() <= 0){
 					// For S1C thruster calibration
-					fprintf(lvlog,"[T+%f] S1C OECO - Thrust %f N @ Alt %f\r\n\r\n",
-						owner->MissionTime,owner->GetThrusterMax(owner->th_main[0]),owner->GetAltitude());
+					TraceLog::Printf(TRACE_LVDC, "[T+%f] S1C OECO - Thrust %f N @ Alt %f\r\n\r\n",
+						mt,owner->GetThrusterMax(owner->th_main[0]),owner->GetAltitude());
 
 					// Move hidden S1B
 					if (owner->hstg1) {
@@ -803,7 +847,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 						stage1->DefSetState(&vs);
 					}				
 					// Set timer
-					S1B_Sep_Time = owner->MissionTime;
+					S1B_Sep_Time = mt;
 					// Engine Shutdown
 					int i;
 					for (i = 0; i < 5; i++){
@@ -837,7 +881,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				}
 				if(LVDC_TB_ETime > 311.5 && MRS == false){
 					// MR Shift
-					fprintf(lvlog,"[TB%d+%f] MR Shift\r\n",LVDC_Timebase,LVDC_TB_ETime);
+					TraceLog::Printf(TRACE_LVDC, "[TB%d+%f] MR Shift\r\n",LVDC_Timebase,LVDC_TB_ETime);
 					// sprintf(oapiDebugString(),"LVDC: EMR SHIFT"); LVDC_GP_PC = 30; break;
 					owner->SwitchSelector(23);
 					MRS = true;
@@ -860,11 +904,11 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 							owner->SetThrusterLevel(owner->th_main[0], 0);
 						}
 					}
-					fprintf(lvlog,"S4B CUTOFF: Time %f Thrust %f\r\n",LVDC_TB_ETime,owner->GetThrusterLevel(owner->th_main[0]));
+					TraceLog::Printf(TRACE_LVDC, "S4B CUTOFF: Time %f Thrust %f\r\n",LVDC_TB_ETime,owner->GetThrusterLevel(owner->th_main[0]));
 				}
 				if (LVDC_TB_ETime >= 10 && LVDC_EI_On == true){
 					owner->SetStage(STAGE_ORBIT_SIVB);
-					fprintf(lvlog,"[TB%d+%f] Set STAGE_ORBIT_SIVB\r\n",LVDC_Timebase,LVDC_TB_ETime);
+					TraceLog::Printf(TRACE_LVDC, "[TB%d+%f] Set STAGE_ORBIT_SIVB\r\n",LVDC_Timebase,LVDC_TB_ETime);
 					LVDC_EI_On = false;
 				}
 				if(LVDC_TB_ETime > 100){
@@ -887,11 +931,11 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 					}
 				}
 				// Fuel boiloff every ten seconds.
-				if (owner->MissionTime >= owner->NextMissionEventTime){
+				if (mt >= owner->NextMissionEventTime){
 					if (owner->GetThrusterLevel(owner->th_main[0]) < 0.5){
 						owner->SIVBBoiloff();					
 					}
-					owner->NextMissionEventTime = owner->MissionTime+10.0;				
+					owner->NextMissionEventTime = mt+10.0;				
 				}
 				// CSM/LV separation
 				if(owner->CSMLVPyros.Blown()){
@@ -948,20 +992,22 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 
 				break;
 		}
-		lvimu.Timestep(simt);								// Give a timestep to the LV IMU
-		lvrg.Timestep(simdt);								// and RG
+		if (sample) {
+			lvimu.Timestep(simt);							// Give a timestep to the LV IMU
+			lvrg.Timestep(simdt);							// and RG
+		}
 		CurrentAttitude = lvimu.GetTotalAttitude();			// Get current attitude
 		/*
-		if (lvimu.Operate) { fprintf(lvlog, "IMU: Operate\r\n"); }else{ fprintf(lvlog, "ERROR: IMU: NO-Operate\r\n"); }
-		if (lvimu.TurnedOn) { fprintf(lvlog, "IMU: Turned On\r\n"); }else{ fprintf(lvlog, "ERROR: IMU: Turned OFF\r\n"); }
-		if (lvimu.ZeroIMUCDUFlag) { fprintf(lvlog, "IMU: ERROR: Zero-IMU-CDU-Flag\r\n"); }
-		if (lvimu.CoarseAlignEnableFlag) { fprintf(lvlog, "IMU: ERROR: Coarse-Align-Enable-Flag\r\n"); }
-		if (lvimu.Caged) { fprintf(lvlog, "IMU: ERROR: Caged\r\n"); }
+		if (lvimu.Operate) { TraceLog::Printf(TRACE_LVDC, "IMU: Operate\r\n"); }else{ TraceLog::Printf(TRACE_LVDC, "ERROR: IMU: NO-Operate\r\n"); }
+		if (lvimu.TurnedOn) { TraceLog::Printf(TRACE_LVDC, "IMU: Turned On\r\n"); }else{ TraceLog::Printf(TRACE_LVDC, "ERROR: IMU: Turned OFF\r\n"); }
+		if (lvimu.ZeroIMUCDUFlag) { TraceLog::Printf(TRACE_LVDC, "IMU: ERROR: Zero-IMU-CDU-Flag\r\n"); }
+		if (lvimu.CoarseAlignEnableFlag) { TraceLog::Printf(TRACE_LVDC, "IMU: ERROR: Coarse-Align-Enable-Flag\r\n"); }
+		if (lvimu.Caged) { TraceLog::Printf(TRACE_LVDC, "IMU: ERROR: Caged\r\n"); }
 		*/
 		AttRate = lvrg.GetRates();							// Get rates	
 		//This is the actual LVDC code & logic; has to be independent from any of the above events
-		if(LVDC_GRR && GRR_init == false){			
-			fprintf(lvlog,"[T%f] GRR received!\r\n",owner->MissionTime);
+		if(sample && LVDC_GRR && GRR_init == false){			
+			TraceLog::Printf(TRACE_LVDC, "[T%f] GRR received!\r\n",mt);
 
 			// Initial Position & Velocity
 			MATRIX3 rot;
@@ -971,46 +1017,46 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 			oapiGetPlanetObliquityMatrix(oapiGetGbodyByName("Earth"),&rot);
 			PosS = tmul(rot,PosS);
 			Dot0 = tmul(rot,Dot0);
-			fprintf(lvlog,"EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
-			fprintf(lvlog,"EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
 			double rad      = sqrt  (PosS.x*PosS.x + PosS.y*PosS.y + PosS.z*PosS.z);
 			phi_lng    = atan2 (PosS.z, PosS.x);
 			phi_lat    = asin  (PosS.y/rad);
 			cos_phi_L = cos(phi_lat);
 			sin_phi_L = sin(phi_lat);
-			fprintf(lvlog, "Latitude = %f, Longitude = %f\r\n", phi_lat*DEG, phi_lng*DEG);
-			fprintf(lvlog, "cos_phi_l = %f, sin_phi_l = %f\r\n", cos_phi_L, sin_phi_L);
+			TraceLog::Printf(TRACE_LVDC, "Latitude = %f, Longitude = %f\r\n", phi_lat*DEG, phi_lng*DEG);
+			TraceLog::Printf(TRACE_LVDC, "cos_phi_l = %f, sin_phi_l = %f\r\n", cos_phi_L, sin_phi_L);
 			rot.m11 = cos(phi_lng); rot.m12 = 0; rot.m13 = sin(phi_lng);
 			rot.m21 = 0; rot.m22 = 1; rot.m23 = 0;
 			rot.m31 = -sin(phi_lng); rot.m32 = 0; rot.m33 = cos(phi_lng);
 			PosS = mul(rot,PosS);
 			Dot0 = mul(rot,Dot0);
-			fprintf(lvlog,"Rot:longitude\r\n");
-			fprintf(lvlog,"EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
-			fprintf(lvlog,"EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
+			TraceLog::Printf(TRACE_LVDC, "Rot:longitude\r\n");
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
 			rot.m11 = cos(-phi_lat); rot.m12 = -sin(-phi_lat); rot.m13 = 0;
 			rot.m21 = sin(-phi_lat); rot.m22 = cos(-phi_lat); rot.m23 = 0;
 			rot.m31 = 0; rot.m32 = 0; rot.m33 = 1;
 			PosS = mul(rot,PosS);
 			Dot0 = mul(rot,Dot0);
-			fprintf(lvlog,"Rot:latitude\r\n");
-			fprintf(lvlog,"EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
-			fprintf(lvlog,"EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
+			TraceLog::Printf(TRACE_LVDC, "Rot:latitude\r\n");
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
 			
 			// Time into launch window = launch time from midnight - reference time of launch from midnight
 			// azimuth = coeff. of azimuth polynomial * time into launch window
 
 			// preset to fixed value to be independent from any external stuff
 			Azimuth = 72.0;
-			fprintf(lvlog,"Azimuth = %f\r\n",Azimuth);
+			TraceLog::Printf(TRACE_LVDC, "Azimuth = %f\r\n",Azimuth);
 			rot.m11 = 1; rot.m12 = 0; rot.m13 = 0;
 			rot.m21 = 0; rot.m22 = cos((90-Azimuth)*RAD); rot.m23 = -sin((90-Azimuth)*RAD);
 			rot.m31 = 0; rot.m32 = sin((90-Azimuth)*RAD); rot.m33 = cos((90-Azimuth)*RAD);
 			PosS = mul(rot,PosS);
 			Dot0 = mul(rot,Dot0);
-			fprintf(lvlog,"Rot:azimuth\r\n");
-			fprintf(lvlog,"EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
-			fprintf(lvlog,"EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
+			TraceLog::Printf(TRACE_LVDC, "Rot:azimuth\r\n");
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n",Dot0.x,Dot0.y,Dot0.z);
 			PosS.y = -PosS.y;
 			Dot0.y = -Dot0.y;
 			// Azo and Azs are used to scale the polys below. These numbers are from Apollo 11.
@@ -1032,7 +1078,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 			}
 			// Let's cheat a little. (Apollo 7)
 			Inclination = 31.605;
-			fprintf(lvlog,"Inclination = %f\r\n",Inclination);
+			TraceLog::Printf(TRACE_LVDC, "Inclination = %f\r\n",Inclination);
 
 			if(theta_N_op == true){
 				// CALCULATE DESCENDING NODAL ANGLE FROM AZIMUTH
@@ -1049,31 +1095,31 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 			
 			// Cheat a little more. (Apollo 7)
 			DescNodeAngle = 119.0; 
-			fprintf(lvlog,"DescNodeAngle = %f\r\n",DescNodeAngle);
+			TraceLog::Printf(TRACE_LVDC, "DescNodeAngle = %f\r\n",DescNodeAngle);
 
 			// Need to make those into radians
 			Azimuth *= RAD;
 			Inclination *= RAD;
 			DescNodeAngle *= RAD;
 
-			fprintf(lvlog,"Rad Convert: Az / Inc / DNA = %f %f %f\r\n",Azimuth,Inclination,DescNodeAngle);
+			TraceLog::Printf(TRACE_LVDC, "Rad Convert: Az / Inc / DNA = %f %f %f\r\n",Azimuth,Inclination,DescNodeAngle);
 
 			if (TerminalConditions == false)
 			{
 				// p is the semi-latus rectum of the desired terminal ellipse.
 				p = (mu / C_3)*(pow(e, 2) - 1);
-				fprintf(lvlog, "p = %f, mu = %f, e2 = %f, mu/C_3 = %f\r\n", p, mu, pow(e, 2), mu / C_3);
+				TraceLog::Printf(TRACE_LVDC, "p = %f, mu = %f, e2 = %f, mu/C_3 = %f\r\n", p, mu, pow(e, 2), mu / C_3);
 
 				// K_5 is the IGM terminal velocity constant
 				K_5 = sqrt(mu / p);
-				fprintf(lvlog, "K_5 = %f\r\n", K_5);
+				TraceLog::Printf(TRACE_LVDC, "K_5 = %f\r\n", K_5);
 
 				R_T = p / (1 + (e*(cos(f))));
 				V_T = K_5*sqrt((1 + ((2 * e)*(cos(f))) + pow(e, 2)));
 				gamma_T = atan((e*(sin(f))) / (1 + (e*(cos(f)))));
 				G_T = -mu / pow(R_T, 2);
 			}
-			fprintf(lvlog,"R_T = %f (Expecting 6,563,366), V_T = %f (Expecting 7793.0429), gamma_T = %f\r\n",R_T,V_T,gamma_T);
+			TraceLog::Printf(TRACE_LVDC, "R_T = %f (Expecting 6,563,366), V_T = %f (Expecting 7793.0429), gamma_T = %f\r\n",R_T,V_T,gamma_T);
 
 			// G MATRIX CALCULATION
 			MX_A.m11 = cos_phi_L;  MX_A.m12 = sin_phi_L*sin(Azimuth); MX_A.m13 = -(sin_phi_L*cos(Azimuth));
@@ -1100,19 +1146,28 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 			lvimu.ZeroPIPACounters();
 			sinceLastIGM = 0;
 			GRR_init = true;
-			fprintf(lvlog,"Initialization completed.\r\n\r\n");
+			TraceLog::Printf(TRACE_LVDC, "Initialization completed.\r\n\r\n");
 			goto minorloop;
 		}
 		// various clocks the LVDC needs...
 		if(LVDC_GRR == true){ TAS += simdt; } //time since GRR
 		if(liftoff == true){ t_clock += simdt; } //time since liftoff
+
+		// Catch-up cycles stop here; the sampled cycle runs guidance over all of their time.
+		if (!sample) {
+			guidanceTime += simdt;
+			goto guidanceskip;
+		}
+		simdt += guidanceTime;
+		guidanceTime = 0;
+
 		sinceLastIGM += simdt;
 		if(sinceLastIGM < 1.7){ goto minorloop; }
 		dt_c = sinceLastIGM;
 		IGMInterval = sinceLastIGM;
 		sinceLastIGM = 0;
 		IGMCycle++;				// For debugging
-		fprintf(lvlog,"[%d+%f] *** Major Loop %d ***\r\n",LVDC_Timebase,LVDC_TB_ETime,IGMCycle);
+		TraceLog::Printf(TRACE_LVDC, "[%d+%f] *** Major Loop %d ***\r\n",LVDC_Timebase,LVDC_TB_ETime,IGMCycle);
 		//powered flight nav
 		if(LVDC_GRR == true){
 			if(poweredflight == true){
@@ -1143,25 +1198,25 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 			DotM_last = DotM_act;
 			DotG_last = DotG_act;
 			ddotG_last = ddotG_act;
-			fprintf(lvlog,"Navigation \r\n");
-			fprintf(lvlog,"Inertial Attitude: %f %f %f \r\n",CurrentAttitude.x*DEG,CurrentAttitude.y*DEG,CurrentAttitude.z*DEG);
-			fprintf(lvlog,"DotM: %f %f %f \r\n", DotM_act.x,DotM_act.y,DotM_act.z);
-			fprintf(lvlog,"Gravity velocity: %f %f %f \r\n", DotG_act.x,DotG_act.y,DotG_act.z);
-			fprintf(lvlog,"EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
-			fprintf(lvlog,"EarthRel Velocity: %f %f %f \r\n",DotS.x,DotS.y,DotS.z);
-			fprintf(lvlog,"Sensed Acceleration: %f \r\n",Fm);	
-			fprintf(lvlog,"Gravity Acceleration: %f \r\n",CG);	
-			fprintf(lvlog,"Total Velocity: %f \r\n",V);
-			fprintf(lvlog,"Dist. from Earth's Center: %f \r\n",R);
-			fprintf(lvlog,"S: %f \r\n",S);
-			fprintf(lvlog,"P: %f \r\n",P);
+			TraceLog::Printf(TRACE_LVDC, "Navigation \r\n");
+			TraceLog::Printf(TRACE_LVDC, "Inertial Attitude: %f %f %f \r\n",CurrentAttitude.x*DEG,CurrentAttitude.y*DEG,CurrentAttitude.z*DEG);
+			TraceLog::Printf(TRACE_LVDC, "DotM: %f %f %f \r\n", DotM_act.x,DotM_act.y,DotM_act.z);
+			TraceLog::Printf(TRACE_LVDC, "Gravity velocity: %f %f %f \r\n", DotG_act.x,DotG_act.y,DotG_act.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n",PosS.x,PosS.y,PosS.z);
+			TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n",DotS.x,DotS.y,DotS.z);
+			TraceLog::Printf(TRACE_LVDC, "Sensed Acceleration: %f \r\n",Fm);	
+			TraceLog::Printf(TRACE_LVDC, "Gravity Acceleration: %f \r\n",CG);	
+			TraceLog::Printf(TRACE_LVDC, "Total Velocity: %f \r\n",V);
+			TraceLog::Printf(TRACE_LVDC, "Dist. from Earth's Center: %f \r\n",R);
+			TraceLog::Printf(TRACE_LVDC, "S: %f \r\n",S);
+			TraceLog::Printf(TRACE_LVDC, "P: %f \r\n",P);
 			lvimu.ZeroPIPACounters();
 		}
 		if(liftoff == false){//liftoff not received; initial roll command for FCC
 			CommandedAttitude.x =  (360-100)*RAD + Azimuth;
 			CommandedAttitude.y =  0;
 			CommandedAttitude.z =  0;
-			fprintf(lvlog,"[%d+%f] Initial roll command: %f\r\n",LVDC_Timebase,LVDC_TB_ETime,CommandedAttitude.x*DEG);
+			TraceLog::Printf(TRACE_LVDC, "[%d+%f] Initial roll command: %f\r\n",LVDC_Timebase,LVDC_TB_ETime,CommandedAttitude.x*DEG);
 			goto minorloop;
 		}
 		if(BOOST == false){//i.e. we're either in orbit or boosting out of orbit
@@ -1177,7 +1232,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 				//S1B engine out interrupt handling
 				T_EO1 = 1;
 				t_fail = t_clock;
-				fprintf(lvlog,"[%d+%f] S1B engine out interrupt received! t_fail = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_fail);
+				TraceLog::Printf(TRACE_LVDC, "[%d+%f] S1B engine out interrupt received! t_fail = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_fail);
 			}
 			if(t_clock > t_1){
 				//roll/pitch program
@@ -1190,12 +1245,12 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 					if(t_5 < t_clock){ dT_F = 0; }
 					t_6 = t_clock + dT_F;
 					T_ar = T_ar + (0.25*(T_ar - t_fail));
-					fprintf(lvlog,"[%d+%f] Freeze time recalculated! t_6 = %f T_ar = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_6,T_ar);
+					TraceLog::Printf(TRACE_LVDC, "[%d+%f] Freeze time recalculated! t_6 = %f T_ar = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_6,T_ar);
 				}
 				if(t_clock >= t_6){
 					if (t_clock > T_ar){
 						//time for pitch freeze?
-						fprintf(lvlog,"[%d+%f] Pitch freeze! \r\n",LVDC_Timebase,LVDC_TB_ETime);
+						TraceLog::Printf(TRACE_LVDC, "[%d+%f] Pitch freeze! \r\n",LVDC_Timebase,LVDC_TB_ETime);
 						CommandedAttitude.y = PCommandedAttitude.y;
 						CommandedAttitude.x = 360 * RAD;
 						CommandedAttitude.z = 0;
@@ -1215,7 +1270,7 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 						CommandedAttitude.y = cmd * RAD;
 						CommandedAttitude.x = 360 * RAD;
 						CommandedAttitude.z = 0;
-						fprintf(lvlog,"[%d+%f] Roll/pitch programm %f \r\n",LVDC_Timebase,LVDC_TB_ETime,cmd);
+						TraceLog::Printf(TRACE_LVDC, "[%d+%f] Roll/pitch programm %f \r\n",LVDC_Timebase,LVDC_TB_ETime,cmd);
 						goto limittest;
 					}
 				}else{
@@ -1234,138 +1289,134 @@ void LVDC1B::TimeStep(double simt, double simdt) {
 		}
 		if(HSL == false){		
 			// If we are not in the high-speed loop
-			fprintf(lvlog,"HSL False\r\n");
+			TraceLog::Printf(TRACE_LVDC, "HSL False\r\n");
 			// IGM STAGE LOGIC
 			if(MRS == true){
-				fprintf(lvlog,"Post-MRS\n");
+				TraceLog::Printf(TRACE_LVDC, "Post-MRS\n");
 				if(t_B1 <= t_B3){
 					tau2 = V_ex2/Fm;
-					fprintf(lvlog,"Normal Tau: tau2 = %f, F/m = %f, m = %f \r\n",tau2,Fm,owner->GetMass());
+					TraceLog::Printf(TRACE_LVDC, "Normal Tau: tau2 = %f, F/m = %f, m = %f \r\n",tau2,Fm,owner->GetMass());
 				}else{
 					// This is the "ARTIFICIAL TAU" code.
 					t_B3 += dt_c; 
 					tau2 = tau2+(T_1*(dotM_1/dotM_2));
-					fprintf(lvlog,"Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
-					fprintf(lvlog,"Diff: %f \r\n",(tau2-(V_ex2/Fm)));
+					TraceLog::Printf(TRACE_LVDC, "Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
+					TraceLog::Printf(TRACE_LVDC, "Diff: %f \r\n",(tau2-(V_ex2/Fm)));
 					T_2 = T_2+T_1*(dotM_1/dotM_2);
 					T_1 = 0;
-					fprintf(lvlog,"T_1 = 0\r\nT_2 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,dotM_1,dotM_2);
+					TraceLog::Printf(TRACE_LVDC, "T_1 = 0\r\nT_2 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,dotM_1,dotM_2);
 				}					
 			}else{
-				fprintf(lvlog,"Pre-MRS\n");
+				TraceLog::Printf(TRACE_LVDC, "Pre-MRS\n");
 				if(T_1 < 0){	// If we're out of first-stage IGM time
 					// Artificial Tau
 					tau2 = tau2+(T_1*(dotM_1/dotM_2));
-					fprintf(lvlog,"Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
+					TraceLog::Printf(TRACE_LVDC, "Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
 					T_2 = T_2+T_1*(dotM_1/dotM_2);
 					T_1 = 0;
-					fprintf(lvlog,"T_2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,T_1,dotM_1,dotM_2);		
+					TraceLog::Printf(TRACE_LVDC, "T_2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,T_1,dotM_1,dotM_2);		
 				}else{															
 					tau1 = V_ex1/Fm; 
-					fprintf(lvlog,"Normal Tau: tau1 = %f, F/m = %f m = %f\r\n",tau1,Fm, owner->GetMass());
+					TraceLog::Printf(TRACE_LVDC, "Normal Tau: tau1 = %f, F/m = %f m = %f\r\n",tau1,Fm, owner->GetMass());
 				}
 			}
-			fprintf(lvlog,"--- STAGE INTEGRAL LOGIC ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- STAGE INTEGRAL LOGIC ---\r\n");
 			// CHI-TILDE LOGIC
 			// STAGE INTEGRAL CALCULATIONS				
 			Pos4 = mul(MX_G,PosS);
-			fprintf(lvlog,"Pos4 = %f, %f, %f\r\n",Pos4.x,Pos4.y,Pos4.z);
-			fprintf(lvlog,"T_1 = %f,T_2 = %f\r\n",T_1,T_2);
-			L_1 = V_ex1 * log(tau1 / (tau1-T_1));
-			J_1 = (L_1 * tau1) - (V_ex1 * T_1);
-			S_1 = (L_1 * T_1) - J_1;
-			Q_1 = (S_1 * tau1) - ((V_ex1 * pow(T_1,2)) / 2);
-			P_1 = (J_1 * tau1) - ((V_ex1 * pow(T_1,2)) / 2);
-			U_1 = (Q_1 * tau1) - ((V_ex1 * pow(T_1,3)) / 6);
-			fprintf(lvlog,"L_1 = %f, J_1 = %f, S_1 = %f, Q_1 = %f, P_1 = %f, U_1 = %f\r\n",L_1,J_1,S_1,Q_1,P_1,U_1);
+			TraceLog::Printf(TRACE_LVDC, "Pos4 = %f, %f, %f\r\n",Pos4.x,Pos4.y,Pos4.z);
+			TraceLog::Printf(TRACE_LVDC, "T_1 = %f,T_2 = %f\r\n",T_1,T_2);
+			IGMStageIntegrals(V_ex1, tau1, T_1, I_1);
+			L_1 = I_1.L; J_1 = I_1.J; S_1 = I_1.S; Q_1 = I_1.Q; P_1 = I_1.P; U_1 = I_1.U;
+			TraceLog::Printf(TRACE_LVDC, "L_1 = %f, J_1 = %f, S_1 = %f, Q_1 = %f, P_1 = %f, U_1 = %f\r\n",L_1,J_1,S_1,Q_1,P_1,U_1);
 
 			Lt_2 = V_ex2 * log(tau2 / (tau2-Tt_2));
-			fprintf(lvlog,"Lt_2 = %f, tau2 = %f, Tt_2 = %f\r\n",Lt_2,tau2,Tt_2);
+			TraceLog::Printf(TRACE_LVDC, "Lt_2 = %f, tau2 = %f, Tt_2 = %f\r\n",Lt_2,tau2,Tt_2);
 
 			Jt_2 = (Lt_2 * tau2) - (V_ex2 * Tt_2);
-			fprintf(lvlog,"Jt_2 = %f",Jt_2);
+			TraceLog::Printf(TRACE_LVDC, "Jt_2 = %f",Jt_2);
 			Lt_Y = (L_1 + Lt_2);
-			fprintf(lvlog,", Lt_Y = %f\r\n",Lt_Y);
+			TraceLog::Printf(TRACE_LVDC, ", Lt_Y = %f\r\n",Lt_Y);
 
 			// SELECT RANGE OPTION				
 gtupdate:	// Target of jump from further down
-			fprintf(lvlog,"--- GT UPDATE ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- GT UPDATE ---\r\n");
 
 			// RANGE ANGLE 1
-			fprintf(lvlog,"RANGE ANGLE\r\n");
+			TraceLog::Printf(TRACE_LVDC, "RANGE ANGLE\r\n");
 			d2 = (V * Tt_T) - Jt_2 + (Lt_Y * Tt_2) - (ROV / V_ex2) * 
 				((tau1 - T_1) * L_1 + (tau2 - Tt_2) * Lt_2) *
 				(Lt_Y + V - V_T);
 			phi_T = ((atan2(Pos4.z,Pos4.x))+(((1/R_T)*(S_1+d2))*(cos(gamma_T))));
-			fprintf(lvlog,"V = %f, d2 = %f, phi_T = %f\r\n",V,d2,phi_T);				
+			TraceLog::Printf(TRACE_LVDC, "V = %f, d2 = %f, phi_T = %f\r\n",V,d2,phi_T);				
 
 			// FREEZE TERMINAL CONDITIONS TEST
 			if(!(Tt_T <= eps_3)){
 				// UPDATE TERMINAL CONDITIONS
-				fprintf(lvlog,"UPDATE TERMINAL CONDITIONS\r\n");
+				TraceLog::Printf(TRACE_LVDC, "UPDATE TERMINAL CONDITIONS\r\n");
 				f = phi_T + alpha_D;
 				R_T = p/(1+((e*(cos(f)))));
-				fprintf(lvlog,"f = %f, R_T = %f\r\n",f,R_T);
+				TraceLog::Printf(TRACE_LVDC, "f = %f, R_T = %f\r\n",f,R_T);
 				V_T = K_5 * pow(1+((2*e)*(cos(f)))+pow(e,2),0.5);
 				gamma_T = atan((e*(sin(f)))/(1+(e*(cos(f)))));
 				G_T = -mu/pow(R_T,2);
-				fprintf(lvlog,"V_T = %f, gamma_T = %f, G_T = %f\r\n",V_T,gamma_T,G_T);
+				TraceLog::Printf(TRACE_LVDC, "V_T = %f, gamma_T = %f, G_T = %f\r\n",V_T,gamma_T,G_T);
 			}
 
 			// UNROTATED TERMINAL CONDITIONS
-			fprintf(lvlog,"UNROTATED TERMINAL CONDITIONS\r\n");
+			TraceLog::Printf(TRACE_LVDC, "UNROTATED TERMINAL CONDITIONS\r\n");
 			xi_T = R_T;					
 			dot_zeta_T = V_T * (cos(gamma_T));
 			dot_xi_T = V_T * (sin(gamma_T));
 			ddot_zeta_GT = 0;
 			ddot_xi_GT = G_T;
-			fprintf(lvlog,"xi_T = %f, dot_zeta_T = %f, dot_xi_T = %f\r\n",xi_T,dot_zeta_T,dot_xi_T);
-			fprintf(lvlog,"ddot_zeta_GT = %f, ddot_xi_GT = %f\r\n",ddot_zeta_GT,ddot_xi_GT);
+			TraceLog::Printf(TRACE_LVDC, "xi_T = %f, dot_zeta_T = %f, dot_xi_T = %f\r\n",xi_T,dot_zeta_T,dot_xi_T);
+			TraceLog::Printf(TRACE_LVDC, "ddot_zeta_GT = %f, ddot_xi_GT = %f\r\n",ddot_zeta_GT,ddot_xi_GT);
 				
 			// ROTATION TO TERMINAL COORDINATES
-			fprintf(lvlog,"--- ROTATION TO TERMINAL COORDINATES ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- ROTATION TO TERMINAL COORDINATES ---\r\n");
 			// This is the last time PosS is referred to.
 			MX_phi_T.m11 = (cos(phi_T));    MX_phi_T.m12 = 0; MX_phi_T.m13 = ((sin(phi_T)));
 			MX_phi_T.m21 = 0;               MX_phi_T.m22 = 1; MX_phi_T.m23 = 0;
 			MX_phi_T.m31 = (-sin(phi_T)); MX_phi_T.m32 = 0; MX_phi_T.m33 = (cos(phi_T));
-			fprintf(lvlog,"MX_phi_T R1 = %f %f %f\r\n",MX_phi_T.m11,MX_phi_T.m12,MX_phi_T.m13);
-			fprintf(lvlog,"MX_phi_T R2 = %f %f %f\r\n",MX_phi_T.m21,MX_phi_T.m22,MX_phi_T.m23);
-			fprintf(lvlog,"MX_phi_T R3 = %f %f %f\r\n",MX_phi_T.m31,MX_phi_T.m32,MX_phi_T.m33);
+			TraceLog::Printf(TRACE_LVDC, "MX_phi_T R1 = %f %f %f\r\n",MX_phi_T.m11,MX_phi_T.m12,MX_phi_T.m13);
+			TraceLog::Printf(TRACE_LVDC, "MX_phi_T R2 = %f %f %f\r\n",MX_phi_T.m21,MX_phi_T.m22,MX_phi_T.m23);
+			TraceLog::Printf(TRACE_LVDC, "MX_phi_T R3 = %f %f %f\r\n",MX_phi_T.m31,MX_phi_T.m32,MX_phi_T.m33);
 
 			MX_K = mul(MX_phi_T,MX_G);
-			fprintf(lvlog,"MX_K R1 = %f %f %f\r\n",MX_K.m11,MX_K.m12,MX_K.m13);
-			fprintf(lvlog,"MX_K R2 = %f %f %f\r\n",MX_K.m21,MX_K.m22,MX_K.m23);
-			fprintf(lvlog,"MX_K R3 = %f %f %f\r\n",MX_K.m31,MX_K.m32,MX_K.m33);
+			TraceLog::Printf(TRACE_LVDC, "MX_K R1 = %f %f %f\r\n",MX_K.m11,MX_K.m12,MX_K.m13);
+			TraceLog::Printf(TRACE_LVDC, "MX_K R2 = %f %f %f\r\n",MX_K.m21,MX_K.m22,MX_K.m23);
+			TraceLog::Printf(TRACE_LVDC, "MX_K R3 = %f %f %f\r\n",MX_K.m31,MX_K.m32,MX_K.m33);
 
 			PosXEZ = mul(MX_K,PosS);
 			DotXEZ = mul(MX_K,DotS);	
-			fprintf(lvlog,"PosXEZ = %f %f %f\r\n",PosXEZ.x,PosXEZ.y,PosXEZ.z);
-			fprintf(lvlog,"DotXEZ = %f %f %f\r\n",DotXEZ.x,DotXEZ.y,DotXEZ.z);
+			TraceLog::Printf(TRACE_LVDC, "PosXEZ = %f %f %f\r\n",PosXEZ.x,PosXEZ.y,PosXEZ.z);
+			TraceLog::Printf(TRACE_LVDC, "DotXEZ = %f %f %f\r\n",DotXEZ.x,DotXEZ.y,DotXEZ.z);
 
 			VECTOR3 RTT_T1,RTT_T2;
 			RTT_T1.x = ddot_xi_GT; RTT_T1.y = 0;        RTT_T1.z = ddot_zeta_GT;
 			RTT_T2 = ddotG_act;
-			fprintf(lvlog,"RTT_T1 = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
-			fprintf(lvlog,"RTT_T2 = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T1 = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T2 = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
 
 			RTT_T2 = mul(MX_K,RTT_T2);
-			fprintf(lvlog,"RTT_T2 (mul) = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T2 (mul) = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
 
 			RTT_T1 = RTT_T1+RTT_T2;	  
-			fprintf(lvlog,"RTT_T1 (add) = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T1 (add) = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
 
 			ddot_xi_G   = 0.5*RTT_T1.x;
 			ddot_eta_G  = 0.5*RTT_T1.y;
 			ddot_zeta_G = 0.5*RTT_T1.z;
-			fprintf(lvlog,"ddot_XEZ_G = %f %f %f\r\n",ddot_xi_G,ddot_eta_G,ddot_zeta_G);
+			TraceLog::Printf(TRACE_LVDC, "ddot_XEZ_G = %f %f %f\r\n",ddot_xi_G,ddot_eta_G,ddot_zeta_G);
 
 			// ESTIMATED TIME-TO-GO
-			fprintf(lvlog,"--- ESTIMATED TIME-TO-GO ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- ESTIMATED TIME-TO-GO ---\r\n");
 
 			dot_dxit   = dot_xi_T - DotXEZ.x - (ddot_xi_G*Tt_T);
 			dot_detat  = -DotXEZ.y - (ddot_eta_G * Tt_T);
 			dot_dzetat = dot_zeta_T - DotXEZ.z - (ddot_zeta_G * Tt_T);
-			fprintf(lvlog,"dot_XEZt = %f %f %f\r\n",dot_dxit,dot_detat,dot_dzetat);
+			TraceLog::Printf(TRACE_LVDC, "dot_XEZt = %f %f %f\r\n",dot_dxit,dot_detat,dot_dzetat);
 			dV = pow((pow(dot_dxit,2)+pow(dot_detat,2)+pow(dot_dzetat,2)),0.5);
 			dL_2 = (((pow(dot_dxit,2)+pow(dot_detat,2)+pow(dot_dzetat,2))/Lt_Y)-Lt_Y)/2;
 			// if(dL_3 < 0){ sprintf(oapiDebugString(),"Est TTG: dL_3 %f (X/E/Z %f %f %f) @ Cycle %d (TB%d+%f)",dL_3,dot_dxit,dot_detat,dot_dzetat,IGMCycle,LVDC_Timebase,LVDC_TB_ETime);
@@ -1374,30 +1425,30 @@ gtupdate:	// Target of jump from further down
 			dT_2 = (dL_2*(tau2-Tt_2))/V_ex2;
 			T_2 = Tt_2 + dT_2;
 			T_T = Tt_T + dT_2;
-			fprintf(lvlog,"dV = %f, dL_2 = %f, dT_2 = %f, T_2 = %f, T_T = %f\r\n",dV,dL_2,dT_2,T_2,T_T);
+			TraceLog::Printf(TRACE_LVDC, "dV = %f, dL_2 = %f, dT_2 = %f, T_2 = %f, T_T = %f\r\n",dV,dL_2,dT_2,T_2,T_T);
 
 			// TARGET PARAMETER UPDATE
 			if(!(UP > 0)){	
-				fprintf(lvlog,"--- TARGET PARAMETER UPDATE ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- TARGET PARAMETER UPDATE ---\r\n");
 				UP = 1; 
 				Tt_2 = T_2;
 				Tt_T = T_T;
-				fprintf(lvlog,"UP = 1, Tt_2 = %f, Tt_T = %f\r\n",Tt_2,Tt_T);
+				TraceLog::Printf(TRACE_LVDC, "UP = 1, Tt_2 = %f, Tt_T = %f\r\n",Tt_2,Tt_T);
 				Lt_2 = Lt_2 + dL_2;
 				Lt_Y = Lt_Y + dL_2;
 				Jt_2 = Jt_2 + (dL_2*T_2);
-				fprintf(lvlog,"Lt_2 = %f, Lt_Y = %f, Jt_2 = %f\r\n",Lt_2,Lt_Y,Jt_2);
+				TraceLog::Printf(TRACE_LVDC, "Lt_2 = %f, Lt_Y = %f, Jt_2 = %f\r\n",Lt_2,Lt_Y,Jt_2);
 
 				// NOTE: This is perfectly valid. Just because Dijkstra and Wirth think otherwise
 				// does not mean it's gospel. I shouldn't have to defend my choice of instructions
 				// because a bunch of people read the title of the paper with no context and take
 				// it as a direct revelation from God with no further study into the issue.
-				fprintf(lvlog,"RECYCLE\r\n");
+				TraceLog::Printf(TRACE_LVDC, "RECYCLE\r\n");
 				goto gtupdate; // Recycle. 
 			}
 
 			// tchi_y AND tchi_p CALCULATIONS
-			fprintf(lvlog,"--- tchi_y/p CALCULATION ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- tchi_y/p CALCULATION ---\r\n");
 
 			L_2 = Lt_2 + dL_2;
 			J_2 = Jt_2 + (dL_2*T_2);
@@ -1405,14 +1456,14 @@ gtupdate:	// Target of jump from further down
 			Q_2 = (S_2*tau2)-((V_ex2*pow(T_2,2))/2);
 			P_2 = (J_2*(tau2+(2*T_2)))-((V_ex2*pow(T_2,2))/2);
 			U_2 = (Q_2*(tau2+(2*T_2)))-((V_ex2*pow(T_2,3))/6);
-			fprintf(lvlog,"L_2 = %f, J_2 = %f, S_2 = %f, Q_2 = %f, P_2 = %f, U_2 = %f\r\n",L_2,J_2,S_2,Q_2,P_2,U_2);
+			TraceLog::Printf(TRACE_LVDC, "L_2 = %f, J_2 = %f, S_2 = %f, Q_2 = %f, P_2 = %f, U_2 = %f\r\n",L_2,J_2,S_2,Q_2,P_2,U_2);
 
 			// This is where velocity-to-be-gained is generated.
 
 			dot_dxi   = dot_dxit   - (ddot_xi_G   * dT_2);
 			dot_deta  = dot_detat  - (ddot_eta_G  * dT_2);
 			dot_dzeta = dot_dzetat - (ddot_zeta_G * dT_2);
-			fprintf(lvlog,"dot_dXEZ = %f %f %f\r\n",dot_dxi,dot_deta,dot_dzeta);
+			TraceLog::Printf(TRACE_LVDC, "dot_dXEZ = %f %f %f\r\n",dot_dxi,dot_deta,dot_dzeta);
 
 				
 	//		sprintf(oapiDebugString(),".dxi = %f | .deta %f | .dzeta %f | dT3 %f",
@@ -1424,12 +1475,12 @@ gtupdate:	// Target of jump from further down
 			tchi_y = atan2(dot_deta,pow(pow(dot_dxi,2)+pow(dot_dzeta,2),0.5));
 			tchi_p = atan2(dot_dxi,dot_dzeta);				
 			UP = -1;
-			fprintf(lvlog,"L_Y = %f, tchi_y = %f, tchi_p = %f, UP = -1\r\n",L_Y,tchi_y,tchi_p);
+			TraceLog::Printf(TRACE_LVDC, "L_Y = %f, tchi_y = %f, tchi_p = %f, UP = -1\r\n",L_Y,tchi_y,tchi_p);
 
 			// *** END OF CHI-TILDE LOGIC ***
 			// Is it time for chi-tilde mode?
 			if(Tt_T <= eps_2){
-				fprintf(lvlog,"CHI BAR STEERING ON, REMOVE ALTITUDE CONSTRAINS (K_1-4 = 0)\r\n");
+				TraceLog::Printf(TRACE_LVDC, "CHI BAR STEERING ON, REMOVE ALTITUDE CONSTRAINS (K_1-4 = 0)\r\n");
 				// Yes
 				// Go to the test that we would be testing if HSL was true
 				K_1 = 0; K_2 = 0; K_3 = 0; K_4 = 0;
@@ -1439,75 +1490,75 @@ gtupdate:	// Target of jump from further down
 			}else{
 				// No.
 				// YAW STEERING PARAMETERS
-				fprintf(lvlog,"--- YAW STEERING PARAMETERS ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- YAW STEERING PARAMETERS ---\r\n");
 
 				J_Y = J_1 + J_2 + (L_2*T_2);
 				S_Y = S_1 - J_2 + (L_Y*T_2);
 				Q_Y = Q_1 + Q_2 + (S_2*T_2) + ((T_2)*J_1);
 				K_Y = L_Y/J_Y;
 				D_Y = S_Y - (K_Y*Q_Y);
-				fprintf(lvlog,"J_Y = %f, S_Y = %f, Q_Y = %f, K_Y = %f, D_Y = %f\r\n",J_Y,S_Y,Q_Y,K_Y,D_Y);
+				TraceLog::Printf(TRACE_LVDC, "J_Y = %f, S_Y = %f, Q_Y = %f, K_Y = %f, D_Y = %f\r\n",J_Y,S_Y,Q_Y,K_Y,D_Y);
 
 				deta = PosXEZ.y + (DotXEZ.y*T_T) + ((ddot_eta_G*pow(T_T,2))/2) + (S_Y*(sin(tchi_y)));
 				K_3 = deta/(D_Y*(cos(tchi_y)));
 				K_4 = K_Y*K_3;
-				fprintf(lvlog,"deta = %f, K_3 = %f, K_4 = %f\r\n",deta,K_3,K_4);
+				TraceLog::Printf(TRACE_LVDC, "deta = %f, K_3 = %f, K_4 = %f\r\n",deta,K_3,K_4);
 
 				// PITCH STEERING PARAMETERS
-				fprintf(lvlog,"--- PITCH STEERING PARAMETERS ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- PITCH STEERING PARAMETERS ---\r\n");
 
 				L_P = L_Y*cos(tchi_y);
 				C_2 = cos(tchi_y)+(K_3*sin(tchi_y));
 				C_4 = K_4*sin(tchi_y);
 				J_P = (J_Y*C_2) - (C_4*(P_1+P_2+(pow(T_2,2)*L_2)));
-				fprintf(lvlog,"L_P = %f, C_2 = %f, C_4 = %f, J_P = %f\r\n",L_P,C_2,C_4,J_P);
+				TraceLog::Printf(TRACE_LVDC, "L_P = %f, C_2 = %f, C_4 = %f, J_P = %f\r\n",L_P,C_2,C_4,J_P);
 
 				S_P = (S_Y*C_2) - (C_4*Q_Y);
 				Q_P = (Q_Y*C_2) - (C_4*(U_1+U_2+(pow(T_2,2)*S_2)+((T_2)*P_1)));
 				K_P = L_P/J_P;
 				D_P = S_P - (K_P*Q_P);
-				fprintf(lvlog,"S_P = %f, Q_P = %f, K_P = %f, D_P = %f\r\n",S_P,Q_P,K_P,D_P);
+				TraceLog::Printf(TRACE_LVDC, "S_P = %f, Q_P = %f, K_P = %f, D_P = %f\r\n",S_P,Q_P,K_P,D_P);
 
 				dxi = PosXEZ.x - xi_T + (DotXEZ.x*T_T) + ((ddot_xi_G*pow(T_T,2))/2) + (S_P*(sin(tchi_p)));
 				K_1 = dxi/(D_P*cos(tchi_p));
 				K_2 = K_P*K_1;
-				fprintf(lvlog,"dxi = %f, K_1 = %f, K_2 = %f, cos(tchi_p) = %f\r\n",dxi,K_1,K_2,cos(tchi_p));
+				TraceLog::Printf(TRACE_LVDC, "dxi = %f, K_1 = %f, K_2 = %f, cos(tchi_p) = %f\r\n",dxi,K_1,K_2,cos(tchi_p));
 			}
 		}else{
 hsl:		// HIGH-SPEED LOOP ENTRY				
 			// CUTOFF VELOCITY EQUATIONS
-			fprintf(lvlog,"--- CUTOFF VELOCITY EQUATIONS ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- CUTOFF VELOCITY EQUATIONS ---\r\n");
 			V_0 = V_1;
 			V_1 = V_2;
 			//V_2 = 0.5 * (V+(pow(V_1,2)/V));
 			V_2 = V;
 			dtt_1 = dtt_2;
 			dtt_2 = dt_c;					
-			fprintf(lvlog,"V = %f, Tt_t = %f\r\n",V,Tt_T);
-			fprintf(lvlog,"V = %f, V_0 = %f, V_1 = %f, V_2 = %f, dtt_1 = %f, dtt_2 = %f\r\n",V,V_0,V_1,V_2,dtt_1,dtt_2);
+			TraceLog::Printf(TRACE_LVDC, "V = %f, Tt_t = %f\r\n",V,Tt_T);
+			TraceLog::Printf(TRACE_LVDC, "V = %f, V_0 = %f, V_1 = %f, V_2 = %f, dtt_1 = %f, dtt_2 = %f\r\n",V,V_0,V_1,V_2,dtt_1,dtt_2);
 			if(Tt_T <= eps_4 && V + V_TC >= V_T){
-				fprintf(lvlog,"--- HI SPEED LOOP ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- HI SPEED LOOP ---\r\n");
 				// TGO CALCULATION
-				fprintf(lvlog,"--- TGO CALCULATION ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- TGO CALCULATION ---\r\n");
 				if(GATE5 == false){
-					fprintf(lvlog,"CHI FREEZE\r\n");
+					TraceLog::Printf(TRACE_LVDC, "CHI FREEZE\r\n");
 					// CHI FREEZE
 					tchi_y = tchi_y_last;
 					tchi_p = tchi_p_last;
 					HSL = true;
 					GATE5 = true;
 					T_GO = T_2;
-					fprintf(lvlog,"HSL = true, GATE5 = true, T_GO = %f\r\n",T_GO);
+					TraceLog::Printf(TRACE_LVDC, "HSL = true, GATE5 = true, T_GO = %f\r\n",T_GO);
 				}
 					
 				// TGO DETERMINATION
-				fprintf(lvlog,"--- TGO DETERMINATION ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- TGO DETERMINATION ---\r\n");
 
 				a_2 = (((V_2-V_1)*dtt_1)-((V_1-V_0)*dtt_2))/(dtt_2*dtt_1*(dtt_2+dtt_1));
 				a_1 = ((V_2-V_1)/dtt_2)+(a_2*dtt_2);
 				T_GO = ((V_T-dV_B)-V_2)/(a_1+a_2*T_GO);
 				T_CO = TAS+T_GO;
-				fprintf(lvlog,"a_2 = %f, a_1 = %f, T_GO = %f, T_CO = %f, V_T = %f\r\n",a_2,a_1,T_GO,T_CO,V_T);
+				TraceLog::Printf(TRACE_LVDC, "a_2 = %f, a_1 = %f, T_GO = %f, T_CO = %f, V_T = %f\r\n",a_2,a_1,T_GO,T_CO,V_T);
 
 				// Done, go to navigation
 				//sprintf(oapiDebugString(),"TB%d+%f | CP/Y %f %f | -HSL- TGO %f",
@@ -1518,7 +1569,7 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 			// End of HSL
 		}
 		// GUIDANCE TIME UPDATE
-		fprintf(lvlog,"--- GUIDANCE TIME UPDATE ---\r\n");
+		TraceLog::Printf(TRACE_LVDC, "--- GUIDANCE TIME UPDATE ---\r\n");
 
 		if(BOOST){
 			if(MRS == false){
@@ -1528,23 +1579,23 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 					T_2 = T_2 - dt_c;
 				}else{
 					// Here if t_B1 is bigger.
-					fprintf(lvlog,"t_B1 = %f, t_B3 = %f\r\n",t_B1,t_B3);
+					TraceLog::Printf(TRACE_LVDC, "t_B1 = %f, t_B3 = %f\r\n",t_B1,t_B3);
 					T_1 = (((dotM_1*(t_B3-t_B1))-(dotM_2*t_B3))*dt)/(dotM_1*t_B1);
 				}
 			}
 		}
-		fprintf(lvlog,"T_1 = %f, T_2 = %f, dt_c = %f\r\n",T_1,T_2,dt_c);
+		TraceLog::Printf(TRACE_LVDC, "T_1 = %f, T_2 = %f, dt_c = %f\r\n",T_1,T_2,dt_c);
 		Tt_2 = T_2;
 		Tt_T = T_1+Tt_2;
-		fprintf(lvlog,"Tt_2 = %f, Tt_T = %f\r\n",Tt_2,Tt_T);
+		TraceLog::Printf(TRACE_LVDC, "Tt_2 = %f, Tt_T = %f\r\n",Tt_2,Tt_T);
 	
 		// IGM STEERING ANGLES
-		fprintf(lvlog,"--- IGM STEERING ANGLES ---\r\n");
+		TraceLog::Printf(TRACE_LVDC, "--- IGM STEERING ANGLES ---\r\n");
 
 		//sprintf(oapiDebugString(),"IGM: K_1 %f K_2 %f K_3 %f K_4 %f",K_1,K_2,K_3,K_4);
 		Xtt_y = ((tchi_y) - K_3 + (K_4 * t));
 		Xtt_p = ((tchi_p) - K_1 + (K_2 * t));
-		fprintf(lvlog,"Xtt_y = %f, Xtt_p = %f\r\n",Xtt_y,Xtt_p);
+		TraceLog::Printf(TRACE_LVDC, "Xtt_y = %f, Xtt_p = %f\r\n",Xtt_y,Xtt_p);
 
 		// -- COMPUTE INVERSE OF [K] --
 		// Get Determinate
@@ -1552,7 +1603,7 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 					- MX_K.m12 * ((MX_K.m21*MX_K.m33) - (MX_K.m31*MX_K.m23))
 					+ MX_K.m13 * ((MX_K.m21*MX_K.m32) - (MX_K.m31*MX_K.m22));
 		// If the determinate is less than 0.0005, this is invalid.
-		fprintf(lvlog,"det = %f (LESS THAN 0.0005 IS INVALID)\r\n",det);
+		TraceLog::Printf(TRACE_LVDC, "det = %f (LESS THAN 0.0005 IS INVALID)\r\n",det);
 
 		MATRIX3 MX_Ki; // TEMPORARY: Inverse of [K]
 		MX_Ki.m11 =   ((MX_K.m22*MX_K.m33) - (MX_K.m23*MX_K.m32))  / det;
@@ -1564,30 +1615,30 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 		MX_Ki.m31 =   ((MX_K.m21*MX_K.m32) - (MX_K.m22*MX_K.m31))  / det;
 		MX_Ki.m32 =   ((MX_K.m12*MX_K.m31) - (MX_K.m11*MX_K.m32))  / det;
 		MX_Ki.m33 =   ((MX_K.m11*MX_K.m22) - (MX_K.m12*MX_K.m21))  / det;
-		fprintf(lvlog,"MX_Ki R1 = %f %f %f\r\n",MX_Ki.m11,MX_Ki.m12,MX_Ki.m13);
-		fprintf(lvlog,"MX_Ki R2 = %f %f %f\r\n",MX_Ki.m21,MX_Ki.m22,MX_Ki.m23);
-		fprintf(lvlog,"MX_Ki R3 = %f %f %f\r\n",MX_Ki.m31,MX_Ki.m32,MX_Ki.m33);
+		TraceLog::Printf(TRACE_LVDC, "MX_Ki R1 = %f %f %f\r\n",MX_Ki.m11,MX_Ki.m12,MX_Ki.m13);
+		TraceLog::Printf(TRACE_LVDC, "MX_Ki R2 = %f %f %f\r\n",MX_Ki.m21,MX_Ki.m22,MX_Ki.m23);
+		TraceLog::Printf(TRACE_LVDC, "MX_Ki R3 = %f %f %f\r\n",MX_Ki.m31,MX_Ki.m32,MX_Ki.m33);
 
 		// Done
 		VECTOR3 VT; 
 		VT.x = (sin(Xtt_p)*cos(Xtt_y));
 		VT.y = (sin(Xtt_y));
 		VT.z = (cos(Xtt_p)*cos(Xtt_y));
-		fprintf(lvlog,"VT (set) = %f %f %f\r\n",VT.x,VT.y,VT.z);
+		TraceLog::Printf(TRACE_LVDC, "VT (set) = %f %f %f\r\n",VT.x,VT.y,VT.z);
 
 		VT = mul(MX_Ki,VT);
-		fprintf(lvlog,"VT (mul) = %f %f %f\r\n",VT.x,VT.y,VT.z);
+		TraceLog::Printf(TRACE_LVDC, "VT (mul) = %f %f %f\r\n",VT.x,VT.y,VT.z);
 
 		X_S1 = VT.x;
 		X_S2 = VT.y;
 		X_S3 = VT.z;
-		fprintf(lvlog,"X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
+		TraceLog::Printf(TRACE_LVDC, "X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
 
 		// FINALLY - COMMANDS!
 		X_Zi = asin(X_S2);			// Yaw
 		X_Yi = atan2(-X_S3,X_S1);	// Pitch
-		fprintf(lvlog,"*** COMMAND ISSUED ***\r\n");
-		fprintf(lvlog,"PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
+		TraceLog::Printf(TRACE_LVDC, "*** COMMAND ISSUED ***\r\n");
+		TraceLog::Printf(TRACE_LVDC, "PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
 			
 		// IGM is supposed to generate attitude directly.
 		CommandedAttitude.x = 360 * RAD;    // ROLL
@@ -1597,43 +1648,43 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 
 orbitalguidance: //orbital guidance logic;
 
-		fprintf(lvlog,"*** ORBITAL GUIDANCE ***\r\n");
+		TraceLog::Printf(TRACE_LVDC, "*** ORBITAL GUIDANCE ***\r\n");
 		if(TAS-TA3 < 0){ //time for maneuver after CSM sep		
 			if(TAS-TA1 > 0){ //1st maneuver to -20 pitch LVLH prior to CSM sep
 				if(TAS-TA2 > 0){ //time for attitude hold
 					if(INH2){
 						alpha_1 = -20 * RAD; //if INH2: maintain orb rate
 						CommandedAttitude.x = 180 * RAD;
-						fprintf(lvlog,"inhibit attitude hold, maintain pitchdown\r\n");
+						TraceLog::Printf(TRACE_LVDC, "inhibit attitude hold, maintain pitchdown\r\n");
 						goto orbatt;
 					}else{
 						CommandedAttitude = PCommandedAttitude; //hold attitude for CSM sep
-						fprintf(lvlog,"Attitude hold\r\n");
+						TraceLog::Printf(TRACE_LVDC, "Attitude hold\r\n");
 						goto minorloop;
 					}
 				}else{
 					if(INH1){
 						alpha_1 = 0 * RAD; //if INH1: no pitchdown
 						CommandedAttitude.x = 360 * RAD;
-						fprintf(lvlog,"inhibit pitchdown");
+						TraceLog::Printf(TRACE_LVDC, "inhibit pitchdown");
 						goto orbatt;
 					}else{
 						alpha_1 = -20 * RAD; //from GRR +9780 till GRR+10275
 						CommandedAttitude.x = 360 * RAD;
-						fprintf(lvlog,"pitchdown");
+						TraceLog::Printf(TRACE_LVDC, "pitchdown");
 						goto orbatt;
 					}
 				}
 			}else{
 				alpha_1 = 360 * RAD; //from TB4+20 till GRR +9780 0
 				CommandedAttitude.x = 360 * RAD;
-				fprintf(lvlog,"TB4+20\r\n");
+				TraceLog::Printf(TRACE_LVDC, "TB4+20\r\n");
 				goto orbatt;
 			}						
 		}else{
 			alpha_1 = 180 * RAD; //tail forward
 			CommandedAttitude.x = 180 * RAD; //heads up
-			fprintf(lvlog,"post sep attitude\r\n");
+			TraceLog::Printf(TRACE_LVDC, "post sep attitude\r\n");
 			goto orbatt;
 		}
 
@@ -1662,21 +1713,21 @@ orbatt: Pos4 = mul(MX_G,PosS); //here we compute the steering angles...
 		VT1.x = (cos_chi_Yit * cos_chi_Zit);
 		VT1.y = (sin_chi_Zit);
 		VT1.z = (-sin_chi_Yit * cos_chi_Zit);
-		fprintf(lvlog,"VT (set) = %f %f %f\r\n",VT1.x,VT1.y,VT1.z);
+		TraceLog::Printf(TRACE_LVDC, "VT (set) = %f %f %f\r\n",VT1.x,VT1.y,VT1.z);
 
 		VT1 = mul(MX_Gi,VT1);
-		fprintf(lvlog,"VT (mul) = %f %f %f\r\n",VT1.x,VT1.y,VT1.z);
+		TraceLog::Printf(TRACE_LVDC, "VT (mul) = %f %f %f\r\n",VT1.x,VT1.y,VT1.z);
 
 		X_S1 = VT1.x;
 		X_S2 = VT1.y;
 		X_S3 = VT1.z;
-		fprintf(lvlog,"X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
+		TraceLog::Printf(TRACE_LVDC, "X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
 
 		// COMMANDS
 		X_Zi = asin(X_S2);			// Yaw
 		X_Yi = atan2(-X_S3,X_S1);	// Pitch
-		fprintf(lvlog,"*** COMMAND ISSUED ***\r\n");
-		fprintf(lvlog,"PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
+		TraceLog::Printf(TRACE_LVDC, "*** COMMAND ISSUED ***\r\n");
+		TraceLog::Printf(TRACE_LVDC, "PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
 		CommandedAttitude.y = X_Yi; // PITCH
 		CommandedAttitude.z = X_Zi; // YAW;				
 
@@ -1722,7 +1773,7 @@ minorloop: //minor loop;
 			BOOST = false;
 			LVDC_Timebase = 4;
 			LVDC_TB_ETime = 0;
-			fprintf(lvlog,"SIVB CUTOFF! TAS = %f \r\n",TAS);
+			TraceLog::Printf(TRACE_LVDC, "SIVB CUTOFF! TAS = %f \r\n",TAS);
 		};
 		//calculate delta attitude
 		DeltaAtt.x = fmod((CurrentAttitude.x - CommandedAttitude.x + TWO_PI),TWO_PI);
@@ -1881,6 +1932,7 @@ minorloop: //minor loop;
 					eps_p, eps_ymr, eps_ypr,V,R/1000);
 			}
 		}*/
+guidanceskip:;
 	}
 
 	/*
@@ -1925,16 +1977,16 @@ minorloop: //minor loop;
 		owner->ENGIND[6] = false;
 		owner->ENGIND[7] = false;
 	}
-	if(owner->stage == LAUNCH_STAGE_ONE && owner->MissionTime < 12.5){
+	if(owner->stage == LAUNCH_STAGE_ONE && mt < 12.5){
 		// Control contrail
-		if(owner->MissionTime > 12){
+		if(mt > 12){
 			owner->contrailLevel = 0;
 		}else{
-			if (owner->MissionTime > 7){
-				owner->contrailLevel = (12.0 - owner->MissionTime) / 100.0;
+			if (mt > 7){
+				owner->contrailLevel = (12.0 - mt) / 100.0;
 			}else{
-				if(owner->MissionTime > 2){
-					owner->contrailLevel = 1.38 - 0.95 / 5.0 * owner->MissionTime;
+				if(mt > 2){
+					owner->contrailLevel = 1.38 - 0.95 / 5.0 * mt;
 				}else{
 					owner->contrailLevel = 1;
 				}
@@ -1944,7 +1996,7 @@ minorloop: //minor loop;
 
 	/* **** ABORT HANDLING **** */
 	// The abort PB will be pressed during prelaunch testing, but shouldn't actually trigger an abort before Mode 1 enabled.
-	if(owner->bAbort && owner->MissionTime > -300){				
+	if(owner->bAbort && mt > -300){				
 		owner->SetEngineLevel(ENGINE_MAIN, 0);						// Kill the engines
 		owner->agc.SetInputChannelBit(030, SIVBSeperateAbort, true);// Notify the AGC of the abort
 		owner->agc.SetInputChannelBit(030, LiftOff, true);			// and the liftoff, if it's not set already
@@ -1952,7 +2004,7 @@ minorloop: //minor loop;
 		LVDC_Stop = true;											// Stop LVDC program
 		// ABORT MODE 1 - Use of LES to extract CM
 		// Allowed from T - 5 minutes until LES jettison.
-		if(owner->MissionTime > -300 && owner->LESAttached){			
+		if(mt > -300 && owner->LESAttached){			
 			owner->SetEngineLevel(ENGINE_MAIN, 0);
 			owner->SeparateStage(CM_STAGE);
 			owner->SetStage(CM_STAGE);
@@ -1990,689 +2042,354 @@ minorloop: //minor loop;
 	}
 }
 
-void LVDC1B::SaveState(FILEHANDLE scn) {
-	oapiWriteLine(scn, LVDC_START_STRING);
-	// Thank heaven for text processing.
+// Scenario keys of the LVDC state, used by both SaveState and LoadState
+void LVDC1B::RegisterScenarioFields(ScenarioFieldTable &t) {
 	// bool
-	oapiWriteScenario_int(scn, "LVDC_alpha_D_op", alpha_D_op);
-	oapiWriteScenario_int(scn, "LVDC_BOOST", BOOST);
-	oapiWriteScenario_int(scn, "LVDC_CountPIPA", CountPIPA);
-	oapiWriteScenario_int(scn, "LVDC_GATE", GATE);
-	oapiWriteScenario_int(scn, "LVDC_GATE5", GATE5);
-	oapiWriteScenario_int(scn, "LVDC_GRR_init", GRR_init);
-	oapiWriteScenario_int(scn, "LVDC_HSL", HSL);
-	oapiWriteScenario_int(scn, "LVDC_INH", INH);
-	oapiWriteScenario_int(scn, "LVDC_INH1", INH1);
-	oapiWriteScenario_int(scn, "LVDC_INH2", INH2);
-	oapiWriteScenario_int(scn, "LVDC_i_op", i_op);
-	oapiWriteScenario_int(scn, "LVDC_liftoff", liftoff);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_EI_On", LVDC_EI_On);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_GRR", LVDC_GRR);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_Stop", LVDC_Stop);
-	oapiWriteScenario_int(scn, "LVDC_MRS", MRS);
-	oapiWriteScenario_int(scn, "LVDC_poweredflight", poweredflight);
-	oapiWriteScenario_int(scn, "LVDC_S1B_Engine_Out", S1B_Engine_Out);
-	oapiWriteScenario_int(scn, "LVDC_S4B_IGN", S4B_IGN);
-	oapiWriteScenario_int(scn, "LVDC_TerminalConditions", TerminalConditions);
-	oapiWriteScenario_int(scn, "LVDC_theta_N_op", theta_N_op);
+	t.Add("LVDC_alpha_D_op", alpha_D_op);
+	t.Add("LVDC_BOOST", BOOST);
+	t.Add("LVDC_CountPIPA", CountPIPA);
+	t.Add("LVDC_GATE", GATE);
+	t.Add("LVDC_GATE5", GATE5);
+	t.Add("LVDC_GRR_init", GRR_init);
+	t.Add("LVDC_HSL", HSL);
+	t.Add("LVDC_INH", INH);
+	t.Add("LVDC_INH1", INH1);
+	t.Add("LVDC_INH2", INH2);
+	t.Add("LVDC_i_op", i_op);
+	t.Add("LVDC_liftoff", liftoff);
+	t.Add("LVDC_LVDC_EI_On", LVDC_EI_On);
+	t.Add("LVDC_LVDC_GRR", LVDC_GRR);
+	t.Add("LVDC_LVDC_Stop", LVDC_Stop);
+	t.Add("LVDC_MRS", MRS);
+	t.Add("LVDC_poweredflight", poweredflight);
+	t.Add("LVDC_S1B_Engine_Out", S1B_Engine_Out);
+	t.Add("LVDC_S4B_IGN", S4B_IGN);
+	t.Add("LVDC_TerminalConditions", TerminalConditions);
+	t.Add("LVDC_theta_N_op", theta_N_op);
 	// int
-	oapiWriteScenario_int(scn, "LVDC_IGMCycle", IGMCycle);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_Timebase", LVDC_Timebase);
-	oapiWriteScenario_int(scn, "LVDC_T_EO1", T_EO1);
-	oapiWriteScenario_int(scn, "LVDC_T_EO2", T_EO2);
-	oapiWriteScenario_int(scn, "LVDC_UP", UP);
+	t.Add("LVDC_IGMCycle", IGMCycle);
+	t.Add("LVDC_LVDC_Timebase", LVDC_Timebase);
+	t.Add("LVDC_T_EO1", T_EO1);
+	t.Add("LVDC_T_EO2", T_EO2);
+	t.Add("LVDC_UP", UP);
 	// double
-	papiWriteScenario_double(scn, "LVDC_a", a);
-	papiWriteScenario_double(scn, "LVDC_a_0p", a_0p);
-	papiWriteScenario_double(scn, "LVDC_a_0r", a_0r);
-	papiWriteScenario_double(scn, "LVDC_a_0y", a_0y);
-	papiWriteScenario_double(scn, "LVDC_a_1", a_1);
-	papiWriteScenario_double(scn, "LVDC_a_2", a_2);
-	papiWriteScenario_double(scn, "LVDC_A1", A1);
-	papiWriteScenario_double(scn, "LVDC_A2", A2);
-	papiWriteScenario_double(scn, "LVDC_A3", A3);
-	papiWriteScenario_double(scn, "LVDC_A4", A4);
-	papiWriteScenario_double(scn, "LVDC_A5", A5);
-	papiWriteScenario_double(scn, "LVDC_a_1p", a_1p);
-	papiWriteScenario_double(scn, "LVDC_a_1r", a_1r);
-	papiWriteScenario_double(scn, "LVDC_a_1y", a_1y);
-	papiWriteScenario_double(scn, "LVDC_alpha_1", alpha_1);
-	papiWriteScenario_double(scn, "LVDC_alpha_2", alpha_2);
-	papiWriteScenario_double(scn, "LVDC_alpha_D", alpha_D);
-	papiWriteScenario_double(scn, "LVDC_Azimuth", Azimuth);
-	papiWriteScenario_double(scn, "LVDC_Azo", Azo);
-	papiWriteScenario_double(scn, "LVDC_Azs", Azs);
-	papiWriteScenario_double(scn, "LVDC_B_11", B_11);
-	papiWriteScenario_double(scn, "LVDC_B_21", B_21);
-	papiWriteScenario_double(scn, "LVDC_B_12", B_12);
-	papiWriteScenario_double(scn, "LVDC_B_22", B_22);
-	papiWriteScenario_double(scn, "LVDC_beta_p1c", beta_p1c);
-	papiWriteScenario_double(scn, "LVDC_beta_p2c", beta_p2c);
-	papiWriteScenario_double(scn, "LVDC_beta_p3c", beta_p3c);
-	papiWriteScenario_double(scn, "LVDC_beta_p4c", beta_p4c);
-	papiWriteScenario_double(scn, "LVDC_beta_pc", beta_pc);
-	papiWriteScenario_double(scn, "LVDC_beta_rc", beta_rc);
-	papiWriteScenario_double(scn, "LVDC_beta_y1c", beta_y1c);
-	papiWriteScenario_double(scn, "LVDC_beta_y2c", beta_y2c);
-	papiWriteScenario_double(scn, "LVDC_beta_y3c", beta_y3c);
-	papiWriteScenario_double(scn, "LVDC_beta_y4c", beta_y4c);
-	papiWriteScenario_double(scn, "LVDC_beta_yc", beta_yc);
-	papiWriteScenario_double(scn, "LVDC_C_2", C_2);
-	papiWriteScenario_double(scn, "LVDC_C_4", C_4);
-	papiWriteScenario_double(scn, "LVDC_C_3", C_3);
-	papiWriteScenario_double(scn, "LVDC_CG", CG);
-	papiWriteScenario_double(scn, "LVDC_cos_chi_Yit", cos_chi_Yit);
-	papiWriteScenario_double(scn, "LVDC_cos_chi_Zit", cos_chi_Zit);
-	papiWriteScenario_double(scn, "LVDC_cos_phi_L", cos_phi_L);
-	papiWriteScenario_double(scn, "LVDC_d2", d2);
-	papiWriteScenario_double(scn, "LVDC_ddot_xi_G", ddot_xi_G);
-	papiWriteScenario_double(scn, "LVDC_ddot_eta_G", ddot_eta_G);
-	papiWriteScenario_double(scn, "LVDC_ddot_zeta_G", ddot_zeta_G);
-	papiWriteScenario_double(scn, "LVDC_ddot_zeta_GT", ddot_zeta_GT);
-	papiWriteScenario_double(scn, "LVDC_ddot_xi_GT", ddot_xi_GT);
-	papiWriteScenario_double(scn, "LVDC_DescNodeAngle", DescNodeAngle);
-	papiWriteScenario_double(scn, "LVDC_deta", deta);
-	papiWriteScenario_double(scn, "LVDC_dxi", dxi);
-	papiWriteScenario_double(scn, "LVDC_dot_dxi", dot_dxi);
-	papiWriteScenario_double(scn, "LVDC_dot_deta", dot_deta);
-	papiWriteScenario_double(scn, "LVDC_dot_dzeta", dot_dzeta);
-	papiWriteScenario_double(scn, "LVDC_dot_dxit", dot_dxit);
-	papiWriteScenario_double(scn, "LVDC_dot_detat", dot_detat);
-	papiWriteScenario_double(scn, "LVDC_dot_dzetat", dot_dzetat);
-	papiWriteScenario_double(scn, "LVDC_dotM_1", dotM_1);
-	papiWriteScenario_double(scn, "LVDC_dotM_2", dotM_2);
-	papiWriteScenario_double(scn, "LVDC_dot_phi_1", dot_phi_1);
-	papiWriteScenario_double(scn, "LVDC_dot_phi_T", dot_phi_T);
-	papiWriteScenario_double(scn, "LVDC_dot_zeta_T", dot_zeta_T);
-	papiWriteScenario_double(scn, "LVDC_dot_xi_T", dot_xi_T);
-	papiWriteScenario_double(scn, "LVDC_dot_eta_T", dot_eta_T);
-	papiWriteScenario_double(scn, "LVDC_dt", dt);
-	papiWriteScenario_double(scn, "LVDC_dT_2", dT_2);
-	papiWriteScenario_double(scn, "LVDC_dt_c", dt_c);
-	papiWriteScenario_double(scn, "LVDC_dT_F", dT_F);
-	papiWriteScenario_double(scn, "LVDC_dt_LET", dt_LET);
-	papiWriteScenario_double(scn, "LVDC_dtt_1", dtt_1);
-	papiWriteScenario_double(scn, "LVDC_dtt_2", dtt_2);
-	papiWriteScenario_double(scn, "LVDC_dV", dV);
-	papiWriteScenario_double(scn, "LVDC_dV_B", dV_B);
-	papiWriteScenario_double(scn, "LVDC_e", e);
-	papiWriteScenario_double(scn, "LVDC_eps_2", eps_2);
-	papiWriteScenario_double(scn, "LVDC_eps_3", eps_3);
-	papiWriteScenario_double(scn, "LVDC_eps_4", eps_4);
-	papiWriteScenario_double(scn, "LVDC_eps_p", eps_p);
-	papiWriteScenario_double(scn, "LVDC_eps_ymr", eps_ymr);
-	papiWriteScenario_double(scn, "LVDC_eps_ypr", eps_ypr);
-	papiWriteScenario_double(scn, "LVDC_f", f);
-	papiWriteScenario_double(scn, "LVDC_F", F);
-	papiWriteScenario_double(scn, "LVDC_Fm", Fm);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][0]", Fx[0][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][1]", Fx[0][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][2]", Fx[0][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][3]", Fx[0][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][4]", Fx[0][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][0]", Fx[1][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][1]", Fx[1][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][2]", Fx[1][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][3]", Fx[1][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][4]", Fx[1][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][0]", Fx[2][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][1]", Fx[2][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][2]", Fx[2][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][3]", Fx[2][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][4]", Fx[2][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][0]", Fx[3][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][1]", Fx[3][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][2]", Fx[3][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][3]", Fx[3][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][4]", Fx[3][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][0]", Fx[4][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][1]", Fx[4][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][2]", Fx[4][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][3]", Fx[4][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][4]", Fx[4][4]);
-	papiWriteScenario_double(scn, "LVDC_fx[0]", fx[0]);
-	papiWriteScenario_double(scn, "LVDC_fx[1]", fx[1]);
-	papiWriteScenario_double(scn, "LVDC_fx[2]", fx[2]);
-	papiWriteScenario_double(scn, "LVDC_fx[3]", fx[3]);
-	papiWriteScenario_double(scn, "LVDC_fx[4]", fx[4]);
-	papiWriteScenario_double(scn, "LVDC_fx[5]", fx[5]);
-	papiWriteScenario_double(scn, "LVDC_fx[6]", fx[6]);
-	papiWriteScenario_double(scn, "LVDC_G_T", G_T);
-	papiWriteScenario_double(scn, "LVDC_gx[0]", gx[0]);
-	papiWriteScenario_double(scn, "LVDC_gx[1]", gx[1]);
-	papiWriteScenario_double(scn, "LVDC_gx[2]", gx[2]);
-	papiWriteScenario_double(scn, "LVDC_gx[3]", gx[3]);
-	papiWriteScenario_double(scn, "LVDC_gx[4]", gx[4]);
-	papiWriteScenario_double(scn, "LVDC_gx[5]", gx[5]);
-	papiWriteScenario_double(scn, "LVDC_gx[6]", gx[6]);
-	papiWriteScenario_double(scn, "LVDC_IGMInterval", IGMInterval);
-	papiWriteScenario_double(scn, "LVDC_Inclination", Inclination);
-	papiWriteScenario_double(scn, "LVDC_J", J);
-	papiWriteScenario_double(scn, "LVDC_J_1", J_1);
-	papiWriteScenario_double(scn, "LVDC_J_2", J_2);
-	papiWriteScenario_double(scn, "LVDC_Jt_2", Jt_2);
-	papiWriteScenario_double(scn, "LVDC_J_Y", J_Y);
-	papiWriteScenario_double(scn, "LVDC_J_P", J_P);
-	papiWriteScenario_double(scn, "LVDC_K_1", K_1);
-	papiWriteScenario_double(scn, "LVDC_K_2", K_2);
-	papiWriteScenario_double(scn, "LVDC_K_3", K_3);
-	papiWriteScenario_double(scn, "LVDC_K_4", K_4);
-	papiWriteScenario_double(scn, "LVDC_K_5", K_5);
-	papiWriteScenario_double(scn, "LVDC_K_P1", K_P1);
-	papiWriteScenario_double(scn, "LVDC_K_P2", K_P2);
-	papiWriteScenario_double(scn, "LVDC_K_p", K_p);
-	papiWriteScenario_double(scn, "LVDC_K_y", K_y);
-	papiWriteScenario_double(scn, "LVDC_K_r", K_r);
-	papiWriteScenario_double(scn, "LVDC_K_Y1", K_Y1);
-	papiWriteScenario_double(scn, "LVDC_K_Y2", K_Y2);
-	papiWriteScenario_double(scn, "LVDC_K_Y", K_Y);
-	papiWriteScenario_double(scn, "LVDC_K_P", K_P);
-	papiWriteScenario_double(scn, "LVDC_D_P", D_P);
-	papiWriteScenario_double(scn, "LVDC_D_Y", D_Y);
-	papiWriteScenario_double(scn, "LVDC_L_1", L_1);
-	papiWriteScenario_double(scn, "LVDC_L_2", L_2);
-	papiWriteScenario_double(scn, "LVDC_dL_2", dL_2);
-	papiWriteScenario_double(scn, "LVDC_Lt_2", Lt_2);
-	papiWriteScenario_double(scn, "LVDC_L_P", L_P);
-	papiWriteScenario_double(scn, "LVDC_L_Y", L_Y);
-	papiWriteScenario_double(scn, "LVDC_Lt_Y", Lt_Y);
-	papiWriteScenario_double(scn, "LVDC_LVDC_TB_ETime", LVDC_TB_ETime);
-	papiWriteScenario_double(scn, "LVDC_mu", mu);
-	papiWriteScenario_double(scn, "LVDC_p", p);
-	papiWriteScenario_double(scn, "LVDC_P_1", P_1);
-	papiWriteScenario_double(scn, "LVDC_P_2", P_2);
-	papiWriteScenario_double(scn, "LVDC_phi_lat", phi_lat);
-	papiWriteScenario_double(scn, "LVDC_phi_lng", phi_lng);
-	papiWriteScenario_double(scn, "LVDC_phi_T", phi_T);
-	papiWriteScenario_double(scn, "LVDC_Q_1", Q_1);
-	papiWriteScenario_double(scn, "LVDC_Q_2", Q_2);
-	papiWriteScenario_double(scn, "LVDC_Q_Y", Q_Y);
-	papiWriteScenario_double(scn, "LVDC_Q_P", Q_P);
-	papiWriteScenario_double(scn, "LVDC_R", R);
-	papiWriteScenario_double(scn, "LVDC_ROV", ROV);
-	papiWriteScenario_double(scn, "LVDC_ROVs", ROVs);
-	papiWriteScenario_double(scn, "LVDC_R_T", R_T);
-	papiWriteScenario_double(scn, "LVDC_S1B_Sep_Time", S1B_Sep_Time);
-	papiWriteScenario_double(scn, "LVDC_S_1", S_1);
-	papiWriteScenario_double(scn, "LVDC_S_2", S_2);
-	papiWriteScenario_double(scn, "LVDC_S_P", S_P);
-	papiWriteScenario_double(scn, "LVDC_S_Y", S_Y);
-	papiWriteScenario_double(scn, "LVDC_sinceLastIGM", sinceLastIGM);
-	papiWriteScenario_double(scn, "LVDC_sin_chi_Yit", sin_chi_Yit);
-	papiWriteScenario_double(scn, "LVDC_sin_chi_Zit", sin_chi_Zit);
-	papiWriteScenario_double(scn, "LVDC_sin_phi_L", sin_phi_L);
-	papiWriteScenario_double(scn, "LVDC_sin_ups", sin_ups);
-	papiWriteScenario_double(scn, "LVDC_cos_ups", cos_ups);
-	papiWriteScenario_double(scn, "LVDC_SMCG", SMCG);
-	papiWriteScenario_double(scn, "LVDC_S", S);
-	papiWriteScenario_double(scn, "LVDC_P", P);
-	papiWriteScenario_double(scn, "LVDC_t", t);
-	papiWriteScenario_double(scn, "LVDC_t_1", t_1);
-	papiWriteScenario_double(scn, "LVDC_T_1", T_1);
-	papiWriteScenario_double(scn, "LVDC_t_2", t_2);
-	papiWriteScenario_double(scn, "LVDC_T_2", T_2);
-	papiWriteScenario_double(scn, "LVDC_t_3", t_3);
-	papiWriteScenario_double(scn, "LVDC_t_3i", t_3i);
-	papiWriteScenario_double(scn, "LVDC_t_4", t_4);
-	papiWriteScenario_double(scn, "LVDC_t_5", t_5);
-	papiWriteScenario_double(scn, "LVDC_t_6", t_6);
-	papiWriteScenario_double(scn, "LVDC_TA1", TA1);
-	papiWriteScenario_double(scn, "LVDC_TA2", TA2);
-	papiWriteScenario_double(scn, "LVDC_TA3", TA3);
-	papiWriteScenario_double(scn, "LVDC_T_ar", T_ar);
-	papiWriteScenario_double(scn, "LVDC_TAS", TAS);
-	papiWriteScenario_double(scn, "LVDC_tau1", tau1);
-	papiWriteScenario_double(scn, "LVDC_tau2", tau2);
-	papiWriteScenario_double(scn, "LVDC_t_B1", t_B1);
-	papiWriteScenario_double(scn, "LVDC_t_B3", t_B3);
-	papiWriteScenario_double(scn, "LVDC_tchi_y_last", tchi_y_last);
-	papiWriteScenario_double(scn, "LVDC_tchi_p_last", tchi_p_last);
-	papiWriteScenario_double(scn, "LVDC_tchi_y", tchi_y);
-	papiWriteScenario_double(scn, "LVDC_tchi_p", tchi_p);
-	papiWriteScenario_double(scn, "LVDC_t_clock", t_clock);
-	papiWriteScenario_double(scn, "LVDC_T_CO", T_CO);
-	papiWriteScenario_double(scn, "LVDC_t_fail", t_fail);
-	papiWriteScenario_double(scn, "LVDC_T_GO", T_GO);
-	papiWriteScenario_double(scn, "LVDC_TI5F2", TI5F2);
-	papiWriteScenario_double(scn, "LVDC_T_LET", T_LET);
-	papiWriteScenario_double(scn, "LVDC_T_S1", T_S1);
-	papiWriteScenario_double(scn, "LVDC_T_S2", T_S2);
-	papiWriteScenario_double(scn, "LVDC_T_S3", T_S3);
-	papiWriteScenario_double(scn, "LVDC_TSMC1", TSMC1);
-	papiWriteScenario_double(scn, "LVDC_TSMC2", TSMC2);
-	papiWriteScenario_double(scn, "LVDC_T_T", T_T);
-	papiWriteScenario_double(scn, "LVDC_Tt_2", Tt_2);
-	papiWriteScenario_double(scn, "LVDC_Tt_T", Tt_T);
-	papiWriteScenario_double(scn, "LVDC_U_1", U_1);
-	papiWriteScenario_double(scn, "LVDC_U_2", U_2);
-	papiWriteScenario_double(scn, "LVDC_gamma_T", gamma_T);
-	papiWriteScenario_double(scn, "LVDC_V", V);
-	papiWriteScenario_double(scn, "LVDC_V_ex1", V_ex1);
-	papiWriteScenario_double(scn, "LVDC_V_ex2", V_ex2);
-	papiWriteScenario_double(scn, "LVDC_V_i", V_i);
-	papiWriteScenario_double(scn, "LVDC_V_0", V_0);
-	papiWriteScenario_double(scn, "LVDC_V_1", V_1);
-	papiWriteScenario_double(scn, "LVDC_V_2", V_2);
-	papiWriteScenario_double(scn, "LVDC_V_T", V_T);
-	papiWriteScenario_double(scn, "LVDC_V_TC", V_TC);
-	papiWriteScenario_double(scn, "LVDC_xi_T", xi_T);
-	papiWriteScenario_double(scn, "LVDC_eta_T", eta_T);
-	papiWriteScenario_double(scn, "LVDC_zeta_T", zeta_T);
-	papiWriteScenario_double(scn, "LVDC_X_S1", X_S1);
-	papiWriteScenario_double(scn, "LVDC_X_S2", X_S2);
-	papiWriteScenario_double(scn, "LVDC_X_S3", X_S3);
-	papiWriteScenario_double(scn, "LVDC_Xtt_y", Xtt_y);
-	papiWriteScenario_double(scn, "LVDC_Xtt_p", Xtt_p);
-	papiWriteScenario_double(scn, "LVDC_X_Zi", X_Zi);
-	papiWriteScenario_double(scn, "LVDC_X_Yi", X_Yi);
-	papiWriteScenario_double(scn, "LVDC_Y_u", Y_u);
+	t.Add("LVDC_a", a);
+	t.Add("LVDC_a_0p", a_0p);
+	t.Add("LVDC_a_0r", a_0r);
+	t.Add("LVDC_a_0y", a_0y);
+	t.Add("LVDC_a_1", a_1);
+	t.Add("LVDC_a_2", a_2);
+	t.Add("LVDC_A1", A1);
+	t.Add("LVDC_A2", A2);
+	t.Add("LVDC_A3", A3);
+	t.Add("LVDC_A4", A4);
+	t.Add("LVDC_A5", A5);
+	t.Add("LVDC_a_1p", a_1p);
+	t.Add("LVDC_a_1r", a_1r);
+	t.Add("LVDC_a_1y", a_1y);
+	t.Add("LVDC_alpha_1", alpha_1);
+	t.Add("LVDC_alpha_2", alpha_2);
+	t.Add("LVDC_alpha_D", alpha_D);
+	t.Add("LVDC_Azimuth", Azimuth);
+	t.Add("LVDC_Azo", Azo);
+	t.Add("LVDC_Azs", Azs);
+	t.Add("LVDC_B_11", B_11);
+	t.Add("LVDC_B_21", B_21);
+	t.Add("LVDC_B_12", B_12);
+	t.Add("LVDC_B_22", B_22);
+	t.Add("LVDC_beta_p1c", beta_p1c);
+	t.Add("LVDC_beta_p2c", beta_p2c);
+	t.Add("LVDC_beta_p3c", beta_p3c);
+	t.Add("LVDC_beta_p4c", beta_p4c);
+	t.Add("LVDC_beta_pc", beta_pc);
+	t.Add("LVDC_beta_rc", beta_rc);
+	t.Add("LVDC_beta_y1c", beta_y1c);
+	t.Add("LVDC_beta_y2c", beta_y2c);
+	t.Add("LVDC_beta_y3c", beta_y3c);
+	t.Add("LVDC_beta_y4c", beta_y4c);
+	t.Add("LVDC_beta_yc", beta_yc);
+	t.Add("LVDC_C_2", C_2);
+	t.Add("LVDC_C_4", C_4);
+	t.Add("LVDC_C_3", C_3);
+	t.Add("LVDC_CG", CG);
+	t.Add("LVDC_cos_chi_Yit", cos_chi_Yit);
+	t.Add("LVDC_cos_chi_Zit", cos_chi_Zit);
+	t.Add("LVDC_cos_phi_L", cos_phi_L);
+	t.Add("LVDC_d2", d2);
+	t.Add("LVDC_ddot_xi_G", ddot_xi_G);
+	t.Add("LVDC_ddot_eta_G", ddot_eta_G);
+	t.Add("LVDC_ddot_zeta_G", ddot_zeta_G);
+	t.Add("LVDC_ddot_zeta_GT", ddot_zeta_GT);
+	t.Add("LVDC_ddot_xi_GT", ddot_xi_GT);
+	t.Add("LVDC_DescNodeAngle", DescNodeAngle);
+	t.Add("LVDC_deta", deta);
+	t.Add("LVDC_dxi", dxi);
+	t.Add("LVDC_dot_dxi", dot_dxi);
+	t.Add("LVDC_dot_deta", dot_deta);
+	t.Add("LVDC_dot_dzeta", dot_dzeta);
+	t.Add("LVDC_dot_dxit", dot_dxit);
+	t.Add("LVDC_dot_detat", dot_detat);
+	t.Add("LVDC_dot_dzetat", dot_dzetat);
+	t.Add("LVDC_dotM_1", dotM_1);
+	t.Add("LVDC_dotM_2", dotM_2);
+	t.Add("LVDC_dot_phi_1", dot_phi_1);
+	t.Add("LVDC_dot_phi_T", dot_phi_T);
+	t.Add("LVDC_dot_zeta_T", dot_zeta_T);
+	t.Add("LVDC_dot_xi_T", dot_xi_T);
+	t.Add("LVDC_dot_eta_T", dot_eta_T);
+	t.Add("LVDC_dt", dt);
+	t.Add("LVDC_dT_2", dT_2);
+	t.Add("LVDC_dt_c", dt_c);
+	t.Add("LVDC_dT_F", dT_F);
+	t.Add("LVDC_dt_LET", dt_LET);
+	t.Add("LVDC_dtt_1", dtt_1);
+	t.Add("LVDC_dtt_2", dtt_2);
+	t.Add("LVDC_dV", dV);
+	t.Add("LVDC_dV_B", dV_B);
+	t.Add("LVDC_e", e);
+	t.Add("LVDC_eps_2", eps_2);
+	t.Add("LVDC_eps_3", eps_3);
+	t.Add("LVDC_eps_4", eps_4);
+	t.Add("LVDC_eps_p", eps_p);
+	t.Add("LVDC_eps_ymr", eps_ymr);
+	t.Add("LVDC_eps_ypr", eps_ypr);
+	t.Add("LVDC_f", f);
+	t.Add("LVDC_F", F);
+	t.Add("LVDC_Fm", Fm);
+	t.Add("LVDC_Fx[0][0]", Fx[0][0]);
+	t.Add("LVDC_Fx[0][1]", Fx[0][1]);
+	t.Add("LVDC_Fx[0][2]", Fx[0][2]);
+	t.Add("LVDC_Fx[0][3]", Fx[0][3]);
+	t.Add("LVDC_Fx[0][4]", Fx[0][4]);
+	t.Add("LVDC_Fx[1][0]", Fx[1][0]);
+	t.Add("LVDC_Fx[1][1]", Fx[1][1]);
+	t.Add("LVDC_Fx[1][2]", Fx[1][2]);
+	t.Add("LVDC_Fx[1][3]", Fx[1][3]);
+	t.Add("LVDC_Fx[1][4]", Fx[1][4]);
+	t.Add("LVDC_Fx[2][0]", Fx[2][0]);
+	t.Add("LVDC_Fx[2][1]", Fx[2][1]);
+	t.Add("LVDC_Fx[2][2]", Fx[2][2]);
+	t.Add("LVDC_Fx[2][3]", Fx[2][3]);
+	t.Add("LVDC_Fx[2][4]", Fx[2][4]);
+	t.Add("LVDC_Fx[3][0]", Fx[3][0]);
+	t.Add("LVDC_Fx[3][1]", Fx[3][1]);
+	t.Add("LVDC_Fx[3][2]", Fx[3][2]);
+	t.Add("LVDC_Fx[3][3]", Fx[3][3]);
+	t.Add("LVDC_Fx[3][4]", Fx[3][4]);
+	t.Add("LVDC_Fx[4][0]", Fx[4][0]);
+	t.Add("LVDC_Fx[4][1]", Fx[4][1]);
+	t.Add("LVDC_Fx[4][2]", Fx[4][2]);
+	t.Add("LVDC_Fx[4][3]", Fx[4][3]);
+	t.Add("LVDC_Fx[4][4]", Fx[4][4]);
+	t.Add("LVDC_fx[0]", fx[0]);
+	t.Add("LVDC_fx[1]", fx[1]);
+	t.Add("LVDC_fx[2]", fx[2]);
+	t.Add("LVDC_fx[3]", fx[3]);
+	t.Add("LVDC_fx[4]", fx[4]);
+	t.Add("LVDC_fx[5]", fx[5]);
+	t.Add("LVDC_fx[6]", fx[6]);
+	t.Add("LVDC_G_T", G_T);
+	t.Add("LVDC_gx[0]", gx[0]);
+	t.Add("LVDC_gx[1]", gx[1]);
+	t.Add("LVDC_gx[2]", gx[2]);
+	t.Add("LVDC_gx[3]", gx[3]);
+	t.Add("LVDC_gx[4]", gx[4]);
+	t.Add("LVDC_gx[5]", gx[5]);
+	t.Add("LVDC_gx[6]", gx[6]);
+	t.Add("LVDC_IGMInterval", IGMInterval);
+	t.Add("LVDC_Inclination", Inclination);
+	t.Add("LVDC_J", J);
+	t.Add("LVDC_J_1", J_1);
+	t.Add("LVDC_J_2", J_2);
+	t.Add("LVDC_Jt_2", Jt_2);
+	t.Add("LVDC_J_Y", J_Y);
+	t.Add("LVDC_J_P", J_P);
+	t.Add("LVDC_K_1", K_1);
+	t.Add("LVDC_K_2", K_2);
+	t.Add("LVDC_K_3", K_3);
+	t.Add("LVDC_K_4", K_4);
+	t.Add("LVDC_K_5", K_5);
+	t.Add("LVDC_K_P1", K_P1);
+	t.Add("LVDC_K_P2", K_P2);
+	t.Add("LVDC_K_p", K_p);
+	t.Add("LVDC_K_y", K_y);
+	t.Add("LVDC_K_r", K_r);
+	t.Add("LVDC_K_Y1", K_Y1);
+	t.Add("LVDC_K_Y2", K_Y2);
+	t.Add("LVDC_K_Y", K_Y);
+	t.Add("LVDC_K_P", K_P);
+	t.Add("LVDC_D_P", D_P);
+	t.Add("LVDC_D_Y", D_Y);
+	t.Add("LVDC_L_1", L_1);
+	t.Add("LVDC_L_2", L_2);
+	t.Add("LVDC_dL_2", dL_2);
+	t.Add("LVDC_Lt_2", Lt_2);
+	t.Add("LVDC_L_P", L_P);
+	t.Add("LVDC_L_Y", L_Y);
+	t.Add("LVDC_Lt_Y", Lt_Y);
+	t.Add("LVDC_LVDC_TB_ETime", LVDC_TB_ETime);
+	t.Add("LVDC_mu", mu);
+	t.Add("LVDC_p", p);
+	t.Add("LVDC_P_1", P_1);
+	t.Add("LVDC_P_2", P_2);
+	t.Add("LVDC_phi_lat", phi_lat);
+	t.Add("LVDC_phi_lng", phi_lng);
+	t.Add("LVDC_phi_T", phi_T);
+	t.Add("LVDC_Q_1", Q_1);
+	t.Add("LVDC_Q_2", Q_2);
+	t.Add("LVDC_Q_Y", Q_Y);
+	t.Add("LVDC_Q_P", Q_P);
+	t.Add("LVDC_R", R);
+	t.Add("LVDC_ROV", ROV);
+	t.Add("LVDC_ROVs", ROVs);
+	t.Add("LVDC_R_T", R_T);
+	t.Add("LVDC_S1B_Sep_Time", S1B_Sep_Time);
+	t.Add("LVDC_S_1", S_1);
+	t.Add("LVDC_S_2", S_2);
+	t.Add("LVDC_S_P", S_P);
+	t.Add("LVDC_S_Y", S_Y);
+	t.Add("LVDC_minorLoopTime", minorLoopTime);
+	t.Add("LVDC_guidanceTime", guidanceTime);
+	t.Add("LVDC_sinceLastIGM", sinceLastIGM);
+	t.Add("LVDC_sin_chi_Yit", sin_chi_Yit);
+	t.Add("LVDC_sin_chi_Zit", sin_chi_Zit);
+	t.Add("LVDC_sin_phi_L", sin_phi_L);
+	t.Add("LVDC_sin_ups", sin_ups);
+	t.Add("LVDC_cos_ups", cos_ups);
+	t.Add("LVDC_SMCG", SMCG);
+	t.Add("LVDC_S", S);
+	t.Add("LVDC_P", P);
+	t.Add("LVDC_t", t);
+	t.Add("LVDC_t_1", t_1);
+	t.Add("LVDC_T_1", T_1);
+	t.Add("LVDC_t_2", t_2);
+	t.Add("LVDC_T_2", T_2);
+	t.Add("LVDC_t_3", t_3);
+	t.Add("LVDC_t_3i", t_3i);
+	t.Add("LVDC_t_4", t_4);
+	t.Add("LVDC_t_5", t_5);
+	t.Add("LVDC_t_6", t_6);
+	t.Add("LVDC_TA1", TA1);
+	t.Add("LVDC_TA2", TA2);
+	t.Add("LVDC_TA3", TA3);
+	t.Add("LVDC_T_ar", T_ar);
+	t.Add("LVDC_TAS", TAS);
+	t.Add("LVDC_tau1", tau1);
+	t.Add("LVDC_tau2", tau2);
+	t.Add("LVDC_t_B1", t_B1);
+	t.Add("LVDC_t_B3", t_B3);
+	t.Add("LVDC_tchi_y_last", tchi_y_last);
+	t.Add("LVDC_tchi_p_last", tchi_p_last);
+	t.Add("LVDC_tchi_y", tchi_y);
+	t.Add("LVDC_tchi_p", tchi_p);
+	t.Add("LVDC_t_clock", t_clock);
+	t.Add("LVDC_T_CO", T_CO);
+	t.Add("LVDC_t_fail", t_fail);
+	t.Add("LVDC_T_GO", T_GO);
+	t.Add("LVDC_TI5F2", TI5F2);
+	t.Add("LVDC_T_LET", T_LET);
+	t.Add("LVDC_T_S1", T_S1);
+	t.Add("LVDC_T_S2", T_S2);
+	t.Add("LVDC_T_S3", T_S3);
+	t.Add("LVDC_TSMC1", TSMC1);
+	t.Add("LVDC_TSMC2", TSMC2);
+	t.Add("LVDC_T_T", T_T);
+	t.Add("LVDC_Tt_2", Tt_2);
+	t.Add("LVDC_Tt_T", Tt_T);
+	t.Add("LVDC_U_1", U_1);
+	t.Add("LVDC_U_2", U_2);
+	t.Add("LVDC_gamma_T", gamma_T);
+	t.Add("LVDC_V", V);
+	t.Add("LVDC_V_ex1", V_ex1);
+	t.Add("LVDC_V_ex2", V_ex2);
+	t.Add("LVDC_V_i", V_i);
+	t.Add("LVDC_V_0", V_0);
+	t.Add("LVDC_V_1", V_1);
+	t.Add("LVDC_V_2", V_2);
+	t.Add("LVDC_V_T", V_T);
+	t.Add("LVDC_V_TC", V_TC);
+	t.Add("LVDC_xi_T", xi_T);
+	t.Add("LVDC_eta_T", eta_T);
+	t.Add("LVDC_zeta_T", zeta_T);
+	t.Add("LVDC_X_S1", X_S1);
+	t.Add("LVDC_X_S2", X_S2);
+	t.Add("LVDC_X_S3", X_S3);
+	t.Add("LVDC_Xtt_y", Xtt_y);
+	t.Add("LVDC_Xtt_p", Xtt_p);
+	t.Add("LVDC_X_Zi", X_Zi);
+	t.Add("LVDC_X_Yi", X_Yi);
+	t.Add("LVDC_Y_u", Y_u);
 	// VECTOR3
-	papiWriteScenario_vec(scn, "LVDC_ACommandedAttitude", ACommandedAttitude);
-	papiWriteScenario_vec(scn, "LVDC_AttitudeError", AttitudeError);
-	papiWriteScenario_vec(scn, "LVDC_AttRate", AttRate);
-	papiWriteScenario_vec(scn, "LVDC_CommandedAttitude", CommandedAttitude);
-	papiWriteScenario_vec(scn, "LVDC_CommandRateLimits", CommandRateLimits);
-	papiWriteScenario_vec(scn, "LVDC_CurrentAttitude", CurrentAttitude);
-	papiWriteScenario_vec(scn, "LVDC_ddotG_act", ddotG_act);
-	papiWriteScenario_vec(scn, "LVDC_ddotG_last", ddotG_last);
-	papiWriteScenario_vec(scn, "LVDC_ddotM_act", ddotM_act);
-	papiWriteScenario_vec(scn, "LVDC_ddotM_last", ddotM_last);
-	papiWriteScenario_vec(scn, "LVDC_DDotXEZ_G", DDotXEZ_G);
-	papiWriteScenario_vec(scn, "LVDC_DeltaAtt", DeltaAtt);
-	papiWriteScenario_vec(scn, "LVDC_Dot0", Dot0);
-	papiWriteScenario_vec(scn, "LVDC_DotG_act", DotG_act);
-	papiWriteScenario_vec(scn, "LVDC_DotG_last", DotG_last);
-	papiWriteScenario_vec(scn, "LVDC_DotM_act", DotM_act);
-	papiWriteScenario_vec(scn, "LVDC_DotM_last", DotM_last);
-	papiWriteScenario_vec(scn, "LVDC_DotS", DotS);
-	papiWriteScenario_vec(scn, "LVDC_DotXEZ", DotXEZ);
-	papiWriteScenario_vec(scn, "LVDC_PCommandedAttitude", PCommandedAttitude);
-	papiWriteScenario_vec(scn, "LVDC_Pos4", Pos4);
-	papiWriteScenario_vec(scn, "LVDC_PosS", PosS);
-	papiWriteScenario_vec(scn, "LVDC_PosXEZ", PosXEZ);
+	t.Add("LVDC_ACommandedAttitude", ACommandedAttitude);
+	t.Add("LVDC_AttitudeError", AttitudeError);
+	t.Add("LVDC_AttRate", AttRate);
+	t.Add("LVDC_CommandedAttitude", CommandedAttitude);
+	t.Add("LVDC_CommandRateLimits", CommandRateLimits);
+	t.Add("LVDC_CurrentAttitude", CurrentAttitude);
+	t.Add("LVDC_ddotG_act", ddotG_act);
+	t.Add("LVDC_ddotG_last", ddotG_last);
+	t.Add("LVDC_ddotM_act", ddotM_act);
+	t.Add("LVDC_ddotM_last", ddotM_last);
+	t.Add("LVDC_DDotXEZ_G", DDotXEZ_G);
+	t.Add("LVDC_DeltaAtt", DeltaAtt);
+	t.Add("LVDC_Dot0", Dot0);
+	t.Add("LVDC_DotG_act", DotG_act);
+	t.Add("LVDC_DotG_last", DotG_last);
+	t.Add("LVDC_DotM_act", DotM_act);
+	t.Add("LVDC_DotM_last", DotM_last);
+	t.Add("LVDC_DotS", DotS);
+	t.Add("LVDC_DotXEZ", DotXEZ);
+	t.Add("LVDC_PCommandedAttitude", PCommandedAttitude);
+	t.Add("LVDC_Pos4", Pos4);
+	t.Add("LVDC_PosS", PosS);
+	t.Add("LVDC_PosXEZ", PosXEZ);
 	// MATRIX3
-	papiWriteScenario_mx(scn, "LVDC_MX_A", MX_A);
-	papiWriteScenario_mx(scn, "LVDC_MX_B", MX_B);
-	papiWriteScenario_mx(scn, "LVDC_MX_G", MX_G);
-	papiWriteScenario_mx(scn, "LVDC_MX_K", MX_K);
-	papiWriteScenario_mx(scn, "LVDC_MX_phi_T", MX_phi_T);
-	// Done
+	t.Add("LVDC_MX_A", MX_A);
+	t.Add("LVDC_MX_B", MX_B);
+	t.Add("LVDC_MX_G", MX_G);
+	t.Add("LVDC_MX_K", MX_K);
+	t.Add("LVDC_MX_phi_T", MX_phi_T);
+}
+
+// The field table is shared by all instances, and built by the first one to load or save
+void LVDC1B::EnsureScenarioFields() {
+	if (!LVDC1BScenarioFields.IsBuilt()) {
+		LVDC1BScenarioFields.Begin(this);
+		RegisterScenarioFields(LVDC1BScenarioFields);
+		LVDC1BScenarioFields.End();
+	}
+}
+
+void LVDC1B::SaveState(FILEHANDLE scn) {
+	EnsureScenarioFields();
+	oapiWriteLine(scn, LVDC_START_STRING);
+	LVDC1BScenarioFields.Save(scn, this);
 	oapiWriteLine(scn, LVDC_END_STRING);
 	lvimu.SaveState(scn);
 }
 
 void LVDC1B::LoadState(FILEHANDLE scn){
-	char *line;	
-	int tmp = 0; // Used in boolean type loader
+	char *line;
 
 	if(Initialized){
-		fprintf(lvlog,"LoadState() called\r\n");
-		fflush(lvlog);
+		TraceLog::Printf(TRACE_LVDC, "LoadState() called\r\n");
 	}
+	EnsureScenarioFields();
 	while (oapiReadScenario_nextline (scn, line)) {
 		if (!strnicmp(line, LVDC_END_STRING, sizeof(LVDC_END_STRING))){
 			break;
 		}
-
-		// OLD STUFF
-		/*
-		if (!strnicmp (line, "phi_lat", 7)) {
-			sscanf(line + 7, "%lf", &phi_lat);
-		} else if (!strnicmp (line, "phi_lng", 7)) {
-			sscanf(line + 7, "%lf", &phi_lng);
-		}else if (!strnicmp (line, "Azimuth", 7)) {
-			sscanf(line + 7, "%lf", &Azimuth);
-		}else if (!strnicmp (line, "DescNodeAngle", 13)) {
-			sscanf(line + 13, "%lf", &DescNodeAngle);
-		}else if (!strnicmp (line, "Inclination", 11)) {
-			sscanf(line + 11, "%lf", &Inclination);
-		}else if (!strnicmp (line, "TB", 2)) {
-			sscanf(line + 2, "%i", &LVDC_Timebase);
-		}else if (!strnicmp (line, "TB_ETime", 8)) {
-			sscanf(line + 8, "%lf", &LVDC_TB_ETime);
-		}else if (!strnicmp (line, "TAS", 3)) {
-			sscanf(line + 3, "%lf", &TAS);
-		}else if (!strnicmp (line, "t_clock", 7)) {
-			sscanf(line + 7, "%lf", &t_clock);
-		}else if (!strnicmp (line, "sinceLastIGM", 12)) {
-			sscanf(line + 12, "%lf", &sinceLastIGM);
-		}else if (!strnicmp (line, "DotM_act", 8)) {
-			sscanf(line + 8, "%lf %lf %lf", &DotM_act.x,&DotM_act.y,&DotM_act.z);
-		}else if (!strnicmp (line, "DotM_last", 9)) {
-			sscanf(line + 9, "%lf %lf %lf", &DotM_last.x,&DotM_last.y,&DotM_last.z);
-		}else if (!strnicmp (line, "PsnS", 4)) {
-			sscanf(line + 4, "%lf %lf %lf", &PosS.x,&PosS.y,&PosS.z);
-		}else if (!strnicmp (line, "Dot0", 4)) {
-			sscanf(line + 4, "%lf %lf %lf", &Dot0.x,&Dot0.y,&Dot0.z);
-		}else if (!strnicmp (line, "DotG_last", 9)) {
-			sscanf(line + 9, "%lf %lf %lf", &DotG_last.x,&DotG_last.y,&DotG_last.z);
-		}else if (!strnicmp (line, "ddotG_last", 10)) {
-			sscanf(line + 10, "%lf %lf %lf", &ddotG_last.x,&ddotG_last.y,&ddotG_last.z);
-		}else if (!strnicmp (line, "PCommandedAttitude", 18)) {
-			sscanf(line + 18, "%lf %lf %lf", &PCommandedAttitude.x,&PCommandedAttitude.y,&PCommandedAttitude.z);
-		}
-		*/
-		// NEW STUFF
-		// Doing all this in one go makes the MS compiler barf.
-		// Doing it in long chains makes the MS compiler silently optimize away the tail of the chain.
-		// So we do it in small groups.
-		// INT
-		papiReadScenario_int(line, "LVDC_IGMCycle", IGMCycle);
-		papiReadScenario_int(line, "LVDC_LVDC_Timebase", LVDC_Timebase);
-		papiReadScenario_int(line, "LVDC_T_EO1", T_EO1);
-		papiReadScenario_int(line, "LVDC_T_EO2", T_EO2);
-		papiReadScenario_int(line, "LVDC_UP", UP);
-		// BOOL
-		papiReadScenario_bool(line, "LVDC_alpha_D_op", alpha_D_op);
-		papiReadScenario_bool(line, "LVDC_BOOST", BOOST);
-		papiReadScenario_bool(line, "LVDC_CountPIPA", CountPIPA);
-		papiReadScenario_bool(line, "LVDC_GATE", GATE);
-		papiReadScenario_bool(line, "LVDC_GATE5", GATE5);
-		papiReadScenario_bool(line, "LVDC_GRR_init", GRR_init);
-		papiReadScenario_bool(line, "LVDC_HSL", HSL);
-		papiReadScenario_bool(line, "LVDC_INH", INH);
-		papiReadScenario_bool(line, "LVDC_INH1", INH1);
-		papiReadScenario_bool(line, "LVDC_INH2", INH2);
-		papiReadScenario_bool(line, "LVDC_i_op", i_op);
-		papiReadScenario_bool(line, "LVDC_liftoff", liftoff);
-		papiReadScenario_bool(line, "LVDC_LVDC_EI_On", LVDC_EI_On);
-		papiReadScenario_bool(line, "LVDC_LVDC_GRR", LVDC_GRR);
-		papiReadScenario_bool(line, "LVDC_LVDC_Stop", LVDC_Stop);
-		papiReadScenario_bool(line, "LVDC_MRS", MRS);
-		papiReadScenario_bool(line, "LVDC_poweredflight", poweredflight);
-		papiReadScenario_bool(line, "LVDC_S1B_Engine_Out", S1B_Engine_Out);
-		papiReadScenario_bool(line, "LVDC_S4B_IGN", S4B_IGN);
-		papiReadScenario_bool(line, "LVDC_TerminalConditions", TerminalConditions);
-		papiReadScenario_bool(line, "LVDC_theta_N_op", theta_N_op);
-
-		// DOUBLE
-		papiReadScenario_double(line, "LVDC_a", a);
-		papiReadScenario_double(line, "LVDC_a_0p", a_0p);
-		papiReadScenario_double(line, "LVDC_a_0r", a_0r);
-		papiReadScenario_double(line, "LVDC_a_0y", a_0y);
-		papiReadScenario_double(line, "LVDC_a_1", a_1);
-		papiReadScenario_double(line, "LVDC_a_2", a_2);
-		papiReadScenario_double(line, "LVDC_A1", A1);
-		papiReadScenario_double(line, "LVDC_A2", A2);
-		papiReadScenario_double(line, "LVDC_A3", A3);
-		papiReadScenario_double(line, "LVDC_A4", A4);
-		papiReadScenario_double(line, "LVDC_A5", A5);
-		papiReadScenario_double(line, "LVDC_a_1p", a_1p);
-		papiReadScenario_double(line, "LVDC_a_1r", a_1r);
-		papiReadScenario_double(line, "LVDC_a_1y", a_1y);
-		papiReadScenario_double(line, "LVDC_alpha_1", alpha_1);
-		papiReadScenario_double(line, "LVDC_alpha_2", alpha_2);
-		papiReadScenario_double(line, "LVDC_alpha_D", alpha_D);
-		papiReadScenario_double(line, "LVDC_Azimuth", Azimuth);
-		papiReadScenario_double(line, "LVDC_Azo", Azo);
-		papiReadScenario_double(line, "LVDC_Azs", Azs);
-		papiReadScenario_double(line, "LVDC_B_11", B_11);
-		papiReadScenario_double(line, "LVDC_B_12", B_12);
-		papiReadScenario_double(line, "LVDC_B_21", B_21);
-		papiReadScenario_double(line, "LVDC_B_22", B_22);
-		papiReadScenario_double(line, "LVDC_beta_p1c", beta_p1c);
-		papiReadScenario_double(line, "LVDC_beta_p2c", beta_p2c);
-		papiReadScenario_double(line, "LVDC_beta_p3c", beta_p3c);
-		papiReadScenario_double(line, "LVDC_beta_p4c", beta_p4c);
-		papiReadScenario_double(line, "LVDC_beta_pc", beta_pc);
-		papiReadScenario_double(line, "LVDC_beta_rc", beta_rc);
-		papiReadScenario_double(line, "LVDC_beta_y1c", beta_y1c);
-		papiReadScenario_double(line, "LVDC_beta_y2c", beta_y2c);
-		papiReadScenario_double(line, "LVDC_beta_y3c", beta_y3c);
-		papiReadScenario_double(line, "LVDC_beta_y4c", beta_y4c);
-		papiReadScenario_double(line, "LVDC_beta_yc", beta_yc);
-		papiReadScenario_double(line, "LVDC_C_2", C_2);
-		papiReadScenario_double(line, "LVDC_C_3", C_3);
-		papiReadScenario_double(line, "LVDC_C_4", C_4);
-		papiReadScenario_double(line, "LVDC_CG", CG);
-		papiReadScenario_double(line, "LVDC_cos_chi_Yit", cos_chi_Yit);
-		papiReadScenario_double(line, "LVDC_cos_chi_Zit", cos_chi_Zit);
-		papiReadScenario_double(line, "LVDC_cos_phi_L", cos_phi_L);
-		papiReadScenario_double(line, "LVDC_d2", d2);
-		papiReadScenario_double(line, "LVDC_ddot_xi_G", ddot_xi_G);
-		papiReadScenario_double(line, "LVDC_ddot_eta_G", ddot_eta_G);
-		papiReadScenario_double(line, "LVDC_ddot_zeta_G", ddot_zeta_G);
-		papiReadScenario_double(line, "LVDC_ddot_zeta_GT", ddot_zeta_GT);
-		papiReadScenario_double(line, "LVDC_ddot_xi_GT", ddot_xi_GT);
-		papiReadScenario_double(line, "LVDC_DescNodeAngle", DescNodeAngle);
-		papiReadScenario_double(line, "LVDC_deta", deta);
-		papiReadScenario_double(line, "LVDC_dxi", dxi);
-		papiReadScenario_double(line, "LVDC_dot_dxi", dot_dxi);
-		papiReadScenario_double(line, "LVDC_dot_dzeta", dot_dzeta);
-		papiReadScenario_double(line, "LVDC_dot_dxit", dot_dxit);
-		papiReadScenario_double(line, "LVDC_dot_detat", dot_detat);
-		papiReadScenario_double(line, "LVDC_dot_dzetat", dot_dzetat);
-		papiReadScenario_double(line, "LVDC_dotM_1", dotM_1);
-		papiReadScenario_double(line, "LVDC_dotM_2", dotM_2);
-		papiReadScenario_double(line, "LVDC_dot_phi_1", dot_phi_1);
-		papiReadScenario_double(line, "LVDC_dot_phi_T", dot_phi_T);
-		papiReadScenario_double(line, "LVDC_dot_zeta_T", dot_zeta_T);
-		papiReadScenario_double(line, "LVDC_dot_xi_T", dot_xi_T);
-		papiReadScenario_double(line, "LVDC_dot_eta_T", dot_eta_T);
-		papiReadScenario_double(line, "LVDC_dt", dt);
-		papiReadScenario_double(line, "LVDC_dT_2", dT_2);
-		papiReadScenario_double(line, "LVDC_dt_c", dt_c);
-		papiReadScenario_double(line, "LVDC_dT_F", dT_F);
-		papiReadScenario_double(line, "LVDC_dt_LET", dt_LET);
-		papiReadScenario_double(line, "LVDC_dtt_1", dtt_1);
-		papiReadScenario_double(line, "LVDC_dtt_2", dtt_2);
-		papiReadScenario_double(line, "LVDC_dV", dV);
-		papiReadScenario_double(line, "LVDC_dV_B", dV_B);
-		papiReadScenario_double(line, "LVDC_e", e);
-		papiReadScenario_double(line, "LVDC_eps_2", eps_2);
-		papiReadScenario_double(line, "LVDC_eps_3", eps_3);
-		papiReadScenario_double(line, "LVDC_eps_4", eps_4);
-		papiReadScenario_double(line, "LVDC_eps_p", eps_p);
-		papiReadScenario_double(line, "LVDC_eps_ymr", eps_ymr);
-		papiReadScenario_double(line, "LVDC_eps_ypr", eps_ypr);
-		papiReadScenario_double(line, "LVDC_e", e);
-		papiReadScenario_double(line, "LVDC_F", F);
-		papiReadScenario_double(line, "LVDC_Fm", Fm);
-		papiReadScenario_double(line, "LVDC_Fx[0][0]", Fx[0][0]);
-		papiReadScenario_double(line, "LVDC_Fx[0][1]", Fx[0][1]);
-		papiReadScenario_double(line, "LVDC_Fx[0][2]", Fx[0][2]);
-		papiReadScenario_double(line, "LVDC_Fx[0][3]", Fx[0][3]);
-		papiReadScenario_double(line, "LVDC_Fx[0][4]", Fx[0][4]);
-		papiReadScenario_double(line, "LVDC_Fx[1][0]", Fx[1][0]);
-		papiReadScenario_double(line, "LVDC_Fx[1][1]", Fx[1][1]);
-		papiReadScenario_double(line, "LVDC_Fx[1][2]", Fx[1][2]);
-		papiReadScenario_double(line, "LVDC_Fx[1][3]", Fx[1][3]);
-		papiReadScenario_double(line, "LVDC_Fx[1][4]", Fx[1][4]);
-		papiReadScenario_double(line, "LVDC_Fx[2][0]", Fx[2][0]);
-		papiReadScenario_double(line, "LVDC_Fx[2][1]", Fx[2][1]);
-		papiReadScenario_double(line, "LVDC_Fx[2][2]", Fx[2][2]);
-		papiReadScenario_double(line, "LVDC_Fx[2][3]", Fx[2][3]);
-		papiReadScenario_double(line, "LVDC_Fx[2][4]", Fx[2][4]);
-		papiReadScenario_double(line, "LVDC_Fx[3][0]", Fx[3][0]);
-		papiReadScenario_double(line, "LVDC_Fx[3][1]", Fx[3][1]);
-		papiReadScenario_double(line, "LVDC_Fx[3][2]", Fx[3][2]);
-		papiReadScenario_double(line, "LVDC_Fx[3][3]", Fx[3][3]);
-		papiReadScenario_double(line, "LVDC_Fx[3][4]", Fx[3][4]);
-		papiReadScenario_double(line, "LVDC_Fx[4][0]", Fx[4][0]);
-		papiReadScenario_double(line, "LVDC_Fx[4][1]", Fx[4][1]);
-		papiReadScenario_double(line, "LVDC_Fx[4][2]", Fx[4][2]);
-		papiReadScenario_double(line, "LVDC_Fx[4][3]", Fx[4][3]);
-		papiReadScenario_double(line, "LVDC_Fx[4][4]", Fx[4][4]);
-		papiReadScenario_double(line, "LVDC_fx[0]", fx[0]);
-		papiReadScenario_double(line, "LVDC_fx[1]", fx[1]);
-		papiReadScenario_double(line, "LVDC_fx[2]", fx[2]);
-		papiReadScenario_double(line, "LVDC_fx[3]", fx[3]);
-		papiReadScenario_double(line, "LVDC_fx[4]", fx[4]);
-		papiReadScenario_double(line, "LVDC_fx[5]", fx[5]);
-		papiReadScenario_double(line, "LVDC_fx[6]", fx[6]);
-		papiReadScenario_double(line, "LVDC_G_T", G_T);
-		papiReadScenario_double(line, "LVDC_gx[0]", gx[0]);
-		papiReadScenario_double(line, "LVDC_gx[1]", gx[1]);
-		papiReadScenario_double(line, "LVDC_gx[2]", gx[2]);
-		papiReadScenario_double(line, "LVDC_gx[3]", gx[3]);
-		papiReadScenario_double(line, "LVDC_gx[4]", gx[4]);
-		papiReadScenario_double(line, "LVDC_gx[5]", gx[5]);
-		papiReadScenario_double(line, "LVDC_gx[6]", gx[6]);
-		papiReadScenario_double(line, "LVDC_IGMInterval", IGMInterval);
-		papiReadScenario_double(line, "LVDC_Inclination", Inclination);
-		papiReadScenario_double(line, "LVDC_J", J);
-		papiReadScenario_double(line, "LVDC_J_1", J_1);
-		papiReadScenario_double(line, "LVDC_J_2", J_2);
-		papiReadScenario_double(line, "LVDC_Jt_2", Jt_2);
-		papiReadScenario_double(line, "LVDC_J_Y", J_Y);
-		papiReadScenario_double(line, "LVDC_J_P", J_P);
-		papiReadScenario_double(line, "LVDC_K_1", K_1);
-		papiReadScenario_double(line, "LVDC_K_2", K_2);
-		papiReadScenario_double(line, "LVDC_K_3", K_3);
-		papiReadScenario_double(line, "LVDC_K_4", K_4);
-		papiReadScenario_double(line, "LVDC_K_5", K_5);
-		papiReadScenario_double(line, "LVDC_K_P1", K_P1);
-		papiReadScenario_double(line, "LVDC_K_P2", K_P2);
-		papiReadScenario_double(line, "LVDC_K_p", K_p);
-		papiReadScenario_double(line, "LVDC_K_y", K_y);
-		papiReadScenario_double(line, "LVDC_K_r", K_r);
-		papiReadScenario_double(line, "LVDC_K_Y1", K_Y1);
-		papiReadScenario_double(line, "LVDC_K_Y2", K_Y2);
-		papiReadScenario_double(line, "LVDC_K_Y", K_Y);
-		papiReadScenario_double(line, "LVDC_K_P", K_P);
-		papiReadScenario_double(line, "LVDC_D_P", D_P);
-		papiReadScenario_double(line, "LVDC_D_Y", D_Y);
-		papiReadScenario_double(line, "LVDC_L_1", L_1);
-		papiReadScenario_double(line, "LVDC_L_2", L_2);
-		papiReadScenario_double(line, "LVDC_dL_2", dL_2);
-		papiReadScenario_double(line, "LVDC_Lt_2", Lt_2);
-		papiReadScenario_double(line, "LVDC_L_P", L_P);
-		papiReadScenario_double(line, "LVDC_L_Y", L_Y);
-		papiReadScenario_double(line, "LVDC_Lt_Y", Lt_Y);
-		papiReadScenario_double(line, "LVDC_LVDC_TB_ETime", LVDC_TB_ETime);
-		papiReadScenario_double(line, "LVDC_mu", mu);
-		papiReadScenario_double(line, "LVDC_p", p);
-		papiReadScenario_double(line, "LVDC_P_1", P_1);
-		papiReadScenario_double(line, "LVDC_P_2", P_2);
-		papiReadScenario_double(line, "LVDC_phi_lat", phi_lat);
-		papiReadScenario_double(line, "LVDC_phi_lng", phi_lng);
-		papiReadScenario_double(line, "LVDC_phi_T", phi_T);
-		papiReadScenario_double(line, "LVDC_Q_1", Q_1);
-		papiReadScenario_double(line, "LVDC_Q_2", Q_2);
-		papiReadScenario_double(line, "LVDC_Q_Y", Q_Y);
-		papiReadScenario_double(line, "LVDC_Q_P", Q_P);
-		papiReadScenario_double(line, "LVDC_R", R);
-		papiReadScenario_double(line, "LVDC_ROV", ROV);
-		papiReadScenario_double(line, "LVDC_ROVs", ROVs);
-		papiReadScenario_double(line, "LVDC_R_T", R_T);
-		papiReadScenario_double(line, "LVDC_S1B_Sep_Time", S1B_Sep_Time);
-		papiReadScenario_double(line, "LVDC_S_1", S_1);
-		papiReadScenario_double(line, "LVDC_S_2", S_2);
-		papiReadScenario_double(line, "LVDC_S_P", S_P);
-		papiReadScenario_double(line, "LVDC_S_Y", S_Y);
-		papiReadScenario_double(line, "LVDC_sinceLastIGM", sinceLastIGM);
-		papiReadScenario_double(line, "LVDC_sin_chi_Yit", sin_chi_Yit);
-		papiReadScenario_double(line, "LVDC_sin_chi_Zit", sin_chi_Zit);
-		papiReadScenario_double(line, "LVDC_sin_phi_L", sin_phi_L);
-		papiReadScenario_double(line, "LVDC_sin_ups", sin_ups);
-		papiReadScenario_double(line, "LVDC_cos_ups", cos_ups);
-		papiReadScenario_double(line, "LVDC_SMCG", SMCG);
-		papiReadScenario_double(line, "LVDC_S", S);
-		papiReadScenario_double(line, "LVDC_P", P);
-		papiReadScenario_double(line, "LVDC_t", t);
-		papiReadScenario_double(line, "LVDC_t_1", t_1);
-		papiReadScenario_double(line, "LVDC_T_1", T_1);
-		papiReadScenario_double(line, "LVDC_t_2", t_2);
-		papiReadScenario_double(line, "LVDC_T_2", T_2);
-		papiReadScenario_double(line, "LVDC_t_3", t_3);
-		papiReadScenario_double(line, "LVDC_t_3i", t_3i);
-		papiReadScenario_double(line, "LVDC_t_4", t_4);
-		papiReadScenario_double(line, "LVDC_t_5", t_5);
-		papiReadScenario_double(line, "LVDC_t_6", t_6);
-		papiReadScenario_double(line, "LVDC_TA1", TA1);
-		papiReadScenario_double(line, "LVDC_TA2", TA2);
-		papiReadScenario_double(line, "LVDC_TA3", TA3);
-		papiReadScenario_double(line, "LVDC_T_ar", T_ar);
-		papiReadScenario_double(line, "LVDC_TAS", TAS);
-		papiReadScenario_double(line, "LVDC_tau1", tau1);
-		papiReadScenario_double(line, "LVDC_tau2", tau2);
-		papiReadScenario_double(line, "LVDC_t_B1", t_B1);
-		papiReadScenario_double(line, "LVDC_t_B3", t_B3);
-		papiReadScenario_double(line, "LVDC_tchi_y_last", tchi_y_last);
-		papiReadScenario_double(line, "LVDC_tchi_p_last", tchi_p_last);
-		papiReadScenario_double(line, "LVDC_tchi_y", tchi_y);
-		papiReadScenario_double(line, "LVDC_tchi_p", tchi_p);
-		papiReadScenario_double(line, "LVDC_t_clock", t_clock);
-		papiReadScenario_double(line, "LVDC_T_CO", T_CO);
-		papiReadScenario_double(line, "LVDC_t_fail", t_fail);
-		papiReadScenario_double(line, "LVDC_T_GO", T_GO);
-		papiReadScenario_double(line, "LVDC_TI5F2", TI5F2);
-		papiReadScenario_double(line, "LVDC_T_LET", T_LET);
-		papiReadScenario_double(line, "LVDC_T_S1", T_S1);
-		papiReadScenario_double(line, "LVDC_T_S2", T_S2);
-		papiReadScenario_double(line, "LVDC_T_S3", T_S3);
-		papiReadScenario_double(line, "LVDC_TSMC1", TSMC1);
-		papiReadScenario_double(line, "LVDC_TSMC2", TSMC2);
-		papiReadScenario_double(line, "LVDC_T_T", T_T);
-		papiReadScenario_double(line, "LVDC_Tt_2", Tt_2);
-		papiReadScenario_double(line, "LVDC_Tt_T", Tt_T);
-		papiReadScenario_double(line, "LVDC_U_1", U_1);
-		papiReadScenario_double(line, "LVDC_U_2", U_2);
-		papiReadScenario_double(line, "LVDC_gamma_T", gamma_T);
-		papiReadScenario_double(line, "LVDC_V", V);
-		papiReadScenario_double(line, "LVDC_V_ex1", V_ex1);
-		papiReadScenario_double(line, "LVDC_V_ex2", V_ex2);
-		papiReadScenario_double(line, "LVDC_V_i", V_i);
-		papiReadScenario_double(line, "LVDC_V_0", V_0);
-		papiReadScenario_double(line, "LVDC_V_1", V_1);
-		papiReadScenario_double(line, "LVDC_V_2", V_2);
-		papiReadScenario_double(line, "LVDC_V_T", V_T);
-		papiReadScenario_double(line, "LVDC_V_TC", V_TC);
-		papiReadScenario_double(line, "LVDC_xi_T", xi_T);
-		papiReadScenario_double(line, "LVDC_eta_T", eta_T);
-		papiReadScenario_double(line, "LVDC_zeta_T", zeta_T);
-		papiReadScenario_double(line, "LVDC_X_S1", X_S1);
-		papiReadScenario_double(line, "LVDC_X_S2", X_S2);
-		papiReadScenario_double(line, "LVDC_X_S3", X_S3);
-		papiReadScenario_double(line, "LVDC_Xtt_y", Xtt_y);
-		papiReadScenario_double(line, "LVDC_Xtt_p", Xtt_p);
-		papiReadScenario_double(line, "LVDC_X_Zi", X_Zi);
-		papiReadScenario_double(line, "LVDC_X_Yi", X_Yi);
-		papiReadScenario_double(line, "LVDC_Y_u", Y_u);
-
-		// VECTOR3
-		papiReadScenario_vec(line, "LVDC_ACommandedAttitude", ACommandedAttitude);
-		papiReadScenario_vec(line, "LVDC_AttitudeError", AttitudeError);
-		papiReadScenario_vec(line, "LVDC_AttRate", AttRate);
-		papiReadScenario_vec(line, "LVDC_CommandedAttitude", CommandedAttitude);
-		papiReadScenario_vec(line, "LVDC_CommandRateLimits", CommandRateLimits);
-		papiReadScenario_vec(line, "LVDC_CurrentAttitude", CurrentAttitude);
-		papiReadScenario_vec(line, "LVDC_ddotG_act", ddotG_act);
-		papiReadScenario_vec(line, "LVDC_ddotG_last", ddotG_last);
-		papiReadScenario_vec(line, "LVDC_ddotM_act", ddotM_act);
-		papiReadScenario_vec(line, "LVDC_ddotM_last", ddotM_last);
-		papiReadScenario_vec(line, "LVDC_DDotXEZ_G", DDotXEZ_G);
-		papiReadScenario_vec(line, "LVDC_DeltaAtt", DeltaAtt);
-		papiReadScenario_vec(line, "LVDC_Dot0", Dot0);
-		papiReadScenario_vec(line, "LVDC_DotG_act", DotG_act);
-		papiReadScenario_vec(line, "LVDC_DotG_last", DotG_last);
-		papiReadScenario_vec(line, "LVDC_DotM_act", DotM_act);
-		papiReadScenario_vec(line, "LVDC_DotM_last", DotM_last);
-		papiReadScenario_vec(line, "LVDC_DotS", DotS);
-		papiReadScenario_vec(line, "LVDC_DotXEZ", DotXEZ);
-		papiReadScenario_vec(line, "LVDC_PCommandedAttitude", PCommandedAttitude);
-		papiReadScenario_vec(line, "LVDC_Pos4", Pos4);
-		papiReadScenario_vec(line, "LVDC_PosS", PosS);
-		papiReadScenario_vec(line, "LVDC_PosXEZ", PosXEZ);
-
-		// MATRIX3
-		papiReadScenario_mat(line, "LVDC_MX_A", MX_A);
-		papiReadScenario_mat(line, "LVDC_MX_B", MX_B);
-		papiReadScenario_mat(line, "LVDC_MX_G", MX_G);
-		papiReadScenario_mat(line, "LVDC_MX_K", MX_K);
-		papiReadScenario_mat(line, "LVDC_MX_phi_T", MX_phi_T);
-	}	
+		LVDC1BScenarioFields.Load(line, this);
+	}
 	if(oapiReadScenario_nextline (scn, line)){
 		if (!strnicmp(line, LVIMU_START_STRING, sizeof(LVIMU_START_STRING))) {
-			// fprintf(lvlog, "LVIMU LoadState() called\r\n");
-			// fflush(lvlog);
+			// TraceLog::Printf(TRACE_LVDC, "LVIMU LoadState() called\r\n");
 			lvimu.LoadState(scn);
 			/*
-			if(lvimu.Initialized) { fprintf(lvlog, "LVIMU Initialized\r\n"); }
-			if(lvimu.Operate){ fprintf(lvlog, "LVIMU Operate\r\n"); }
-			if(lvimu.Caged) { fprintf(lvlog, "LVIMU Caged\r\n"); }			
-			if(lvimu.TurnedOn) { fprintf(lvlog, "LVIMU Turned On\r\n"); }
-			fflush(lvlog);
+			if(lvimu.Initialized) { TraceLog::Printf(TRACE_LVDC, "LVIMU Initialized\r\n"); }
+			if(lvimu.Operate){ TraceLog::Printf(TRACE_LVDC, "LVIMU Operate\r\n"); }
+			if(lvimu.Caged) { TraceLog::Printf(TRACE_LVDC, "LVIMU Caged\r\n"); }			
+			if(lvimu.TurnedOn) { TraceLog::Printf(TRACE_LVDC, "LVIMU Turned On\r\n"); }
 			*/
 		}
 	}
@@ -2684,7 +2401,7 @@ void LVDC1B::LoadState(FILEHANDLE scn){
 // ***************************
 
 // Constructor
-LVDC::LVDC(){
+LVDC::LVDC() : cycleTimer("LVDC") {
 	int x=0;
 	Initialized = false;					// Reset cloberness flag
 	// Zeroize
@@ -2935,6 +2652,9 @@ LVDC::LVDC(){
 	S_P = 0;
 	S_Y = 0;
 	S1_Sep_Time = 0;
+	minorLoopTime = 0;
+	guidanceTime = 0;
+	padForce = 0;
 	sinceLastCycle = 0;
 	sinceLastGuidanceCycle = 0;
 	sin_chi_Yit = 0;
@@ -3083,12 +2803,10 @@ void LVDC::Init(Saturn* vs){
 	if(vs == NULL){ return; }				// Bail
 	if(Initialized == true){ 
 		if(owner == vs){
-			fprintf(lvlog,"init called after init, ignored\r\n");
-			fflush(lvlog);
+			TraceLog::Printf(TRACE_LVDC, "init called after init, ignored\r\n");
 			return;
 		}else{
-			fprintf(lvlog,"init called after init with new owner, proceeding\r\n");
-			fflush(lvlog);
+			TraceLog::Printf(TRACE_LVDC, "init called after init with new owner, proceeding\r\n");
 		}
 	}
 	owner = vs;								// Our ship
@@ -3412,6 +3130,9 @@ void LVDC::Init(Saturn* vs){
 	LVDC_TB_ETime = 0;
 	LVDC_Stop = 0;
 	IGMCycle = 0;
+	minorLoopTime = 0;
+	guidanceTime = 0;
+	padForce = 0;
 	sinceLastCycle = 0;
 	sinceLastGuidanceCycle = 0;
 	OrbNavCycle = 0;
@@ -3419,1329 +3140,686 @@ void LVDC::Init(Saturn* vs){
 	LVDC_EI_On = false;
 	S1_Sep_Time = 0;
 	CountPIPA = false;
-	if(!Initialized){ lvlog = fopen("lvlog.txt","w+"); }
-	fprintf(lvlog,"init complete\r\n");
-	fflush(lvlog);
+	TraceLog::Printf(TRACE_LVDC, "init complete\r\n");
 	Initialized = true;
 }
 
+// Scenario keys of the LVDC state, used by both SaveState and LoadState
+void LVDC::RegisterScenarioFields(ScenarioFieldTable &t) {
+	t.Add("LVDC_alpha_D_op", alpha_D_op);
+	t.Add("LVDC_BOOST", BOOST);
+	t.Add("LVDC_CountPIPA", CountPIPA);
+	t.Add("LVDC_Direct_Ascent", Direct_Ascent);
+	t.Add("LVDC_directstageint", directstageint);
+	t.Add("LVDC_directstagereset", directstagereset);
+	t.Add("LVDC_first_op", first_op);
+	t.Add("LVDC_GATE", GATE);
+	t.Add("LVDC_GATE0", GATE0);
+	t.Add("LVDC_GATE1", GATE1);
+	t.Add("LVDC_GATE2", GATE2);
+	t.Add("LVDC_GATE3", GATE3);
+	t.Add("LVDC_GATE4", GATE4);
+	t.Add("LVDC_GATE5", GATE5);
+	t.Add("LVDC_GATE6", GATE6);
+	t.Add("LVDC_HSL", HSL);
+	t.Add("LVDC_INH", INH);
+	t.Add("LVDC_INH1", INH1);
+	t.Add("LVDC_INH2", INH2);
+	t.Add("LVDC_init", init);
+	t.Add("LVDC_i_op", i_op);
+	t.Add("LVDC_liftoff", liftoff);
+	t.Add("LVDC_LVDC_EI_On", LVDC_EI_On);
+	t.Add("LVDC_LVDC_GRR", LVDC_GRR);
+	t.Add("LVDC_MRS", MRS);
+	t.Add("LVDC_OrbNavCycle", OrbNavCycle);
+	t.Add("LVDC_poweredflight", poweredflight);
+	t.Add("LVDC_ROT", ROT);
+	t.Add("LVDC_ROTR", ROTR);
+	t.Add("LVDC_S1_Engine_Out", S1_Engine_Out);
+	t.Add("LVDC_S2_BURNOUT", S2_BURNOUT);
+	t.Add("LVDC_S2_ENGINE_OUT", S2_ENGINE_OUT);
+	t.Add("LVDC_S2_IGNITION", S2_IGNITION);
+	t.Add("LVDC_S2_Startup", S2_Startup);
+	t.Add("LVDC_S4B_IGN", S4B_IGN);
+	t.Add("LVDC_S4B_REIGN", S4B_REIGN);
+	t.Add("LVDC_TerminalConditions", TerminalConditions);
+	t.Add("LVDC_theta_N_op", theta_N_op);
+	t.Add("LVDC_TU", TU);
+	t.Add("LVDC_TU10", TU10);
+	t.Add("LVDC_IGMCycle", IGMCycle);
+	t.Add("LVDC_LVDC_Stop", LVDC_Stop);
+	t.Add("LVDC_LVDC_Timebase", LVDC_Timebase);
+	t.Add("LVDC_tgt_index", tgt_index);
+	t.Add("LVDC_T_EO1", T_EO1);
+	t.Add("LVDC_T_EO2", T_EO2);
+	t.Add("LVDC_UP", UP);
+	t.Add("LVDC_a", a);
+	t.Add("LVDC_a_0p", a_0p);
+	t.Add("LVDC_a_0r", a_0r);
+	t.Add("LVDC_a_0y", a_0y);
+	t.Add("LVDC_a_1", a_1);
+	t.Add("LVDC_a_2", a_2);
+	t.Add("LVDC_a_1p", a_1p);
+	t.Add("LVDC_a_1r", a_1r);
+	t.Add("LVDC_a_1y", a_1y);
+	t.Add("LVDC_alpha_1", alpha_1);
+	t.Add("LVDC_alpha_2", alpha_2);
+	t.Add("LVDC_alpha_D", alpha_D);
+	t.Add("LVDC_alpha_TS", alpha_TS);
+	t.Add("LVDC_ALFTSA", TABLE15[0].alphaS_TS);
+	t.Add("LVDC_ALFTSB", TABLE15[1].alphaS_TS);
+	t.Add("LVDC_Azimuth", Azimuth);
+	t.Add("LVDC_Azo", Azo);
+	t.Add("LVDC_Azs", Azs);
+	t.Add("LVDC_B_11", B_11);
+	t.Add("LVDC_B_21", B_21);
+	t.Add("LVDC_B_12", B_12);
+	t.Add("LVDC_B_22", B_22);
+	t.Add("LVDC_beta", beta);
+	t.Add("LVDC_BETAA", TABLE15[0].beta);
+	t.Add("LVDC_BETAB", TABLE15[1].beta);
+	t.Add("LVDC_beta_p1c", beta_p1c);
+	t.Add("LVDC_beta_p2c", beta_p2c);
+	t.Add("LVDC_beta_p3c", beta_p3c);
+	t.Add("LVDC_beta_p4c", beta_p4c);
+	t.Add("LVDC_beta_pc", beta_pc);
+	t.Add("LVDC_beta_rc", beta_rc);
+	t.Add("LVDC_beta_y1c", beta_y1c);
+	t.Add("LVDC_beta_y2c", beta_y2c);
+	t.Add("LVDC_beta_y3c", beta_y3c);
+	t.Add("LVDC_beta_y4c", beta_y4c);
+	t.Add("LVDC_beta_yc", beta_yc);
+	t.Add("LVDC_C_2", C_2);
+	t.Add("LVDC_C_3", C_3);
+	t.Add("LVDC_C_4", C_4);
+	t.Add("LVDC_C3A0", TABLE15[0].target[0].C_3);
+	t.Add("LVDC_C3A1", TABLE15[0].target[1].C_3);
+	t.Add("LVDC_C3A2", TABLE15[0].target[2].C_3);
+	t.Add("LVDC_C3A3", TABLE15[0].target[3].C_3);
+	t.Add("LVDC_C3A4", TABLE15[0].target[4].C_3);
+	t.Add("LVDC_C3A5", TABLE15[0].target[5].C_3);
+	t.Add("LVDC_C3A6", TABLE15[0].target[6].C_3);
+	t.Add("LVDC_C3A7", TABLE15[0].target[7].C_3);
+	t.Add("LVDC_C3A8", TABLE15[0].target[8].C_3);
+	t.Add("LVDC_C3A9", TABLE15[0].target[9].C_3);
+	t.Add("LVDC_C3A10", TABLE15[0].target[10].C_3);
+	t.Add("LVDC_C3A11", TABLE15[0].target[11].C_3);
+	t.Add("LVDC_C3A12", TABLE15[0].target[12].C_3);
+	t.Add("LVDC_C3A13", TABLE15[0].target[13].C_3);
+	t.Add("LVDC_C3A14", TABLE15[0].target[14].C_3);
+	t.Add("LVDC_C3B0", TABLE15[1].target[0].C_3);
+	t.Add("LVDC_C3B1", TABLE15[1].target[1].C_3);
+	t.Add("LVDC_C3B2", TABLE15[1].target[2].C_3);
+	t.Add("LVDC_C3B3", TABLE15[1].target[3].C_3);
+	t.Add("LVDC_C3B4", TABLE15[1].target[4].C_3);
+	t.Add("LVDC_C3B5", TABLE15[1].target[5].C_3);
+	t.Add("LVDC_C3B6", TABLE15[1].target[6].C_3);
+	t.Add("LVDC_C3B7", TABLE15[1].target[7].C_3);
+	t.Add("LVDC_C3B8", TABLE15[1].target[8].C_3);
+	t.Add("LVDC_C3B9", TABLE15[1].target[9].C_3);
+	t.Add("LVDC_C3B10", TABLE15[1].target[10].C_3);
+	t.Add("LVDC_C3B11", TABLE15[1].target[11].C_3);
+	t.Add("LVDC_C3B12", TABLE15[1].target[12].C_3);
+	t.Add("LVDC_C3B13", TABLE15[1].target[13].C_3);
+	t.Add("LVDC_C3B14", TABLE15[1].target[14].C_3);
+	t.Add("LVDC_CCSA0", TABLE15[0].target[0].cos_sigma);
+	t.Add("LVDC_CCSA1", TABLE15[0].target[1].cos_sigma);
+	t.Add("LVDC_CCSA2", TABLE15[0].target[2].cos_sigma);
+	t.Add("LVDC_CCSA3", TABLE15[0].target[3].cos_sigma);
+	t.Add("LVDC_CCSA4", TABLE15[0].target[4].cos_sigma);
+	t.Add("LVDC_CCSA5", TABLE15[0].target[5].cos_sigma);
+	t.Add("LVDC_CCSA6", TABLE15[0].target[6].cos_sigma);
+	t.Add("LVDC_CCSA7", TABLE15[0].target[7].cos_sigma);
+	t.Add("LVDC_CCSA8", TABLE15[0].target[8].cos_sigma);
+	t.Add("LVDC_CCSA9", TABLE15[0].target[9].cos_sigma);
+	t.Add("LVDC_CCSA10", TABLE15[0].target[10].cos_sigma);
+	t.Add("LVDC_CCSA11", TABLE15[0].target[11].cos_sigma);
+	t.Add("LVDC_CCSA12", TABLE15[0].target[12].cos_sigma);
+	t.Add("LVDC_CCSA13", TABLE15[0].target[13].cos_sigma);
+	t.Add("LVDC_CCSA14", TABLE15[0].target[14].cos_sigma);
+	t.Add("LVDC_CCSB0", TABLE15[1].target[0].cos_sigma);
+	t.Add("LVDC_CCSB1", TABLE15[1].target[1].cos_sigma);
+	t.Add("LVDC_CCSB2", TABLE15[1].target[2].cos_sigma);
+	t.Add("LVDC_CCSB3", TABLE15[1].target[3].cos_sigma);
+	t.Add("LVDC_CCSB4", TABLE15[1].target[4].cos_sigma);
+	t.Add("LVDC_CCSB5", TABLE15[1].target[5].cos_sigma);
+	t.Add("LVDC_CCSB6", TABLE15[1].target[6].cos_sigma);
+	t.Add("LVDC_CCSB7", TABLE15[1].target[7].cos_sigma);
+	t.Add("LVDC_CCSB8", TABLE15[1].target[8].cos_sigma);
+	t.Add("LVDC_CCSB9", TABLE15[1].target[9].cos_sigma);
+	t.Add("LVDC_CCSB10", TABLE15[1].target[10].cos_sigma);
+	t.Add("LVDC_CCSB11", TABLE15[1].target[11].cos_sigma);
+	t.Add("LVDC_CCSB12", TABLE15[1].target[12].cos_sigma);
+	t.Add("LVDC_CCSB13", TABLE15[1].target[13].cos_sigma);
+	t.Add("LVDC_CCSB14", TABLE15[1].target[14].cos_sigma);
+	t.Add("LVDC_Cf", Cf);
+	t.Add("LVDC_CG", CG);
+	t.Add("LVDC_cos_chi_Yit", cos_chi_Yit);
+	t.Add("LVDC_cos_chi_Zit", cos_chi_Zit);
+	t.Add("LVDC_cos_sigma", cos_sigma);
+	t.Add("LVDC_Ct", Ct);
+	t.Add("LVDC_Ct_o", Ct_o);
+	t.Add("LVDC_D", D);
+	t.Add("LVDC_d2", d2);
+	t.Add("LVDC_ddot_zeta_GT", ddot_zeta_GT);
+	t.Add("LVDC_ddot_xi_GT", ddot_xi_GT);
+	t.Add("LVDC_DEC", DEC);
+	t.Add("LVDC_DECA0", TABLE15[0].target[0].DEC);
+	t.Add("LVDC_DECA1", TABLE15[0].target[1].DEC);
+	t.Add("LVDC_DECA2", TABLE15[0].target[2].DEC);
+	t.Add("LVDC_DECA3", TABLE15[0].target[3].DEC);
+	t.Add("LVDC_DECA4", TABLE15[0].target[4].DEC);
+	t.Add("LVDC_DECA5", TABLE15[0].target[5].DEC);
+	t.Add("LVDC_DECA6", TABLE15[0].target[6].DEC);
+	t.Add("LVDC_DECA7", TABLE15[0].target[7].DEC);
+	t.Add("LVDC_DECA8", TABLE15[0].target[8].DEC);
+	t.Add("LVDC_DECA9", TABLE15[0].target[9].DEC);
+	t.Add("LVDC_DECA10", TABLE15[0].target[10].DEC);
+	t.Add("LVDC_DECA11", TABLE15[0].target[11].DEC);
+	t.Add("LVDC_DECA12", TABLE15[0].target[12].DEC);
+	t.Add("LVDC_DECA13", TABLE15[0].target[13].DEC);
+	t.Add("LVDC_DECA14", TABLE15[0].target[14].DEC);
+	t.Add("LVDC_DECB0", TABLE15[1].target[0].DEC);
+	t.Add("LVDC_DECB1", TABLE15[1].target[1].DEC);
+	t.Add("LVDC_DECB2", TABLE15[1].target[2].DEC);
+	t.Add("LVDC_DECB3", TABLE15[1].target[3].DEC);
+	t.Add("LVDC_DECB4", TABLE15[1].target[4].DEC);
+	t.Add("LVDC_DECB5", TABLE15[1].target[5].DEC);
+	t.Add("LVDC_DECB6", TABLE15[1].target[6].DEC);
+	t.Add("LVDC_DECB7", TABLE15[1].target[7].DEC);
+	t.Add("LVDC_DECB8", TABLE15[1].target[8].DEC);
+	t.Add("LVDC_DECB9", TABLE15[1].target[9].DEC);
+	t.Add("LVDC_DECB10", TABLE15[1].target[10].DEC);
+	t.Add("LVDC_DECB11", TABLE15[1].target[11].DEC);
+	t.Add("LVDC_DECB12", TABLE15[1].target[12].DEC);
+	t.Add("LVDC_DECB13", TABLE15[1].target[13].DEC);
+	t.Add("LVDC_DECB14", TABLE15[1].target[14].DEC);
+	t.Add("LVDC_deta", deta);
+	t.Add("LVDC_dxi", dxi);
+	t.Add("LVDC_dot_dxi", dot_dxi);
+	t.Add("LVDC_dot_deta", dot_deta);
+	t.Add("LVDC_dot_dzeta", dot_dzeta);
+	t.Add("LVDC_dot_dxit", dot_dxit);
+	t.Add("LVDC_dot_detat", dot_detat);
+	t.Add("LVDC_dot_dzetat", dot_dzetat);
+	t.Add("LVDC_dotM_1", dotM_1);
+	t.Add("LVDC_dotM_2", dotM_2);
+	t.Add("LVDC_dotM_2R", dotM_2R);
+	t.Add("LVDC_dotM_3", dotM_3);
+	t.Add("LVDC_dotM_3R", dotM_3R);
+	t.Add("LVDC_dot_phi_1", dot_phi_1);
+	t.Add("LVDC_dot_phi_T", dot_phi_T);
+	t.Add("LVDC_dot_zeta_T", dot_zeta_T);
+	t.Add("LVDC_dot_xi_T", dot_xi_T);
+	t.Add("LVDC_dot_eta_T", dot_eta_T);
+	t.Add("LVDC_Drag_Area[0]", Drag_Area[0]);
+	t.Add("LVDC_Drag_Area[1]", Drag_Area[1]);
+	t.Add("LVDC_Drag_Area[2]", Drag_Area[2]);
+	t.Add("LVDC_Drag_Area[3]", Drag_Area[3]);
+	t.Add("LVDC_Drag_Area[4]", Drag_Area[4]);
+	t.Add("LVDC_dt", dt);
+	t.Add("LVDC_dT_3", dT_3);
+	t.Add("LVDC_dT_4", dT_4);
+	t.Add("LVDC_dt_c", dt_c);
+	t.Add("LVDC_dT_cost", dT_cost);
+	t.Add("LVDC_dT_F", dT_F);
+	t.Add("LVDC_dt_g", dt_g);
+	t.Add("LVDC_dt_LET", dt_LET);
+	t.Add("LVDC_dT_LIM", dT_LIM);
+	t.Add("LVDC_dtt_1", dtt_1);
+	t.Add("LVDC_dtt_2", dtt_2);
+	t.Add("LVDC_dTt_4", dTt_4);
+	t.Add("LVDC_dV", dV);
+	t.Add("LVDC_dV_B", dV_B);
+	t.Add("LVDC_dV_BR", dV_BR);
+	t.Add("LVDC_e", e);
+	t.Add("LVDC_e_N", e_N);
+	t.Add("LVDC_ENA0", TABLE15[0].target[0].e_N);
+	t.Add("LVDC_ENA1", TABLE15[0].target[1].e_N);
+	t.Add("LVDC_ENA2", TABLE15[0].target[2].e_N);
+	t.Add("LVDC_ENA3", TABLE15[0].target[3].e_N);
+	t.Add("LVDC_ENA4", TABLE15[0].target[4].e_N);
+	t.Add("LVDC_ENA5", TABLE15[0].target[5].e_N);
+	t.Add("LVDC_ENA6", TABLE15[0].target[6].e_N);
+	t.Add("LVDC_ENA7", TABLE15[0].target[7].e_N);
+	t.Add("LVDC_ENA8", TABLE15[0].target[8].e_N);
+	t.Add("LVDC_ENA9", TABLE15[0].target[9].e_N);
+	t.Add("LVDC_ENA10", TABLE15[0].target[10].e_N);
+	t.Add("LVDC_ENA11", TABLE15[0].target[11].e_N);
+	t.Add("LVDC_ENA12", TABLE15[0].target[12].e_N);
+	t.Add("LVDC_ENA13", TABLE15[0].target[13].e_N);
+	t.Add("LVDC_ENA14", TABLE15[0].target[14].e_N);
+	t.Add("LVDC_ENB0", TABLE15[1].target[0].e_N);
+	t.Add("LVDC_ENB1", TABLE15[1].target[1].e_N);
+	t.Add("LVDC_ENB2", TABLE15[1].target[2].e_N);
+	t.Add("LVDC_ENB3", TABLE15[1].target[3].e_N);
+	t.Add("LVDC_ENB4", TABLE15[1].target[4].e_N);
+	t.Add("LVDC_ENB5", TABLE15[1].target[5].e_N);
+	t.Add("LVDC_ENB6", TABLE15[1].target[6].e_N);
+	t.Add("LVDC_ENB7", TABLE15[1].target[7].e_N);
+	t.Add("LVDC_ENB8", TABLE15[1].target[8].e_N);
+	t.Add("LVDC_ENB9", TABLE15[1].target[9].e_N);
+	t.Add("LVDC_ENB10", TABLE15[1].target[10].e_N);
+	t.Add("LVDC_ENB11", TABLE15[1].target[11].e_N);
+	t.Add("LVDC_ENB12", TABLE15[1].target[12].e_N);
+	t.Add("LVDC_ENB13", TABLE15[1].target[13].e_N);
+	t.Add("LVDC_ENB14", TABLE15[1].target[14].e_N);
+	t.Add("LVDC_eps_1", eps_1);
+	t.Add("LVDC_eps_1R", eps_1R);
+	t.Add("LVDC_eps_2", eps_2);
+	t.Add("LVDC_eps_2R", eps_2R);
+	t.Add("LVDC_eps_3", eps_3);
+	t.Add("LVDC_eps_3R", eps_3R);
+	t.Add("LVDC_eps_4", eps_4);
+	t.Add("LVDC_eps_4R", eps_4R);
+	t.Add("LVDC_eps_p", eps_p);
+	t.Add("LVDC_eps_ymr", eps_ymr);
+	t.Add("LVDC_eps_ypr", eps_ypr);
+	t.Add("LVDC_f", f);
+	t.Add("LVDC_F", F);
+	t.Add("LVDC_FA", TABLE15[0].f);
+	t.Add("LVDC_FB", TABLE15[1].f);
+	t.Add("LVDC_Fm", Fm);
+	t.Add("LVDC_Fx[0][0]", Fx[0][0]);
+	t.Add("LVDC_Fx[0][1]", Fx[0][1]);
+	t.Add("LVDC_Fx[0][2]", Fx[0][2]);
+	t.Add("LVDC_Fx[0][3]", Fx[0][3]);
+	t.Add("LVDC_Fx[0][4]", Fx[0][4]);
+	t.Add("LVDC_Fx[1][0]", Fx[1][0]);
+	t.Add("LVDC_Fx[1][1]", Fx[1][1]);
+	t.Add("LVDC_Fx[1][2]", Fx[1][2]);
+	t.Add("LVDC_Fx[1][3]", Fx[1][3]);
+	t.Add("LVDC_Fx[1][4]", Fx[1][4]);
+	t.Add("LVDC_Fx[2][0]", Fx[2][0]);
+	t.Add("LVDC_Fx[2][1]", Fx[2][1]);
+	t.Add("LVDC_Fx[2][2]", Fx[2][2]);
+	t.Add("LVDC_Fx[2][3]", Fx[2][3]);
+	t.Add("LVDC_Fx[2][4]", Fx[2][4]);
+	t.Add("LVDC_Fx[3][0]", Fx[3][0]);
+	t.Add("LVDC_Fx[3][1]", Fx[3][1]);
+	t.Add("LVDC_Fx[3][2]", Fx[3][2]);
+	t.Add("LVDC_Fx[3][3]", Fx[3][3]);
+	t.Add("LVDC_Fx[3][4]", Fx[3][4]);
+	t.Add("LVDC_Fx[4][0]", Fx[4][0]);
+	t.Add("LVDC_Fx[4][1]", Fx[4][1]);
+	t.Add("LVDC_Fx[4][2]", Fx[4][2]);
+	t.Add("LVDC_Fx[4][3]", Fx[4][3]);
+	t.Add("LVDC_Fx[4][4]", Fx[4][4]);
+	t.Add("LVDC_fx[0]", fx[0]);
+	t.Add("LVDC_fx[1]", fx[1]);
+	t.Add("LVDC_fx[2]", fx[2]);
+	t.Add("LVDC_fx[3]", fx[3]);
+	t.Add("LVDC_fx[4]", fx[4]);
+	t.Add("LVDC_fx[5]", fx[5]);
+	t.Add("LVDC_fx[6]", fx[6]);
+	t.Add("LVDC_fxt[0]", fxt[0]);
+	t.Add("LVDC_fxt[1]", fxt[1]);
+	t.Add("LVDC_fxt[2]", fxt[2]);
+	t.Add("LVDC_fxt[3]", fxt[3]);
+	t.Add("LVDC_fxt[4]", fxt[4]);
+	t.Add("LVDC_fxt[5]", fxt[5]);
+	t.Add("LVDC_fxt[6]", fxt[6]);
+	t.Add("LVDC_GPitch[0]", GPitch[0]);
+	t.Add("LVDC_GPitch[1]", GPitch[1]);
+	t.Add("LVDC_GPitch[2]", GPitch[2]);
+	t.Add("LVDC_GPitch[3]", GPitch[3]);
+	t.Add("LVDC_GYaw[0]", GYaw[0]);
+	t.Add("LVDC_GYaw[1]", GYaw[1]);
+	t.Add("LVDC_GYaw[2]", GYaw[2]);
+	t.Add("LVDC_GYaw[3]", GYaw[3]);
+	t.Add("LVDC_G_T", G_T);
+	t.Add("LVDC_gx[0]", gx[0]);
+	t.Add("LVDC_gx[1]", gx[1]);
+	t.Add("LVDC_gx[2]", gx[2]);
+	t.Add("LVDC_gx[3]", gx[3]);
+	t.Add("LVDC_gx[4]", gx[4]);
+	t.Add("LVDC_gx[5]", gx[5]);
+	t.Add("LVDC_gx[6]", gx[6]);
+	t.Add("LVDC_gxt[0]", gxt[0]);
+	t.Add("LVDC_gxt[1]", gxt[1]);
+	t.Add("LVDC_gxt[2]", gxt[2]);
+	t.Add("LVDC_gxt[3]", gxt[3]);
+	t.Add("LVDC_gxt[4]", gxt[4]);
+	t.Add("LVDC_gxt[5]", gxt[5]);
+	t.Add("LVDC_gxt[6]", gxt[6]);
+	t.Add("LVDC_H", H);
+	t.Add("LVDC_hx[0][0]", hx[0][0]);
+	t.Add("LVDC_hx[0][1]", hx[0][1]);
+	t.Add("LVDC_hx[0][2]", hx[0][2]);
+	t.Add("LVDC_hx[0][3]", hx[0][3]);
+	t.Add("LVDC_hx[0][4]", hx[0][4]);
+	t.Add("LVDC_hx[1][0]", hx[1][0]);
+	t.Add("LVDC_hx[1][1]", hx[1][1]);
+	t.Add("LVDC_hx[1][2]", hx[1][2]);
+	t.Add("LVDC_hx[1][3]", hx[1][3]);
+	t.Add("LVDC_hx[1][4]", hx[1][4]);
+	t.Add("LVDC_hx[2][0]", hx[2][0]);
+	t.Add("LVDC_hx[2][1]", hx[2][1]);
+	t.Add("LVDC_hx[2][2]", hx[2][2]);
+	t.Add("LVDC_hx[2][3]", hx[2][3]);
+	t.Add("LVDC_hx[2][4]", hx[2][4]);
+	t.Add("LVDC_IGMInterval", IGMInterval);
+	t.Add("LVDC_Inclination", Inclination);
+	t.Add("LVDC_J", J);
+	t.Add("LVDC_J_1", J_1);
+	t.Add("LVDC_J_2", J_2);
+	t.Add("LVDC_J_3", J_3);
+	t.Add("LVDC_J_12", J_12);
+	t.Add("LVDC_Jt_3", Jt_3);
+	t.Add("LVDC_J_Y", J_Y);
+	t.Add("LVDC_J_P", J_P);
+	t.Add("LVDC_K_1", K_1);
+	t.Add("LVDC_K_2", K_2);
+	t.Add("LVDC_K_3", K_3);
+	t.Add("LVDC_K_4", K_4);
+	t.Add("LVDC_K_5", K_5);
+	t.Add("LVDC_K_P1", K_P1);
+	t.Add("LVDC_K_P2", K_P2);
+	t.Add("LVDC_K_Y1", K_Y1);
+	t.Add("LVDC_K_Y2", K_Y2);
+	t.Add("LVDC_K_Y", K_Y);
+	t.Add("LVDC_K_P", K_P);
+	t.Add("LVDC_D_P", D_P);
+	t.Add("LVDC_D_Y", D_Y);
+	t.Add("LVDC_L_1", L_1);
+	t.Add("LVDC_L_2", L_2);
+	t.Add("LVDC_L_3", L_3);
+	t.Add("LVDC_dL_3", dL_3);
+	t.Add("LVDC_Lt_3", Lt_3);
+	t.Add("LVDC_L_12", L_12);
+	t.Add("LVDC_L_P", L_P);
+	t.Add("LVDC_L_Y", L_Y);
+	t.Add("LVDC_Lt_Y", Lt_Y);
+	t.Add("LVDC_LVDC_TB_ETime", LVDC_TB_ETime);
+	t.Add("LVDC_mu", mu);
+	t.Add("LVDC_omega_E", omega_E);
+	t.Add("LVDC_OPitch[0]", OPitch[0]);
+	t.Add("LVDC_OPitch[1]", OPitch[1]);
+	t.Add("LVDC_OPitch[2]", OPitch[2]);
+	t.Add("LVDC_OPitch[3]", OPitch[3]);
+	t.Add("LVDC_OYaw[0]", OYaw[0]);
+	t.Add("LVDC_OYaw[1]", OYaw[1]);
+	t.Add("LVDC_OYaw[2]", OYaw[2]);
+	t.Add("LVDC_OYaw[3]", OYaw[3]);
+	t.Add("LVDC_p", p);
+	t.Add("LVDC_P_1", P_1);
+	t.Add("LVDC_P_2", P_2);
+	t.Add("LVDC_P_3", P_3);
+	t.Add("LVDC_P_12", P_12);
+	t.Add("LVDC_phi_L", phi_L);
+	t.Add("LVDC_phi_T", phi_T);
+	t.Add("LVDC_Q_1", Q_1);
+	t.Add("LVDC_Q_2", Q_2);
+	t.Add("LVDC_Q_3", Q_3);
+	t.Add("LVDC_Q_12", Q_12);
+	t.Add("LVDC_Q_Y", Q_Y);
+	t.Add("LVDC_Q_P", Q_P);
+	t.Add("LVDC_R", R);
+	t.Add("LVDC_RAS", RAS);
+	t.Add("LVDC_RASA0", TABLE15[0].target[0].RAS);
+	t.Add("LVDC_RASA1", TABLE15[0].target[1].RAS);
+	t.Add("LVDC_RASA2", TABLE15[0].target[2].RAS);
+	t.Add("LVDC_RASA3", TABLE15[0].target[3].RAS);
+	t.Add("LVDC_RASA4", TABLE15[0].target[4].RAS);
+	t.Add("LVDC_RASA5", TABLE15[0].target[5].RAS);
+	t.Add("LVDC_RASA6", TABLE15[0].target[6].RAS);
+	t.Add("LVDC_RASA7", TABLE15[0].target[7].RAS);
+	t.Add("LVDC_RASA8", TABLE15[0].target[8].RAS);
+	t.Add("LVDC_RASA9", TABLE15[0].target[9].RAS);
+	t.Add("LVDC_RASA10", TABLE15[0].target[10].RAS);
+	t.Add("LVDC_RASA11", TABLE15[0].target[11].RAS);
+	t.Add("LVDC_RASA12", TABLE15[0].target[12].RAS);
+	t.Add("LVDC_RASA13", TABLE15[0].target[13].RAS);
+	t.Add("LVDC_RASA14", TABLE15[0].target[14].RAS);
+	t.Add("LVDC_RASB0", TABLE15[1].target[0].RAS);
+	t.Add("LVDC_RASB1", TABLE15[1].target[1].RAS);
+	t.Add("LVDC_RASB2", TABLE15[1].target[2].RAS);
+	t.Add("LVDC_RASB3", TABLE15[1].target[3].RAS);
+	t.Add("LVDC_RASB4", TABLE15[1].target[4].RAS);
+	t.Add("LVDC_RASB5", TABLE15[1].target[5].RAS);
+	t.Add("LVDC_RASB6", TABLE15[1].target[6].RAS);
+	t.Add("LVDC_RASB7", TABLE15[1].target[7].RAS);
+	t.Add("LVDC_RASB8", TABLE15[1].target[8].RAS);
+	t.Add("LVDC_RASB9", TABLE15[1].target[9].RAS);
+	t.Add("LVDC_RASB10", TABLE15[1].target[10].RAS);
+	t.Add("LVDC_RASB11", TABLE15[1].target[11].RAS);
+	t.Add("LVDC_RASB12", TABLE15[1].target[12].RAS);
+	t.Add("LVDC_RASB13", TABLE15[1].target[13].RAS);
+	t.Add("LVDC_RASB14", TABLE15[1].target[14].RAS);
+	t.Add("LVDC_RateGain", RateGain);
+	t.Add("LVDC_ErrorGain", ErrorGain);
+	t.Add("LVDC_rho", rho);
+	t.Add("LVDC_Rho[0]", Rho[0]);
+	t.Add("LVDC_Rho[1]", Rho[1]);
+	t.Add("LVDC_Rho[2]", Rho[2]);
+	t.Add("LVDC_Rho[3]", Rho[3]);
+	t.Add("LVDC_Rho[4]", Rho[4]);
+	t.Add("LVDC_Rho[5]", Rho[5]);
+	t.Add("LVDC_R_N", R_N);
+	t.Add("LVDC_RNA", TABLE15[0].R_N);
+	t.Add("LVDC_RNB", TABLE15[1].R_N);
+	t.Add("LVDC_ROV", ROV);
+	t.Add("LVDC_ROVR", ROVR);
+	t.Add("LVDC_ROVs", ROVs);
+	t.Add("LVDC_R_T", R_T);
+	t.Add("LVDC_S_1", S_1);
+	t.Add("LVDC_S_2", S_2);
+	t.Add("LVDC_S_3", S_3);
+	t.Add("LVDC_S_12", S_12);
+	t.Add("LVDC_S_P", S_P);
+	t.Add("LVDC_S_Y", S_Y);
+	t.Add("LVDC_S1_Sep_Time", S1_Sep_Time);
+	t.Add("LVDC_minorLoopTime", minorLoopTime);
+	t.Add("LVDC_guidanceTime", guidanceTime);
+	t.Add("LVDC_sinceLastCycle", sinceLastCycle);
+	t.Add("LVDC_sinceLastGuidanceCycle", sinceLastGuidanceCycle);
+	t.Add("LVDC_sin_chi_Yit", sin_chi_Yit);
+	t.Add("LVDC_sin_chi_Zit", sin_chi_Zit);
+	t.Add("LVDC_sin_gam", sin_gam);
+	t.Add("LVDC_cos_gam", cos_gam);
+	t.Add("LVDC_SMCG", SMCG);
+	t.Add("LVDC_S", S);
+	t.Add("LVDC_P", P);
+	t.Add("LVDC_S_34", S_34);
+	t.Add("LVDC_P_34", P_34);
+	t.Add("LVDC_t", t);
+	t.Add("LVDC_T_0", T_0);
+	t.Add("LVDC_t_1", t_1);
+	t.Add("LVDC_T_1", T_1);
+	t.Add("LVDC_T_1c", T_1c);
+	t.Add("LVDC_t_2", t_2);
+	t.Add("LVDC_T_2", T_2);
+	t.Add("LVDC_t_21", t_21);
+	t.Add("LVDC_T_2R", T_2R);
+	t.Add("LVDC_t_3", t_3);
+	t.Add("LVDC_T_3", T_3);
+	t.Add("LVDC_t_3i", t_3i);
+	t.Add("LVDC_t_4", t_4);
+	t.Add("LVDC_T_4N", T_4N);
+	t.Add("LVDC_t_5", t_5);
+	t.Add("LVDC_t_6", t_6);
+	t.Add("LVDC_TA1", TA1);
+	t.Add("LVDC_TA2", TA2);
+	t.Add("LVDC_T_ar", T_ar);
+	t.Add("LVDC_TAS", TAS);
+	t.Add("LVDC_tau1", tau1);
+	t.Add("LVDC_tau2", tau2);
+	t.Add("LVDC_tau2N", tau2N);
+	t.Add("LVDC_tau3", tau3);
+	t.Add("LVDC_tau3N", tau3N);
+	t.Add("LVDC_tau3R", tau3R);
+	t.Add("LVDC_t_B1", t_B1);
+	t.Add("LVDC_TB1", TB1);
+	t.Add("LVDC_t_B2", t_B2);
+	t.Add("LVDC_TB2", TB2);
+	t.Add("LVDC_t_B3", t_B3);
+	t.Add("LVDC_TB3", TB3);
+	t.Add("LVDC_t_B4", t_B4);
+	t.Add("LVDC_TB4", TB4);
+	t.Add("LVDC_TB4A", TB4A);
+	t.Add("LVDC_TB5", TB5);
+	t.Add("LVDC_TB6", TB6);
+	t.Add("LVDC_TB7", TB7);
+	t.Add("LVDC_T_c", T_c);
+	t.Add("LVDC_tchi_y_last", tchi_y_last);
+	t.Add("LVDC_tchi_p_last", tchi_p_last);
+	t.Add("LVDC_tchi_y", tchi_y);
+	t.Add("LVDC_tchi_p", tchi_p);
+	t.Add("LVDC_t_clock", t_clock);
+	t.Add("LVDC_T_CO", T_CO);
+	t.Add("LVDC_t_D", t_D);
+	t.Add("LVDC_t_D0", t_D0);
+	t.Add("LVDC_t_D1", t_D1);
+	t.Add("LVDC_t_D2", t_D2);
+	t.Add("LVDC_t_D3", t_D3);
+	t.Add("LVDC_t_DS0", t_DS0);
+	t.Add("LVDC_t_DS1", t_DS1);
+	t.Add("LVDC_t_DS2", t_DS2);
+	t.Add("LVDC_t_DS3", t_DS3);
+	t.Add("LVDC_t_fail", t_fail);
+	t.Add("LVDC_T_GO", T_GO);
+	t.Add("LVDC_TETEO", theta_EO);
+	t.Add("LVDC_theta_N", theta_N);
+	t.Add("LVDC_TI5F2", TI5F2);
+	t.Add("LVDC_T_IGM", T_IGM);
+	t.Add("LVDC_T_L", T_L);
+	t.Add("LVDC_T_LET", T_LET);
+	t.Add("LVDC_T_LO", T_LO);
+	t.Add("LVDC_TPA0", TABLE15[0].target[0].t_D);
+	t.Add("LVDC_TPA1", TABLE15[0].target[1].t_D);
+	t.Add("LVDC_TPA2", TABLE15[0].target[2].t_D);
+	t.Add("LVDC_TPA3", TABLE15[0].target[3].t_D);
+	t.Add("LVDC_TPA4", TABLE15[0].target[4].t_D);
+	t.Add("LVDC_TPA5", TABLE15[0].target[5].t_D);
+	t.Add("LVDC_TPA6", TABLE15[0].target[6].t_D);
+	t.Add("LVDC_TPA7", TABLE15[0].target[7].t_D);
+	t.Add("LVDC_TPA8", TABLE15[0].target[8].t_D);
+	t.Add("LVDC_TPA9", TABLE15[0].target[9].t_D);
+	t.Add("LVDC_TPA10", TABLE15[0].target[10].t_D);
+	t.Add("LVDC_TPA11", TABLE15[0].target[11].t_D);
+	t.Add("LVDC_TPA12", TABLE15[0].target[12].t_D);
+	t.Add("LVDC_TPA13", TABLE15[0].target[13].t_D);
+	t.Add("LVDC_TPA14", TABLE15[0].target[14].t_D);
+	t.Add("LVDC_TPB0", TABLE15[1].target[0].t_D);
+	t.Add("LVDC_TPB1", TABLE15[1].target[1].t_D);
+	t.Add("LVDC_TPB2", TABLE15[1].target[2].t_D);
+	t.Add("LVDC_TPB3", TABLE15[1].target[3].t_D);
+	t.Add("LVDC_TPB4", TABLE15[1].target[4].t_D);
+	t.Add("LVDC_TPB5", TABLE15[1].target[5].t_D);
+	t.Add("LVDC_TPB6", TABLE15[1].target[6].t_D);
+	t.Add("LVDC_TPB7", TABLE15[1].target[7].t_D);
+	t.Add("LVDC_TPB8", TABLE15[1].target[8].t_D);
+	t.Add("LVDC_TPB9", TABLE15[1].target[9].t_D);
+	t.Add("LVDC_TPB10", TABLE15[1].target[10].t_D);
+	t.Add("LVDC_TPB11", TABLE15[1].target[11].t_D);
+	t.Add("LVDC_TPB12", TABLE15[1].target[12].t_D);
+	t.Add("LVDC_TPB13", TABLE15[1].target[13].t_D);
+	t.Add("LVDC_TPB14", TABLE15[1].target[14].t_D);
+	t.Add("LVDC_T_RG", T_RG);
+	t.Add("LVDC_T_RP", T_RP);
+	t.Add("LVDC_T_S1", T_S1);
+	t.Add("LVDC_T_S2", T_S2);
+	t.Add("LVDC_T_S3", T_S3);
+	t.Add("LVDC_TS4BS", TS4BS);
+	t.Add("LVDC_t_SD1", t_SD1);
+	t.Add("LVDC_t_SD2", t_SD2);
+	t.Add("LVDC_t_SD3", t_SD3);
+	t.Add("LVDC_TSMC1", TSMC1);
+	t.Add("LVDC_TSMC2", TSMC2);
+	t.Add("LVDC_T_ST", T_ST);
+	t.Add("LVDC_TSTA", TABLE15[0].T_ST);
+	t.Add("LVDC_TSTB", TABLE15[1].T_ST);
+	t.Add("LVDC_T_T", T_T);
+	t.Add("LVDC_Tt_3", Tt_3);
+	t.Add("LVDC_Tt_T", Tt_T);
+	t.Add("LVDC_U_1", U_1);
+	t.Add("LVDC_U_2", U_2);
+	t.Add("LVDC_U_3", U_3);
+	t.Add("LVDC_U_12", U_12);
+	t.Add("LVDC_gamma_T", gamma_T);
+	t.Add("LVDC_V", V);
+	t.Add("LVDC_V_ex1", V_ex1);
+	t.Add("LVDC_V_ex2", V_ex2);
+	t.Add("LVDC_V_ex2R", V_ex2R);
+	t.Add("LVDC_V_ex3", V_ex3);
+	t.Add("LVDC_V_ex3R", V_ex3R);
+	t.Add("LVDC_V_i", V_i);
+	t.Add("LVDC_V_0", V_0);
+	t.Add("LVDC_V_1", V_1);
+	t.Add("LVDC_V_2", V_2);
+	t.Add("LVDC_V_S2T", V_S2T);
+	t.Add("LVDC_V_T", V_T);
+	t.Add("LVDC_V_TC", V_TC);
+	t.Add("LVDC_xi_T", xi_T);
+	t.Add("LVDC_eta_T", eta_T);
+	t.Add("LVDC_zeta_T", zeta_T);
+	t.Add("LVDC_X_S1", X_S1);
+	t.Add("LVDC_X_S2", X_S2);
+	t.Add("LVDC_X_S3", X_S3);
+	t.Add("LVDC_Xtt_y", Xtt_y);
+	t.Add("LVDC_Xtt_p", Xtt_p);
+	t.Add("LVDC_X_Zi", X_Zi);
+	t.Add("LVDC_X_Yi", X_Yi);
+	t.Add("LVDC_Y_u", Y_u);
+	t.Add("LVDC_ACommandedAttitude", ACommandedAttitude);
+	t.Add("LVDC_AttitudeError", AttitudeError);
+	t.Add("LVDC_AttRate", AttRate);
+	t.Add("LVDC_CommandedAttitude", CommandedAttitude);
+	t.Add("LVDC_CommandRateLimits", CommandRateLimits);
+	t.Add("LVDC_CurrentAttitude", CurrentAttitude);
+	t.Add("LVDC_ddotG_act", ddotG_act);
+	t.Add("LVDC_ddotG_last", ddotG_last);
+	t.Add("LVDC_ddotM_act", ddotM_act);
+	t.Add("LVDC_ddotM_last", ddotM_last);
+	t.Add("LVDC_DDotXEZ_G", DDotXEZ_G);
+	t.Add("LVDC_DotG_act", DotG_act);
+	t.Add("LVDC_DotG_last", DotG_last);
+	t.Add("LVDC_DotM_act", DotM_act);
+	t.Add("LVDC_DotM_last", DotM_last);
+	t.Add("LVDC_DotS", DotS);
+	t.Add("LVDC_DotXEZ", DotXEZ);
+	t.Add("LVDC_PCommandedAttitude", PCommandedAttitude);
+	t.Add("LVDC_Pos4", Pos4);
+	t.Add("LVDC_PosS", PosS);
+	t.Add("LVDC_PosXEZ", PosXEZ);
+	t.Add("LVDC_TargetVector", TargetVector);
+	t.Add("LVDC_WV", WV);
+	t.Add("LVDC_XLunarAttitude", XLunarAttitude);
+	t.Add("LVDC_MX_A", MX_A);
+	t.Add("LVDC_MX_B", MX_B);
+	t.Add("LVDC_MX_G", MX_G);
+	t.Add("LVDC_MX_K", MX_K);
+	t.Add("LVDC_MX_phi_T", MX_phi_T);
+}
+
+// The field table is shared by all instances, and built by the first one to load or save
+void LVDC::EnsureScenarioFields() {
+	if (!LVDCScenarioFields.IsBuilt()) {
+		LVDCScenarioFields.Begin(this);
+		RegisterScenarioFields(LVDCScenarioFields);
+		LVDCScenarioFields.End();
+	}
+}
+
 void LVDC::SaveState(FILEHANDLE scn) {
+	EnsureScenarioFields();
 	oapiWriteLine(scn, LVDC_START_STRING);
-	// Here we go
-	oapiWriteScenario_int(scn, "LVDC_alpha_D_op", alpha_D_op);
-	oapiWriteScenario_int(scn, "LVDC_BOOST", BOOST);
-	oapiWriteScenario_int(scn, "LVDC_CountPIPA", CountPIPA);
-	oapiWriteScenario_int(scn, "LVDC_Direct_Ascent", Direct_Ascent);
-	oapiWriteScenario_int(scn, "LVDC_directstageint", directstageint);
-	oapiWriteScenario_int(scn, "LVDC_directstagereset", directstagereset);
-	oapiWriteScenario_int(scn, "LVDC_first_op", first_op);
-	oapiWriteScenario_int(scn, "LVDC_GATE", GATE);
-	oapiWriteScenario_int(scn, "LVDC_GATE0", GATE0);
-	oapiWriteScenario_int(scn, "LVDC_GATE1", GATE1);
-	oapiWriteScenario_int(scn, "LVDC_GATE2", GATE2);
-	oapiWriteScenario_int(scn, "LVDC_GATE3", GATE3);
-	oapiWriteScenario_int(scn, "LVDC_GATE4", GATE4);
-	oapiWriteScenario_int(scn, "LVDC_GATE5", GATE5);
-	oapiWriteScenario_int(scn, "LVDC_GATE6", GATE6);
-	oapiWriteScenario_int(scn, "LVDC_HSL", HSL);
-	oapiWriteScenario_int(scn, "LVDC_INH", INH);
-	oapiWriteScenario_int(scn, "LVDC_INH1", INH1);
-	oapiWriteScenario_int(scn, "LVDC_INH2", INH2);
-	oapiWriteScenario_int(scn, "LVDC_init", init);
-	oapiWriteScenario_int(scn, "LVDC_i_op", i_op);
-	oapiWriteScenario_int(scn, "LVDC_liftoff", liftoff);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_EI_On", LVDC_EI_On);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_GRR", LVDC_GRR);
-	oapiWriteScenario_int(scn, "LVDC_MRS", MRS);
-	oapiWriteScenario_int(scn, "LVDC_OrbNavCycle", OrbNavCycle);
-	oapiWriteScenario_int(scn, "LVDC_poweredflight", poweredflight);
-	oapiWriteScenario_int(scn, "LVDC_ROT", ROT);
-	oapiWriteScenario_int(scn, "LVDC_ROTR", ROTR);
-	oapiWriteScenario_int(scn, "LVDC_S1_Engine_Out", S1_Engine_Out);
-	oapiWriteScenario_int(scn, "LVDC_S2_BURNOUT", S2_BURNOUT);
-	oapiWriteScenario_int(scn, "LVDC_S2_ENGINE_OUT", S2_ENGINE_OUT);
-	oapiWriteScenario_int(scn, "LVDC_S2_IGNITION", S2_IGNITION);
-	oapiWriteScenario_int(scn, "LVDC_S2_Startup", S2_Startup);
-	oapiWriteScenario_int(scn, "LVDC_S4B_IGN", S4B_IGN);
-	oapiWriteScenario_int(scn, "LVDC_S4B_REIGN", S4B_REIGN);
-	oapiWriteScenario_int(scn, "LVDC_TerminalConditions", TerminalConditions);
-	oapiWriteScenario_int(scn, "LVDC_theta_N_op", theta_N_op);
-	oapiWriteScenario_int(scn, "LVDC_TU", TU);
-	oapiWriteScenario_int(scn, "LVDC_TU10", TU10);
-	oapiWriteScenario_int(scn, "LVDC_IGMCycle", IGMCycle);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_Stop", LVDC_Stop);
-	oapiWriteScenario_int(scn, "LVDC_LVDC_Timebase", LVDC_Timebase);
-	oapiWriteScenario_int(scn, "LVDC_tgt_index", tgt_index);
-	oapiWriteScenario_int(scn, "LVDC_T_EO1", T_EO1);
-	oapiWriteScenario_int(scn, "LVDC_T_EO2", T_EO2);
-	oapiWriteScenario_int(scn, "LVDC_UP", UP);
-	papiWriteScenario_double(scn, "LVDC_a", a);
-	papiWriteScenario_double(scn, "LVDC_a_0p", a_0p);
-	papiWriteScenario_double(scn, "LVDC_a_0r", a_0r);
-	papiWriteScenario_double(scn, "LVDC_a_0y", a_0y);
-	papiWriteScenario_double(scn, "LVDC_a_1", a_1);
-	papiWriteScenario_double(scn, "LVDC_a_2", a_2);
-	papiWriteScenario_double(scn, "LVDC_a_1p", a_1p);
-	papiWriteScenario_double(scn, "LVDC_a_1r", a_1r);
-	papiWriteScenario_double(scn, "LVDC_a_1y", a_1y);
-	papiWriteScenario_double(scn, "LVDC_alpha_1", alpha_1);
-	papiWriteScenario_double(scn, "LVDC_alpha_2", alpha_2);
-	papiWriteScenario_double(scn, "LVDC_alpha_D", alpha_D);
-	papiWriteScenario_double(scn, "LVDC_alpha_TS", alpha_TS);
-	papiWriteScenario_double(scn, "LVDC_ALFTSA", TABLE15[0].alphaS_TS);
-	papiWriteScenario_double(scn, "LVDC_ALFTSB", TABLE15[1].alphaS_TS);
-	papiWriteScenario_double(scn, "LVDC_Azimuth", Azimuth);
-	papiWriteScenario_double(scn, "LVDC_Azo", Azo);
-	papiWriteScenario_double(scn, "LVDC_Azs", Azs);
-	papiWriteScenario_double(scn, "LVDC_B_11", B_11);
-	papiWriteScenario_double(scn, "LVDC_B_21", B_21);
-	papiWriteScenario_double(scn, "LVDC_B_12", B_12);
-	papiWriteScenario_double(scn, "LVDC_B_22", B_22);
-	papiWriteScenario_double(scn, "LVDC_beta", beta);
-	papiWriteScenario_double(scn, "LVDC_BETAA", TABLE15[0].beta);
-	papiWriteScenario_double(scn, "LVDC_BETAB", TABLE15[1].beta);
-	papiWriteScenario_double(scn, "LVDC_beta_p1c", beta_p1c);
-	papiWriteScenario_double(scn, "LVDC_beta_p2c", beta_p2c);
-	papiWriteScenario_double(scn, "LVDC_beta_p3c", beta_p3c);
-	papiWriteScenario_double(scn, "LVDC_beta_p4c", beta_p4c);
-	papiWriteScenario_double(scn, "LVDC_beta_pc", beta_pc);
-	papiWriteScenario_double(scn, "LVDC_beta_rc", beta_rc);
-	papiWriteScenario_double(scn, "LVDC_beta_y1c", beta_y1c);
-	papiWriteScenario_double(scn, "LVDC_beta_y2c", beta_y2c);
-	papiWriteScenario_double(scn, "LVDC_beta_y3c", beta_y3c);
-	papiWriteScenario_double(scn, "LVDC_beta_y4c", beta_y4c);
-	papiWriteScenario_double(scn, "LVDC_beta_yc", beta_yc);
-	papiWriteScenario_double(scn, "LVDC_C_2", C_2);
-	papiWriteScenario_double(scn, "LVDC_C_3", C_3);
-	papiWriteScenario_double(scn, "LVDC_C_4", C_4);
-	papiWriteScenario_double(scn, "LVDC_C3A0", TABLE15[0].target[0].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A1", TABLE15[0].target[1].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A2", TABLE15[0].target[2].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A3", TABLE15[0].target[3].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A4", TABLE15[0].target[4].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A5", TABLE15[0].target[5].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A6", TABLE15[0].target[6].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A7", TABLE15[0].target[7].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A8", TABLE15[0].target[8].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A9", TABLE15[0].target[9].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A10", TABLE15[0].target[10].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A11", TABLE15[0].target[11].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A12", TABLE15[0].target[12].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A13", TABLE15[0].target[13].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3A14", TABLE15[0].target[14].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B0", TABLE15[1].target[0].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B1", TABLE15[1].target[1].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B2", TABLE15[1].target[2].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B3", TABLE15[1].target[3].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B4", TABLE15[1].target[4].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B5", TABLE15[1].target[5].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B6", TABLE15[1].target[6].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B7", TABLE15[1].target[7].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B8", TABLE15[1].target[8].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B9", TABLE15[1].target[9].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B10", TABLE15[1].target[10].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B11", TABLE15[1].target[11].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B12", TABLE15[1].target[12].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B13", TABLE15[1].target[13].C_3);
-	papiWriteScenario_double(scn, "LVDC_C3B14", TABLE15[1].target[14].C_3);
-	papiWriteScenario_double(scn, "LVDC_CCSA0", TABLE15[0].target[0].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA1", TABLE15[0].target[1].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA2", TABLE15[0].target[2].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA3", TABLE15[0].target[3].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA4", TABLE15[0].target[4].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA5", TABLE15[0].target[5].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA6", TABLE15[0].target[6].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA7", TABLE15[0].target[7].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA8", TABLE15[0].target[8].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA9", TABLE15[0].target[9].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA10", TABLE15[0].target[10].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA11", TABLE15[0].target[11].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA12", TABLE15[0].target[12].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA13", TABLE15[0].target[13].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSA14", TABLE15[0].target[14].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB0", TABLE15[1].target[0].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB1", TABLE15[1].target[1].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB2", TABLE15[1].target[2].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB3", TABLE15[1].target[3].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB4", TABLE15[1].target[4].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB5", TABLE15[1].target[5].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB6", TABLE15[1].target[6].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB7", TABLE15[1].target[7].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB8", TABLE15[1].target[8].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB9", TABLE15[1].target[9].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB10", TABLE15[1].target[10].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB11", TABLE15[1].target[11].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB12", TABLE15[1].target[12].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB13", TABLE15[1].target[13].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_CCSB14", TABLE15[1].target[14].cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_Cf", Cf);
-	papiWriteScenario_double(scn, "LVDC_CG", CG);
-	papiWriteScenario_double(scn, "LVDC_cos_chi_Yit", cos_chi_Yit);
-	papiWriteScenario_double(scn, "LVDC_cos_chi_Zit", cos_chi_Zit);
-	papiWriteScenario_double(scn, "LVDC_cos_sigma", cos_sigma);
-	papiWriteScenario_double(scn, "LVDC_Ct", Ct);
-	papiWriteScenario_double(scn, "LVDC_Ct_o", Ct_o);
-	papiWriteScenario_double(scn, "LVDC_D", D);
-	papiWriteScenario_double(scn, "LVDC_d2", d2);
-	papiWriteScenario_double(scn, "LVDC_ddot_zeta_GT", ddot_zeta_GT);
-	papiWriteScenario_double(scn, "LVDC_ddot_xi_GT", ddot_xi_GT);
-	papiWriteScenario_double(scn, "LVDC_DEC", DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA0", TABLE15[0].target[0].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA1", TABLE15[0].target[1].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA2", TABLE15[0].target[2].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA3", TABLE15[0].target[3].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA4", TABLE15[0].target[4].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA5", TABLE15[0].target[5].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA6", TABLE15[0].target[6].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA7", TABLE15[0].target[7].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA8", TABLE15[0].target[8].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA9", TABLE15[0].target[9].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA10", TABLE15[0].target[10].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA11", TABLE15[0].target[11].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA12", TABLE15[0].target[12].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA13", TABLE15[0].target[13].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECA14", TABLE15[0].target[14].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB0", TABLE15[1].target[0].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB1", TABLE15[1].target[1].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB2", TABLE15[1].target[2].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB3", TABLE15[1].target[3].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB4", TABLE15[1].target[4].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB5", TABLE15[1].target[5].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB6", TABLE15[1].target[6].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB7", TABLE15[1].target[7].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB8", TABLE15[1].target[8].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB9", TABLE15[1].target[9].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB10", TABLE15[1].target[10].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB11", TABLE15[1].target[11].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB12", TABLE15[1].target[12].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB13", TABLE15[1].target[13].DEC);
-	papiWriteScenario_double(scn, "LVDC_DECB14", TABLE15[1].target[14].DEC);
-	papiWriteScenario_double(scn, "LVDC_deta", deta);
-	papiWriteScenario_double(scn, "LVDC_dxi", dxi);
-	papiWriteScenario_double(scn, "LVDC_dot_dxi", dot_dxi);
-	papiWriteScenario_double(scn, "LVDC_dot_deta", dot_deta);
-	papiWriteScenario_double(scn, "LVDC_dot_dzeta", dot_dzeta);
-	papiWriteScenario_double(scn, "LVDC_dot_dxit", dot_dxit);
-	papiWriteScenario_double(scn, "LVDC_dot_detat", dot_detat);
-	papiWriteScenario_double(scn, "LVDC_dot_dzetat", dot_dzetat);
-	papiWriteScenario_double(scn, "LVDC_dotM_1", dotM_1);
-	papiWriteScenario_double(scn, "LVDC_dotM_2", dotM_2);
-	papiWriteScenario_double(scn, "LVDC_dotM_2R", dotM_2R);
-	papiWriteScenario_double(scn, "LVDC_dotM_3", dotM_3);
-	papiWriteScenario_double(scn, "LVDC_dotM_3R", dotM_3R);
-	papiWriteScenario_double(scn, "LVDC_dot_phi_1", dot_phi_1);
-	papiWriteScenario_double(scn, "LVDC_dot_phi_T", dot_phi_T);
-	papiWriteScenario_double(scn, "LVDC_dot_zeta_T", dot_zeta_T);
-	papiWriteScenario_double(scn, "LVDC_dot_xi_T", dot_xi_T);
-	papiWriteScenario_double(scn, "LVDC_dot_eta_T", dot_eta_T);
-	papiWriteScenario_double(scn, "LVDC_Drag_Area[0]", Drag_Area[0]);
-	papiWriteScenario_double(scn, "LVDC_Drag_Area[1]", Drag_Area[1]);
-	papiWriteScenario_double(scn, "LVDC_Drag_Area[2]", Drag_Area[2]);
-	papiWriteScenario_double(scn, "LVDC_Drag_Area[3]", Drag_Area[3]);
-	papiWriteScenario_double(scn, "LVDC_Drag_Area[4]", Drag_Area[4]);
-	papiWriteScenario_double(scn, "LVDC_dt", dt);
-	papiWriteScenario_double(scn, "LVDC_dT_3", dT_3);
-	papiWriteScenario_double(scn, "LVDC_dT_4", dT_4);
-	papiWriteScenario_double(scn, "LVDC_dt_c", dt_c);
-	papiWriteScenario_double(scn, "LVDC_dT_cost", dT_cost);
-	papiWriteScenario_double(scn, "LVDC_dT_F", dT_F);
-	papiWriteScenario_double(scn, "LVDC_dt_g", dt_g);
-	papiWriteScenario_double(scn, "LVDC_dt_LET", dt_LET);
-	papiWriteScenario_double(scn, "LVDC_dT_LIM", dT_LIM);
-	papiWriteScenario_double(scn, "LVDC_dtt_1", dtt_1);
-	papiWriteScenario_double(scn, "LVDC_dtt_2", dtt_2);
-	papiWriteScenario_double(scn, "LVDC_dTt_4", dTt_4);
-	papiWriteScenario_double(scn, "LVDC_dV", dV);
-	papiWriteScenario_double(scn, "LVDC_dV_B", dV_B);
-	papiWriteScenario_double(scn, "LVDC_dV_BR", dV_BR);
-	papiWriteScenario_double(scn, "LVDC_e", e);
-	papiWriteScenario_double(scn, "LVDC_e_N", e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA0", TABLE15[0].target[0].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA1", TABLE15[0].target[1].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA2", TABLE15[0].target[2].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA3", TABLE15[0].target[3].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA4", TABLE15[0].target[4].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA5", TABLE15[0].target[5].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA6", TABLE15[0].target[6].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA7", TABLE15[0].target[7].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA8", TABLE15[0].target[8].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA9", TABLE15[0].target[9].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA10", TABLE15[0].target[10].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA11", TABLE15[0].target[11].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA12", TABLE15[0].target[12].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA13", TABLE15[0].target[13].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENA14", TABLE15[0].target[14].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB0", TABLE15[1].target[0].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB1", TABLE15[1].target[1].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB2", TABLE15[1].target[2].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB3", TABLE15[1].target[3].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB4", TABLE15[1].target[4].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB5", TABLE15[1].target[5].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB6", TABLE15[1].target[6].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB7", TABLE15[1].target[7].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB8", TABLE15[1].target[8].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB9", TABLE15[1].target[9].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB10", TABLE15[1].target[10].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB11", TABLE15[1].target[11].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB12", TABLE15[1].target[12].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB13", TABLE15[1].target[13].e_N);
-	papiWriteScenario_double(scn, "LVDC_ENB14", TABLE15[1].target[14].e_N);
-	papiWriteScenario_double(scn, "LVDC_eps_1", eps_1);
-	papiWriteScenario_double(scn, "LVDC_eps_1R", eps_1R);
-	papiWriteScenario_double(scn, "LVDC_eps_2", eps_2);
-	papiWriteScenario_double(scn, "LVDC_eps_2R", eps_2R);
-	papiWriteScenario_double(scn, "LVDC_eps_3", eps_3);
-	papiWriteScenario_double(scn, "LVDC_eps_3R", eps_3R);
-	papiWriteScenario_double(scn, "LVDC_eps_4", eps_4);
-	papiWriteScenario_double(scn, "LVDC_eps_4R", eps_4R);
-	papiWriteScenario_double(scn, "LVDC_eps_p", eps_p);
-	papiWriteScenario_double(scn, "LVDC_eps_ymr", eps_ymr);
-	papiWriteScenario_double(scn, "LVDC_eps_ypr", eps_ypr);
-	papiWriteScenario_double(scn, "LVDC_f", f);
-	papiWriteScenario_double(scn, "LVDC_F", F);
-	papiWriteScenario_double(scn, "LVDC_FA", TABLE15[0].f);
-	papiWriteScenario_double(scn, "LVDC_FB", TABLE15[1].f);
-	papiWriteScenario_double(scn, "LVDC_Fm", Fm);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][0]", Fx[0][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][1]", Fx[0][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][2]", Fx[0][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][3]", Fx[0][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[0][4]", Fx[0][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][0]", Fx[1][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][1]", Fx[1][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][2]", Fx[1][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][3]", Fx[1][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[1][4]", Fx[1][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][0]", Fx[2][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][1]", Fx[2][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][2]", Fx[2][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][3]", Fx[2][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[2][4]", Fx[2][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][0]", Fx[3][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][1]", Fx[3][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][2]", Fx[3][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][3]", Fx[3][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[3][4]", Fx[3][4]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][0]", Fx[4][0]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][1]", Fx[4][1]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][2]", Fx[4][2]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][3]", Fx[4][3]);
-	papiWriteScenario_double(scn, "LVDC_Fx[4][4]", Fx[4][4]);
-	papiWriteScenario_double(scn, "LVDC_fx[0]", fx[0]);
-	papiWriteScenario_double(scn, "LVDC_fx[1]", fx[1]);
-	papiWriteScenario_double(scn, "LVDC_fx[2]", fx[2]);
-	papiWriteScenario_double(scn, "LVDC_fx[3]", fx[3]);
-	papiWriteScenario_double(scn, "LVDC_fx[4]", fx[4]);
-	papiWriteScenario_double(scn, "LVDC_fx[5]", fx[5]);
-	papiWriteScenario_double(scn, "LVDC_fx[6]", fx[6]);
-	papiWriteScenario_double(scn, "LVDC_fxt[0]", fxt[0]);
-	papiWriteScenario_double(scn, "LVDC_fxt[1]", fxt[1]);
-	papiWriteScenario_double(scn, "LVDC_fxt[2]", fxt[2]);
-	papiWriteScenario_double(scn, "LVDC_fxt[3]", fxt[3]);
-	papiWriteScenario_double(scn, "LVDC_fxt[4]", fxt[4]);
-	papiWriteScenario_double(scn, "LVDC_fxt[5]", fxt[5]);
-	papiWriteScenario_double(scn, "LVDC_fxt[6]", fxt[6]);
-	papiWriteScenario_double(scn, "LVDC_GPitch[0]", GPitch[0]);
-	papiWriteScenario_double(scn, "LVDC_GPitch[1]", GPitch[1]);
-	papiWriteScenario_double(scn, "LVDC_GPitch[2]", GPitch[2]);
-	papiWriteScenario_double(scn, "LVDC_GPitch[3]", GPitch[3]);
-	papiWriteScenario_double(scn, "LVDC_GYaw[0]", GYaw[0]);
-	papiWriteScenario_double(scn, "LVDC_GYaw[1]", GYaw[1]);
-	papiWriteScenario_double(scn, "LVDC_GYaw[2]", GYaw[2]);
-	papiWriteScenario_double(scn, "LVDC_GYaw[3]", GYaw[3]);
-	papiWriteScenario_double(scn, "LVDC_G_T", G_T);
-	papiWriteScenario_double(scn, "LVDC_gx[0]", gx[0]);
-	papiWriteScenario_double(scn, "LVDC_gx[1]", gx[1]);
-	papiWriteScenario_double(scn, "LVDC_gx[2]", gx[2]);
-	papiWriteScenario_double(scn, "LVDC_gx[3]", gx[3]);
-	papiWriteScenario_double(scn, "LVDC_gx[4]", gx[4]);
-	papiWriteScenario_double(scn, "LVDC_gx[5]", gx[5]);
-	papiWriteScenario_double(scn, "LVDC_gx[6]", gx[6]);
-	papiWriteScenario_double(scn, "LVDC_gxt[0]", gxt[0]);
-	papiWriteScenario_double(scn, "LVDC_gxt[1]", gxt[1]);
-	papiWriteScenario_double(scn, "LVDC_gxt[2]", gxt[2]);
-	papiWriteScenario_double(scn, "LVDC_gxt[3]", gxt[3]);
-	papiWriteScenario_double(scn, "LVDC_gxt[4]", gxt[4]);
-	papiWriteScenario_double(scn, "LVDC_gxt[5]", gxt[5]);
-	papiWriteScenario_double(scn, "LVDC_gxt[6]", gxt[6]);
-	papiWriteScenario_double(scn, "LVDC_H", H);
-	papiWriteScenario_double(scn, "LVDC_hx[0][0]", hx[0][0]);
-	papiWriteScenario_double(scn, "LVDC_hx[0][1]", hx[0][1]);
-	papiWriteScenario_double(scn, "LVDC_hx[0][2]", hx[0][2]);
-	papiWriteScenario_double(scn, "LVDC_hx[0][3]", hx[0][3]);
-	papiWriteScenario_double(scn, "LVDC_hx[0][4]", hx[0][4]);
-	papiWriteScenario_double(scn, "LVDC_hx[1][0]", hx[1][0]);
-	papiWriteScenario_double(scn, "LVDC_hx[1][1]", hx[1][1]);
-	papiWriteScenario_double(scn, "LVDC_hx[1][2]", hx[1][2]);
-	papiWriteScenario_double(scn, "LVDC_hx[1][3]", hx[1][3]);
-	papiWriteScenario_double(scn, "LVDC_hx[1][4]", hx[1][4]);
-	papiWriteScenario_double(scn, "LVDC_hx[2][0]", hx[2][0]);
-	papiWriteScenario_double(scn, "LVDC_hx[2][1]", hx[2][1]);
-	papiWriteScenario_double(scn, "LVDC_hx[2][2]", hx[2][2]);
-	papiWriteScenario_double(scn, "LVDC_hx[2][3]", hx[2][3]);
-	papiWriteScenario_double(scn, "LVDC_hx[2][4]", hx[2][4]);
-	papiWriteScenario_double(scn, "LVDC_IGMInterval", IGMInterval);
-	papiWriteScenario_double(scn, "LVDC_Inclination", Inclination);
-	papiWriteScenario_double(scn, "LVDC_J", J);
-	papiWriteScenario_double(scn, "LVDC_J_1", J_1);
-	papiWriteScenario_double(scn, "LVDC_J_2", J_2);
-	papiWriteScenario_double(scn, "LVDC_J_3", J_3);
-	papiWriteScenario_double(scn, "LVDC_J_12", J_12);
-	papiWriteScenario_double(scn, "LVDC_Jt_3", Jt_3);
-	papiWriteScenario_double(scn, "LVDC_J_Y", J_Y);
-	papiWriteScenario_double(scn, "LVDC_J_P", J_P);
-	papiWriteScenario_double(scn, "LVDC_K_1", K_1);
-	papiWriteScenario_double(scn, "LVDC_K_2", K_2);
-	papiWriteScenario_double(scn, "LVDC_K_3", K_3);
-	papiWriteScenario_double(scn, "LVDC_K_4", K_4);
-	papiWriteScenario_double(scn, "LVDC_K_5", K_5);
-	papiWriteScenario_double(scn, "LVDC_K_P1", K_P1);
-	papiWriteScenario_double(scn, "LVDC_K_P2", K_P2);
-	papiWriteScenario_double(scn, "LVDC_K_Y1", K_Y1);
-	papiWriteScenario_double(scn, "LVDC_K_Y2", K_Y2);
-	papiWriteScenario_double(scn, "LVDC_K_Y", K_Y);
-	papiWriteScenario_double(scn, "LVDC_K_P", K_P);
-	papiWriteScenario_double(scn, "LVDC_D_P", D_P);
-	papiWriteScenario_double(scn, "LVDC_D_Y", D_Y);
-	papiWriteScenario_double(scn, "LVDC_L_1", L_1);
-	papiWriteScenario_double(scn, "LVDC_L_2", L_2);
-	papiWriteScenario_double(scn, "LVDC_L_3", L_3);
-	papiWriteScenario_double(scn, "LVDC_dL_3", dL_3);
-	papiWriteScenario_double(scn, "LVDC_Lt_3", Lt_3);
-	papiWriteScenario_double(scn, "LVDC_L_12", L_12);
-	papiWriteScenario_double(scn, "LVDC_L_P", L_P);
-	papiWriteScenario_double(scn, "LVDC_L_Y", L_Y);
-	papiWriteScenario_double(scn, "LVDC_Lt_Y", Lt_Y);
-	papiWriteScenario_double(scn, "LVDC_LVDC_TB_ETime", LVDC_TB_ETime);
-	papiWriteScenario_double(scn, "LVDC_mu", mu);
-	papiWriteScenario_double(scn, "LVDC_omega_E", omega_E);
-	papiWriteScenario_double(scn, "LVDC_OPitch[0]", OPitch[0]);
-	papiWriteScenario_double(scn, "LVDC_OPitch[1]", OPitch[1]);
-	papiWriteScenario_double(scn, "LVDC_OPitch[2]", OPitch[2]);
-	papiWriteScenario_double(scn, "LVDC_OPitch[3]", OPitch[3]);
-	papiWriteScenario_double(scn, "LVDC_OYaw[0]", OYaw[0]);
-	papiWriteScenario_double(scn, "LVDC_OYaw[1]", OYaw[1]);
-	papiWriteScenario_double(scn, "LVDC_OYaw[2]", OYaw[2]);
-	papiWriteScenario_double(scn, "LVDC_OYaw[3]", OYaw[3]);
-	papiWriteScenario_double(scn, "LVDC_p", p);
-	papiWriteScenario_double(scn, "LVDC_P_1", P_1);
-	papiWriteScenario_double(scn, "LVDC_P_2", P_2);
-	papiWriteScenario_double(scn, "LVDC_P_3", P_3);
-	papiWriteScenario_double(scn, "LVDC_P_12", P_12);
-	papiWriteScenario_double(scn, "LVDC_phi_L", phi_L);
-	papiWriteScenario_double(scn, "LVDC_phi_T", phi_T);
-	papiWriteScenario_double(scn, "LVDC_Q_1", Q_1);
-	papiWriteScenario_double(scn, "LVDC_Q_2", Q_2);
-	papiWriteScenario_double(scn, "LVDC_Q_3", Q_3);
-	papiWriteScenario_double(scn, "LVDC_Q_12", Q_12);
-	papiWriteScenario_double(scn, "LVDC_Q_Y", Q_Y);
-	papiWriteScenario_double(scn, "LVDC_Q_P", Q_P);
-	papiWriteScenario_double(scn, "LVDC_R", R);
-	papiWriteScenario_double(scn, "LVDC_RAS", RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA0", TABLE15[0].target[0].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA1", TABLE15[0].target[1].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA2", TABLE15[0].target[2].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA3", TABLE15[0].target[3].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA4", TABLE15[0].target[4].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA5", TABLE15[0].target[5].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA6", TABLE15[0].target[6].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA7", TABLE15[0].target[7].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA8", TABLE15[0].target[8].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA9", TABLE15[0].target[9].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA10", TABLE15[0].target[10].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA11", TABLE15[0].target[11].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA12", TABLE15[0].target[12].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA13", TABLE15[0].target[13].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASA14", TABLE15[0].target[14].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB0", TABLE15[1].target[0].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB1", TABLE15[1].target[1].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB2", TABLE15[1].target[2].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB3", TABLE15[1].target[3].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB4", TABLE15[1].target[4].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB5", TABLE15[1].target[5].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB6", TABLE15[1].target[6].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB7", TABLE15[1].target[7].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB8", TABLE15[1].target[8].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB9", TABLE15[1].target[9].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB10", TABLE15[1].target[10].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB11", TABLE15[1].target[11].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB12", TABLE15[1].target[12].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB13", TABLE15[1].target[13].RAS);
-	papiWriteScenario_double(scn, "LVDC_RASB14", TABLE15[1].target[14].RAS);
-	papiWriteScenario_double(scn, "LVDC_RateGain", RateGain);
-	papiWriteScenario_double(scn, "LVDC_ErrorGain", ErrorGain);
-	papiWriteScenario_double(scn, "LVDC_rho", rho);
-	papiWriteScenario_double(scn, "LVDC_Rho[0]", Rho[0]);
-	papiWriteScenario_double(scn, "LVDC_Rho[1]", Rho[1]);
-	papiWriteScenario_double(scn, "LVDC_Rho[2]", Rho[2]);
-	papiWriteScenario_double(scn, "LVDC_Rho[3]", Rho[3]);
-	papiWriteScenario_double(scn, "LVDC_Rho[4]", Rho[4]);
-	papiWriteScenario_double(scn, "LVDC_Rho[5]", Rho[5]);
-	papiWriteScenario_double(scn, "LVDC_R_N", R_N);
-	papiWriteScenario_double(scn, "LVDC_RNA", TABLE15[0].R_N);
-	papiWriteScenario_double(scn, "LVDC_RNB", TABLE15[1].R_N);
-	papiWriteScenario_double(scn, "LVDC_ROV", ROV);
-	papiWriteScenario_double(scn, "LVDC_ROVR", ROVR);
-	papiWriteScenario_double(scn, "LVDC_ROVs", ROVs);
-	papiWriteScenario_double(scn, "LVDC_R_T", R_T);
-	papiWriteScenario_double(scn, "LVDC_S_1", S_1);
-	papiWriteScenario_double(scn, "LVDC_S_2", S_2);
-	papiWriteScenario_double(scn, "LVDC_S_3", S_3);
-	papiWriteScenario_double(scn, "LVDC_S_12", S_12);
-	papiWriteScenario_double(scn, "LVDC_S_P", S_P);
-	papiWriteScenario_double(scn, "LVDC_S_Y", S_Y);
-	papiWriteScenario_double(scn, "LVDC_S1_Sep_Time", S1_Sep_Time);
-	papiWriteScenario_double(scn, "LVDC_sinceLastCycle", sinceLastCycle);
-	papiWriteScenario_double(scn, "LVDC_sinceLastGuidanceCycle", sinceLastGuidanceCycle);
-	papiWriteScenario_double(scn, "LVDC_sin_chi_Yit", sin_chi_Yit);
-	papiWriteScenario_double(scn, "LVDC_sin_chi_Zit", sin_chi_Zit);
-	papiWriteScenario_double(scn, "LVDC_sin_gam", sin_gam);
-	papiWriteScenario_double(scn, "LVDC_cos_gam", cos_gam);
-	papiWriteScenario_double(scn, "LVDC_SMCG", SMCG);
-	papiWriteScenario_double(scn, "LVDC_S", S);
-	papiWriteScenario_double(scn, "LVDC_P", P);
-	papiWriteScenario_double(scn, "LVDC_S_34", S_34);
-	papiWriteScenario_double(scn, "LVDC_P_34", P_34);
-	papiWriteScenario_double(scn, "LVDC_t", t);
-	papiWriteScenario_double(scn, "LVDC_T_0", T_0);
-	papiWriteScenario_double(scn, "LVDC_t_1", t_1);
-	papiWriteScenario_double(scn, "LVDC_T_1", T_1);
-	papiWriteScenario_double(scn, "LVDC_T_1c", T_1c);
-	papiWriteScenario_double(scn, "LVDC_t_2", t_2);
-	papiWriteScenario_double(scn, "LVDC_T_2", T_2);
-	papiWriteScenario_double(scn, "LVDC_t_21", t_21);
-	papiWriteScenario_double(scn, "LVDC_T_2R", T_2R);
-	papiWriteScenario_double(scn, "LVDC_t_3", t_3);
-	papiWriteScenario_double(scn, "LVDC_T_3", T_3);
-	papiWriteScenario_double(scn, "LVDC_t_3i", t_3i);
-	papiWriteScenario_double(scn, "LVDC_t_4", t_4);
-	papiWriteScenario_double(scn, "LVDC_T_4N", T_4N);
-	papiWriteScenario_double(scn, "LVDC_t_5", t_5);
-	papiWriteScenario_double(scn, "LVDC_t_6", t_6);
-	papiWriteScenario_double(scn, "LVDC_TA1", TA1);
-	papiWriteScenario_double(scn, "LVDC_TA2", TA2);
-	papiWriteScenario_double(scn, "LVDC_T_ar", T_ar);
-	papiWriteScenario_double(scn, "LVDC_TAS", TAS);
-	papiWriteScenario_double(scn, "LVDC_tau1", tau1);
-	papiWriteScenario_double(scn, "LVDC_tau2", tau2);
-	papiWriteScenario_double(scn, "LVDC_tau2N", tau2N);
-	papiWriteScenario_double(scn, "LVDC_tau3", tau3);
-	papiWriteScenario_double(scn, "LVDC_tau3N", tau3N);
-	papiWriteScenario_double(scn, "LVDC_tau3R", tau3R);
-	papiWriteScenario_double(scn, "LVDC_t_B1", t_B1);
-	papiWriteScenario_double(scn, "LVDC_TB1", TB1);
-	papiWriteScenario_double(scn, "LVDC_t_B2", t_B2);
-	papiWriteScenario_double(scn, "LVDC_TB2", TB2);
-	papiWriteScenario_double(scn, "LVDC_t_B3", t_B3);
-	papiWriteScenario_double(scn, "LVDC_TB3", TB3);
-	papiWriteScenario_double(scn, "LVDC_t_B4", t_B4);
-	papiWriteScenario_double(scn, "LVDC_TB4", TB4);
-	papiWriteScenario_double(scn, "LVDC_TB4A", TB4A);
-	papiWriteScenario_double(scn, "LVDC_TB5", TB5);
-	papiWriteScenario_double(scn, "LVDC_TB6", TB6);
-	papiWriteScenario_double(scn, "LVDC_TB7", TB7);
-	papiWriteScenario_double(scn, "LVDC_T_c", T_c);
-	papiWriteScenario_double(scn, "LVDC_tchi_y_last", tchi_y_last);
-	papiWriteScenario_double(scn, "LVDC_tchi_p_last", tchi_p_last);
-	papiWriteScenario_double(scn, "LVDC_tchi_y", tchi_y);
-	papiWriteScenario_double(scn, "LVDC_tchi_p", tchi_p);
-	papiWriteScenario_double(scn, "LVDC_t_clock", t_clock);
-	papiWriteScenario_double(scn, "LVDC_T_CO", T_CO);
-	papiWriteScenario_double(scn, "LVDC_t_D", t_D);
-	papiWriteScenario_double(scn, "LVDC_t_D0", t_D0);
-	papiWriteScenario_double(scn, "LVDC_t_D1", t_D1);
-	papiWriteScenario_double(scn, "LVDC_t_D2", t_D2);
-	papiWriteScenario_double(scn, "LVDC_t_D3", t_D3);
-	papiWriteScenario_double(scn, "LVDC_t_DS0", t_DS0);
-	papiWriteScenario_double(scn, "LVDC_t_DS1", t_DS1);
-	papiWriteScenario_double(scn, "LVDC_t_DS2", t_DS2);
-	papiWriteScenario_double(scn, "LVDC_t_DS3", t_DS3);
-	papiWriteScenario_double(scn, "LVDC_t_fail", t_fail);
-	papiWriteScenario_double(scn, "LVDC_T_GO", T_GO);
-	papiWriteScenario_double(scn, "LVDC_TETEO", theta_EO);
-	papiWriteScenario_double(scn, "LVDC_theta_N", theta_N);
-	papiWriteScenario_double(scn, "LVDC_TI5F2", TI5F2);
-	papiWriteScenario_double(scn, "LVDC_T_IGM", T_IGM);
-	papiWriteScenario_double(scn, "LVDC_T_L", T_L);
-	papiWriteScenario_double(scn, "LVDC_T_LET", T_LET);
-	papiWriteScenario_double(scn, "LVDC_T_LO", T_LO);
-	papiWriteScenario_double(scn, "LVDC_TPA0", TABLE15[0].target[0].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA1", TABLE15[0].target[1].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA2", TABLE15[0].target[2].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA3", TABLE15[0].target[3].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA4", TABLE15[0].target[4].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA5", TABLE15[0].target[5].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA6", TABLE15[0].target[6].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA7", TABLE15[0].target[7].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA8", TABLE15[0].target[8].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA9", TABLE15[0].target[9].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA10", TABLE15[0].target[10].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA11", TABLE15[0].target[11].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA12", TABLE15[0].target[12].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA13", TABLE15[0].target[13].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPA14", TABLE15[0].target[14].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB0", TABLE15[1].target[0].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB1", TABLE15[1].target[1].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB2", TABLE15[1].target[2].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB3", TABLE15[1].target[3].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB4", TABLE15[1].target[4].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB5", TABLE15[1].target[5].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB6", TABLE15[1].target[6].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB7", TABLE15[1].target[7].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB8", TABLE15[1].target[8].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB9", TABLE15[1].target[9].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB10", TABLE15[1].target[10].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB11", TABLE15[1].target[11].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB12", TABLE15[1].target[12].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB13", TABLE15[1].target[13].t_D);
-	papiWriteScenario_double(scn, "LVDC_TPB14", TABLE15[1].target[14].t_D);
-	papiWriteScenario_double(scn, "LVDC_T_RG", T_RG);
-	papiWriteScenario_double(scn, "LVDC_T_RP", T_RP);
-	papiWriteScenario_double(scn, "LVDC_T_S1", T_S1);
-	papiWriteScenario_double(scn, "LVDC_T_S2", T_S2);
-	papiWriteScenario_double(scn, "LVDC_T_S3", T_S3);
-	papiWriteScenario_double(scn, "LVDC_TS4BS", TS4BS);
-	papiWriteScenario_double(scn, "LVDC_t_SD1", t_SD1);
-	papiWriteScenario_double(scn, "LVDC_t_SD2", t_SD2);
-	papiWriteScenario_double(scn, "LVDC_t_SD3", t_SD3);
-	papiWriteScenario_double(scn, "LVDC_TSMC1", TSMC1);
-	papiWriteScenario_double(scn, "LVDC_TSMC2", TSMC2);
-	papiWriteScenario_double(scn, "LVDC_T_ST", T_ST);
-	papiWriteScenario_double(scn, "LVDC_TSTA", TABLE15[0].T_ST);
-	papiWriteScenario_double(scn, "LVDC_TSTB", TABLE15[1].T_ST);
-	papiWriteScenario_double(scn, "LVDC_T_T", T_T);
-	papiWriteScenario_double(scn, "LVDC_Tt_3", Tt_3);
-	papiWriteScenario_double(scn, "LVDC_Tt_T", Tt_T);
-	papiWriteScenario_double(scn, "LVDC_U_1", U_1);
-	papiWriteScenario_double(scn, "LVDC_U_2", U_2);
-	papiWriteScenario_double(scn, "LVDC_U_3", U_3);
-	papiWriteScenario_double(scn, "LVDC_U_12", U_12);
-	papiWriteScenario_double(scn, "LVDC_gamma_T", gamma_T);
-	papiWriteScenario_double(scn, "LVDC_V", V);
-	papiWriteScenario_double(scn, "LVDC_V_ex1", V_ex1);
-	papiWriteScenario_double(scn, "LVDC_V_ex2", V_ex2);
-	papiWriteScenario_double(scn, "LVDC_V_ex2R", V_ex2R);
-	papiWriteScenario_double(scn, "LVDC_V_ex3", V_ex3);
-	papiWriteScenario_double(scn, "LVDC_V_ex3R", V_ex3R);
-	papiWriteScenario_double(scn, "LVDC_V_i", V_i);
-	papiWriteScenario_double(scn, "LVDC_V_0", V_0);
-	papiWriteScenario_double(scn, "LVDC_V_1", V_1);
-	papiWriteScenario_double(scn, "LVDC_V_2", V_2);
-	papiWriteScenario_double(scn, "LVDC_V_S2T", V_S2T);
-	papiWriteScenario_double(scn, "LVDC_V_T", V_T);
-	papiWriteScenario_double(scn, "LVDC_V_TC", V_TC);
-	papiWriteScenario_double(scn, "LVDC_xi_T", xi_T);
-	papiWriteScenario_double(scn, "LVDC_eta_T", eta_T);
-	papiWriteScenario_double(scn, "LVDC_zeta_T", zeta_T);
-	papiWriteScenario_double(scn, "LVDC_X_S1", X_S1);
-	papiWriteScenario_double(scn, "LVDC_X_S2", X_S2);
-	papiWriteScenario_double(scn, "LVDC_X_S3", X_S3);
-	papiWriteScenario_double(scn, "LVDC_Xtt_y", Xtt_y);
-	papiWriteScenario_double(scn, "LVDC_Xtt_p", Xtt_p);
-	papiWriteScenario_double(scn, "LVDC_X_Zi", X_Zi);
-	papiWriteScenario_double(scn, "LVDC_X_Yi", X_Yi);
-	papiWriteScenario_double(scn, "LVDC_Y_u", Y_u);
-	papiWriteScenario_vec(scn, "LVDC_ACommandedAttitude", ACommandedAttitude);
-	papiWriteScenario_vec(scn, "LVDC_AttitudeError", AttitudeError);
-	papiWriteScenario_vec(scn, "LVDC_AttRate", AttRate);
-	papiWriteScenario_vec(scn, "LVDC_CommandedAttitude", CommandedAttitude);
-	papiWriteScenario_vec(scn, "LVDC_CommandRateLimits", CommandRateLimits);
-	papiWriteScenario_vec(scn, "LVDC_CurrentAttitude", CurrentAttitude);
-	papiWriteScenario_vec(scn, "LVDC_ddotG_act", ddotG_act);
-	papiWriteScenario_vec(scn, "LVDC_ddotG_last", ddotG_last);
-	papiWriteScenario_vec(scn, "LVDC_ddotM_act", ddotM_act);
-	papiWriteScenario_vec(scn, "LVDC_ddotM_last", ddotM_last);
-	papiWriteScenario_vec(scn, "LVDC_DDotXEZ_G", DDotXEZ_G);
-	papiWriteScenario_vec(scn, "LVDC_DotG_act", DotG_act);
-	papiWriteScenario_vec(scn, "LVDC_DotG_last", DotG_last);
-	papiWriteScenario_vec(scn, "LVDC_DotM_act", DotM_act);
-	papiWriteScenario_vec(scn, "LVDC_DotM_last", DotM_last);
-	papiWriteScenario_vec(scn, "LVDC_DotS", DotS);
-	papiWriteScenario_vec(scn, "LVDC_DotXEZ", DotXEZ);
-	papiWriteScenario_vec(scn, "LVDC_PCommandedAttitude", PCommandedAttitude);
-	papiWriteScenario_vec(scn, "LVDC_Pos4", Pos4);
-	papiWriteScenario_vec(scn, "LVDC_PosS", PosS);
-	papiWriteScenario_vec(scn, "LVDC_PosXEZ", PosXEZ);
-	papiWriteScenario_vec(scn, "LVDC_TargetVector", TargetVector);
-	papiWriteScenario_vec(scn, "LVDC_WV", WV);
-	papiWriteScenario_vec(scn, "LVDC_XLunarAttitude", XLunarAttitude);
-	papiWriteScenario_mx(scn, "LVDC_MX_A", MX_A);
-	papiWriteScenario_mx(scn, "LVDC_MX_B", MX_B);
-	papiWriteScenario_mx(scn, "LVDC_MX_G", MX_G);
-	papiWriteScenario_mx(scn, "LVDC_MX_K", MX_K);
-	papiWriteScenario_mx(scn, "LVDC_MX_phi_T", MX_phi_T);
-	// All done
+	LVDCScenarioFields.Save(scn, this);
 	oapiWriteLine(scn, LVDC_END_STRING);
 	lvimu.SaveState(scn);
 }
 
 void LVDC::LoadState(FILEHANDLE scn){
-	char *line;	
-	int tmp=0; // for bool loader
+	char *line;
 	if(Initialized){
-		fprintf(lvlog,"LoadState() called\r\n");
-		fflush(lvlog);
+		TraceLog::Printf(TRACE_LVDC, "LoadState() called\r\n");
 	}
+	EnsureScenarioFields();
 	while (oapiReadScenario_nextline (scn, line)) {
 		if (!strnicmp(line, LVDC_END_STRING, sizeof(LVDC_END_STRING))){
 			break;
 		}
-		// are we there yet?
-		// Doing all this in one go makes the MS compiler barf.
-		// Doing it in long chains makes the MS compiler silently optimize away the tail of the chain.
-		// So we do it in single lines.
-		// booleans
-		papiReadScenario_bool(line, "LVDC_alpha_D_op", alpha_D_op);
-		papiReadScenario_bool(line, "LVDC_BOOST", BOOST);
-		papiReadScenario_bool(line, "LVDC_CountPIPA", CountPIPA);
-		papiReadScenario_bool(line, "LVDC_Direct_Ascent", Direct_Ascent);
-		papiReadScenario_bool(line, "LVDC_directstageint", directstageint);
-		papiReadScenario_bool(line, "LVDC_directstagereset", directstagereset);
-		papiReadScenario_bool(line, "LVDC_first_op", first_op);
-		papiReadScenario_bool(line, "LVDC_GATE", GATE);
-		papiReadScenario_bool(line, "LVDC_GATE0", GATE0);
-		papiReadScenario_bool(line, "LVDC_GATE1", GATE1);
-		papiReadScenario_bool(line, "LVDC_GATE2", GATE2);
-		papiReadScenario_bool(line, "LVDC_GATE3", GATE3);
-		papiReadScenario_bool(line, "LVDC_GATE4", GATE4);
-		papiReadScenario_bool(line, "LVDC_GATE5", GATE5);
-		papiReadScenario_bool(line, "LVDC_GATE6", GATE6);
-		papiReadScenario_bool(line, "LVDC_HSL", HSL);
-		papiReadScenario_bool(line, "LVDC_INH", INH);
-		papiReadScenario_bool(line, "LVDC_INH1", INH1);
-		papiReadScenario_bool(line, "LVDC_INH2", INH2);
-		papiReadScenario_bool(line, "LVDC_init", init);
-		papiReadScenario_bool(line, "LVDC_i_op", i_op);
-		papiReadScenario_bool(line, "LVDC_liftoff", liftoff);
-		papiReadScenario_bool(line, "LVDC_LVDC_EI_On", LVDC_EI_On);
-		papiReadScenario_bool(line, "LVDC_LVDC_GRR", LVDC_GRR);
-		papiReadScenario_bool(line, "LVDC_MRS", MRS);
-		papiReadScenario_bool(line, "LVDC_poweredflight", poweredflight);
-		papiReadScenario_bool(line, "LVDC_ROT", ROT);
-		papiReadScenario_bool(line, "LVDC_ROTR", ROTR);
-		papiReadScenario_bool(line, "LVDC_S1_Engine_Out", S1_Engine_Out);
-		papiReadScenario_bool(line, "LVDC_S2_BURNOUT", S2_BURNOUT);
-		papiReadScenario_bool(line, "LVDC_S2_ENGINE_OUT", S2_ENGINE_OUT);
-		papiReadScenario_bool(line, "LVDC_S2_IGNITION", S2_IGNITION);
-		papiReadScenario_bool(line, "LVDC_S2_Startup", S2_Startup);
-		papiReadScenario_bool(line, "LVDC_S4B_IGN", S4B_IGN);
-		papiReadScenario_bool(line, "LVDC_S4B_REIGN", S4B_REIGN);
-		papiReadScenario_bool(line, "LVDC_TerminalConditions", TerminalConditions);
-		papiReadScenario_bool(line, "LVDC_theta_N_op", theta_N_op);
-		papiReadScenario_bool(line, "LVDC_TU", TU);
-		papiReadScenario_bool(line, "LVDC_TU10", TU10);
-
-		// integers
-		papiReadScenario_int(line, "LVDC_IGMCycle", IGMCycle);
-		papiReadScenario_int(line, "LVDC_OrbNavCycle", OrbNavCycle);
-		papiReadScenario_int(line, "LVDC_LVDC_Stop", LVDC_Stop);
-		papiReadScenario_int(line, "LVDC_LVDC_Timebase", LVDC_Timebase);
-		papiReadScenario_int(line, "LVDC_tgt_index", tgt_index);
-		papiReadScenario_int(line, "LVDC_T_EO1", T_EO1);
-		papiReadScenario_int(line, "LVDC_T_EO2", T_EO2);
-		papiReadScenario_int(line, "LVDC_UP", UP);
-
-		// doubles
-		papiReadScenario_double(line, "LVDC_a", a);
-		papiReadScenario_double(line, "LVDC_a_0p", a_0p);
-		papiReadScenario_double(line, "LVDC_a_0r", a_0r);
-		papiReadScenario_double(line, "LVDC_a_0y", a_0y);
-		papiReadScenario_double(line, "LVDC_a_1", a_1);
-		papiReadScenario_double(line, "LVDC_a_2", a_2);
-		papiReadScenario_double(line, "LVDC_a_1p", a_1p);
-		papiReadScenario_double(line, "LVDC_a_1r", a_1r);
-		papiReadScenario_double(line, "LVDC_a_1y", a_1y);
-		papiReadScenario_double(line, "LVDC_alpha_1", alpha_1);
-		papiReadScenario_double(line, "LVDC_alpha_2", alpha_2);
-		papiReadScenario_double(line, "LVDC_alpha_D", alpha_D);
-		papiReadScenario_double(line, "LVDC_alpha_TS", alpha_TS);
-		papiReadScenario_double(line, "LVDC_ALFTSA", TABLE15[0].alphaS_TS);
-		papiReadScenario_double(line, "LVDC_ALFTSB", TABLE15[1].alphaS_TS);
-		papiReadScenario_double(line, "LVDC_Azimuth", Azimuth);
-		papiReadScenario_double(line, "LVDC_Azo", Azo);
-		papiReadScenario_double(line, "LVDC_Azs", Azs);
-		papiReadScenario_double(line, "LVDC_B_11", B_11);
-		papiReadScenario_double(line, "LVDC_B_12", B_12);
-		papiReadScenario_double(line, "LVDC_B_21", B_21);
-		papiReadScenario_double(line, "LVDC_B_22", B_22);
-		papiReadScenario_double(line, "LVDC_beta", beta);
-		papiReadScenario_double(line, "LVDC_BETAA", TABLE15[0].beta);
-		papiReadScenario_double(line, "LVDC_BETAB", TABLE15[1].beta);
-		papiReadScenario_double(line, "LVDC_beta_p1c", beta_p1c);
-		papiReadScenario_double(line, "LVDC_beta_p2c", beta_p2c);
-		papiReadScenario_double(line, "LVDC_beta_p3c", beta_p3c);
-		papiReadScenario_double(line, "LVDC_beta_p4c", beta_p4c);
-		papiReadScenario_double(line, "LVDC_beta_pc", beta_pc);
-		papiReadScenario_double(line, "LVDC_beta_rc", beta_rc);
-		papiReadScenario_double(line, "LVDC_beta_y1c", beta_y1c);
-		papiReadScenario_double(line, "LVDC_beta_y2c", beta_y2c);
-		papiReadScenario_double(line, "LVDC_beta_y3c", beta_y3c);
-		papiReadScenario_double(line, "LVDC_beta_y4c", beta_y4c);
-		papiReadScenario_double(line, "LVDC_beta_yc", beta_yc);
-		papiReadScenario_double(line, "LVDC_C_2", C_2);
-		papiReadScenario_double(line, "LVDC_C_3", C_3);
-		papiReadScenario_double(line, "LVDC_C_4", C_4);
-		papiReadScenario_double(line, "LVDC_C3A0", TABLE15[0].target[0].C_3);
-		papiReadScenario_double(line, "LVDC_C3A1", TABLE15[0].target[1].C_3);
-		papiReadScenario_double(line, "LVDC_C3A2", TABLE15[0].target[2].C_3);
-		papiReadScenario_double(line, "LVDC_C3A3", TABLE15[0].target[3].C_3);
-		papiReadScenario_double(line, "LVDC_C3A4", TABLE15[0].target[4].C_3);
-		papiReadScenario_double(line, "LVDC_C3A5", TABLE15[0].target[5].C_3);
-		papiReadScenario_double(line, "LVDC_C3A6", TABLE15[0].target[6].C_3);
-		papiReadScenario_double(line, "LVDC_C3A7", TABLE15[0].target[7].C_3);
-		papiReadScenario_double(line, "LVDC_C3A8", TABLE15[0].target[8].C_3);
-		papiReadScenario_double(line, "LVDC_C3A9", TABLE15[0].target[9].C_3);
-		papiReadScenario_double(line, "LVDC_C3A10", TABLE15[0].target[10].C_3);
-		papiReadScenario_double(line, "LVDC_C3A11", TABLE15[0].target[11].C_3);
-		papiReadScenario_double(line, "LVDC_C3A12", TABLE15[0].target[12].C_3);
-		papiReadScenario_double(line, "LVDC_C3A13", TABLE15[0].target[13].C_3);
-		papiReadScenario_double(line, "LVDC_C3A14", TABLE15[0].target[14].C_3);
-		papiReadScenario_double(line, "LVDC_C3B0", TABLE15[1].target[0].C_3);
-		papiReadScenario_double(line, "LVDC_C3B1", TABLE15[1].target[1].C_3);
-		papiReadScenario_double(line, "LVDC_C3B2", TABLE15[1].target[2].C_3);
-		papiReadScenario_double(line, "LVDC_C3B3", TABLE15[1].target[3].C_3);
-		papiReadScenario_double(line, "LVDC_C3B4", TABLE15[1].target[4].C_3);
-		papiReadScenario_double(line, "LVDC_C3B5", TABLE15[1].target[5].C_3);
-		papiReadScenario_double(line, "LVDC_C3B6", TABLE15[1].target[6].C_3);
-		papiReadScenario_double(line, "LVDC_C3B7", TABLE15[1].target[7].C_3);
-		papiReadScenario_double(line, "LVDC_C3B8", TABLE15[1].target[8].C_3);
-		papiReadScenario_double(line, "LVDC_C3B9", TABLE15[1].target[9].C_3);
-		papiReadScenario_double(line, "LVDC_C3B10", TABLE15[1].target[10].C_3);
-		papiReadScenario_double(line, "LVDC_C3B11", TABLE15[1].target[11].C_3);
-		papiReadScenario_double(line, "LVDC_C3B12", TABLE15[1].target[12].C_3);
-		papiReadScenario_double(line, "LVDC_C3B13", TABLE15[1].target[13].C_3);
-		papiReadScenario_double(line, "LVDC_C3B14", TABLE15[1].target[14].C_3);
-		papiReadScenario_double(line, "LVDC_CCSA0", TABLE15[0].target[0].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA1", TABLE15[0].target[1].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA2", TABLE15[0].target[2].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA3", TABLE15[0].target[3].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA4", TABLE15[0].target[4].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA5", TABLE15[0].target[5].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA6", TABLE15[0].target[6].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA7", TABLE15[0].target[7].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA8", TABLE15[0].target[8].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA9", TABLE15[0].target[9].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA10", TABLE15[0].target[10].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA11", TABLE15[0].target[11].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA12", TABLE15[0].target[12].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA13", TABLE15[0].target[13].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSA14", TABLE15[0].target[14].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB0", TABLE15[1].target[0].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB1", TABLE15[1].target[1].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB2", TABLE15[1].target[2].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB3", TABLE15[1].target[3].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB4", TABLE15[1].target[4].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB5", TABLE15[1].target[5].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB6", TABLE15[1].target[6].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB7", TABLE15[1].target[7].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB8", TABLE15[1].target[8].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB9", TABLE15[1].target[9].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB10", TABLE15[1].target[10].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB11", TABLE15[1].target[11].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB12", TABLE15[1].target[12].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB13", TABLE15[1].target[13].cos_sigma);
-		papiReadScenario_double(line, "LVDC_CCSB14", TABLE15[1].target[14].cos_sigma);
-		papiReadScenario_double(line, "LVDC_Cf", Cf);
-		papiReadScenario_double(line, "LVDC_CG", CG);
-		papiReadScenario_double(line, "LVDC_cos_chi_Yit", cos_chi_Yit);
-		papiReadScenario_double(line, "LVDC_cos_chi_Zit", cos_chi_Zit);
-		papiReadScenario_double(line, "LVDC_cos_sigma", cos_sigma);
-		papiReadScenario_double(line, "LVDC_Ct", Ct);
-		papiReadScenario_double(line, "LVDC_Ct_o", Ct_o);
-		papiReadScenario_double(line, "LVDC_D", D);
-		papiReadScenario_double(line, "LVDC_d2", d2);
-		papiReadScenario_double(line, "LVDC_ddot_xi_GT", ddot_xi_GT);
-		papiReadScenario_double(line, "LVDC_ddot_zeta_GT", ddot_zeta_GT);
-		papiReadScenario_double(line, "LVDC_DEC", DEC);
-		papiReadScenario_double(line, "LVDC_DECA0", TABLE15[0].target[0].DEC);
-		papiReadScenario_double(line, "LVDC_DECA1", TABLE15[0].target[1].DEC);
-		papiReadScenario_double(line, "LVDC_DECA2", TABLE15[0].target[2].DEC);
-		papiReadScenario_double(line, "LVDC_DECA3", TABLE15[0].target[3].DEC);
-		papiReadScenario_double(line, "LVDC_DECA4", TABLE15[0].target[4].DEC);
-		papiReadScenario_double(line, "LVDC_DECA5", TABLE15[0].target[5].DEC);
-		papiReadScenario_double(line, "LVDC_DECA6", TABLE15[0].target[6].DEC);
-		papiReadScenario_double(line, "LVDC_DECA7", TABLE15[0].target[7].DEC);
-		papiReadScenario_double(line, "LVDC_DECA8", TABLE15[0].target[8].DEC);
-		papiReadScenario_double(line, "LVDC_DECA9", TABLE15[0].target[9].DEC);
-		papiReadScenario_double(line, "LVDC_DECA10", TABLE15[0].target[10].DEC);
-		papiReadScenario_double(line, "LVDC_DECA11", TABLE15[0].target[11].DEC);
-		papiReadScenario_double(line, "LVDC_DECA12", TABLE15[0].target[12].DEC);
-		papiReadScenario_double(line, "LVDC_DECA13", TABLE15[0].target[13].DEC);
-		papiReadScenario_double(line, "LVDC_DECA14", TABLE15[0].target[14].DEC);
-		papiReadScenario_double(line, "LVDC_DECB0", TABLE15[1].target[0].DEC);
-		papiReadScenario_double(line, "LVDC_DECB1", TABLE15[1].target[1].DEC);
-		papiReadScenario_double(line, "LVDC_DECB2", TABLE15[1].target[2].DEC);
-		papiReadScenario_double(line, "LVDC_DECB3", TABLE15[1].target[3].DEC);
-		papiReadScenario_double(line, "LVDC_DECB4", TABLE15[1].target[4].DEC);
-		papiReadScenario_double(line, "LVDC_DECB5", TABLE15[1].target[5].DEC);
-		papiReadScenario_double(line, "LVDC_DECB6", TABLE15[1].target[6].DEC);
-		papiReadScenario_double(line, "LVDC_DECB7", TABLE15[1].target[7].DEC);
-		papiReadScenario_double(line, "LVDC_DECB8", TABLE15[1].target[8].DEC);
-		papiReadScenario_double(line, "LVDC_DECB9", TABLE15[1].target[9].DEC);
-		papiReadScenario_double(line, "LVDC_DECB10", TABLE15[1].target[10].DEC);
-		papiReadScenario_double(line, "LVDC_DECB11", TABLE15[1].target[11].DEC);
-		papiReadScenario_double(line, "LVDC_DECB12", TABLE15[1].target[12].DEC);
-		papiReadScenario_double(line, "LVDC_DECB13", TABLE15[1].target[13].DEC);
-		papiReadScenario_double(line, "LVDC_DECB14", TABLE15[1].target[14].DEC);
-		papiReadScenario_double(line, "LVDC_deta", deta);
-		papiReadScenario_double(line, "LVDC_dxi", dxi);
-		papiReadScenario_double(line, "LVDC_dot_dxi", dot_dxi);
-		papiReadScenario_double(line, "LVDC_dot_deta", dot_deta);
-		papiReadScenario_double(line, "LVDC_dot_dzeta", dot_dzeta);
-		papiReadScenario_double(line, "LVDC_dot_dxit", dot_dxit);
-		papiReadScenario_double(line, "LVDC_dot_detat", dot_detat);
-		papiReadScenario_double(line, "LVDC_dot_dzetat", dot_dzetat);
-		papiReadScenario_double(line, "LVDC_dotM_1", dotM_1);
-		papiReadScenario_double(line, "LVDC_dotM_2", dotM_2);
-		papiReadScenario_double(line, "LVDC_dotM_2R", dotM_2R);
-		papiReadScenario_double(line, "LVDC_dotM_3", dotM_3);
-		papiReadScenario_double(line, "LVDC_dotM_3R", dotM_3R);
-		papiReadScenario_double(line, "LVDC_dot_phi_1", dot_phi_1);
-		papiReadScenario_double(line, "LVDC_dot_phi_T", dot_phi_T);
-		papiReadScenario_double(line, "LVDC_dot_zeta_T", dot_zeta_T);
-		papiReadScenario_double(line, "LVDC_dot_xi_T", dot_xi_T);
-		papiReadScenario_double(line, "LVDC_dot_eta_T", dot_eta_T);
-		papiReadScenario_double(line, "LVDC_Drag_Area[0]", Drag_Area[0]);
-		papiReadScenario_double(line, "LVDC_Drag_Area[1]", Drag_Area[1]);
-		papiReadScenario_double(line, "LVDC_Drag_Area[2]", Drag_Area[2]);
-		papiReadScenario_double(line, "LVDC_Drag_Area[3]", Drag_Area[3]);
-		papiReadScenario_double(line, "LVDC_Drag_Area[4]", Drag_Area[4]);
-		papiReadScenario_double(line, "LVDC_dt", dt);
-		papiReadScenario_double(line, "LVDC_dT_3", dT_3);
-		papiReadScenario_double(line, "LVDC_dT_4", dT_4);
-		papiReadScenario_double(line, "LVDC_dt_c", dt_c);
-		papiReadScenario_double(line, "LVDC_dT_cost", dT_cost);
-		papiReadScenario_double(line, "LVDC_dT_F", dT_F);
-		papiReadScenario_double(line, "LVDC_dt_g", dt_g);
-		papiReadScenario_double(line, "LVDC_dt_LET", dt_LET);
-		papiReadScenario_double(line, "LVDC_dT_LIM", dT_LIM);
-		papiReadScenario_double(line, "LVDC_dtt_1", dtt_1);
-		papiReadScenario_double(line, "LVDC_dtt_2", dtt_2);
-		papiReadScenario_double(line, "LVDC_dTt_4", dTt_4);
-		papiReadScenario_double(line, "LVDC_dV", dV);
-		papiReadScenario_double(line, "LVDC_dV_B", dV_B);
-		papiReadScenario_double(line, "LVDC_dV_BR", dV_BR);
-		papiReadScenario_double(line, "LVDC_e", e);
-		papiReadScenario_double(line, "LVDC_e_N", e_N);
-		papiReadScenario_double(line, "LVDC_ENA0", TABLE15[0].target[0].e_N);
-		papiReadScenario_double(line, "LVDC_ENA1", TABLE15[0].target[1].e_N);
-		papiReadScenario_double(line, "LVDC_ENA2", TABLE15[0].target[2].e_N);
-		papiReadScenario_double(line, "LVDC_ENA3", TABLE15[0].target[3].e_N);
-		papiReadScenario_double(line, "LVDC_ENA4", TABLE15[0].target[4].e_N);
-		papiReadScenario_double(line, "LVDC_ENA5", TABLE15[0].target[5].e_N);
-		papiReadScenario_double(line, "LVDC_ENA6", TABLE15[0].target[6].e_N);
-		papiReadScenario_double(line, "LVDC_ENA7", TABLE15[0].target[7].e_N);
-		papiReadScenario_double(line, "LVDC_ENA8", TABLE15[0].target[8].e_N);
-		papiReadScenario_double(line, "LVDC_ENA9", TABLE15[0].target[9].e_N);
-		papiReadScenario_double(line, "LVDC_ENA10", TABLE15[0].target[10].e_N);
-		papiReadScenario_double(line, "LVDC_ENA11", TABLE15[0].target[11].e_N);
-		papiReadScenario_double(line, "LVDC_ENA12", TABLE15[0].target[12].e_N);
-		papiReadScenario_double(line, "LVDC_ENA13", TABLE15[0].target[13].e_N);
-		papiReadScenario_double(line, "LVDC_ENA14", TABLE15[0].target[14].e_N);
-		papiReadScenario_double(line, "LVDC_ENB0", TABLE15[1].target[0].e_N);
-		papiReadScenario_double(line, "LVDC_ENB1", TABLE15[1].target[1].e_N);
-		papiReadScenario_double(line, "LVDC_ENB2", TABLE15[1].target[2].e_N);
-		papiReadScenario_double(line, "LVDC_ENB3", TABLE15[1].target[3].e_N);
-		papiReadScenario_double(line, "LVDC_ENB4", TABLE15[1].target[4].e_N);
-		papiReadScenario_double(line, "LVDC_ENB5", TABLE15[1].target[5].e_N);
-		papiReadScenario_double(line, "LVDC_ENB6", TABLE15[1].target[6].e_N);
-		papiReadScenario_double(line, "LVDC_ENB7", TABLE15[1].target[7].e_N);
-		papiReadScenario_double(line, "LVDC_ENB8", TABLE15[1].target[8].e_N);
-		papiReadScenario_double(line, "LVDC_ENB9", TABLE15[1].target[9].e_N);
-		papiReadScenario_double(line, "LVDC_ENB10", TABLE15[1].target[10].e_N);
-		papiReadScenario_double(line, "LVDC_ENB11", TABLE15[1].target[11].e_N);
-		papiReadScenario_double(line, "LVDC_ENB12", TABLE15[1].target[12].e_N);
-		papiReadScenario_double(line, "LVDC_ENB13", TABLE15[1].target[13].e_N);
-		papiReadScenario_double(line, "LVDC_ENB14", TABLE15[1].target[14].e_N);
-		papiReadScenario_double(line, "LVDC_eps_1", eps_1);
-		papiReadScenario_double(line, "LVDC_eps_1R", eps_1R);
-		papiReadScenario_double(line, "LVDC_eps_2", eps_2);
-		papiReadScenario_double(line, "LVDC_eps_2R", eps_2R);
-		papiReadScenario_double(line, "LVDC_eps_3", eps_3);
-		papiReadScenario_double(line, "LVDC_eps_3R", eps_3R);
-		papiReadScenario_double(line, "LVDC_eps_4", eps_4);
-		papiReadScenario_double(line, "LVDC_eps_4R", eps_4R);
-		papiReadScenario_double(line, "LVDC_eps_p", eps_p);
-		papiReadScenario_double(line, "LVDC_eps_ymr", eps_ymr);
-		papiReadScenario_double(line, "LVDC_eps_ypr", eps_ypr);
-		papiReadScenario_double(line, "LVDC_f", f);
-		papiReadScenario_double(line, "LVDC_F", F);
-		papiReadScenario_double(line, "LVDC_FA", TABLE15[0].f);
-		papiReadScenario_double(line, "LVDC_FB", TABLE15[1].f);
-		papiReadScenario_double(line, "LVDC_Fm", Fm);
-		papiReadScenario_double(line, "LVDC_fx[0]", fx[0]);
-		papiReadScenario_double(line, "LVDC_fx[1]", fx[1]);
-		papiReadScenario_double(line, "LVDC_fx[2]", fx[2]);
-		papiReadScenario_double(line, "LVDC_fx[3]", fx[3]);
-		papiReadScenario_double(line, "LVDC_fx[4]", fx[4]);
-		papiReadScenario_double(line, "LVDC_fx[5]", fx[5]);
-		papiReadScenario_double(line, "LVDC_fx[6]", fx[6]);
-		papiReadScenario_double(line, "LVDC_fxt[0]", fxt[0]);
-		papiReadScenario_double(line, "LVDC_fxt[1]", fxt[1]);
-		papiReadScenario_double(line, "LVDC_fxt[2]", fxt[2]);
-		papiReadScenario_double(line, "LVDC_fxt[3]", fxt[3]);
-		papiReadScenario_double(line, "LVDC_fxt[4]", fxt[4]);
-		papiReadScenario_double(line, "LVDC_fxt[5]", fxt[5]);
-		papiReadScenario_double(line, "LVDC_fxt[6]", fxt[6]);
-		papiReadScenario_double(line, "LVDC_Fx[0][0]", Fx[0][0]);
-		papiReadScenario_double(line, "LVDC_Fx[0][1]", Fx[0][1]);
-		papiReadScenario_double(line, "LVDC_Fx[0][2]", Fx[0][2]);
-		papiReadScenario_double(line, "LVDC_Fx[0][3]", Fx[0][3]);
-		papiReadScenario_double(line, "LVDC_Fx[0][4]", Fx[0][4]);
-		papiReadScenario_double(line, "LVDC_Fx[1][0]", Fx[1][0]);
-		papiReadScenario_double(line, "LVDC_Fx[1][1]", Fx[1][1]);
-		papiReadScenario_double(line, "LVDC_Fx[1][2]", Fx[1][2]);
-		papiReadScenario_double(line, "LVDC_Fx[1][3]", Fx[1][3]);
-		papiReadScenario_double(line, "LVDC_Fx[1][4]", Fx[1][4]);
-		papiReadScenario_double(line, "LVDC_Fx[2][0]", Fx[2][0]);
-		papiReadScenario_double(line, "LVDC_Fx[2][1]", Fx[2][1]);
-		papiReadScenario_double(line, "LVDC_Fx[2][2]", Fx[2][2]);
-		papiReadScenario_double(line, "LVDC_Fx[2][3]", Fx[2][3]);
-		papiReadScenario_double(line, "LVDC_Fx[2][4]", Fx[2][4]);
-		papiReadScenario_double(line, "LVDC_Fx[3][0]", Fx[3][0]);
-		papiReadScenario_double(line, "LVDC_Fx[3][1]", Fx[3][1]);
-		papiReadScenario_double(line, "LVDC_Fx[3][2]", Fx[3][2]);
-		papiReadScenario_double(line, "LVDC_Fx[3][3]", Fx[3][3]);
-		papiReadScenario_double(line, "LVDC_Fx[3][4]", Fx[3][4]);
-		papiReadScenario_double(line, "LVDC_Fx[4][0]", Fx[4][0]);
-		papiReadScenario_double(line, "LVDC_Fx[4][1]", Fx[4][1]);
-		papiReadScenario_double(line, "LVDC_Fx[4][2]", Fx[4][2]);
-		papiReadScenario_double(line, "LVDC_Fx[4][3]", Fx[4][3]);
-		papiReadScenario_double(line, "LVDC_Fx[4][4]", Fx[4][4]);
-		papiReadScenario_double(line, "LVDC_GPitch[0]", GPitch[0]);
-		papiReadScenario_double(line, "LVDC_GPitch[1]", GPitch[1]);
-		papiReadScenario_double(line, "LVDC_GPitch[2]", GPitch[2]);
-		papiReadScenario_double(line, "LVDC_GPitch[3]", GPitch[3]);
-		papiReadScenario_double(line, "LVDC_GYaw[0]", GYaw[0]);
-		papiReadScenario_double(line, "LVDC_GYaw[1]", GYaw[1]);
-		papiReadScenario_double(line, "LVDC_GYaw[2]", GYaw[2]);
-		papiReadScenario_double(line, "LVDC_GYaw[3]", GYaw[3]);
-		papiReadScenario_double(line, "LVDC_G_T", G_T);
-		papiReadScenario_double(line, "LVDC_gx[0]", gx[0]);
-		papiReadScenario_double(line, "LVDC_gx[1]", gx[1]);
-		papiReadScenario_double(line, "LVDC_gx[2]", gx[2]);
-		papiReadScenario_double(line, "LVDC_gx[3]", gx[3]);
-		papiReadScenario_double(line, "LVDC_gx[4]", gx[4]);
-		papiReadScenario_double(line, "LVDC_gx[5]", gx[5]);
-		papiReadScenario_double(line, "LVDC_gx[6]", gx[6]);
-		papiReadScenario_double(line, "LVDC_gxt[0]", gxt[0]);
-		papiReadScenario_double(line, "LVDC_gxt[1]", gxt[1]);
-		papiReadScenario_double(line, "LVDC_gxt[2]", gxt[2]);
-		papiReadScenario_double(line, "LVDC_gxt[3]", gxt[3]);
-		papiReadScenario_double(line, "LVDC_gxt[4]", gxt[4]);
-		papiReadScenario_double(line, "LVDC_gxt[5]", gxt[5]);
-		papiReadScenario_double(line, "LVDC_gxt[6]", gxt[6]);
-		papiReadScenario_double(line, "LVDC_H", H);
-		papiReadScenario_double(line, "LVDC_hx[0][0]", hx[0][0]);
-		papiReadScenario_double(line, "LVDC_hx[0][1]", hx[0][1]);
-		papiReadScenario_double(line, "LVDC_hx[0][2]", hx[0][2]);
-		papiReadScenario_double(line, "LVDC_hx[0][3]", hx[0][3]);
-		papiReadScenario_double(line, "LVDC_hx[0][4]", hx[0][4]);
-		papiReadScenario_double(line, "LVDC_hx[1][0]", hx[1][0]);
-		papiReadScenario_double(line, "LVDC_hx[1][1]", hx[1][1]);
-		papiReadScenario_double(line, "LVDC_hx[1][2]", hx[1][2]);
-		papiReadScenario_double(line, "LVDC_hx[1][3]", hx[1][3]);
-		papiReadScenario_double(line, "LVDC_hx[1][4]", hx[1][4]);
-		papiReadScenario_double(line, "LVDC_hx[2][0]", hx[2][0]);
-		papiReadScenario_double(line, "LVDC_hx[2][1]", hx[2][1]);
-		papiReadScenario_double(line, "LVDC_hx[2][2]", hx[2][2]);
-		papiReadScenario_double(line, "LVDC_hx[2][3]", hx[2][3]);
-		papiReadScenario_double(line, "LVDC_hx[2][4]", hx[2][4]);
-		papiReadScenario_double(line, "LVDC_IGMInterval", IGMInterval);
-		papiReadScenario_double(line, "LVDC_Inclination", Inclination);
-		papiReadScenario_double(line, "LVDC_J", J);
-		papiReadScenario_double(line, "LVDC_J_1", J_1);
-		papiReadScenario_double(line, "LVDC_J_2", J_2);
-		papiReadScenario_double(line, "LVDC_J_3", J_3);
-		papiReadScenario_double(line, "LVDC_J_12", J_12);
-		papiReadScenario_double(line, "LVDC_Jt_3", Jt_3);
-		papiReadScenario_double(line, "LVDC_J_P", J_P);
-		papiReadScenario_double(line, "LVDC_J_Y", J_Y);
-		papiReadScenario_double(line, "LVDC_K_1", K_1);
-		papiReadScenario_double(line, "LVDC_K_2", K_2);
-		papiReadScenario_double(line, "LVDC_K_3", K_3);
-		papiReadScenario_double(line, "LVDC_K_4", K_4);
-		papiReadScenario_double(line, "LVDC_K_5", K_5);
-		papiReadScenario_double(line, "LVDC_K_P1", K_P1);
-		papiReadScenario_double(line, "LVDC_K_P2", K_P2);
-		papiReadScenario_double(line, "LVDC_K_Y1", K_Y1);
-		papiReadScenario_double(line, "LVDC_K_Y2", K_Y2);
-		papiReadScenario_double(line, "LVDC_K_P", K_P);
-		papiReadScenario_double(line, "LVDC_K_Y", K_Y);
-		papiReadScenario_double(line, "LVDC_D_P", D_P);
-		papiReadScenario_double(line, "LVDC_D_Y", D_Y);
-		papiReadScenario_double(line, "LVDC_L_1", L_1);
-		papiReadScenario_double(line, "LVDC_L_2", L_2);
-		papiReadScenario_double(line, "LVDC_L_3", L_3);
-		papiReadScenario_double(line, "LVDC_dL_3", dL_3);
-		papiReadScenario_double(line, "LVDC_Lt_3", Lt_3);
-		papiReadScenario_double(line, "LVDC_L_12", L_12);
-		papiReadScenario_double(line, "LVDC_L_P", L_P);
-		papiReadScenario_double(line, "LVDC_L_Y", L_Y);
-		papiReadScenario_double(line, "LVDC_Lt_Y", Lt_Y);
-		papiReadScenario_double(line, "LVDC_LVDC_TB_ETime", LVDC_TB_ETime);
-		papiReadScenario_double(line, "LVDC_mu", mu);
-		papiReadScenario_double(line, "LVDC_omega_E", omega_E);
-		papiReadScenario_double(line, "LVDC_OPitch[0]", OPitch[0]);
-		papiReadScenario_double(line, "LVDC_OPitch[1]", OPitch[1]);
-		papiReadScenario_double(line, "LVDC_OPitch[2]", OPitch[2]);
-		papiReadScenario_double(line, "LVDC_OPitch[3]", OPitch[3]);
-		papiReadScenario_double(line, "LVDC_OYaw[0]", OYaw[0]);
-		papiReadScenario_double(line, "LVDC_OYaw[1]", OYaw[1]);
-		papiReadScenario_double(line, "LVDC_OYaw[2]", OYaw[2]);
-		papiReadScenario_double(line, "LVDC_OYaw[3]", OYaw[3]);
-		papiReadScenario_double(line, "LVDC_p", p);
-		papiReadScenario_double(line, "LVDC_P_1", P_1);
-		papiReadScenario_double(line, "LVDC_P_2", P_2);
-		papiReadScenario_double(line, "LVDC_P_3", P_3);
-		papiReadScenario_double(line, "LVDC_P_12", P_12);
-		papiReadScenario_double(line, "LVDC_phi_L", phi_L);
-		papiReadScenario_double(line, "LVDC_phi_T", phi_T);
-		papiReadScenario_double(line, "LVDC_Q_1", Q_1);
-		papiReadScenario_double(line, "LVDC_Q_2", Q_2);
-		papiReadScenario_double(line, "LVDC_Q_3", Q_3);
-		papiReadScenario_double(line, "LVDC_Q_12", Q_12);
-		papiReadScenario_double(line, "LVDC_Q_P", Q_P);
-		papiReadScenario_double(line, "LVDC_Q_Y", Q_Y);
-		papiReadScenario_double(line, "LVDC_R", R);
-		papiReadScenario_double(line, "LVDC_RAS", RAS);
-		papiReadScenario_double(line, "LVDC_RASA0", TABLE15[0].target[0].RAS);
-		papiReadScenario_double(line, "LVDC_RASA1", TABLE15[0].target[1].RAS);
-		papiReadScenario_double(line, "LVDC_RASA2", TABLE15[0].target[2].RAS);
-		papiReadScenario_double(line, "LVDC_RASA3", TABLE15[0].target[3].RAS);
-		papiReadScenario_double(line, "LVDC_RASA4", TABLE15[0].target[4].RAS);
-		papiReadScenario_double(line, "LVDC_RASA5", TABLE15[0].target[5].RAS);
-		papiReadScenario_double(line, "LVDC_RASA6", TABLE15[0].target[6].RAS);
-		papiReadScenario_double(line, "LVDC_RASA7", TABLE15[0].target[7].RAS);
-		papiReadScenario_double(line, "LVDC_RASA8", TABLE15[0].target[8].RAS);
-		papiReadScenario_double(line, "LVDC_RASA9", TABLE15[0].target[9].RAS);
-		papiReadScenario_double(line, "LVDC_RASA10", TABLE15[0].target[10].RAS);
-		papiReadScenario_double(line, "LVDC_RASA11", TABLE15[0].target[11].RAS);
-		papiReadScenario_double(line, "LVDC_RASA12", TABLE15[0].target[12].RAS);
-		papiReadScenario_double(line, "LVDC_RASA13", TABLE15[0].target[13].RAS);
-		papiReadScenario_double(line, "LVDC_RASA14", TABLE15[0].target[14].RAS);
-		papiReadScenario_double(line, "LVDC_RASB0", TABLE15[1].target[0].RAS);
-		papiReadScenario_double(line, "LVDC_RASB1", TABLE15[1].target[1].RAS);
-		papiReadScenario_double(line, "LVDC_RASB2", TABLE15[1].target[2].RAS);
-		papiReadScenario_double(line, "LVDC_RASB3", TABLE15[1].target[3].RAS);
-		papiReadScenario_double(line, "LVDC_RASB4", TABLE15[1].target[4].RAS);
-		papiReadScenario_double(line, "LVDC_RASB5", TABLE15[1].target[5].RAS);
-		papiReadScenario_double(line, "LVDC_RASB6", TABLE15[1].target[6].RAS);
-		papiReadScenario_double(line, "LVDC_RASB7", TABLE15[1].target[7].RAS);
-		papiReadScenario_double(line, "LVDC_RASB8", TABLE15[1].target[8].RAS);
-		papiReadScenario_double(line, "LVDC_RASB9", TABLE15[1].target[9].RAS);
-		papiReadScenario_double(line, "LVDC_RASB10", TABLE15[1].target[10].RAS);
-		papiReadScenario_double(line, "LVDC_RASB11", TABLE15[1].target[11].RAS);
-		papiReadScenario_double(line, "LVDC_RASB12", TABLE15[1].target[12].RAS);
-		papiReadScenario_double(line, "LVDC_RASB13", TABLE15[1].target[13].RAS);
-		papiReadScenario_double(line, "LVDC_RASB14", TABLE15[1].target[14].RAS);
-		papiReadScenario_double(line, "LVDC_RateGain", RateGain);
-		papiReadScenario_double(line, "LVDC_ErrorGain", ErrorGain);
-		papiReadScenario_double(line, "LVDC_rho", rho);
-		papiReadScenario_double(line, "LVDC_R_N", R_N);
-		papiReadScenario_double(line, "LVDC_RNA", TABLE15[0].R_N);
-		papiReadScenario_double(line, "LVDC_RNB", TABLE15[1].R_N);
-		papiReadScenario_double(line, "LVDC_Rho[0]", Rho[0]);
-		papiReadScenario_double(line, "LVDC_Rho[1]", Rho[1]);
-		papiReadScenario_double(line, "LVDC_Rho[2]", Rho[2]);
-		papiReadScenario_double(line, "LVDC_Rho[3]", Rho[3]);
-		papiReadScenario_double(line, "LVDC_Rho[4]", Rho[4]);
-		papiReadScenario_double(line, "LVDC_Rho[5]", Rho[5]);
-		papiReadScenario_double(line, "LVDC_ROV", ROV);
-		papiReadScenario_double(line, "LVDC_ROVR", ROVR);
-		papiReadScenario_double(line, "LVDC_ROVs", ROVs);
-		papiReadScenario_double(line, "LVDC_R_T", R_T);
-		papiReadScenario_double(line, "LVDC_S_1", S_1);
-		papiReadScenario_double(line, "LVDC_S_2", S_2);
-		papiReadScenario_double(line, "LVDC_S_3", S_3);
-		papiReadScenario_double(line, "LVDC_S_12", S_12);
-		papiReadScenario_double(line, "LVDC_S_P", S_P);
-		papiReadScenario_double(line, "LVDC_S_Y", S_Y);
-		papiReadScenario_double(line, "LVDC_S1_Sep_Time", S1_Sep_Time);
-		papiReadScenario_double(line, "LVDC_sinceLastCycle", sinceLastCycle);
-		papiReadScenario_double(line, "LVDC_sinceLastGuidanceCycle", sinceLastGuidanceCycle);
-		papiReadScenario_double(line, "LVDC_sin_chi_Yit", sin_chi_Yit);
-		papiReadScenario_double(line, "LVDC_sin_chi_Zit", sin_chi_Zit);
-		papiReadScenario_double(line, "LVDC_sin_gam", sin_gam);
-		papiReadScenario_double(line, "LVDC_cos_gam", cos_gam);
-		papiReadScenario_double(line, "LVDC_SMCG", SMCG);
-		papiReadScenario_double(line, "LVDC_S", S);
-		papiReadScenario_double(line, "LVDC_P", P);
-		papiReadScenario_double(line, "LVDC_S_34", S_34);
-		papiReadScenario_double(line, "LVDC_P_34", P_34);
-		papiReadScenario_double(line, "LVDC_t", t);
-		papiReadScenario_double(line, "LVDC_T_0", T_0);
-		papiReadScenario_double(line, "LVDC_t_1", t_1);
-		papiReadScenario_double(line, "LVDC_T_1", T_1);
-		papiReadScenario_double(line, "LVDC_T_1c", T_1c);
-		papiReadScenario_double(line, "LVDC_t_2", t_2);
-		papiReadScenario_double(line, "LVDC_T_2", T_2);
-		papiReadScenario_double(line, "LVDC_t_21", t_21);
-		papiReadScenario_double(line, "LVDC_T_2R", T_2R);
-		papiReadScenario_double(line, "LVDC_t_3", t_3);
-		papiReadScenario_double(line, "LVDC_T_3", T_3);
-		papiReadScenario_double(line, "LVDC_t_3i", t_3i);
-		papiReadScenario_double(line, "LVDC_t_4", t_4);
-		papiReadScenario_double(line, "LVDC_T_4N", T_4N);
-		papiReadScenario_double(line, "LVDC_t_5", t_5);
-		papiReadScenario_double(line, "LVDC_t_6", t_6);
-		papiReadScenario_double(line, "LVDC_TA1", TA1);
-		papiReadScenario_double(line, "LVDC_TA2", TA2);
-		papiReadScenario_double(line, "LVDC_T_ar", T_ar);
-		papiReadScenario_double(line, "LVDC_TAS", TAS);
-		papiReadScenario_double(line, "LVDC_tau1", tau1);
-		papiReadScenario_double(line, "LVDC_tau2", tau2);
-		papiReadScenario_double(line, "LVDC_tau2N", tau2N);
-		papiReadScenario_double(line, "LVDC_tau3", tau3);
-		papiReadScenario_double(line, "LVDC_tau3N", tau3N);
-		papiReadScenario_double(line, "LVDC_tau3R", tau3R);
-		papiReadScenario_double(line, "LVDC_t_B1", t_B1);
-		papiReadScenario_double(line, "LVDC_TB1", TB1);
-		papiReadScenario_double(line, "LVDC_t_B2", t_B2);
-		papiReadScenario_double(line, "LVDC_TB2", TB2);
-		papiReadScenario_double(line, "LVDC_t_B3", t_B3);
-		papiReadScenario_double(line, "LVDC_TB3", TB3);
-		papiReadScenario_double(line, "LVDC_t_B4", t_B4);
-		papiReadScenario_double(line, "LVDC_TB4", TB4);
-		papiReadScenario_double(line, "LVDC_TB4A", TB4A);
-		papiReadScenario_double(line, "LVDC_TB5", TB5);
-		papiReadScenario_double(line, "LVDC_TB6", TB6);
-		papiReadScenario_double(line, "LVDC_TB7", TB7);
-		papiReadScenario_double(line, "LVDC_T_c", T_c);
-		papiReadScenario_double(line, "LVDC_tchi_p_last", tchi_p_last);
-		papiReadScenario_double(line, "LVDC_tchi_y_last", tchi_y_last);
-		papiReadScenario_double(line, "LVDC_tchi_p", tchi_p);
-		papiReadScenario_double(line, "LVDC_tchi_y", tchi_y);
-		papiReadScenario_double(line, "LVDC_t_clock", t_clock);
-		papiReadScenario_double(line, "LVDC_T_CO", T_CO);
-		papiReadScenario_double(line, "LVDC_t_D", t_D);
-		papiReadScenario_double(line, "LVDC_t_D0", t_D0);
-		papiReadScenario_double(line, "LVDC_t_D1", t_D1);
-		papiReadScenario_double(line, "LVDC_t_D2", t_D2);
-		papiReadScenario_double(line, "LVDC_t_D3", t_D3);
-		papiReadScenario_double(line, "LVDC_t_DS0", t_DS0);
-		papiReadScenario_double(line, "LVDC_t_DS1", t_DS1);
-		papiReadScenario_double(line, "LVDC_t_DS2", t_DS2);
-		papiReadScenario_double(line, "LVDC_t_DS3", t_DS3);
-		papiReadScenario_double(line, "LVDC_t_fail", t_fail);
-		papiReadScenario_double(line, "LVDC_T_GO", T_GO);
-		papiReadScenario_double(line, "LVDC_TETEO", theta_EO);
-		papiReadScenario_double(line, "LVDC_theta_N", theta_N);
-		papiReadScenario_double(line, "LVDC_TI5F2", TI5F2);
-		papiReadScenario_double(line, "LVDC_T_IGM", T_IGM);
-		papiReadScenario_double(line, "LVDC_T_L", T_L);
-		papiReadScenario_double(line, "LVDC_T_LET", T_LET);
-		papiReadScenario_double(line, "LVDC_T_LO", T_LO);
-		papiReadScenario_double(line, "LVDC_TPA0", TABLE15[0].target[0].t_D);
-		papiReadScenario_double(line, "LVDC_TPA1", TABLE15[0].target[1].t_D);
-		papiReadScenario_double(line, "LVDC_TPA2", TABLE15[0].target[2].t_D);
-		papiReadScenario_double(line, "LVDC_TPA3", TABLE15[0].target[3].t_D);
-		papiReadScenario_double(line, "LVDC_TPA4", TABLE15[0].target[4].t_D);
-		papiReadScenario_double(line, "LVDC_TPA5", TABLE15[0].target[5].t_D);
-		papiReadScenario_double(line, "LVDC_TPA6", TABLE15[0].target[6].t_D);
-		papiReadScenario_double(line, "LVDC_TPA7", TABLE15[0].target[7].t_D);
-		papiReadScenario_double(line, "LVDC_TPA8", TABLE15[0].target[8].t_D);
-		papiReadScenario_double(line, "LVDC_TPA9", TABLE15[0].target[9].t_D);
-		papiReadScenario_double(line, "LVDC_TPA10", TABLE15[0].target[10].t_D);
-		papiReadScenario_double(line, "LVDC_TPA11", TABLE15[0].target[11].t_D);
-		papiReadScenario_double(line, "LVDC_TPA12", TABLE15[0].target[12].t_D);
-		papiReadScenario_double(line, "LVDC_TPA13", TABLE15[0].target[13].t_D);
-		papiReadScenario_double(line, "LVDC_TPA14", TABLE15[0].target[14].t_D);
-		papiReadScenario_double(line, "LVDC_TPB0", TABLE15[1].target[0].t_D);
-		papiReadScenario_double(line, "LVDC_TPB1", TABLE15[1].target[1].t_D);
-		papiReadScenario_double(line, "LVDC_TPB2", TABLE15[1].target[2].t_D);
-		papiReadScenario_double(line, "LVDC_TPB3", TABLE15[1].target[3].t_D);
-		papiReadScenario_double(line, "LVDC_TPB4", TABLE15[1].target[4].t_D);
-		papiReadScenario_double(line, "LVDC_TPB5", TABLE15[1].target[5].t_D);
-		papiReadScenario_double(line, "LVDC_TPB6", TABLE15[1].target[6].t_D);
-		papiReadScenario_double(line, "LVDC_TPB7", TABLE15[1].target[7].t_D);
-		papiReadScenario_double(line, "LVDC_TPB8", TABLE15[1].target[8].t_D);
-		papiReadScenario_double(line, "LVDC_TPB9", TABLE15[1].target[9].t_D);
-		papiReadScenario_double(line, "LVDC_TPB10", TABLE15[1].target[10].t_D);
-		papiReadScenario_double(line, "LVDC_TPB11", TABLE15[1].target[11].t_D);
-		papiReadScenario_double(line, "LVDC_TPB12", TABLE15[1].target[12].t_D);
-		papiReadScenario_double(line, "LVDC_TPB13", TABLE15[1].target[13].t_D);
-		papiReadScenario_double(line, "LVDC_TPB14", TABLE15[1].target[14].t_D);
-		papiReadScenario_double(line, "LVDC_T_RG", T_RG);
-		papiReadScenario_double(line, "LVDC_T_RP", T_RP);
-		papiReadScenario_double(line, "LVDC_T_S1", T_S1);
-		papiReadScenario_double(line, "LVDC_T_S2", T_S2);
-		papiReadScenario_double(line, "LVDC_T_S3", T_S3);
-		papiReadScenario_double(line, "LVDC_TS4BS", TS4BS);
-		papiReadScenario_double(line, "LVDC_t_SD1", t_SD1);
-		papiReadScenario_double(line, "LVDC_t_SD2", t_SD2);
-		papiReadScenario_double(line, "LVDC_t_SD3", t_SD3);
-		papiReadScenario_double(line, "LVDC_TSMC1", TSMC1);
-		papiReadScenario_double(line, "LVDC_TSMC2", TSMC2);
-		papiReadScenario_double(line, "LVDC_T_ST", T_ST);
-		papiReadScenario_double(line, "LVDC_TSTA", TABLE15[0].T_ST);
-		papiReadScenario_double(line, "LVDC_TSTB", TABLE15[1].T_ST);
-		papiReadScenario_double(line, "LVDC_T_T", T_T);
-		papiReadScenario_double(line, "LVDC_Tt_3", Tt_3);
-		papiReadScenario_double(line, "LVDC_Tt_T", Tt_T);
-		papiReadScenario_double(line, "LVDC_U_1", U_1);
-		papiReadScenario_double(line, "LVDC_U_2", U_2);
-		papiReadScenario_double(line, "LVDC_U_3", U_3);
-		papiReadScenario_double(line, "LVDC_U_12", U_12);
-		papiReadScenario_double(line, "LVDC_gamma_T", gamma_T);
-		papiReadScenario_double(line, "LVDC_V", V);
-		papiReadScenario_double(line, "LVDC_V_ex1", V_ex1);
-		papiReadScenario_double(line, "LVDC_V_ex2", V_ex2);
-		papiReadScenario_double(line, "LVDC_V_ex2R", V_ex2R);
-		papiReadScenario_double(line, "LVDC_V_ex3", V_ex3);
-		papiReadScenario_double(line, "LVDC_V_ex3R", V_ex3R);
-		papiReadScenario_double(line, "LVDC_V_i", V_i);
-		papiReadScenario_double(line, "LVDC_V_0", V_0);
-		papiReadScenario_double(line, "LVDC_V_1", V_1);
-		papiReadScenario_double(line, "LVDC_V_2", V_2);
-		papiReadScenario_double(line, "LVDC_V_S2T", V_S2T);
-		papiReadScenario_double(line, "LVDC_V_T", V_T);
-		papiReadScenario_double(line, "LVDC_V_TC", V_TC);
-		papiReadScenario_double(line, "LVDC_xi_T", xi_T);
-		papiReadScenario_double(line, "LVDC_eta_T", eta_T);
-		papiReadScenario_double(line, "LVDC_zeta_T", zeta_T);
-		papiReadScenario_double(line, "LVDC_X_S1", X_S1);
-		papiReadScenario_double(line, "LVDC_X_S2", X_S2);
-		papiReadScenario_double(line, "LVDC_X_S3", X_S3);
-		papiReadScenario_double(line, "LVDC_Xtt_p", Xtt_p);
-		papiReadScenario_double(line, "LVDC_Xtt_y", Xtt_y);
-		papiReadScenario_double(line, "LVDC_X_Zi", X_Zi);
-		papiReadScenario_double(line, "LVDC_X_Yi", X_Yi);
-		papiReadScenario_double(line, "LVDC_Y_u", Y_u);
-
-		// VECTOR3
-		papiReadScenario_vec(line, "LVDC_ACommandedAttitude", ACommandedAttitude);
-		papiReadScenario_vec(line, "LVDC_AttitudeError", AttitudeError);
-		papiReadScenario_vec(line, "LVDC_AttRate", AttRate);
-		papiReadScenario_vec(line, "LVDC_CommandedAttitude", CommandedAttitude);
-		papiReadScenario_vec(line, "LVDC_CommandRateLimits", CommandRateLimits);
-		papiReadScenario_vec(line, "LVDC_CurrentAttitude", CurrentAttitude);
-		papiReadScenario_vec(line, "LVDC_ddotG_act", ddotG_act);
-		papiReadScenario_vec(line, "LVDC_ddotG_last", ddotG_last);
-		papiReadScenario_vec(line, "LVDC_ddotM_act", ddotM_act);
-		papiReadScenario_vec(line, "LVDC_ddotM_last", ddotM_last);
-		papiReadScenario_vec(line, "LVDC_DDotXEZ_G", DDotXEZ_G);
-		papiReadScenario_vec(line, "LVDC_DotG_act", DotG_act);
-		papiReadScenario_vec(line, "LVDC_DotG_last", DotG_last);
-		papiReadScenario_vec(line, "LVDC_DotM_act", DotM_act);
-		papiReadScenario_vec(line, "LVDC_DotM_last", DotM_last);
-		papiReadScenario_vec(line, "LVDC_DotS", DotS);
-		papiReadScenario_vec(line, "LVDC_DotXEZ", DotXEZ);
-		papiReadScenario_vec(line, "LVDC_PCommandedAttitude", PCommandedAttitude);
-		papiReadScenario_vec(line, "LVDC_Pos4", Pos4);
-		papiReadScenario_vec(line, "LVDC_PosS", PosS);
-		papiReadScenario_vec(line, "LVDC_PosXEZ", PosXEZ);
-		papiReadScenario_vec(line, "LVDC_TargetVector", TargetVector);
-		papiReadScenario_vec(line, "LVDC_WV", WV);
-		papiReadScenario_vec(line, "LVDC_XLunarAttitude", XLunarAttitude);
-
-		// MATRIX3
-		papiReadScenario_mat(line, "LVDC_MX_A", MX_A);
-		papiReadScenario_mat(line, "LVDC_MX_B", MX_B);
-		papiReadScenario_mat(line, "LVDC_MX_G", MX_G);
-		papiReadScenario_mat(line, "LVDC_MX_K", MX_K);
-		papiReadScenario_mat(line, "LVDC_MX_phi_T", MX_phi_T);
-		// Done
+		LVDCScenarioFields.Load(line, this);
 	}
 	if(oapiReadScenario_nextline (scn, line)){
 		if (!strnicmp(line, LVIMU_START_STRING, sizeof(LVIMU_START_STRING))) {
@@ -4754,6 +3832,41 @@ void LVDC::LoadState(FILEHANDLE scn){
 void LVDC::TimeStep(double simt, double simdt) {
 	if(owner == NULL){ return; }
 	if (owner->stage < PRELAUNCH_STAGE) { return; }
+
+	// Frames shorter than a minor loop run no cycle
+	minorLoopTime += simdt;
+	int loops = (int)(minorLoopTime / LVDC_MINOR_LOOP_PERIOD);
+	double dt = LVDC_MINOR_LOOP_PERIOD;
+	if (loops > LVDC_MAX_MINOR_LOOPS) {
+		loops = LVDC_MAX_MINOR_LOOPS;
+		dt = minorLoopTime / loops;
+	}
+
+	// Each cycle runs the event sequencing at its own mission time. The vehicle only moves
+	// once per frame, so only the last cycle samples the IMU and runs guidance.
+	// Staging or a stop ends the frame; what's left runs on the next one.
+	int stage = owner->stage;
+	int stop = LVDC_Stop;
+	int run = 0;
+	cycleTimer.Start();
+	while (run < loops) {
+		minorLoopTime -= dt;
+		run++;
+		Cycle(simt, dt, owner->MissionTime - minorLoopTime, run == loops);
+		if (owner->stage != stage || LVDC_Stop != stop) { break; }
+	}
+	cycleTimer.Stop(simdt, run);
+
+	// An added force only acts for one frame, so the hold-down and release pin force
+	// is added on every frame, whether a cycle ran or not.
+	if (padForce != 0.0) {
+		owner->AddForce(_V(0, 0, padForce), _V(0, 0, 0));
+	}
+}
+
+void LVDC::Cycle(double simt, double simdt, double mt, bool sample) {
+	IGMIntegrals I_1, I_2, I_12;							// IGM stage integrals
+	padForce = 0.0;
 	// Is the LVDC running?
 	if(LVDC_Stop == 0){
 		// Update timebase ET
@@ -4778,15 +3891,15 @@ void LVDC::TimeStep(double simt, double simdt) {
 
 				// Prelaunch tank venting between -3:00h and engine ignition
 				// No clue if the venting start time is correct
-				if(owner->MissionTime < -10800){
+				if(mt < -10800){
 					owner->SwitchSelector(10);
 				}else{
 					owner->SwitchSelector(11);
 				}
 
 				// BEFORE PTL COMMAND (T-00:20:00) STOPS HERE
-				if(owner->MissionTime < -1200){
-					double Source  = fabs(owner->MissionTime);
+				if(mt < -1200){
+					double Source  = fabs(mt);
 					double Minutes = Source/60;
 					double Hours   = (int)Minutes/60;				
 					double Seconds = Source - ((int)Minutes*60);
@@ -4797,13 +3910,13 @@ void LVDC::TimeStep(double simt, double simdt) {
 				}
 		
 				// Engine lights on at T-00:04:10
-				if (owner->MissionTime >= -250 && LVDC_EI_On == false) { LVDC_EI_On = true; }
+				if (mt >= -250 && LVDC_EI_On == false) { LVDC_EI_On = true; }
 
 				// Between PTL signal and GRR, we monitor the IMU for any failure signals and do vehicle self-tests.
 				// At GRR we transfer control to the flight program and start TB0.
 
 				// BEFORE GRR (T-00:00:17) STOPS HERE
-				if (owner->MissionTime < -17){
+				if (mt < -17){
 					/*sprintf(oapiDebugString(),"LVDC: T %f | IMU XYZ %f %f %f PIPA %f %f %f | TV %f | AWAITING GRR",owner->MissionTime,
 						lvimu.CDURegisters[LVRegCDUX],lvimu.CDURegisters[LVRegCDUY],lvimu.CDURegisters[LVRegCDUZ],
 						lvimu.CDURegisters[LVRegPIPAX],lvimu.CDURegisters[LVRegPIPAY],lvimu.CDURegisters[LVRegPIPAZ],atan((double)45));*/
@@ -4824,11 +3937,11 @@ void LVDC::TimeStep(double simt, double simdt) {
 				}
 
 				// At 10 seconds, play the countdown sound.
-				if (owner->MissionTime >= -10.3) { // Was -10.9
+				if (mt >= -10.3) { // Was -10.9
 					owner->SwitchSelector(13);
 				}
 				// Shut down venting at T - 9
-				if(owner->MissionTime > -9 && owner->prelaunchvent[0] != NULL) { owner->SwitchSelector(14); }
+				if(mt > -9 && owner->prelaunchvent[0] != NULL) { owner->SwitchSelector(14); }
 
 				// SATURN V ENGINE STARTUP
 				// Engine startup was staggered 1-2-2, with engine 5 starting first, then 1+3, then 2+4. 
@@ -4843,7 +3956,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 				// Source: Apollo 8 LV Flight Evaluation
 
 				// Transition from seperate throttles to single throttle
-				if(owner->MissionTime < -0.715){ 
+				if(mt < -0.715){ 
 					int x=0; // Start Sequence Index
 					double tm_1,tm_2,tm_3,tm_4; // CC light, 1st rise start, and 2nd rise start, and 100% thrust times.
 					double SumThrust=0;
@@ -4864,19 +3977,19 @@ void LVDC::TimeStep(double simt, double simdt) {
 						tm_2 = tm_1 + 0.3;  // Start of 1st rise
 						tm_3 = tm_2 + 0.85; // Start of 2nd rise
 						tm_4 = tm_3 + 0.75; // End of 2nd rise
-						if(owner->MissionTime >= tm_1){
+						if(mt >= tm_1){
 							// Light CC
-							if(owner->MissionTime < tm_2){
+							if(mt < tm_2){
 								// Idle at 2.5% thrust
 								thrst[x] = 0.025;
 							}else{
-								if(owner->MissionTime < tm_3){
+								if(mt < tm_3){
 									// Rise to 93% at a rate of 106 percent per second
-									thrst[x] = 0.025+(1.06*(owner->MissionTime-tm_2));
+									thrst[x] = 0.025+(1.06*(mt-tm_2));
 								}else{
-									if(owner->MissionTime < tm_4){
+									if(mt < tm_4){
 										// Rise to 100% at a rate of 9 percent per second.
-										thrst[x] = 0.93+(0.09*(owner->MissionTime-tm_3));
+										thrst[x] = 0.93+(0.09*(mt-tm_3));
 									}else{
 										// Hold 100%
 										thrst[x] = 1;
@@ -4897,17 +4010,17 @@ void LVDC::TimeStep(double simt, double simdt) {
 						owner->SetThrusterLevel(owner->th_main[4],thrst[0]); // Engine 5
 
 						owner->contrailLevel = SumThrust/5;
-						owner->AddForce(_V(0, 0, -10. * owner->THRUST_FIRST_VAC), _V(0, 0, 0)); // Maintain hold-down lock
+						padForce = -10. * owner->THRUST_FIRST_VAC; // Maintain hold-down lock
 					}
 				}else{
 					// Get 100% thrust on all engines.
 					owner->SetThrusterGroupLevel(owner->thg_main,1);
 					owner->contrailLevel = 1;				
-					owner->AddForce(_V(0, 0, -10. * owner->THRUST_FIRST_VAC), _V(0, 0, 0));
+					padForce = -10. * owner->THRUST_FIRST_VAC;
 				}
 
 				// LIFTOFF
-				if(owner->MissionTime >= 0){
+				if(mt >= 0){
 					TB1 = TAS;//-simdt;
 					LVDC_Timebase = 1;
 					LVDC_TB_ETime = 0;
@@ -4924,15 +4037,15 @@ void LVDC::TimeStep(double simt, double simdt) {
 				}
 
 				// Soft-Release Pin Dragging
-				if(owner->MissionTime < 0.5){
-				  double PinDragFactor = 1 - (owner->MissionTime*2);
-				  owner->AddForce(_V(0, 0, -(owner->THRUST_FIRST_VAC * PinDragFactor)), _V(0, 0, 0));
+				if(mt < 0.5){
+				  double PinDragFactor = 1 - (mt*2);
+				  padForce = -(owner->THRUST_FIRST_VAC * PinDragFactor);
 				}
 
 				// S1C CECO TRIGGER:
 				// I have multiple conflicting leads as to the CECO trigger.
 				// One says it happens at 4G acceleration and another says it happens by a timer at T+135.5			
-				if(owner->MissionTime > 125.9){ 
+				if(mt > 125.9){ 
 					// Apollo 11
 					owner->SwitchSelector(16);
 					S1_Engine_Out = true;
@@ -4950,10 +4063,10 @@ void LVDC::TimeStep(double simt, double simdt) {
 				// Apollo 8 cut off at 32877, Apollo 11 cut off at 31995.
 				if (owner->stage == LAUNCH_STAGE_ONE && owner->GetFuelMass() <= 0){
 					// For S1B/C thruster calibration
-					fprintf(lvlog,"[T+%f] S1 OECO - Thrust %f N @ Alt %f\r\n\r\n",owner->MissionTime,owner->GetThrusterMax(owner->th_main[0]),owner->GetAltitude());
+					TraceLog::Printf(TRACE_LVDC, "[T+%f] S1 OECO - Thrust %f N @ Alt %f\r\n\r\n",mt,owner->GetThrusterMax(owner->th_main[0]),owner->GetAltitude());
 					owner->SwitchSelector(17);
 					// Set timer
-					S1_Sep_Time = owner->MissionTime;
+					S1_Sep_Time = mt;
 					// Begin timebase 3
 					TB3 = TAS;//-simdt;
 					LVDC_Timebase = 3;
@@ -5005,7 +4118,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 			
 				// MR Shift
 				if(LVDC_TB_ETime > 284.4 && owner->stage == LAUNCH_STAGE_TWO_ISTG_JET && MRS == false){
-					fprintf(lvlog,"[TB%d+%f] MR Shift\r\n",LVDC_Timebase,LVDC_TB_ETime);
+					TraceLog::Printf(TRACE_LVDC, "[TB%d+%f] MR Shift\r\n",LVDC_Timebase,LVDC_TB_ETime);
 					// sprintf(oapiDebugString(),"LVDC: EMR SHIFT"); LVDC_GP_PC = 30; break;
 					owner->SwitchSelector(23);
 					MRS = true;
@@ -5015,7 +4128,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 				if(MRS == true){
 					double oetl = owner->GetThrusterLevel(owner->th_main[0])+owner->GetThrusterLevel(owner->th_main[1])+owner->GetThrusterLevel(owner->th_main[2])+owner->GetThrusterLevel(owner->th_main[3]);
 					if(oetl == 0){
-						fprintf(lvlog,"[MT %f] TB4 Start\r\n",simt);
+						TraceLog::Printf(TRACE_LVDC, "[MT %f] TB4 Start\r\n",simt);
 						// S2 OECO, start TB4
 						owner->SetThrusterGroupLevel(owner->thg_main, 0);
 						S2_BURNOUT = true;
@@ -5045,7 +4158,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 				// S2 STAGE SEP
 				if (LVDC_TB_ETime > 0.8 && owner->stage <= LAUNCH_STAGE_TWO_ISTG_JET) {
 					// S2ShutS.done(); No CECO on AP8
-					fprintf(lvlog,"[%d+%f] S2/S4B STAGING\r\n",LVDC_Timebase,LVDC_TB_ETime);
+					TraceLog::Printf(TRACE_LVDC, "[%d+%f] S2/S4B STAGING\r\n",LVDC_Timebase,LVDC_TB_ETime);
 					owner->SPUShiftS.done(); // Make sure it's done
 					owner->ClearEngineIndicators();
 					owner->SeparateStage(LAUNCH_STAGE_SIVB);
@@ -5073,7 +4186,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 					TB5 = TAS;//-simdt;
 					LVDC_Timebase = 5;
 					LVDC_TB_ETime = 0;
-					fprintf(lvlog, "SIVB CUTOFF! TAS = %f \r\n", TAS);
+					TraceLog::Printf(TRACE_LVDC, "SIVB CUTOFF! TAS = %f \r\n", TAS);
 				}
 
 				// CSM/LV separation
@@ -5101,7 +4214,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 							owner->SetThrusterLevel(owner->th_main[0], 0);
 						}
 					}
-					fprintf(lvlog,"S4B CUTOFF: Time %f Thrust %f\r\n",LVDC_TB_ETime,owner->GetThrusterLevel(owner->th_main[0]));
+					TraceLog::Printf(TRACE_LVDC, "S4B CUTOFF: Time %f Thrust %f\r\n",LVDC_TB_ETime,owner->GetThrusterLevel(owner->th_main[0]));
 				}
 
 				if (LVDC_TB_ETime >= 10 && LVDC_EI_On == true){
@@ -5120,11 +4233,11 @@ void LVDC::TimeStep(double simt, double simdt) {
 				}
 
 				// Fuel boiloff every ten seconds.
-				if (owner->MissionTime >= owner->NextMissionEventTime) {
+				if (mt >= owner->NextMissionEventTime) {
 					if (owner->GetThrusterLevel(owner->th_main[0]) < 0.5) {
 						owner->SIVBBoiloff();
 					}
-					owner->NextMissionEventTime = owner->MissionTime + 10.0;
+					owner->NextMissionEventTime = mt + 10.0;
 				}
 				// CSM/LV separation
 				if (owner->CSMLVPyros.Blown()) {
@@ -5166,7 +4279,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 				}	
 				if (LVDC_TB_ETime >= T_RG && S4B_REIGN == false) {
 					owner->SetThrusterGroupLevel(owner->thg_main, ((LVDC_TB_ETime - 578.6)*0.53)); //Engine ignites at MR 4.5 and throttles up
-					fprintf(lvlog, "S4B IGNITION: Time %f Thrust %f\r\n", LVDC_TB_ETime, owner->GetThrusterLevel(owner->th_main[0]));
+					TraceLog::Printf(TRACE_LVDC, "S4B IGNITION: Time %f Thrust %f\r\n", LVDC_TB_ETime, owner->GetThrusterLevel(owner->th_main[0]));
 				}
 				if(LVDC_TB_ETime>=580.3 && S4B_REIGN==false)
 				{
@@ -5186,7 +4299,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 					TB7 = TAS;//-simdt;
 					LVDC_Timebase = 7;
 					LVDC_TB_ETime = 0;
-					fprintf(lvlog, "SIVB CUTOFF! TAS = %f \r\n", TAS);
+					TraceLog::Printf(TRACE_LVDC, "SIVB CUTOFF! TAS = %f \r\n", TAS);
 					owner->TLI_Ended();
 				}
 				break;
@@ -5208,7 +4321,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 							owner->SetThrusterLevel(owner->th_main[0], 0);
 						}
 					}
-					fprintf(lvlog, "S4B CUTOFF: Time %f Thrust %f\r\n", LVDC_TB_ETime, owner->GetThrusterLevel(owner->th_main[0]));
+					TraceLog::Printf(TRACE_LVDC, "S4B CUTOFF: Time %f Thrust %f\r\n", LVDC_TB_ETime, owner->GetThrusterLevel(owner->th_main[0]));
 				}
 				if (LVDC_TB_ETime >= 10 && LVDC_EI_On == true) {
 					LVDC_EI_On = false;
@@ -5227,14 +4340,16 @@ void LVDC::TimeStep(double simt, double simdt) {
 				}
 				break;
 		}
-		lvimu.Timestep(simt);								// Give a timestep to the LV IMU
-		lvrg.Timestep(simdt);								// and RG
+		if (sample) {
+			lvimu.Timestep(simt);							// Give a timestep to the LV IMU
+			lvrg.Timestep(simdt);							// and RG
+		}
 		CurrentAttitude = lvimu.GetTotalAttitude();			// Get current attitude	
 		AttRate = lvrg.GetRates();							// Get rates	
 		//This is the actual LVDC code & logic; has to be independent from any of the above events
-		if(LVDC_GRR && init == false)
+		if(sample && LVDC_GRR && init == false)
 		{
-			fprintf(lvlog,"[T%f] GRR received!\r\n",owner->MissionTime);
+			TraceLog::Printf(TRACE_LVDC, "[T%f] GRR received!\r\n",mt);
 
 			// Initial Position & Velocity from Apollo 9 operational trajectory
 			/*PosS.x = 6373324.5;
@@ -5257,7 +4372,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 			t_D = T_L - T_LO;
 			//t_D = TABLE15.target[tgt_index].t_D;
 
-			fprintf(lvlog, "Time into launch window = %f\r\n", t_D);
+			TraceLog::Printf(TRACE_LVDC, "Time into launch window = %f\r\n", t_D);
 
 			//Azimuth determination
 			if (t_DS0 <= t_D && t_D < t_DS1)
@@ -5297,22 +4412,22 @@ void LVDC::TimeStep(double simt, double simdt) {
 
 			// preset to fixed value to be independent from any external stuff
 			// Azimuth = 72.124;
-			fprintf(lvlog,"Azimuth = %f\r\n",Azimuth);
+			TraceLog::Printf(TRACE_LVDC, "Azimuth = %f\r\n",Azimuth);
 
 			// Let's cheat a little. (Apollo 8)
 			//Inclination = 32.5031;
-			fprintf(lvlog,"Inclination = %f\r\n",Inclination);
+			TraceLog::Printf(TRACE_LVDC, "Inclination = %f\r\n",Inclination);
 
 			// Cheat a little more. (Apollo 8)
 			// DescNodeAngle = 123.004; 
-			fprintf(lvlog,"DescNodeAngle = %f\r\n", theta_N);
+			TraceLog::Printf(TRACE_LVDC, "DescNodeAngle = %f\r\n", theta_N);
 
 			// Need to make those into radians
 			Azimuth *= RAD;
 			Inclination *= RAD;
 			theta_N *= RAD;
 
-			fprintf(lvlog,"Rad Convert: Az / Inc / DNA = %f %f %f\r\n",Azimuth,Inclination, theta_N);
+			TraceLog::Printf(TRACE_LVDC, "Rad Convert: Az / Inc / DNA = %f %f %f\r\n",Azimuth,Inclination, theta_N);
 
 			if (TerminalConditions == false)
 			{
@@ -5327,18 +4442,18 @@ void LVDC::TimeStep(double simt, double simdt) {
 
 				// p is the semi-latus rectum of the desired terminal ellipse.
 				p = (mu / C_3)*(pow(e, 2) - 1);
-				fprintf(lvlog, "p = %f, mu = %f, e2 = %f, mu/C_3 = %f\r\n", p, mu, pow(e, 2), mu / C_3);
+				TraceLog::Printf(TRACE_LVDC, "p = %f, mu = %f, e2 = %f, mu/C_3 = %f\r\n", p, mu, pow(e, 2), mu / C_3);
 
 				// K_5 is the IGM terminal velocity constant
 				K_5 = sqrt(mu / p);
-				fprintf(lvlog, "K_5 = %f\r\n", K_5);
+				TraceLog::Printf(TRACE_LVDC, "K_5 = %f\r\n", K_5);
 
 				R_T = p / (1 + e*cos(f));
 				V_T = K_5*sqrt((1 + 2 * e*cos(f) + pow(e, 2)));
 				gamma_T = atan2((e*(sin(f))), (1 + (e*(cos(f)))));
 				G_T = -mu / pow(R_T, 2);
 			}
-			fprintf(lvlog,"R_T = %f (Expecting 6,563,366), V_T = %f (Expecting 7793.0429), gamma_T = %f\r\n",R_T,V_T,gamma_T);
+			TraceLog::Printf(TRACE_LVDC, "R_T = %f (Expecting 6,563,366), V_T = %f (Expecting 7793.0429), gamma_T = %f\r\n",R_T,V_T,gamma_T);
 
 			// G MATRIX CALCULATION
 			MX_A.m11 = cos(phi_L);  MX_A.m12 = sin(phi_L)*sin(Azimuth); MX_A.m13 = -(sin(phi_L)*cos(Azimuth));
@@ -5355,7 +4470,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 			U_Z = tmul(MX_A, U_Z);
 			DotS = crossp(U_Z*omega_E, PosS);
 
-			fprintf(lvlog, "Initial Velocity = %f %f %f\r\n", DotS.x, DotS.y, DotS.z);
+			TraceLog::Printf(TRACE_LVDC, "Initial Velocity = %f %f %f\r\n", DotS.x, DotS.y, DotS.z);
 		
 			Y_u= -(PosS.x*MX_A.m21+PosS.y*MX_A.m22+PosS.z*MX_A.m23); //position component south of equator
 			R = pow(pow(PosS.x,2)+pow(PosS.y,2)+pow(PosS.z,2),0.5); //instantaneous distance from earth's center
@@ -5377,7 +4492,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 			lvimu.ZeroPIPACounters();
 			sinceLastCycle = 0;
 			init = true;
-			fprintf(lvlog, "Initialization completed.\r\n\r\n");
+			TraceLog::Printf(TRACE_LVDC, "Initialization completed.\r\n\r\n");
 			goto minorloop;
 		}
 		// various clocks the LVDC needs...
@@ -5412,6 +4527,14 @@ void LVDC::TimeStep(double simt, double simdt) {
 		if(LVDC_GRR == true){TAS += simdt;} //time since GRR
 		if(liftoff == true){t_clock += simdt;} //time since liftoff
 		if(S2_IGNITION == true && t_21 == 0){t_21 = t_clock;} //I hope this is the right way to determine t_21; the boeing doc is silent on that
+
+		// Catch-up cycles stop here; the sampled cycle runs guidance over all of their time.
+		if (!sample) {
+			guidanceTime += simdt;
+			goto guidanceskip;
+		}
+		simdt += guidanceTime;
+		guidanceTime = 0;
 		
 		//Major loop(s)
 		if(LVDC_GRR == true){
@@ -5424,7 +4547,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 				dt_c = sinceLastCycle;
 				sinceLastCycle = 0;
 				IGMCycle++;				// For debugging
-				fprintf(lvlog, "[%d+%f] *** Major Loop (powered) %d ***\r\n", LVDC_Timebase, LVDC_TB_ETime, IGMCycle);
+				TraceLog::Printf(TRACE_LVDC, "[%d+%f] *** Major Loop (powered) %d ***\r\n", LVDC_Timebase, LVDC_TB_ETime, IGMCycle);
 				//read the PIPA CDUs
 				DotM_act.x += (lvimu.CDURegisters[LVRegPIPAX]);
 				DotM_act.y += (lvimu.CDURegisters[LVRegPIPAY]);
@@ -5449,20 +4572,20 @@ void LVDC::TimeStep(double simt, double simdt) {
 
 				ddotM_act = ddotG_last; //For orbital nav initialization
 
-				fprintf(lvlog, "Powered Navigation \r\n");
-				fprintf(lvlog, "Inertial Attitude: %f %f %f \r\n", CurrentAttitude.x*DEG, CurrentAttitude.y*DEG, CurrentAttitude.z*DEG);
-				fprintf(lvlog, "DotM: %f %f %f \r\n", DotM_act.x, DotM_act.y, DotM_act.z);
-				fprintf(lvlog, "Accelerometer readings: %f %f %f\r\n",lvimu.CDURegisters[LVRegPIPAX], lvimu.CDURegisters[LVRegPIPAY], lvimu.CDURegisters[LVRegPIPAZ]);
-				fprintf(lvlog, "Gravity velocity: %f %f %f \r\n", DotG_act.x, DotG_act.y, DotG_act.z);
-				fprintf(lvlog, "EarthRel Position: %f %f %f \r\n", PosS.x, PosS.y, PosS.z);
-				fprintf(lvlog, "SV Accuracy: %f \r\n", SVCompare());
-				fprintf(lvlog, "EarthRel Velocity: %f %f %f \r\n", DotS.x, DotS.y, DotS.z);
-				fprintf(lvlog, "Sensed Acceleration: %f \r\n", Fm);
-				fprintf(lvlog, "Gravity Acceleration: %f \r\n", CG);
-				fprintf(lvlog, "Total Velocity: %f \r\n", V);
-				fprintf(lvlog, "Dist. from Earth's Center: %f \r\n", R);
-				fprintf(lvlog, "S: %f \r\n", S);
-				fprintf(lvlog, "P: %f \r\n", P);
+				TraceLog::Printf(TRACE_LVDC, "Powered Navigation \r\n");
+				TraceLog::Printf(TRACE_LVDC, "Inertial Attitude: %f %f %f \r\n", CurrentAttitude.x*DEG, CurrentAttitude.y*DEG, CurrentAttitude.z*DEG);
+				TraceLog::Printf(TRACE_LVDC, "DotM: %f %f %f \r\n", DotM_act.x, DotM_act.y, DotM_act.z);
+				TraceLog::Printf(TRACE_LVDC, "Accelerometer readings: %f %f %f\r\n",lvimu.CDURegisters[LVRegPIPAX], lvimu.CDURegisters[LVRegPIPAY], lvimu.CDURegisters[LVRegPIPAZ]);
+				TraceLog::Printf(TRACE_LVDC, "Gravity velocity: %f %f %f \r\n", DotG_act.x, DotG_act.y, DotG_act.z);
+				TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n", PosS.x, PosS.y, PosS.z);
+				TraceLog::Printf(TRACE_LVDC, "SV Accuracy: %f \r\n", SVCompare());
+				TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n", DotS.x, DotS.y, DotS.z);
+				TraceLog::Printf(TRACE_LVDC, "Sensed Acceleration: %f \r\n", Fm);
+				TraceLog::Printf(TRACE_LVDC, "Gravity Acceleration: %f \r\n", CG);
+				TraceLog::Printf(TRACE_LVDC, "Total Velocity: %f \r\n", V);
+				TraceLog::Printf(TRACE_LVDC, "Dist. from Earth's Center: %f \r\n", R);
+				TraceLog::Printf(TRACE_LVDC, "S: %f \r\n", S);
+				TraceLog::Printf(TRACE_LVDC, "P: %f \r\n", P);
 				lvimu.ZeroPIPACounters();
 			}
 			else
@@ -5481,7 +4604,7 @@ void LVDC::TimeStep(double simt, double simdt) {
 				dt_c = sinceLastCycle;
 				sinceLastCycle = 0.0;
 				OrbNavCycle++;		//For debugging
-				fprintf(lvlog, "[%d+%f] *** Major Loop (orbital) %d ***\r\n", LVDC_Timebase, LVDC_TB_ETime, OrbNavCycle);
+				TraceLog::Printf(TRACE_LVDC, "[%d+%f] *** Major Loop (orbital) %d ***\r\n", LVDC_Timebase, LVDC_TB_ETime, OrbNavCycle);
 				//4-second intermediate integration
 				PosS_4sec = PosS + DotS*dt_c / 2.0 + ddotM_act*dt_c*dt_c/8.0;
 				DotS_4sec = DotS + ddotM_act*dt_c / 2.0;
@@ -5585,18 +4708,18 @@ void LVDC::TimeStep(double simt, double simdt) {
 				DotG_last = DotS;
 				lvimu.ZeroPIPACounters();
 
-				fprintf(lvlog, "Orbital Navigation \r\n");
-				fprintf(lvlog, "Inertial Attitude: %f %f %f \r\n", CurrentAttitude.x*DEG, CurrentAttitude.y*DEG, CurrentAttitude.z*DEG);
-				fprintf(lvlog, "DDotM: %f %f %f \r\n", ddotM_act.x, ddotM_act.y, ddotM_act.z);
-				fprintf(lvlog, "EarthRel Position: %f %f %f \r\n", PosS.x, PosS.y, PosS.z);
-				fprintf(lvlog, "SV Accuracy: %f \r\n", SVCompare());
-				fprintf(lvlog, "EarthRel Velocity: %f %f %f \r\n", DotS.x, DotS.y, DotS.z);
-				fprintf(lvlog, "Drag Acceleration: %f \r\n", length(DDotS_D));
-				fprintf(lvlog, "Gravity Acceleration: %f \r\n", CG);
-				fprintf(lvlog, "Total Velocity: %f \r\n", V);
-				fprintf(lvlog, "Dist. from Earth's Center: %f \r\n", R);
-				fprintf(lvlog, "S: %f \r\n", S);
-				fprintf(lvlog, "P: %f \r\n", P);
+				TraceLog::Printf(TRACE_LVDC, "Orbital Navigation \r\n");
+				TraceLog::Printf(TRACE_LVDC, "Inertial Attitude: %f %f %f \r\n", CurrentAttitude.x*DEG, CurrentAttitude.y*DEG, CurrentAttitude.z*DEG);
+				TraceLog::Printf(TRACE_LVDC, "DDotM: %f %f %f \r\n", ddotM_act.x, ddotM_act.y, ddotM_act.z);
+				TraceLog::Printf(TRACE_LVDC, "EarthRel Position: %f %f %f \r\n", PosS.x, PosS.y, PosS.z);
+				TraceLog::Printf(TRACE_LVDC, "SV Accuracy: %f \r\n", SVCompare());
+				TraceLog::Printf(TRACE_LVDC, "EarthRel Velocity: %f %f %f \r\n", DotS.x, DotS.y, DotS.z);
+				TraceLog::Printf(TRACE_LVDC, "Drag Acceleration: %f \r\n", length(DDotS_D));
+				TraceLog::Printf(TRACE_LVDC, "Gravity Acceleration: %f \r\n", CG);
+				TraceLog::Printf(TRACE_LVDC, "Total Velocity: %f \r\n", V);
+				TraceLog::Printf(TRACE_LVDC, "Dist. from Earth's Center: %f \r\n", R);
+				TraceLog::Printf(TRACE_LVDC, "S: %f \r\n", S);
+				TraceLog::Printf(TRACE_LVDC, "P: %f \r\n", P);
 			}
 			
 		}
@@ -5606,7 +4729,7 @@ GuidanceLoop:
 			CommandedAttitude.y =  0;
 			CommandedAttitude.z =  0;
 			//Just clogs the lvlog
-			//fprintf(lvlog,"[%d+%f] Initial roll command: %f\r\n",LVDC_Timebase,LVDC_TB_ETime,CommandedAttitude.x*DEG);
+			//TraceLog::Printf(TRACE_LVDC, "[%d+%f] Initial roll command: %f\r\n",LVDC_Timebase,LVDC_TB_ETime,CommandedAttitude.x*DEG);
 			goto minorloop;
 		}
 		if(BOOST == false){//i.e. we're either in orbit or boosting out of orbit
@@ -5628,7 +4751,7 @@ GuidanceLoop:
 				ROV = ROVs;
 				//S4B_IGN = true;
 				GATE4 = true;
-				fprintf(lvlog,"[%d+%f] Direct stage interrupt received! Guidance update executed!\r\n",LVDC_Timebase,LVDC_TB_ETime);
+				TraceLog::Printf(TRACE_LVDC, "[%d+%f] Direct stage interrupt received! Guidance update executed!\r\n",LVDC_Timebase,LVDC_TB_ETime);
 			}
 			if(TAS-TB4A-TS4BS < 0){ goto minorloop; }else{ goto IGM; }						
 		}
@@ -5638,7 +4761,7 @@ GuidanceLoop:
 				// S1C engine out interrupt handling
 				T_EO1 = 1;
 				t_fail = t_clock;
-				fprintf(lvlog,"[%d+%f] S1C engine out interrupt received! t_fail = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_fail);
+				TraceLog::Printf(TRACE_LVDC, "[%d+%f] S1C engine out interrupt received! t_fail = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_fail);
 			}				
 			if((PosS.x - a) > 137 || t_clock > t_1){
 				//roll/pitch program
@@ -5651,7 +4774,7 @@ GuidanceLoop:
 					if (t_5 < t_clock){ dT_F = 0; }
 					t_6 = t_clock + dT_F;
 					T_ar = T_ar + (0.25*(T_ar - t_fail));
-					fprintf(lvlog,"[%d+%f] Freeze time recalculated! t_6 = %f T_ar = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_6,T_ar);
+					TraceLog::Printf(TRACE_LVDC, "[%d+%f] Freeze time recalculated! t_6 = %f T_ar = %f\r\n",LVDC_Timebase,LVDC_TB_ETime,t_6,T_ar);
 				}
 				if (t_clock >= t_6){
 					if (t_clock > T_ar){
@@ -5666,10 +4789,10 @@ GuidanceLoop:
 							CommandedAttitude.y = PCommandedAttitude.y;
 							CommandedAttitude.x = 360 * RAD;
 							CommandedAttitude.z = 0;
-							fprintf(lvlog,"[%d+%f] Pre-IGM SII engine out interrupt received!\r\n",LVDC_Timebase,LVDC_TB_ETime);
+							TraceLog::Printf(TRACE_LVDC, "[%d+%f] Pre-IGM SII engine out interrupt received!\r\n",LVDC_Timebase,LVDC_TB_ETime);
 							goto minorloop;
 						}else{
-							fprintf(lvlog,"[%d+%f] Pitch freeze! \r\n",LVDC_Timebase,LVDC_TB_ETime);
+							TraceLog::Printf(TRACE_LVDC, "[%d+%f] Pitch freeze! \r\n",LVDC_Timebase,LVDC_TB_ETime);
 							CommandedAttitude.y = PCommandedAttitude.y;
 							CommandedAttitude.x = 360 * RAD;
 							CommandedAttitude.z = 0;
@@ -5690,7 +4813,7 @@ GuidanceLoop:
 						CommandedAttitude.y = cmd * RAD;
 						CommandedAttitude.x = 360 * RAD;
 						CommandedAttitude.z = 0;
-						fprintf(lvlog,"[%d+%f] Roll/pitch programm %f \r\n",LVDC_Timebase,LVDC_TB_ETime,cmd);
+						TraceLog::Printf(TRACE_LVDC, "[%d+%f] Roll/pitch programm %f \r\n",LVDC_Timebase,LVDC_TB_ETime,cmd);
 						goto minorloop;
 					}
 				}else{CommandedAttitude.y = PCommandedAttitude.y;
@@ -5700,7 +4823,7 @@ GuidanceLoop:
 				}
 			}else{
 				// S-IC yaw maneuver
-				fprintf(lvlog,"[%d+%f] Yaw maneuver\r\n",LVDC_Timebase,LVDC_TB_ETime);
+				TraceLog::Printf(TRACE_LVDC, "[%d+%f] Yaw maneuver\r\n",LVDC_Timebase,LVDC_TB_ETime);
 				if(1 <= t_clock && t_clock < 8.75){
 					//yaw command issued between t +1s and t+8.75s
 					CommandedAttitude.z = 1.25*RAD;
@@ -5715,20 +4838,20 @@ GuidanceLoop:
 		//end of pre igm
 IGM:	if(HSL == false){		
 			// We are not in the high-speed loop
-			fprintf(lvlog,"HSL False\r\n");
+			TraceLog::Printf(TRACE_LVDC, "HSL False\r\n");
 			// IGM STAGE LOGIC
 			if (S4B_REIGN)
 			{
-				fprintf(lvlog, "S-IVB 2nd BURN\n");
+				TraceLog::Printf(TRACE_LVDC, "S-IVB 2nd BURN\n");
 				if (MRS)
 				{
-					fprintf(lvlog, "MRS\r\n");
+					TraceLog::Printf(TRACE_LVDC, "MRS\r\n");
 					Tt_3 += T_2*(dotM_2 / dotM_3);
-					fprintf(lvlog, "Tt_3 = %f\r\n", Tt_3);
+					TraceLog::Printf(TRACE_LVDC, "Tt_3 = %f\r\n", Tt_3);
 					if(t_B2<=t_B4)
 					{goto relightentry1;}
 					t_B4 += dt_c;
-					fprintf(lvlog, "t_B4 = %f\r\n", t_B4);
+					TraceLog::Printf(TRACE_LVDC, "t_B4 = %f\r\n", t_B4);
 				}
 				else
 				{
@@ -5739,7 +4862,7 @@ IGM:	if(HSL == false){
 						{
 							MRS = true;
 							t_B2 = 0;
-							fprintf(lvlog, "MRS\r\n");
+							TraceLog::Printf(TRACE_LVDC, "MRS\r\n");
 						}
 					}
 					else
@@ -5755,44 +4878,44 @@ IGM:	if(HSL == false){
 					tau2 = tau2N + (V_ex2 * 1.0 / Fm - dt_c / 2.0 - tau2N)*pow(Ct / Ct_o, 4);
 					tau2N -= dt_c;
 					Ct += dt_c;
-					fprintf(lvlog, "Art. Tau Mode 2: tau2 = %f, tau2N = %f, Ct = %f, Diff = %f\r\n", tau2, tau2N, Ct, tau2 - V_ex2 / Fm);
+					TraceLog::Printf(TRACE_LVDC, "Art. Tau Mode 2: tau2 = %f, tau2N = %f, Ct = %f, Diff = %f\r\n", tau2, tau2N, Ct, tau2 - V_ex2 / Fm);
 					goto relightentry3;
 				}
 			}
 			if(S4B_IGN == true){
-				fprintf(lvlog,"S-IVB 1st BURN\n");
+				TraceLog::Printf(TRACE_LVDC, "S-IVB 1st BURN\n");
 				if (Ct >= Ct_o){
 					relightentry1:
 					tau3 = V_ex3/Fm;
-					fprintf(lvlog,"Normal Tau: tau3 = %f, F = %f, m = %f \r\n",tau3,owner->GetThrusterMax(owner->th_main[0])*owner->GetThrusterLevel(owner->th_main[0]),owner->GetMass());
+					TraceLog::Printf(TRACE_LVDC, "Normal Tau: tau3 = %f, F = %f, m = %f \r\n",tau3,owner->GetThrusterMax(owner->th_main[0])*owner->GetThrusterLevel(owner->th_main[0]),owner->GetMass());
 				}else{
 					tau3 = tau3N + (V_ex3/Fm - dt_c/2 - tau3N)*pow((Ct/Ct_o),4);
 					tau3N = tau3N - dt_c;
 					Ct = Ct + dt_c;
-					fprintf(lvlog,"Art. Tau Mode 3: tau3 = %f, tau3N = %f, Ct = %f, Diff = %f\r\n",tau3,tau3N,Ct,tau3-V_ex3/Fm);								
+					TraceLog::Printf(TRACE_LVDC, "Art. Tau Mode 3: tau3 = %f, tau3N = %f, Ct = %f, Diff = %f\r\n",tau3,tau3N,Ct,tau3-V_ex3/Fm);								
 				}
 				GATE = false; //end chi freeze
 				T_c = 0;
 				T_2 = 0;
 				T_1 = 0;
-				fprintf(lvlog,"GATE = false, T_c = 0, T_1 = 0, T_2 = 0\r\n");
+				TraceLog::Printf(TRACE_LVDC, "GATE = false, T_c = 0, T_1 = 0, T_2 = 0\r\n");
 				goto chitilde;
 			}
 			if(S2_BURNOUT == true){
-				fprintf(lvlog,"SII CUTOFF\n");
+				TraceLog::Printf(TRACE_LVDC, "SII CUTOFF\n");
 				if (T_c < 0){
 					//this prevents T_c from getting negative in case of late SIVB ignition
 					T_c = 0;
 					T_2 = 0;
 					T_1 = 0;
-					fprintf(lvlog,"T_c = 0, T_1 = 0, T_2 = 0\r\n");
+					TraceLog::Printf(TRACE_LVDC, "T_c = 0, T_1 = 0, T_2 = 0\r\n");
 					goto chitilde;
 				}else{
 					//chi freeze, kill the first two stage integrals
 					GATE = true;
 					T_2 = 0;
 					T_1 = 0;
-					fprintf(lvlog,"GATE = true, T_1 = 0, T_2 = 0\r\n");
+					TraceLog::Printf(TRACE_LVDC, "GATE = true, T_1 = 0, T_2 = 0\r\n");
 					goto chitilde;
 				}				
 			}
@@ -5803,99 +4926,87 @@ IGM:	if(HSL == false){
 				T_EO2 = 1;
 			}
 			if(MRS == true){
-				fprintf(lvlog,"Post-MRS\n");
+				TraceLog::Printf(TRACE_LVDC, "Post-MRS\n");
 				if(t_B1 <= t_B3){
 					relightentry2:
 					tau2 = V_ex2/Fm;
-					fprintf(lvlog,"Normal Tau: tau2 = %f, F/m = %f, m = %f \r\n",tau2,Fm,owner->GetMass());
+					TraceLog::Printf(TRACE_LVDC, "Normal Tau: tau2 = %f, F/m = %f, m = %f \r\n",tau2,Fm,owner->GetMass());
 				}else{
 					// This is the "ARTIFICIAL TAU" code.
 					t_B3 += dt_c; 
 					tau2 = tau2+(T_1*(dotM_1/dotM_2));
-					fprintf(lvlog,"Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
-					fprintf(lvlog,"Diff: %f \r\n",(tau2-V_ex2/Fm));
+					TraceLog::Printf(TRACE_LVDC, "Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
+					TraceLog::Printf(TRACE_LVDC, "Diff: %f \r\n",(tau2-V_ex2/Fm));
 				}
 				// This T_2 test is also tested after T_1 < 0 etc etc
 				relightentry3:
 				if(T_2 > 0){
 					T_2 = T_2+T_1*(dotM_1/dotM_2);
 					T_1 = 0;
-					fprintf(lvlog,"T_1 = 0\r\nT_2 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,dotM_1,dotM_2);
+					TraceLog::Printf(TRACE_LVDC, "T_1 = 0\r\nT_2 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,dotM_1,dotM_2);
 					// Go to CHI-TILDE LOGIC
 				}else{
 					T_2 = 0;
 					T_1 = 0;
-					fprintf(lvlog,"T_1 = 0, T_2 = 0\r\n");
+					TraceLog::Printf(TRACE_LVDC, "T_1 = 0, T_2 = 0\r\n");
 					// Go to CHI-TILDE LOGIC
 				}
 				if(T_2 < 11 && !S4B_REIGN){GATE = true;}//pre SIVB-staging chi-freeze
 			}else{
-				fprintf(lvlog,"Pre-MRS\n");
+				TraceLog::Printf(TRACE_LVDC, "Pre-MRS\n");
 				if(T_1 < 0){	
 					// If we're out of first-stage IGM time
 					// Artificial Tau
 					tau2 = tau2+(T_1*(dotM_1/dotM_2));
-					fprintf(lvlog,"Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
+					TraceLog::Printf(TRACE_LVDC, "Art. Tau: tau2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",tau2,T_1,dotM_1,dotM_2);
 					if(T_2 > 0){
 						T_2 = T_2+T_1*(dotM_1/dotM_2);
 						T_1 = 0;
-						fprintf(lvlog,"T_2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,T_1,dotM_1,dotM_2);
+						TraceLog::Printf(TRACE_LVDC, "T_2 = %f, T_1 = %f, dotM_1 = %f, dotM_2 = %f \r\n",T_2,T_1,dotM_1,dotM_2);
 					}else{
 						T_2 = 0;
 						T_1 = 0;
-						fprintf(lvlog,"T_2 = 0\r\n");
+						TraceLog::Printf(TRACE_LVDC, "T_2 = 0\r\n");
 					}					
 				}else{															
 					tau1 = V_ex1/Fm; 
-					fprintf(lvlog,"Normal Tau: tau1 = %f, F/m = %f m = %f\r\n",tau1,Fm, owner->GetMass());
+					TraceLog::Printf(TRACE_LVDC, "Normal Tau: tau1 = %f, F/m = %f m = %f\r\n",tau1,Fm, owner->GetMass());
 				}
 			}
-			fprintf(lvlog,"--- STAGE INTEGRAL LOGIC ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- STAGE INTEGRAL LOGIC ---\r\n");
 
 			// CHI-TILDE LOGIC
 			// STAGE INTEGRAL CALCULATIONS				
 chitilde:	Pos4 = mul(MX_G,PosS);
-			fprintf(lvlog,"Pos4 = %f, %f, %f\r\n",Pos4.x,Pos4.y,Pos4.z);
-			fprintf(lvlog,"T_1 = %f,T_2 = %f\r\n",T_1,T_2);
-			L_1 = V_ex1 * log(tau1 / (tau1-T_1));
-			J_1 = (L_1 * tau1) - (V_ex1 * T_1);
-			S_1 = (L_1 * T_1) - J_1;
-			Q_1 = (S_1 * tau1) - ((V_ex1 * pow(T_1,2)) / 2);
-			P_1 = (J_1 * tau1) - ((V_ex1 * pow(T_1,2)) / 2);
-			U_1 = (Q_1 * tau1) - ((V_ex1 * pow(T_1,3)) / 6);
-			fprintf(lvlog,"L_1 = %f, J_1 = %f, S_1 = %f, Q_1 = %f, P_1 = %f, U_1 = %f\r\n",L_1,J_1,S_1,Q_1,P_1,U_1);
-
-			L_2 = V_ex2 * log(tau2 / (tau2-T_2));
-			J_2 = (L_2 * tau2) - (V_ex2 * T_2);
-			S_2 = (L_2 * T_2) - J_2;
-			Q_2 = (S_2 * tau2) - ((V_ex2 * pow(T_2,2)) / 2);
-			P_2 = (J_2 * tau2) - ((V_ex2 * pow(T_2,2)) / 2);
-			U_2 = (Q_2 * tau2) - ((V_ex2 * pow(T_2,3)) / 6);
-			fprintf(lvlog,"L_2 = %f, J_2 = %f, S_2 = %f, Q_2 = %f, P_2 = %f, U_2 = %f\r\n",L_2,J_2,S_2,Q_2,P_2,U_2);
-
-			L_12 = L_1 + L_2;
-			J_12 = J_1 + J_2 + (L_2 * T_1);
-			S_12 = S_1 - J_2 + (L_12 * (T_2 + T_c));
-			Q_12 = Q_1 + Q_2 + (S_2 * T_1) + (J_1 * T_2);
-			P_12 = P_1 + P_2 + (T_1 * ((2 * J_2) + (L_2 * T_1)));
-			U_12 = U_1 + U_2 + (T_1 * ((2 * Q_2) + (S_2 * T_1))) + (T_2 * P_1);
-			fprintf(lvlog,"L_12 = %f, J_12 = %f, S_12 = %f, Q_12 = %f, P_12 = %f, U_12 = %f\r\n",L_12,J_12,S_12,Q_12,P_12,U_12);
+			TraceLog::Printf(TRACE_LVDC, "Pos4 = %f, %f, %f\r\n",Pos4.x,Pos4.y,Pos4.z);
+			TraceLog::Printf(TRACE_LVDC, "T_1 = %f,T_2 = %f\r\n",T_1,T_2);
+			IGMStageIntegrals(V_ex1, tau1, T_1, I_1);
+			L_1 = I_1.L; J_1 = I_1.J; S_1 = I_1.S; Q_1 = I_1.Q; P_1 = I_1.P; U_1 = I_1.U;
+			TraceLog::Printf(TRACE_LVDC, "L_1 = %f, J_1 = %f, S_1 = %f, Q_1 = %f, P_1 = %f, U_1 = %f\r\n",L_1,J_1,S_1,Q_1,P_1,U_1);
+
+			IGMStageIntegrals(V_ex2, tau2, T_2, I_2);
+			L_2 = I_2.L; J_2 = I_2.J; S_2 = I_2.S; Q_2 = I_2.Q; P_2 = I_2.P; U_2 = I_2.U;
+			TraceLog::Printf(TRACE_LVDC, "L_2 = %f, J_2 = %f, S_2 = %f, Q_2 = %f, P_2 = %f, U_2 = %f\r\n",L_2,J_2,S_2,Q_2,P_2,U_2);
+
+			IGMCombine(I_1, T_1, I_2, T_2, T_c, I_12);
+			L_12 = I_12.L; J_12 = I_12.J; S_12 = I_12.S; Q_12 = I_12.Q; P_12 = I_12.P; U_12 = I_12.U;
+			TraceLog::Printf(TRACE_LVDC, "L_12 = %f, J_12 = %f, S_12 = %f, Q_12 = %f, P_12 = %f, U_12 = %f\r\n",L_12,J_12,S_12,Q_12,P_12,U_12);
 
 			Lt_3 = V_ex3 * log(tau3 / (tau3-Tt_3));
-			fprintf(lvlog,"Lt_3 = %f, tau3 = %f, Tt_3 = %f\r\n",Lt_3,tau3,Tt_3);
+			TraceLog::Printf(TRACE_LVDC, "Lt_3 = %f, tau3 = %f, Tt_3 = %f\r\n",Lt_3,tau3,Tt_3);
 
 			Jt_3 = (Lt_3 * tau3) - (V_ex3 * Tt_3);
-			fprintf(lvlog,"Jt_3 = %f",Jt_3);
+			TraceLog::Printf(TRACE_LVDC, "Jt_3 = %f",Jt_3);
 			Lt_Y = (L_12 + Lt_3);
-			fprintf(lvlog,", Lt_Y = %f\r\n",Lt_Y);
+			TraceLog::Printf(TRACE_LVDC, ", Lt_Y = %f\r\n",Lt_Y);
 
 			// SELECT RANGE OPTION				
 gtupdate:	// Target of jump from further down
-			fprintf(lvlog,"--- GT UPDATE ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- GT UPDATE ---\r\n");
 
 			if(Tt_T <= eps_1){
 				// RANGE ANGLE 2 (out-of orbit)
-				fprintf(lvlog,"RANGE ANGLE 2\r\n");
+				TraceLog::Printf(TRACE_LVDC, "RANGE ANGLE 2\r\n");
 				//sprintf(oapiDebugString(),"LVDC: RANGE ANGLE 2: %f %f",Tt_T,eps_1);
 				// LVDC_GP_PC = 30; // STOP
 				V = length(DotS);
@@ -5905,32 +5016,32 @@ gtupdate:	// Target of jump from further down
 				dot_phi_1 = (V*cos_gam)/R;
 				dot_phi_T = (V_T*cos(gamma_T))/R_T;
 				phi_T = atan2(Pos4.z,Pos4.x)+(((dot_phi_1+dot_phi_T)/2.0)*Tt_T);
-				fprintf(lvlog, "V = %f, dot_phi_1 = %f, dot_phi_T = %f, phi_T = %f\r\n", V, dot_phi_1, dot_phi_T, phi_T);
+				TraceLog::Printf(TRACE_LVDC, "V = %f, dot_phi_1 = %f, dot_phi_T = %f, phi_T = %f\r\n", V, dot_phi_1, dot_phi_T, phi_T);
 			}else{
 				// RANGE ANGLE 1 (into orbit)
-				fprintf(lvlog,"RANGE ANGLE 1\r\n");
+				TraceLog::Printf(TRACE_LVDC, "RANGE ANGLE 1\r\n");
 				d2 = (V * Tt_T) - Jt_3 + (Lt_Y * Tt_3) - (ROV / V_ex3) * 
 					((tau1 - T_1) * L_1 + (tau2 - T_2) * L_2 + (tau3 - Tt_3) * Lt_3) *
 					(Lt_Y + V - V_T);
 				phi_T = atan2(Pos4.z, Pos4.x) + (1.0 / R_T)*(S_12 + d2)*cos(gamma_T);
-				fprintf(lvlog,"V = %f, d2 = %f, phi_T = %f\r\n",V,d2,phi_T);
+				TraceLog::Printf(TRACE_LVDC, "V = %f, d2 = %f, phi_T = %f\r\n",V,d2,phi_T);
 			}
 			// FREEZE TERMINAL CONDITIONS TEST
 			if(!(Tt_T <= eps_3)){
 				// UPDATE TERMINAL CONDITIONS
-				fprintf(lvlog,"UPDATE TERMINAL CONDITIONS\r\n");
+				TraceLog::Printf(TRACE_LVDC, "UPDATE TERMINAL CONDITIONS\r\n");
 				f = phi_T + alpha_D;
 				R_T = p/(1+((e*(cos(f)))));
-				fprintf(lvlog, "f = %f, R_T = %f, phi_T = %f, alpha_D = %f\r\n", f, R_T, phi_T, alpha_D);
+				TraceLog::Printf(TRACE_LVDC, "f = %f, R_T = %f, phi_T = %f, alpha_D = %f\r\n", f, R_T, phi_T, alpha_D);
 				V_T = K_5 * pow(1+((2*e)*(cos(f)))+pow(e,2),0.5);
 				gamma_T = atan2((e*(sin(f))),(1+(e*(cos(f)))));
 				G_T = -mu/pow(R_T,2);
-				fprintf(lvlog,"V_T = %f, gamma_T = %f, G_T = %f\r\n",V_T,gamma_T,G_T);
+				TraceLog::Printf(TRACE_LVDC, "V_T = %f, gamma_T = %f, G_T = %f\r\n",V_T,gamma_T,G_T);
 			}
 			// ROT TEST
 			if(ROT){
 				// ROTATED TERMINAL CONDITIONS (out-of-orbit)
-				fprintf(lvlog,"ROTATED TERMINAL CONDITIONS\r\n");
+				TraceLog::Printf(TRACE_LVDC, "ROTATED TERMINAL CONDITIONS\r\n");
 				//sprintf(oapiDebugString(),"LVDC: ROTATED TERMINAL CNDS");
 				xi_T = R_T*cos(gamma_T);
 				dot_zeta_T = V_T;
@@ -5938,63 +5049,63 @@ gtupdate:	// Target of jump from further down
 				ddot_zeta_GT = G_T*sin(gamma_T);
 				ddot_xi_GT = G_T*cos(gamma_T);
 				phi_T = phi_T - gamma_T;
-				fprintf(lvlog, "xi_T = %f, dot_zeta_T = %f, dot_xi_T = %f\r\n", xi_T, dot_zeta_T, dot_xi_T);
-				fprintf(lvlog, "ddot_zeta_GT = %f, ddot_xi_GT = %f\r\n", ddot_zeta_GT, ddot_xi_GT);
+				TraceLog::Printf(TRACE_LVDC, "xi_T = %f, dot_zeta_T = %f, dot_xi_T = %f\r\n", xi_T, dot_zeta_T, dot_xi_T);
+				TraceLog::Printf(TRACE_LVDC, "ddot_zeta_GT = %f, ddot_xi_GT = %f\r\n", ddot_zeta_GT, ddot_xi_GT);
 
 				// LVDC_GP_PC = 30; // STOP
 			}else{
 				// UNROTATED TERMINAL CONDITIONS (into-orbit)
-				fprintf(lvlog,"UNROTATED TERMINAL CONDITIONS\r\n");
+				TraceLog::Printf(TRACE_LVDC, "UNROTATED TERMINAL CONDITIONS\r\n");
 				xi_T = R_T;					
 				dot_zeta_T = V_T * (cos(gamma_T));
 				dot_xi_T = V_T * (sin(gamma_T));
 				ddot_zeta_GT = 0;
 				ddot_xi_GT = G_T;
-				fprintf(lvlog,"xi_T = %f, dot_zeta_T = %f, dot_xi_T = %f\r\n",xi_T,dot_zeta_T,dot_xi_T);
-				fprintf(lvlog,"ddot_zeta_GT = %f, ddot_xi_GT = %f\r\n",ddot_zeta_GT,ddot_xi_GT);
+				TraceLog::Printf(TRACE_LVDC, "xi_T = %f, dot_zeta_T = %f, dot_xi_T = %f\r\n",xi_T,dot_zeta_T,dot_xi_T);
+				TraceLog::Printf(TRACE_LVDC, "ddot_zeta_GT = %f, ddot_xi_GT = %f\r\n",ddot_zeta_GT,ddot_xi_GT);
 			}
 			// ROTATION TO TERMINAL COORDINATES
-			fprintf(lvlog,"--- ROTATION TO TERMINAL COORDINATES ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- ROTATION TO TERMINAL COORDINATES ---\r\n");
 			// This is the last time PosS is referred to.
 			MX_phi_T.m11 = (cos(phi_T));    MX_phi_T.m12 = 0; MX_phi_T.m13 = ((sin(phi_T)));
 			MX_phi_T.m21 = 0;               MX_phi_T.m22 = 1; MX_phi_T.m23 = 0;
 			MX_phi_T.m31 = (-sin(phi_T)); MX_phi_T.m32 = 0; MX_phi_T.m33 = (cos(phi_T));
-			fprintf(lvlog,"MX_phi_T R1 = %f %f %f\r\n",MX_phi_T.m11,MX_phi_T.m12,MX_phi_T.m13);
-			fprintf(lvlog,"MX_phi_T R2 = %f %f %f\r\n",MX_phi_T.m21,MX_phi_T.m22,MX_phi_T.m23);
-			fprintf(lvlog,"MX_phi_T R3 = %f %f %f\r\n",MX_phi_T.m31,MX_phi_T.m32,MX_phi_T.m33);
+			TraceLog::Printf(TRACE_LVDC, "MX_phi_T R1 = %f %f %f\r\n",MX_phi_T.m11,MX_phi_T.m12,MX_phi_T.m13);
+			TraceLog::Printf(TRACE_LVDC, "MX_phi_T R2 = %f %f %f\r\n",MX_phi_T.m21,MX_phi_T.m22,MX_phi_T.m23);
+			TraceLog::Printf(TRACE_LVDC, "MX_phi_T R3 = %f %f %f\r\n",MX_phi_T.m31,MX_phi_T.m32,MX_phi_T.m33);
 
 			MX_K = mul(MX_phi_T,MX_G);
-			fprintf(lvlog,"MX_K R1 = %f %f %f\r\n",MX_K.m11,MX_K.m12,MX_K.m13);
-			fprintf(lvlog,"MX_K R2 = %f %f %f\r\n",MX_K.m21,MX_K.m22,MX_K.m23);
-			fprintf(lvlog,"MX_K R3 = %f %f %f\r\n",MX_K.m31,MX_K.m32,MX_K.m33);
+			TraceLog::Printf(TRACE_LVDC, "MX_K R1 = %f %f %f\r\n",MX_K.m11,MX_K.m12,MX_K.m13);
+			TraceLog::Printf(TRACE_LVDC, "MX_K R2 = %f %f %f\r\n",MX_K.m21,MX_K.m22,MX_K.m23);
+			TraceLog::Printf(TRACE_LVDC, "MX_K R3 = %f %f %f\r\n",MX_K.m31,MX_K.m32,MX_K.m33);
 
 			PosXEZ = mul(MX_K,PosS);
 			DotXEZ = mul(MX_K,DotS);	
-			fprintf(lvlog,"PosXEZ = %f %f %f\r\n",PosXEZ.x,PosXEZ.y,PosXEZ.z);
-			fprintf(lvlog,"DotXEZ = %f %f %f\r\n",DotXEZ.x,DotXEZ.y,DotXEZ.z);
+			TraceLog::Printf(TRACE_LVDC, "PosXEZ = %f %f %f\r\n",PosXEZ.x,PosXEZ.y,PosXEZ.z);
+			TraceLog::Printf(TRACE_LVDC, "DotXEZ = %f %f %f\r\n",DotXEZ.x,DotXEZ.y,DotXEZ.z);
 
 			VECTOR3 RTT_T1,RTT_T2;
 			RTT_T1.x = ddot_xi_GT; RTT_T1.y = 0;        RTT_T1.z = ddot_zeta_GT;
 			RTT_T2 = ddotG_act;
-			fprintf(lvlog,"RTT_T1 = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
-			fprintf(lvlog,"RTT_T2 = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T1 = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T2 = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
 
 			RTT_T2 = mul(MX_K,RTT_T2);
-			fprintf(lvlog,"RTT_T2 (mul) = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T2 (mul) = %f %f %f\r\n",RTT_T2.x,RTT_T2.y,RTT_T2.z);
 
 			RTT_T1 = RTT_T1+RTT_T2;	  
-			fprintf(lvlog,"RTT_T1 (add) = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
+			TraceLog::Printf(TRACE_LVDC, "RTT_T1 (add) = %f %f %f\r\n",RTT_T1.x,RTT_T1.y,RTT_T1.z);
 
 			DDotXEZ_G  = _V(0.5*RTT_T1.x, 0.5*RTT_T1.y, 0.5*RTT_T1.z);
-			fprintf(lvlog,"ddot_XEZ_G = %f %f %f\r\n", DDotXEZ_G.x, DDotXEZ_G.y, DDotXEZ_G.z);
+			TraceLog::Printf(TRACE_LVDC, "ddot_XEZ_G = %f %f %f\r\n", DDotXEZ_G.x, DDotXEZ_G.y, DDotXEZ_G.z);
 
 			// ESTIMATED TIME-TO-GO
-			fprintf(lvlog,"--- ESTIMATED TIME-TO-GO ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- ESTIMATED TIME-TO-GO ---\r\n");
 
 			dot_dxit   = dot_xi_T - DotXEZ.x - (DDotXEZ_G.x*Tt_T);
 			dot_detat  = -DotXEZ.y - (DDotXEZ_G.y * Tt_T);
 			dot_dzetat = dot_zeta_T - DotXEZ.z - (DDotXEZ_G.z * Tt_T);
-			fprintf(lvlog,"dot_XEZt = %f %f %f\r\n",dot_dxit,dot_detat,dot_dzetat);
+			TraceLog::Printf(TRACE_LVDC, "dot_XEZt = %f %f %f\r\n",dot_dxit,dot_detat,dot_dzetat);
 			dV = pow((pow(dot_dxit,2)+pow(dot_detat,2)+pow(dot_dzetat,2)),0.5);
 			dL_3 = (((pow(dot_dxit,2)+pow(dot_detat,2)+pow(dot_dzetat,2))/Lt_Y)-Lt_Y)/2;
 			// if(dL_3 < 0){ sprintf(oapiDebugString(),"Est TTG: dL_3 %f (X/E/Z %f %f %f) @ Cycle %d (TB%d+%f)",dL_3,dot_dxit,dot_detat,dot_dzetat,IGMCycle,LVDC_Timebase,LVDC_TB_ETime);
@@ -6003,30 +5114,30 @@ gtupdate:	// Target of jump from further down
 			dT_3 = (dL_3*(tau3-Tt_3))/V_ex3;
 			T_3 = Tt_3 + dT_3;
 			T_T = Tt_T + dT_3;
-			fprintf(lvlog,"dV = %f, dL_3 = %f, dT_3 = %f, T_3 = %f, T_T = %f\r\n",dV,dL_3,dT_3,T_3,T_T);
+			TraceLog::Printf(TRACE_LVDC, "dV = %f, dL_3 = %f, dT_3 = %f, T_3 = %f, T_T = %f\r\n",dV,dL_3,dT_3,T_3,T_T);
 
 			// TARGET PARAMETER UPDATE
 			if(!(UP > 0)){	
-				fprintf(lvlog,"--- TARGET PARAMETER UPDATE ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- TARGET PARAMETER UPDATE ---\r\n");
 				UP = 1; 
 				Tt_3 = T_3;
 				Tt_T = T_T;
-				fprintf(lvlog,"UP = 1, Tt_3 = %f, Tt_T = %f\r\n",Tt_3,Tt_T);
+				TraceLog::Printf(TRACE_LVDC, "UP = 1, Tt_3 = %f, Tt_T = %f\r\n",Tt_3,Tt_T);
 				Lt_3 = Lt_3 + dL_3;
 				Lt_Y = Lt_Y + dL_3;
 				Jt_3 = Jt_3 + (dL_3*T_3);
-				fprintf(lvlog,"Lt_3 = %f, Lt_Y = %f, Jt_3 = %f\r\n",Lt_3,Lt_Y,Jt_3);
+				TraceLog::Printf(TRACE_LVDC, "Lt_3 = %f, Lt_Y = %f, Jt_3 = %f\r\n",Lt_3,Lt_Y,Jt_3);
 
 				// NOTE: This is perfectly valid. Just because Dijkstra and Wirth think otherwise
 				// does not mean it's gospel. I shouldn't have to defend my choice of instructions
 				// because a bunch of people read the title of the paper with no context and take
 				// it as a direct revelation from God with no further study into the issue.
-				fprintf(lvlog,"RECYCLE\r\n");
+				TraceLog::Printf(TRACE_LVDC, "RECYCLE\r\n");
 				goto gtupdate; // Recycle. 
 			}
 
 			// tchi_y AND tchi_p CALCULATIONS
-			fprintf(lvlog,"--- tchi_y/p CALCULATION ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- tchi_y/p CALCULATION ---\r\n");
 
 			L_3 = Lt_3 + dL_3;
 			J_3 = Jt_3 + (dL_3*T_3);
@@ -6034,14 +5145,14 @@ gtupdate:	// Target of jump from further down
 			Q_3 = (S_3*tau3)-((V_ex3*pow(T_3,2))/2);
 			P_3 = (J_3*(tau3+(2*T_1c)))-((V_ex3*pow(T_3,2))/2);
 			U_3 = (Q_3*(tau3+(2*T_1c)))-((V_ex3*pow(T_3,3))/6);
-			fprintf(lvlog,"L_3 = %f, J_3 = %f, S_3 = %f, Q_3 = %f, P_3 = %f, U_3 = %f\r\n",L_3,J_3,S_3,Q_3,P_3,U_3);
+			TraceLog::Printf(TRACE_LVDC, "L_3 = %f, J_3 = %f, S_3 = %f, Q_3 = %f, P_3 = %f, U_3 = %f\r\n",L_3,J_3,S_3,Q_3,P_3,U_3);
 
 			// This is where velocity-to-be-gained is generated.
 
 			dot_dxi   = dot_dxit   - (DDotXEZ_G.x   * dT_3);
 			dot_deta  = dot_detat  - (DDotXEZ_G.y  * dT_3);
 			dot_dzeta = dot_dzetat - (DDotXEZ_G.z * dT_3);
-			fprintf(lvlog,"dot_dXEZ = %f %f %f\r\n",dot_dxi,dot_deta,dot_dzeta);
+			TraceLog::Printf(TRACE_LVDC, "dot_dXEZ = %f %f %f\r\n",dot_dxi,dot_deta,dot_dzeta);
 
 			//				sprintf(oapiDebugString(),".dxi = %f | .deta %f | .dzeta %f | dT3 %f",
 			//					dot_dxi,dot_deta,dot_dzeta,dT_3);
@@ -6052,12 +5163,12 @@ gtupdate:	// Target of jump from further down
 			tchi_y = atan2(dot_deta,pow(pow(dot_dxi,2)+pow(dot_dzeta,2),0.5));
 			tchi_p = atan2(dot_dxi,dot_dzeta);				
 			UP = -1;
-			fprintf(lvlog,"L_Y = %f, tchi_y = %f, tchi_p = %f, UP = -1\r\n",L_Y,tchi_y,tchi_p);
+			TraceLog::Printf(TRACE_LVDC, "L_Y = %f, tchi_y = %f, tchi_p = %f, UP = -1\r\n",L_Y,tchi_y,tchi_p);
 
 			// *** END OF CHI-TILDE LOGIC ***
 			// Is it time for chi-tilde mode?
 			if(Tt_T <= eps_2){
-				fprintf(lvlog,"CHI BAR STERRING ON, REMOVE ALTITUDE CONSTRAINS (K_1-4 = 0)\r\n");
+				TraceLog::Printf(TRACE_LVDC, "CHI BAR STERRING ON, REMOVE ALTITUDE CONSTRAINS (K_1-4 = 0)\r\n");
 				// Yes
 				// Go to the test that we would be testing if HSL was true
 				K_1 = 0; K_2 = 0; K_3 = 0; K_4 = 0;
@@ -6067,58 +5178,58 @@ gtupdate:	// Target of jump from further down
 			}else{
 				// No.
 				// YAW STEERING PARAMETERS
-				fprintf(lvlog,"--- YAW STEERING PARAMETERS ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- YAW STEERING PARAMETERS ---\r\n");
 
 				J_Y = J_12 + J_3 + (L_3*T_1c);
 				S_Y = S_12 - J_3 + (L_Y*T_3);
 				Q_Y = Q_12 + Q_3 + (S_3*T_1c) + ((T_c+T_3)*J_12);
 				K_Y = L_Y/J_Y;
 				D_Y = S_Y - (K_Y*Q_Y);
-				fprintf(lvlog,"J_Y = %f, S_Y = %f, Q_Y = %f, K_Y = %f, D_Y = %f\r\n",J_Y,S_Y,Q_Y,K_Y,D_Y);
+				TraceLog::Printf(TRACE_LVDC, "J_Y = %f, S_Y = %f, Q_Y = %f, K_Y = %f, D_Y = %f\r\n",J_Y,S_Y,Q_Y,K_Y,D_Y);
 
 				deta = PosXEZ.y + (DotXEZ.y*T_T) + ((DDotXEZ_G.y*pow(T_T,2))/2) + (S_Y*(sin(tchi_y)));
 				K_3 = deta/(D_Y*(cos(tchi_y)));
 				K_4 = K_Y*K_3;
-				fprintf(lvlog,"deta = %f, K_3 = %f, K_4 = %f\r\n",deta,K_3,K_4);
+				TraceLog::Printf(TRACE_LVDC, "deta = %f, K_3 = %f, K_4 = %f\r\n",deta,K_3,K_4);
 
 				// PITCH STEERING PARAMETERS
-				fprintf(lvlog,"--- PITCH STEERING PARAMETERS ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- PITCH STEERING PARAMETERS ---\r\n");
 
 				L_P = L_Y*cos(tchi_y);
 				C_2 = cos(tchi_y)+(K_3*sin(tchi_y));
 				C_4 = K_4*sin(tchi_y);
 				J_P = (J_Y*C_2) - (C_4*(P_12+P_3+(pow(T_1c,2)*L_3)));
-				fprintf(lvlog,"L_P = %f, C_2 = %f, C_4 = %f, J_P = %f\r\n",L_P,C_2,C_4,J_P);
+				TraceLog::Printf(TRACE_LVDC, "L_P = %f, C_2 = %f, C_4 = %f, J_P = %f\r\n",L_P,C_2,C_4,J_P);
 
 				S_P = (S_Y*C_2) - (C_4*Q_Y);
 				Q_P = (Q_Y*C_2) - (C_4*(U_12+U_3+(pow(T_1c,2)*S_3)+((T_3+T_c)*P_12)));
 				K_P = L_P/J_P;
 				D_P = S_P - (K_P*Q_P);
-				fprintf(lvlog,"S_P = %f, Q_P = %f, K_P = %f, D_P = %f\r\n",S_P,Q_P,K_P,D_P);
+				TraceLog::Printf(TRACE_LVDC, "S_P = %f, Q_P = %f, K_P = %f, D_P = %f\r\n",S_P,Q_P,K_P,D_P);
 
 				dxi = PosXEZ.x - xi_T + (DotXEZ.x*T_T) + ((DDotXEZ_G.x*pow(T_T,2))/2) + (S_P*(sin(tchi_p)));
 				K_1 = dxi/(D_P*cos(tchi_p));
 				K_2 = K_P*K_1;
-				fprintf(lvlog,"dxi = %f, K_1 = %f, K_2 = %f, cos(tchi_p) = %f\r\n",dxi,K_1,K_2,cos(tchi_p));
+				TraceLog::Printf(TRACE_LVDC, "dxi = %f, K_1 = %f, K_2 = %f, cos(tchi_p) = %f\r\n",dxi,K_1,K_2,cos(tchi_p));
 			}
 		}else{
 hsl:		// HIGH-SPEED LOOP ENTRY				
 			// CUTOFF VELOCITY EQUATIONS
-			fprintf(lvlog,"--- CUTOFF VELOCITY EQUATIONS ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- CUTOFF VELOCITY EQUATIONS ---\r\n");
 			V_0 = V_1;
 			V_1 = V_2;
 			//V_2 = 0.5 * (V+(pow(V_1,2)/V));
 			V_2 = V;
 			dtt_1 = dtt_2;
 			dtt_2 = dt_c;					
-			fprintf(lvlog,"V = %f, Tt_t = %f\r\n",V,Tt_T);
-			fprintf(lvlog,"V = %f, V_0 = %f, V_1 = %f, V_2 = %f, dtt_1 = %f, dtt_2 = %f\r\n",V,V_0,V_1,V_2,dtt_1,dtt_2);
+			TraceLog::Printf(TRACE_LVDC, "V = %f, Tt_t = %f\r\n",V,Tt_T);
+			TraceLog::Printf(TRACE_LVDC, "V = %f, V_0 = %f, V_1 = %f, V_2 = %f, dtt_1 = %f, dtt_2 = %f\r\n",V,V_0,V_1,V_2,dtt_1,dtt_2);
 			if(Tt_T <= eps_4 && V + V_TC >= V_T){
-				fprintf(lvlog,"--- HI SPEED LOOP ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- HI SPEED LOOP ---\r\n");
 				// TGO CALCULATION
-				fprintf(lvlog,"--- TGO CALCULATION ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- TGO CALCULATION ---\r\n");
 				if(GATE5 == false){
-					fprintf(lvlog,"CHI FREEZE\r\n");
+					TraceLog::Printf(TRACE_LVDC, "CHI FREEZE\r\n");
 					// CHI FREEZE
 					tchi_y = tchi_y_last;
 					tchi_p = tchi_p_last;
@@ -6126,10 +5237,10 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 					HSL = true;
 					GATE5 = true;
 					T_GO = T_3;
-					fprintf(lvlog,"HSL = true, GATE5 = true, T_GO = %f\r\n",T_GO);
+					TraceLog::Printf(TRACE_LVDC, "HSL = true, GATE5 = true, T_GO = %f\r\n",T_GO);
 				}
 				if(BOOST == true){
-					fprintf(lvlog,"BOOST-TO-ORBIT ACTIVE\r\n");
+					TraceLog::Printf(TRACE_LVDC, "BOOST-TO-ORBIT ACTIVE\r\n");
 					// dT_4 CALCULATION
 					if (LVDC_Timebase == 40)
 					{
@@ -6141,37 +5252,37 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 					}
 					dT_4 = TAS-t_3i-T_4N;
 					//dT_4 = t_3i - T_4N;
-					fprintf(lvlog,"t_3i = %f, dT_4 = %f\r\n",t_3i,dT_4);
+					TraceLog::Printf(TRACE_LVDC, "t_3i = %f, dT_4 = %f\r\n",t_3i,dT_4);
 					if(fabs(dT_4) <= dT_LIM){							
 						dTt_4 = dT_4;
 					}else{
-						fprintf(lvlog,"dTt_4 CLAMPED\r\n");
+						TraceLog::Printf(TRACE_LVDC, "dTt_4 CLAMPED\r\n");
 						dTt_4 = dT_LIM;
 					}
-					fprintf(lvlog,"dTt_4 = %f\r\n",dTt_4);
+					TraceLog::Printf(TRACE_LVDC, "dTt_4 = %f\r\n",dTt_4);
 				}else{
 					// TRANSLUNAR INJECTION VELOCITY
-					fprintf(lvlog,"TRANSLUNAR INJECTION\r\n");
+					TraceLog::Printf(TRACE_LVDC, "TRANSLUNAR INJECTION\r\n");
 					double dotR = dotp(PosS, DotS) / R;
 					R_T = R + dotR*(T_3 - dt);
 					V_T = sqrt(C_3 + 2.0*mu / R_T);
 					dV_B = dV_BR;
 					//sprintf(oapiDebugString(),"LVDC: HISPEED LOOP, TLI VELOCITY: %f %f %f %f %f",Tt_T,eps_4,V,V_TC,V_T);
-					fprintf(lvlog, "TLI VELOCITY: Tt_T: %f, eps_4: %f, V: %f, V_TC: %f, V_T: %f\r\n", Tt_T, eps_4, V, V_TC, V_T);
+					TraceLog::Printf(TRACE_LVDC, "TLI VELOCITY: Tt_T: %f, eps_4: %f, V: %f, V_TC: %f, V_T: %f\r\n", Tt_T, eps_4, V, V_TC, V_T);
 					// LVDC_GP_PC = 30; // STOP
 				}
 				// TGO DETERMINATION
-				fprintf(lvlog,"--- TGO DETERMINATION ---\r\n");
+				TraceLog::Printf(TRACE_LVDC, "--- TGO DETERMINATION ---\r\n");
 
 				a_2 = (((V_2-V_1)*dtt_1)-((V_1-V_0)*dtt_2))/(dtt_2*dtt_1*(dtt_2+dtt_1));
 				a_1 = ((V_2-V_1)/dtt_2)+(a_2*dtt_2);
 				T_GO = ((V_T-dV_B)-V_2)/(a_1+a_2*T_GO);
 				T_CO = TAS+T_GO;
-				fprintf(lvlog,"a_2 = %f, a_1 = %f, T_GO = %f, T_CO = %f, V_T = %f\r\n",a_2,a_1,T_GO,T_CO,V_T);
+				TraceLog::Printf(TRACE_LVDC, "a_2 = %f, a_1 = %f, T_GO = %f, T_CO = %f, V_T = %f\r\n",a_2,a_1,T_GO,T_CO,V_T);
 
 				// S4B CUTOFF?
 				if(S4B_IGN == false && (LVDC_Timebase < 6 || LVDC_Timebase == 40)){
-					fprintf(lvlog,"*** HSL EXIT SETTINGS ***\r\n");
+					TraceLog::Printf(TRACE_LVDC, "*** HSL EXIT SETTINGS ***\r\n");
 					GATE = false;
 					GATE5 = false;
 					Tt_T = 1000;
@@ -6181,7 +5292,7 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 				}
 				// S4B 2ND CUTOFF?
 				if(S4B_REIGN == false && (LVDC_Timebase >= 6 && LVDC_Timebase != 40)) {
-					fprintf(lvlog, "*** HSL EXIT SETTINGS ***\r\n");
+					TraceLog::Printf(TRACE_LVDC, "*** HSL EXIT SETTINGS ***\r\n");
 					GATE = false;
 					GATE5 = false;
 					Tt_T = 1000;
@@ -6196,7 +5307,7 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 			// End of high-speed loop
 		}
 		// GUIDANCE TIME UPDATE
-		fprintf(lvlog,"--- GUIDANCE TIME UPDATE ---\r\n");
+		TraceLog::Printf(TRACE_LVDC, "--- GUIDANCE TIME UPDATE ---\r\n");
 		if(BOOST){
 			if(S4B_IGN){
 				T_3 = T_3 - dt_c;
@@ -6211,16 +5322,16 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 							T_2 = T_2 - dt_c;
 						}else{
 							// Here if t_B1 is bigger.
-							fprintf(lvlog,"t_B1 = %f, t_B3 = %f\r\n",t_B1,t_B3);
+							TraceLog::Printf(TRACE_LVDC, "t_B1 = %f, t_B3 = %f\r\n",t_B1,t_B3);
 							T_1 = (((dotM_1*(t_B3-t_B1))-(dotM_2*t_B3))*dt)/(dotM_1*t_B1);
 						}
 					}
 				}
 			}
-			fprintf(lvlog,"T_1 = %f, T_2 = %f, T_3 = %f, T_c = %f dt_c = %f\r\n",T_1,T_2,T_3,T_c,dt_c);
+			TraceLog::Printf(TRACE_LVDC, "T_1 = %f, T_2 = %f, T_3 = %f, T_c = %f dt_c = %f\r\n",T_1,T_2,T_3,T_c,dt_c);
 		}else{
 			// MRS TEST
-			fprintf(lvlog,"MRS TEST\r\n");
+			TraceLog::Printf(TRACE_LVDC, "MRS TEST\r\n");
 			//sprintf(oapiDebugString(),"LVDC: MRS TEST");
 			if (MRS)
 			{
@@ -6237,26 +5348,26 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 			{
 				T_2 = T_2 - dt_c;
 			}
-			fprintf(lvlog, "T_2 = %f, T_3 = %f, dt_c = %f\r\n", T_2, T_3, dt_c);
+			TraceLog::Printf(TRACE_LVDC, "T_2 = %f, T_3 = %f, dt_c = %f\r\n", T_2, T_3, dt_c);
 			// LVDC_GP_PC = 30; // STOP
 		}
 		Tt_3 = T_3;
 		T_1c = T_1+T_2+T_c;			
 		Tt_T = T_1c+Tt_3;
-		fprintf(lvlog,"Tt_3 = %f, T_1c = %f, Tt_T = %f\r\n",Tt_3,T_1c,Tt_T);
+		TraceLog::Printf(TRACE_LVDC, "Tt_3 = %f, T_1c = %f, Tt_T = %f\r\n",Tt_3,T_1c,Tt_T);
 		if(GATE){
 			// FREEZE CHI
-			fprintf(lvlog,"Thru GATE; CHI FREEZE\r\n");
+			TraceLog::Printf(TRACE_LVDC, "Thru GATE; CHI FREEZE\r\n");
 			//sprintf(oapiDebugString(),"LVDC: CHI FREEZE");
 			goto minorloop;
 		}else{
 			// IGM STEERING ANGLES
-			fprintf(lvlog,"--- IGM STEERING ANGLES ---\r\n");
+			TraceLog::Printf(TRACE_LVDC, "--- IGM STEERING ANGLES ---\r\n");
 
 			//sprintf(oapiDebugString(),"IGM: K_1 %f K_2 %f K_3 %f K_4 %f",K_1,K_2,K_3,K_4);
 			Xtt_y = ((tchi_y) - K_3 + (K_4 * t));
 			Xtt_p = ((tchi_p) - K_1 + (K_2 * t));
-			fprintf(lvlog,"Xtt_y = %f, Xtt_p = %f\r\n",Xtt_y,Xtt_p);
+			TraceLog::Printf(TRACE_LVDC, "Xtt_y = %f, Xtt_p = %f\r\n",Xtt_y,Xtt_p);
 
 			// -- COMPUTE INVERSE OF [K] --
 			// Get Determinate
@@ -6264,7 +5375,7 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 						- MX_K.m12 * ((MX_K.m21*MX_K.m33) - (MX_K.m31*MX_K.m23))
 						+ MX_K.m13 * ((MX_K.m21*MX_K.m32) - (MX_K.m31*MX_K.m22));
 			// If the determinate is less than 0.0005, this is invalid.
-			fprintf(lvlog,"det = %f (LESS THAN 0.0005 IS INVALID)\r\n",det);
+			TraceLog::Printf(TRACE_LVDC, "det = %f (LESS THAN 0.0005 IS INVALID)\r\n",det);
 
 			MATRIX3 MX_Ki; // TEMPORARY: Inverse of [K]
 			MX_Ki.m11 =   ((MX_K.m22*MX_K.m33) - (MX_K.m23*MX_K.m32))  / det;
@@ -6276,30 +5387,30 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 			MX_Ki.m31 =   ((MX_K.m21*MX_K.m32) - (MX_K.m22*MX_K.m31))  / det;
 			MX_Ki.m32 =   ((MX_K.m12*MX_K.m31) - (MX_K.m11*MX_K.m32))  / det;
 			MX_Ki.m33 =   ((MX_K.m11*MX_K.m22) - (MX_K.m12*MX_K.m21))  / det;
-			fprintf(lvlog,"MX_Ki R1 = %f %f %f\r\n",MX_Ki.m11,MX_Ki.m12,MX_Ki.m13);
-			fprintf(lvlog,"MX_Ki R2 = %f %f %f\r\n",MX_Ki.m21,MX_Ki.m22,MX_Ki.m23);
-			fprintf(lvlog,"MX_Ki R3 = %f %f %f\r\n",MX_Ki.m31,MX_Ki.m32,MX_Ki.m33);
+			TraceLog::Printf(TRACE_LVDC, "MX_Ki R1 = %f %f %f\r\n",MX_Ki.m11,MX_Ki.m12,MX_Ki.m13);
+			TraceLog::Printf(TRACE_LVDC, "MX_Ki R2 = %f %f %f\r\n",MX_Ki.m21,MX_Ki.m22,MX_Ki.m23);
+			TraceLog::Printf(TRACE_LVDC, "MX_Ki R3 = %f %f %f\r\n",MX_Ki.m31,MX_Ki.m32,MX_Ki.m33);
 
 			// Done
 			VECTOR3 VT; 
 			VT.x = (sin(Xtt_p)*cos(Xtt_y));
 			VT.y = (sin(Xtt_y));
 			VT.z = (cos(Xtt_p)*cos(Xtt_y));
-			fprintf(lvlog,"VT (set) = %f %f %f\r\n",VT.x,VT.y,VT.z);
+			TraceLog::Printf(TRACE_LVDC, "VT (set) = %f %f %f\r\n",VT.x,VT.y,VT.z);
 
 			VT = mul(MX_Ki,VT);
-			fprintf(lvlog,"VT (mul) = %f %f %f\r\n",VT.x,VT.y,VT.z);
+			TraceLog::Printf(TRACE_LVDC, "VT (mul) = %f %f %f\r\n",VT.x,VT.y,VT.z);
 
 			X_S1 = VT.x;
 			X_S2 = VT.y;
 			X_S3 = VT.z;
-			fprintf(lvlog,"X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
+			TraceLog::Printf(TRACE_LVDC, "X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
 
 			// FINALLY - COMMANDS!
 			X_Zi = asin(X_S2);			// Yaw
 			X_Yi = atan2(-X_S3,X_S1);	// Pitch
-			fprintf(lvlog,"*** COMMAND ISSUED ***\r\n");
-			fprintf(lvlog,"PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
+			TraceLog::Printf(TRACE_LVDC, "*** COMMAND ISSUED ***\r\n");
+			TraceLog::Printf(TRACE_LVDC, "PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
 			// IGM is supposed to generate attitude directly.
 			CommandedAttitude.x = 360 * RAD;    // ROLL
 			CommandedAttitude.y = X_Yi; // PITCH
@@ -6309,7 +5420,7 @@ hsl:		// HIGH-SPEED LOOP ENTRY
 
 orbitalguidance: 
 		//orbital guidance logic
-		fprintf(lvlog,"*** ORBITAL GUIDANCE ***\r\n");
+		TraceLog::Printf(TRACE_LVDC, "*** ORBITAL GUIDANCE ***\r\n");
 		if(TAS-TB7<0){
 			if(TAS-TB6<0){
 				if(TAS-TB5-TA1 >= 0){
@@ -6318,24 +5429,24 @@ orbitalguidance:
 						if(INH2){
 							alpha_1 = 0 * RAD;
 							CommandedAttitude.x = 360 * RAD;
-							fprintf(lvlog, "inhibit attitude hold, maintain orbrate\r\n");
+							TraceLog::Printf(TRACE_LVDC, "inhibit attitude hold, maintain orbrate\r\n");
 							goto orbatt;
 						}else{
 							CommandedAttitude = ACommandedAttitude;
-							fprintf(lvlog, "Attitude hold\r\n");
+							TraceLog::Printf(TRACE_LVDC, "Attitude hold\r\n");
 							goto minorloop;
 						}
 					}else{
 						if(INH1){
 							alpha_1 = 0 * RAD;
 							CommandedAttitude.x = 360 * RAD;
-							fprintf(lvlog, "No pitch down, maintain orbrate\r\n");
+							TraceLog::Printf(TRACE_LVDC, "No pitch down, maintain orbrate\r\n");
 							goto orbatt;
 						}else{
 							alpha_1 = XLunarAttitude.y;
 							alpha_2 = XLunarAttitude.z;
 							CommandedAttitude.x = XLunarAttitude.x;
-							fprintf(lvlog, "Pitch down\r\n");
+							TraceLog::Printf(TRACE_LVDC, "Pitch down\r\n");
 							goto orbatt;
 						}
 					}
@@ -6367,7 +5478,7 @@ orbitalguidance:
 				{	
 					//attitude hold for T&D
 					CommandedAttitude = ACommandedAttitude;
-					fprintf(lvlog, "T&D attitude hold\r\n");
+					TraceLog::Printf(TRACE_LVDC, "T&D attitude hold\r\n");
 					goto minorloop;
 				}
 				else
@@ -6377,7 +5488,7 @@ orbitalguidance:
 					alpha_2 = XLunarAttitude.z;
 					CommandedAttitude.x = XLunarAttitude.x;
 					GATE6 = true;
-					fprintf(lvlog, "T&D attitude\r\n");
+					TraceLog::Printf(TRACE_LVDC, "T&D attitude\r\n");
 					goto orbatt;
 				}
 			}
@@ -6409,21 +5520,21 @@ orbatt: Pos4 = mul(MX_G,PosS); //here we compute the steering angles...
 		VT.x = (cos_chi_Yit * cos_chi_Zit);
 		VT.y = (sin_chi_Zit);
 		VT.z = (-sin_chi_Yit * cos_chi_Zit);
-		fprintf(lvlog,"VT (set) = %f %f %f\r\n",VT.x,VT.y,VT.z);
+		TraceLog::Printf(TRACE_LVDC, "VT (set) = %f %f %f\r\n",VT.x,VT.y,VT.z);
 
 		VT = mul(MX_Gi,VT);
-		fprintf(lvlog,"VT (mul) = %f %f %f\r\n",VT.x,VT.y,VT.z);
+		TraceLog::Printf(TRACE_LVDC, "VT (mul) = %f %f %f\r\n",VT.x,VT.y,VT.z);
 
 		X_S1 = VT.x;
 		X_S2 = VT.y;
 		X_S3 = VT.z;
-		fprintf(lvlog,"X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
+		TraceLog::Printf(TRACE_LVDC, "X_S1-3 = %f %f %f\r\n",X_S1,X_S2,X_S3);
 
 		// FINALLY - COMMANDS!
 		X_Zi = asin(X_S2);			// Yaw
 		X_Yi = atan2(-X_S3,X_S1);	// Pitch
-		fprintf(lvlog,"*** COMMAND ISSUED ***\r\n");
-		fprintf(lvlog,"PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
+		TraceLog::Printf(TRACE_LVDC, "*** COMMAND ISSUED ***\r\n");
+		TraceLog::Printf(TRACE_LVDC, "PITCH = %f, YAW = %f\r\n\r\n",X_Yi*DEG,X_Zi*DEG);
 		CommandedAttitude.y = X_Yi; // PITCH
 		CommandedAttitude.z = X_Zi; // YAW;
 		ACommandedAttitude = CommandedAttitude;
@@ -6449,7 +5560,7 @@ restartprep:
 					{
 						tgt_index++;
 					}
-					fprintf(lvlog, "Target index = %d \r\n", tgt_index);
+					TraceLog::Printf(TRACE_LVDC, "Target index = %d \r\n", tgt_index);
 
 					double tdint0, tdint1;
 
@@ -6462,8 +5573,8 @@ restartprep:
 					cos_sigma = LinInter(tdint0, tdint1, TABLE15[1].target[tgt_index - 1].cos_sigma, TABLE15[1].target[tgt_index].cos_sigma, t_D);
 					e_N = LinInter(tdint0, tdint1, TABLE15[1].target[tgt_index - 1].e_N, TABLE15[1].target[tgt_index].e_N, t_D);
 
-					fprintf(lvlog, "Selected TLI Targeting Parameters (Second Opportunity): \r\n");
-					fprintf(lvlog, "RAS: %f, DEC: %f, C_3 = %f, cos_sigma = %f, e_N = %f \r\n", RAS*DEG, DEC*DEG, C_3, cos_sigma, e_N);
+					TraceLog::Printf(TRACE_LVDC, "Selected TLI Targeting Parameters (Second Opportunity): \r\n");
+					TraceLog::Printf(TRACE_LVDC, "RAS: %f, DEC: %f, C_3 = %f, cos_sigma = %f, e_N = %f \r\n", RAS*DEG, DEC*DEG, C_3, cos_sigma, e_N);
 
 					f = TABLE15[1].f*RAD;
 					beta = TABLE15[1].beta*RAD;
@@ -6482,7 +5593,7 @@ restartprep:
 					{
 						tgt_index++;
 					}
-					fprintf(lvlog, "Target index = %d \r\n", tgt_index);
+					TraceLog::Printf(TRACE_LVDC, "Target index = %d \r\n", tgt_index);
 
 					double tdint0, tdint1;
 
@@ -6495,8 +5606,8 @@ restartprep:
 					cos_sigma = LinInter(tdint0, tdint1, TABLE15[0].target[tgt_index - 1].cos_sigma, TABLE15[0].target[tgt_index].cos_sigma, t_D);
 					e_N = LinInter(tdint0, tdint1, TABLE15[0].target[tgt_index - 1].e_N, TABLE15[0].target[tgt_index].e_N, t_D);
 
-					fprintf(lvlog, "Selected TLI Targeting Parameters (First Opportunity): \r\n");
-					fprintf(lvlog, "RAS: %f, DEC: %f, C_3 = %f, cos_sigma = %f, e_N = %f \r\n", RAS*DEG, DEC*DEG, C_3, cos_sigma, e_N);
+					TraceLog::Printf(TRACE_LVDC, "Selected TLI Targeting Parameters (First Opportunity): \r\n");
+					TraceLog::Printf(TRACE_LVDC, "RAS: %f, DEC: %f, C_3 = %f, cos_sigma = %f, e_N = %f \r\n", RAS*DEG, DEC*DEG, C_3, cos_sigma, e_N);
 
 					f = TABLE15[0].f*RAD;
 					beta = TABLE15[0].beta*RAD;
@@ -6548,7 +5659,7 @@ restartprep:
 					f			True anomaly of transfer ellipse
 					*/
 
-					fprintf(lvlog, "7-parameter update: T_RP: %f, C_3: %f, Inc: %f, e: %f, alpha_D: %f, f: %f, theta_N: %f \r\n", T_RP, C_3, Inclination*DEG, e, alpha_D*DEG, f*DEG, theta_N*DEG);
+					TraceLog::Printf(TRACE_LVDC, "7-parameter update: T_RP: %f, C_3: %f, Inc: %f, e: %f, alpha_D: %f, f: %f, theta_N: %f \r\n", T_RP, C_3, Inclination*DEG, e, alpha_D*DEG, f*DEG, theta_N*DEG);
 
 					alpha_D_op = 0;
 					first_op = false;
@@ -6566,7 +5677,7 @@ restartprep:
 			
 			if (TAS - TB5 - T_ST < 0) //Sufficient time before S*T_P test?
 			{
-				fprintf(lvlog, "Time until first TB6 check = %f \r\n", TAS - TB5 - T_ST);
+				TraceLog::Printf(TRACE_LVDC, "Time until first TB6 check = %f \r\n", TAS - TB5 - T_ST);
 				goto orbitalguidance;
 			}
 
@@ -6647,7 +5758,7 @@ O3precalc:
 			alpha_D = TABLE15[1].target[tgt_index].alpha_D;
 		}
 
-		fprintf(lvlog, "Elliptic parameters: Inc: %f, e: %f, p: %f, theta_N: %f, alpha_D: %f, f: %f\r\n", Inclination*DEG, e, p, theta_N*DEG, alpha_D*DEG, f*DEG);
+		TraceLog::Printf(TRACE_LVDC, "Elliptic parameters: Inc: %f, e: %f, p: %f, theta_N: %f, alpha_D: %f, f: %f\r\n", Inclination*DEG, e, p, theta_N*DEG, alpha_D*DEG, f*DEG);
 
 	O3GMatrix:
 		MX_B = _M(cos(theta_N), 0, sin(theta_N), sin(theta_N)*sin(Inclination), cos(Inclination), -cos(theta_N)*sin(Inclination),
@@ -6659,7 +5770,7 @@ O3precalc:
 		gamma_T = atan((e*sin(f)) / (1.0 + cos(f)));
 		G_T = -mu / pow(R_T, 2);
 
-		fprintf(lvlog, "TLI Targets: R_T: %f, V_T: %f, gamma_T: %f, G_T: %f\r\n", R_T, V_T, gamma_T, G_T);
+		TraceLog::Printf(TRACE_LVDC, "TLI Targets: R_T: %f, V_T: %f, gamma_T: %f, G_T: %f\r\n", R_T, V_T, gamma_T, G_T);
 
 		//Update IGM parameters
 		Ct = 0.0;
@@ -6682,7 +5793,7 @@ O3precalc:
 		eps_4 = eps_4R;
 		tau3 = tau3R - dTt_4;
 
-		fprintf(lvlog, "Tt_3 = %f, dTt_4 = %f\r\n", Tt_3, dTt_4);
+		TraceLog::Printf(TRACE_LVDC, "Tt_3 = %f, dTt_4 = %f\r\n", Tt_3, dTt_4);
 
 		//Bypass further burn calculations
 
@@ -6697,7 +5808,7 @@ minorloop:
 			TB5 = TAS;//-simdt;
 			LVDC_Timebase = 5;
 			LVDC_TB_ETime = 0;
-			fprintf(lvlog,"SIVB CUTOFF! TAS = %f \r\n",TAS);
+			TraceLog::Printf(TRACE_LVDC, "SIVB CUTOFF! TAS = %f \r\n",TAS);
 		}
 		if (T_GO - sinceLastCycle <= 0 && HSL == true && S4B_REIGN == true) {
 			//Time for S4B cutoff? We need to check that here -IGM runs every 2 sec only, but cutoff has to be on the second			
@@ -6705,7 +5816,7 @@ minorloop:
 			TB7 = TAS;//-simdt;
 			LVDC_Timebase = 7;
 			LVDC_TB_ETime = 0;
-			fprintf(lvlog, "SIVB CUTOFF! TAS = %f \r\n", TAS);
+			TraceLog::Printf(TRACE_LVDC, "SIVB CUTOFF! TAS = %f \r\n", TAS);
 			owner->TLI_Ended();
 		}
 
@@ -6948,6 +6059,7 @@ minorloop:
 			*/
 		//	CurrentAttitude.x*DEG,CurrentAttitude.y*DEG,CurrentAttitude.z*DEG,V);								
 
+guidanceskip:
 		// Update engine indicators and failure flags
 		if(LVDC_EI_On == true){
 			double level;
@@ -7002,21 +6114,21 @@ minorloop:
 		// End of test for LVDC_Stop
 	}
 
-	if(owner->stage == LAUNCH_STAGE_ONE && owner->MissionTime < 12.5){
+	if(owner->stage == LAUNCH_STAGE_ONE && mt < 12.5){
 		// Control contrail
-		if (owner->MissionTime > 12)
+		if (mt > 12)
 			owner->contrailLevel = 0;
-		else if (owner->MissionTime > 7)
-			owner->contrailLevel = (12.0 - owner->MissionTime) / 100.0;
-		else if (owner->MissionTime > 2)
-			owner->contrailLevel = 1.38 - 0.95 / 5.0 * owner->MissionTime;
+		else if (mt > 7)
+			owner->contrailLevel = (12.0 - mt) / 100.0;
+		else if (mt > 2)
+			owner->contrailLevel = 1.38 - 0.95 / 5.0 * mt;
 		else
 			owner->contrailLevel = 1;
 	}
 
 	/* **** SATURN 5 ABORT HANDLING **** */
 	// The abort PB will be pressed during prelaunch testing, but shouldn't actually trigger an abort before Mode 1 enabled.
-	if(owner->bAbort && owner->MissionTime > -300){				
+	if(owner->bAbort && mt > -300){				
 		owner->SetEngineLevel(ENGINE_MAIN, 0);			// Kill the engines
 		owner->agc.SetInputChannelBit(030, SIVBSeperateAbort, true);	// Notify the AGC of the abort
 		owner->agc.SetInputChannelBit(030, LiftOff, true);	// and the liftoff, if it's not set already
@@ -7024,7 +6136,7 @@ minorloop:
 		LVDC_Stop = 1;									// Stop LVDC program
 		// ABORT MODE 1 - Use of LES to extract CM
 		// Allowed from T - 5 minutes until LES jettison.
-		if(owner->MissionTime > -300 && owner->LESAttached){			
+		if(mt > -300 && owner->LESAttached){			
 			owner->SetEngineLevel(ENGINE_MAIN, 0);
 			owner->SeparateStage(CM_STAGE);
 			owner->SetStage(CM_STAGE);
@@ -24,7 +24,17 @@
 
 #pragma once
 #include "LVIMU.h"
+#include "tracelog.h"
 class Saturn1b;
+class ScenarioFieldTable;
+
+///
+/// The LVDC program runs in fixed minor loop cycles instead of once per frame. Frames
+/// shorter than a cycle carry their time over; longer ones (time acceleration) run
+/// several cycles. The major loops count cycles, so they run at fixed rates too.
+///
+#define LVDC_MINOR_LOOP_PERIOD	0.04		///< 25 Hz minor loop.
+#define LVDC_MAX_MINOR_LOOPS	50			///< Most cycles per frame; beyond that the cycles are stretched.
 
 /* *******************
  * LVDC++ SV VERSION *
@@ -48,10 +58,13 @@ public:
 	double LinInter(double x0, double x1, double y0, double y1, double x);
 	LVDCTLIparam GetTLIParams();
 private:
+	void RegisterScenarioFields(ScenarioFieldTable &t);
+	void EnsureScenarioFields();
+	void Cycle(double simt, double simdt, double mt, bool sample);	// One minor loop at mission time mt; sample reads the IMU and runs guidance
+
 	Saturn* owner;									// Saturn LV
 	LVIMU lvimu;									// ST-124-M3 IMU (LV version)
 	LVRG lvrg;										// LV rate gyro package
-	FILE* lvlog;									// LV Log file
 	bool Initialized;								// Clobberness flag
 
 	int LVDC_Timebase;								// Time Base
@@ -75,6 +88,10 @@ private:
 	VECTOR3 AttRate;                                // Attitude Change Rate
 	VECTOR3 AttitudeError;                          // Attitude Error
 	VECTOR3 WV;										// Gravity
+	double minorLoopTime;							// Frame time not yet run by the minor loop
+	double guidanceTime;							// Minor loop time since guidance last ran
+	double padForce;								// Hold-down or release pin force, added every frame
+	TraceTimer cycleTimer;							// Minor loop time, for TRACE_PERF
 	double sinceLastCycle;							// Time since last IGM run
 	double sinceLastGuidanceCycle;					// Time since last guidance run during orbital flight
 	double IGMInterval;								// IGM Interval
@@ -430,8 +447,11 @@ public:
 	void SaveState(FILEHANDLE scn);
 	void LoadState(FILEHANDLE scn);
 private:
+	void RegisterScenarioFields(ScenarioFieldTable &t);
+	void EnsureScenarioFields();
+	void Cycle(double simt, double simdt, double mt, bool sample);	// One minor loop at mission time mt; sample reads the IMU and runs guidance
+
 	bool Initialized;								// Clobberness flag
-	FILE* lvlog;									// LV Log file
 	Saturn* owner;
 	LVIMU lvimu;									// ST-124-M3 IMU (LV version)
 	LVRG lvrg;										// LV rate gyro package
@@ -467,6 +487,10 @@ private:
 	double T_LET;									// LET Jettison Time
 	double dt_LET;									// Nominal interval between S2 ignition and LET jettison
 	// IGM event times
+	double minorLoopTime;							// Frame time not yet run by the minor loop
+	double guidanceTime;							// Minor loop time since guidance last ran
+	double padForce;								// Hold-down or release pin force, added every frame
+	TraceTimer cycleTimer;							// Minor loop time, for TRACE_PERF
 	double sinceLastIGM;							// Time since last IGM run
 	double IGMInterval;								// IGM Interval
 	double T_1;										// Time left in first-stage IGM
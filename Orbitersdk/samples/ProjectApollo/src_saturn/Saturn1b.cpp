@@ -49,7 +49,7 @@
 
 #include "tracer.h"
 
-char trace_file[] = "ProjectApollo Saturn1b.log";
+char trace_file[] = "ProjectApollo Saturn1b.trc";
 
 #define LOADBMP(id) (LoadBitmap (g_Param.hDLL, MAKEINTRESOURCE (id)))
 
@@ -53,7 +53,7 @@
 // Set the file name for the tracer code.
 //
 
-char trace_file[] = "ProjectApollo Saturn5.log";
+char trace_file[] = "ProjectApollo Saturn5.trc";
 
 //
 // Various bits of real global data for the DLL. Most things should be vessel
@@ -0,0 +1,78 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Iterative guidance mode stage integrals
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_IGM_H)
+#define _PA_IGM_H
+
+#include <math.h>
+
+///
+/// Thrust integrals of one IGM burn stage over its burn time T:
+///
+///   L = integral of thrust acceleration (velocity gained)
+///   J, S, Q, P, U = the first and second moments the IGM uses for range and steering.
+///
+struct IGMIntegrals
+{
+	double L, J, S, Q, P, U;
+};
+
+///
+/// Integrals of one stage burning for T seconds. V_ex is the exhaust velocity and tau the
+/// time to burn the whole vehicle mass at the current thrust (mass / mass flow).
+///
+/// This is one log() and a handful of multiplies, with no allocation, so the LVDC and the
+/// RTCC TLI prediction can both run it on every pass.
+///
+inline void IGMStageIntegrals(double V_ex, double tau, double T, IGMIntegrals &out)
+
+{
+	double T2 = T * T;
+
+	out.L = V_ex * log(tau / (tau - T));
+	out.J = (out.L * tau) - (V_ex * T);
+	out.S = (out.L * T) - out.J;
+	out.Q = (out.S * tau) - ((V_ex * T2) / 2.0);
+	out.P = (out.J * tau) - ((V_ex * T2) / 2.0);
+	out.U = (out.Q * tau) - ((V_ex * T2 * T) / 6.0);
+}
+
+///
+/// Integrals of two stages burned back to back: a for T_a seconds, then b for T_b seconds
+/// after a coast of T_c seconds.
+///
+inline void IGMCombine(const IGMIntegrals &a, double T_a, const IGMIntegrals &b, double T_b, double T_c, IGMIntegrals &out)
+
+{
+	double L = a.L + b.L;
+
+	out.J = a.J + b.J + (b.L * T_a);
+	out.S = a.S - b.J + (L * (T_b + T_c));
+	out.Q = a.Q + b.Q + (b.S * T_a) + (a.J * T_b);
+	out.P = a.P + b.P + (T_a * ((2.0 * b.J) + (b.L * T_a)));
+	out.U = a.U + b.U + (T_a * ((2.0 * b.Q) + (b.S * T_a))) + (T_b * a.P);
+	out.L = L;
+}
+
+#endif // _PA_IGM_H
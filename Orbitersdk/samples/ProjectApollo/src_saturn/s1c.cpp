@@ -31,6 +31,7 @@
 
 #include "soundlib.h"
 #include "s1c.h"
+#include "stagemesh.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -123,7 +124,6 @@ void S1C::SetS1c()
 	SetPitchMomentScale (0);
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
-    ClearMeshes();
     ClearExhaustRefs();
     ClearAttExhaustRefs();
 
@@ -522,31 +522,20 @@ void S1C::ShowS1c()
 {
 	SetEmptyMass(EmptyMass);
 
-	UINT meshidx;
-	VECTOR3 mesh_dir = _V(0,0,0);
-	if (LowRes)
-	{
-		if (hsat5stg1low)
-		{
-			meshidx = AddMesh(hsat5stg1low, &mesh_dir);
-			SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
-		}
-	}
-	else
-	{
-		if (hsat5stg1)
-		{
-			meshidx = AddMesh(hsat5stg1, &mesh_dir);
-			SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
-		}
-	}
+	//
+	// The mesh handles are per stage, so the configuration is too. Showing the
+	// stage again after loading keeps the meshes it already has.
+	//
+	StageConfig config;
+	MESHHANDLE stage = LowRes ? hsat5stg1low : hsat5stg1;
+
+	if (stage)
+		config.AddMesh(stage, _V(0, 0, 0), MESHVIS_ALWAYS);
 
 	if (S4Interstage && hS4Interstage)
-	{
-		mesh_dir = _V(0, 0, 12.35);
-		meshidx = AddMesh(hS4Interstage, &mesh_dir);
-		SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
-	}
+		config.AddMesh(hS4Interstage, _V(0, 0, 12.35), MESHVIS_ALWAYS);
+
+	config.ApplyMeshes(this);
 
 	AddEngines();
 }
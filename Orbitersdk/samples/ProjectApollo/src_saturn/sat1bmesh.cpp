@@ -45,6 +45,7 @@
 #include "saturn.h"
 
 #include "saturn1b.h"
+#include "stagemesh.h"
 
 #include "sivb.h"
 #include "s1b.h"
@@ -195,10 +196,12 @@ void Saturn1b::SetFirstStage ()
 	SetPitchMomentScale (0);
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
-	ClearMeshes();
 
-	SetFirstStageMeshes(-14.0);
-	SetSecondStageMeshes(13.95);
+	StageConfig config;
+
+	SetFirstStageMeshes(config, -14.0);
+	SetSecondStageMeshes(config, 13.95);
+	ApplyStageMeshes(config);
 
 	SetView(34.95, false);
 
@@ -212,7 +215,7 @@ void Saturn1b::SetFirstStage ()
 	InitNavRadios (4);
 }
 
-void Saturn1b::SetFirstStageMeshes(double offset)
+void Saturn1b::SetFirstStageMeshes(StageConfig &config, double offset)
 
 {
 	double TCP=-54.485-TCPO;//STG0O;
@@ -220,9 +223,9 @@ void Saturn1b::SetFirstStageMeshes(double offset)
 
 	VECTOR3 mesh_dir=_V(0,0,offset);
 
-	AddMesh (hStage1Mesh, &mesh_dir);
+	config.AddMesh (hStage1Mesh, mesh_dir);
 	mesh_dir=_V(0,0,16.2 + offset);
-	AddMesh (hInterstageMesh, &mesh_dir);
+	config.AddMesh (hInterstageMesh, mesh_dir);
 }
 
 void Saturn1b::SetFirstStageEngines()
@@ -338,25 +341,25 @@ void Saturn1b::SetSecondStage ()
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
 
-    ClearMeshes();
-	SetSecondStageMeshes(13.95-12.25);
+	StageConfig config;
+
+	SetSecondStageMeshes(config, 13.95-12.25);
+	ApplyStageMeshes(config);
 }
 
-void Saturn1b::SetSecondStageMeshes(double offset)
+void Saturn1b::SetSecondStageMeshes(StageConfig &config, double offset)
 {
-	UINT meshidx;
-
 	VECTOR3 mesh_dir=_V(0,0,offset);
-    AddMesh (hStage2Mesh, &mesh_dir);
+	config.AddMesh (hStage2Mesh, mesh_dir);
 
 	mesh_dir=_V(2.45, 0, 10.55 + offset);
-    AddMesh (hStageSLA1Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA1Mesh, mesh_dir);
 	mesh_dir=_V(0, 2.45, 10.55 + offset);
-    AddMesh (hStageSLA2Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA2Mesh, mesh_dir);
 	mesh_dir=_V(0, -2.45, 10.55 + offset);
-    AddMesh (hStageSLA3Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA3Mesh, mesh_dir);
 	mesh_dir=_V(-2.45, 0, 10.55 + offset);
-    AddMesh (hStageSLA4Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA4Mesh, mesh_dir);
 
 	probeidx = -1;
 	probeextidx = -1;
@@ -374,7 +377,7 @@ void Saturn1b::SetSecondStageMeshes(double offset)
 		// Add CSM.
 		//
 
-		AddSM(17.05 + offset, false);
+		AddSM(config, 17.05 + offset, false);
 
 		WORD CMMode = MESHVIS_VCEXTERNAL;
 
@@ -382,8 +385,7 @@ void Saturn1b::SetSecondStageMeshes(double offset)
 		{
 			TowerOffset = 26.15 + offset;
 			mesh_dir=_V(0, 0, TowerOffset);
-			meshidx = AddMesh (hsat5tower, &mesh_dir);
-			SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+			config.AddMesh (hsat5tower, mesh_dir, MESHVIS_VCEXTERNAL);
 
 			//
 			// If the LES is attached, no point drawing things in the external view which can't
@@ -394,9 +396,8 @@ void Saturn1b::SetSecondStageMeshes(double offset)
 		else if (HasProbe)
 		{
 			mesh_dir=_V(0,0,21.2 + offset);
-			probeidx = AddMesh(hprobe, &mesh_dir);
-			probeextidx = AddMesh(hprobeext, &mesh_dir);
-			SetDockingProbeMesh();
+			probeidx = config.AddMesh (hprobe, mesh_dir);
+			probeextidx = config.AddMesh (hprobeext, mesh_dir);
 		}
 
 		//
@@ -404,43 +405,37 @@ void Saturn1b::SetSecondStageMeshes(double offset)
 		// otherwise the BPC is floating above the SM.
 		//
 		mesh_dir=_V(0,0,21.2 + offset);
-		meshidx = AddMesh (hCM, &mesh_dir);
-		SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+		config.AddMesh (hCM, mesh_dir, MESHVIS_VCEXTERNAL);
 
 		//
 		// And the Crew.
 		//
 		if (Crewed) {
-			cmpidx = AddMesh (hCMP, &mesh_dir);
-			crewidx = AddMesh (hCREW, &mesh_dir);
-			SetCrewMesh();
+			cmpidx = config.AddMesh (hCMP, mesh_dir);
+			crewidx = config.AddMesh (hCREW, mesh_dir);
 		}
 
-		meshidx = AddMesh (hCMInt, &mesh_dir);
-		SetMeshVisibilityMode (meshidx, CMMode);
+		config.AddMesh (hCMInt, mesh_dir, CMMode);
 
 		//
 		// Don't Forget the Hatch
 		//
-		sidehatchidx = AddMesh (hFHC, &mesh_dir);
-		sidehatchopenidx = AddMesh (hFHO, &mesh_dir);
-		SetSideHatchMesh();
+		sidehatchidx = config.AddMesh (hFHC, mesh_dir);
+		sidehatchopenidx = config.AddMesh (hFHO, mesh_dir);
 
 		// Optics Cover
-		opticscoveridx = AddMesh (hopticscover, &mesh_dir);
-		SetOpticsCoverMesh();
+		opticscoveridx = config.AddMesh (hopticscover, mesh_dir);
 
 	} else if (NosecapAttached) {
 		//
 		// Add nosecap.
 		//
 		mesh_dir=_V(0,0,15.8 + offset);
-		nosecapidx = AddMesh (hNosecap, &mesh_dir);
-		SetNosecapMesh();
+		nosecapidx = config.AddMesh (hNosecap, mesh_dir);
 
 		//TODO: Only Apollo 5 with nosecape, but this should still be optional
 		mesh_dir = _V(0, 0, 9.8 + offset);
-		meshLM_1 = AddMesh(hlm_1, &mesh_dir);
+		meshLM_1 = config.AddMesh (hlm_1, mesh_dir);
 	}
 
 	// Dummy docking port so the auto burn feature of IMFD 4.2 is working
@@ -454,6 +449,24 @@ void Saturn1b::SetSecondStageMeshes(double offset)
     SetView(22.7, false);
 }
 
+//
+// Apply a stack configuration, keeping the meshes it shares with the
+// current one, then set up the meshes whose visibility follows the crew,
+// hatch, optics cover, probe and nosecap state.
+//
+
+void Saturn1b::ApplyStageMeshes(StageConfig &config)
+
+{
+	config.ApplyMeshes(this);
+
+	SetCrewMesh();
+	SetSideHatchMesh();
+	SetOpticsCoverMesh();
+	SetDockingProbeMesh();
+	SetNosecapMesh();
+}
+
 void Saturn1b::SetSecondStageEngines ()
 
 {
@@ -43,6 +43,7 @@
 
 #include "saturn.h"
 #include "saturnv.h"
+#include "stagemesh.h"
 #include "tracer.h"
 #include "LEM.h"
 
@@ -300,44 +301,44 @@ void SaturnV::ChangeSatVBuildState (int bstate)
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
 	SetSurfaceFrictionCoeff(10e80,10e80);
-	ClearMeshes();
+	StageConfig config;
 	VECTOR3 m_exhaust_pos1= {3,3,Offset1st};
 	VECTOR3 mesh_dir=_V(0,0,-80.0+STG0O);
 
 	if (bstate >=1)
 	{
 		mesh_dir=_V(0,0,-54.0+STG0O);
-		AddMesh (hStage1Mesh, &mesh_dir);
+		config.AddMesh (hStage1Mesh, mesh_dir);
 	}
 
 	if (bstate >=2)
 	{
 		mesh_dir=_V(0,0,-30.5+STG0O);
-		AddMesh (GetInterstageMesh(), &mesh_dir);
+		config.AddMesh (GetInterstageMesh(), mesh_dir);
 	}
 
 	if (bstate == 2)
 	{
 		mesh_dir=_V(0,0,-17.2+STG0O);
-		AddMesh (hsat5stg2base, &mesh_dir);
+		config.AddMesh (hsat5stg2base, mesh_dir);
 	}
 
 	if (bstate > 2)
 	{
 		mesh_dir=_V(0,0,-17.2+STG0O);
-		AddMesh (hStage2Mesh, &mesh_dir);
+		config.AddMesh (hStage2Mesh, mesh_dir);
 	}
 
 	if (bstate ==3 )
 	{
 		mesh_dir=_V(0,0,2.+STG0O);
-		AddMesh (hsat5stg3base, &mesh_dir);
+		config.AddMesh (hsat5stg3base, mesh_dir);
 	}
 
 	if (bstate > 3)
 	{
 		mesh_dir=_V(0,0,2.+STG0O);
-		AddMesh (hStage3Mesh, &mesh_dir);
+		config.AddMesh (hStage3Mesh, mesh_dir);
 	}
 
 	if (bstate >=4)
@@ -345,68 +346,70 @@ void SaturnV::ChangeSatVBuildState (int bstate)
 		if (LEM_DISPLAY && (SIVBPayload == PAYLOAD_LEM))
 		{
 			mesh_dir=_V(0,0,12+STG0O);
-			AddMesh (hLMPKD, &mesh_dir);
+			config.AddMesh (hLMPKD, mesh_dir);
 		}
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(-1.48,-1.48,14.55+STG0O);
-		AddMesh (hStageSLA1Mesh, &mesh_dir);
+		config.AddMesh (hStageSLA1Mesh, mesh_dir);
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(1.48,-1.48,14.55+STG0O);
-		AddMesh (hStageSLA2Mesh, &mesh_dir);
+		config.AddMesh (hStageSLA2Mesh, mesh_dir);
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(1.48,1.48,14.55+STG0O);
-		AddMesh (hStageSLA3Mesh, &mesh_dir);
+		config.AddMesh (hStageSLA3Mesh, mesh_dir);
 	}
 
 	if (bstate >=4){
 		mesh_dir=_V(-1.48,1.48,14.55+STG0O);
-		AddMesh (hStageSLA4Mesh, &mesh_dir);
+		config.AddMesh (hStageSLA4Mesh, mesh_dir);
 	}
 
 	if (bstate >=4)
 	{
-		AddSM(19.1+STG0O, false);
+		AddSM(config, 19.1+STG0O, false);
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(0,0,23.25+STG0O);
-		AddMesh (hCM, &mesh_dir);
+		config.AddMesh (hCM, mesh_dir);
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(0,0,23.25+STG0O);
-		AddMesh (hCMInt, &mesh_dir);
+		config.AddMesh (hCMInt, mesh_dir);
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(0,0,23.25+STG0O);
-		AddMesh (hFHC, &mesh_dir);
+		config.AddMesh (hFHC, mesh_dir);
 	}
 
 	if (bstate >=4)
 	{
 		mesh_dir=_V(0,0,23.25+STG0O);
-		AddMesh (hprobe, &mesh_dir);
+		config.AddMesh (hprobe, mesh_dir);
 	}
 
 	if (bstate >=5)
 	{
 		mesh_dir=_V(0,0,28.2+STG0O);
-		AddMesh (hsat5tower, &mesh_dir);
+		config.AddMesh (hsat5tower, mesh_dir);
 	}
 
+	config.ApplyMeshes(this);
+
 	Offset1st = -60.1+STG0O;
 	SetCameraOffset (_V(-1,1.0,23.1+STG0O));
 
@@ -440,27 +443,26 @@ void SaturnV::SetFirstStage ()
 	// ************************ visual parameters **********************************
 	//
 
-	ClearMeshes();
-	UINT meshidx;
+	StageConfig config;
 	double TCP=-101.5+STG0O-TCPO;
 	SetTouchdownPoints (_V(0,-100.0,TCP), _V(-7,7,TCP), _V(7,7,TCP));
 
 	VECTOR3 mesh_dir=_V(0,0,-54.0+STG0O);
-	meshidx = AddMesh (hStage1Mesh, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
+	config.AddMesh (hStage1Mesh, mesh_dir, MESHVIS_ALWAYS);
 
 	if (SaturnType == SAT_INT20)
 	{
 		mesh_dir = _V(0, 0, 12.35-54.0+STG0O);
-		meshidx = AddMesh (hsat5stg2interstage, &mesh_dir);
-		SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
-		SetThirdStageMesh(STG0O - 24.5);
+		config.AddMesh (hsat5stg2interstage, mesh_dir, MESHVIS_ALWAYS);
+		SetThirdStageMesh(config, STG0O - 24.5);
 	}
 	else
 	{
-		SetSecondStageMesh(STG0O);
+		SetSecondStageMesh(config, STG0O);
 	}
 
+	ApplyStageMeshes(config);
+
 	buildstatus = 6;
 
 	EnableTransponder (true);
@@ -546,8 +548,6 @@ void SaturnV::SetSecondStage ()
 {
 	TRACESETUP("SetSecondStage");
 
-	ClearMeshes();
-
 	double EmptyMass = Stage2Mass - (InterstageAttached ? 0.0 : Interstage_Mass) - (LESAttached ? 0.0 : Abort_Mass);
 
 	SetSize (35.5);
@@ -561,29 +561,29 @@ void SaturnV::SetSecondStage ()
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
 
-	SetSecondStageMesh(-STG1O);
+	StageConfig config;
+
+	SetSecondStageMesh(config, -STG1O);
+	ApplyStageMeshes(config);
 
 	SIISepState = InterstageAttached;
 }
 
-void SaturnV::SetSecondStageMesh(double offset)
+void SaturnV::SetSecondStageMesh(StageConfig &config, double offset)
 
 {
 	VECTOR3 mesh_dir;
-	UINT meshidx;
 
 	if (InterstageAttached)
 	{
 		mesh_dir=_V(0,0,-30.5 + offset);
-		meshidx = AddMesh (GetInterstageMesh(), &mesh_dir);
-		SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
+		config.AddMesh (GetInterstageMesh(), mesh_dir, MESHVIS_ALWAYS);
 	}
 
 	mesh_dir=_V(0,0,-17.2 + offset);
-	meshidx = AddMesh (hStage2Mesh, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_ALWAYS);
+	config.AddMesh (hStage2Mesh, mesh_dir, MESHVIS_ALWAYS);
 
-	SetThirdStageMesh(offset);
+	SetThirdStageMesh(config, offset);
 }
 
 void SaturnV::SetSecondStageEngines(double offset)
@@ -704,7 +704,6 @@ void SaturnV::SetSecondStageEngines(double offset)
 void SaturnV::SetThirdStage ()
 
 {
-	ClearMeshes();
 	TRACESETUP("SetThirdStage");
 
 	SetSize (15.5);
@@ -724,62 +723,58 @@ void SaturnV::SetThirdStage ()
 
 	ClearSIISep();
 
-	SetThirdStageMesh(-STG2O);
+	StageConfig config;
+
+	SetThirdStageMesh(config, -STG2O);
+	ApplyStageMeshes(config);
 }
 
-void SaturnV::SetThirdStageMesh (double offset)
+void SaturnV::SetThirdStageMesh (StageConfig &config, double offset)
 {
 	S4Offset = 2.0 + offset;
 
 	VECTOR3 mesh_dir=_V(0, 0, S4Offset);
 
-	AddMesh (hStage3Mesh, &mesh_dir);
+	config.AddMesh (hStage3Mesh, mesh_dir);
 	if (LEM_DISPLAY && (SIVBPayload == PAYLOAD_LEM)){
 		mesh_dir=_V(0,0,12 + offset);
-		AddMesh (hLMPKD, &mesh_dir);
+		config.AddMesh (hLMPKD, mesh_dir);
 	}
 
 	mesh_dir=_V(-1.48,-1.48,14.55 + offset);
-	AddMesh (hStageSLA1Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA1Mesh, mesh_dir);
 	mesh_dir=_V(1.48,-1.48,14.55 + offset);
-	AddMesh (hStageSLA2Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA2Mesh, mesh_dir);
 	mesh_dir=_V(1.48,1.48,14.55 + offset);
-    AddMesh (hStageSLA3Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA3Mesh, mesh_dir);
 	mesh_dir=_V(-1.48,1.48,14.55 + offset);
-    AddMesh (hStageSLA4Mesh, &mesh_dir);
+	config.AddMesh (hStageSLA4Mesh, mesh_dir);
 
-	AddSM(19.1 + offset, false);
+	AddSM(config, 19.1 + offset, false);
 
 	mesh_dir=_V(0, 0, 23.25 + offset);
 
-	UINT meshidx;
-	meshidx = AddMesh (hCM, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+	config.AddMesh (hCM, mesh_dir, MESHVIS_VCEXTERNAL);
 
 	// And the Crew
 	if (Crewed) {
-		cmpidx = AddMesh (hCMP, &mesh_dir);
-		crewidx = AddMesh (hCREW, &mesh_dir);
-		SetCrewMesh();
+		cmpidx = config.AddMesh (hCMP, mesh_dir);
+		crewidx = config.AddMesh (hCREW, mesh_dir);
 	} else {
 		cmpidx = -1;
 		crewidx = -1;
 	}
 
-	meshidx = AddMesh (hCMInt, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_EXTERNAL);
+	config.AddMesh (hCMInt, mesh_dir, MESHVIS_EXTERNAL);
 
-	meshidx = AddMesh (hCMVC, &mesh_dir);
-	SetMeshVisibilityMode (meshidx, MESHVIS_VC);
+	config.AddMesh (hCMVC, mesh_dir, MESHVIS_VC);
 	VCMeshOffset = mesh_dir;
 
-	sidehatchidx = AddMesh (hFHC, &mesh_dir);
-	sidehatchopenidx = AddMesh (hFHO, &mesh_dir);
-	SetSideHatchMesh();
+	sidehatchidx = config.AddMesh (hFHC, mesh_dir);
+	sidehatchopenidx = config.AddMesh (hFHO, mesh_dir);
 
 	// Optics Cover
-	opticscoveridx = AddMesh (hopticscover, &mesh_dir);
-	SetOpticsCoverMesh();
+	opticscoveridx = config.AddMesh (hopticscover, mesh_dir);
 
 	probeidx = -1;
 	probeextidx = -1;
@@ -788,14 +783,12 @@ void SaturnV::SetThirdStageMesh (double offset)
 	{
 		TowerOffset = 28.2 + offset;
 		mesh_dir=_V(0, 0, TowerOffset);
-		meshidx = AddMesh (hsat5tower, &mesh_dir);
-		SetMeshVisibilityMode (meshidx, MESHVIS_VCEXTERNAL);
+		config.AddMesh (hsat5tower, mesh_dir, MESHVIS_VCEXTERNAL);
 	}
 	else {
 		if (HasProbe) {
-			probeidx = AddMesh(hprobe, &mesh_dir);
-			probeextidx = AddMesh(hprobeext, &mesh_dir);
-			SetDockingProbeMesh();
+			probeidx = config.AddMesh (hprobe, mesh_dir);
+			probeextidx = config.AddMesh (hprobeext, mesh_dir);
 		}
 	}
 
@@ -808,6 +801,23 @@ void SaturnV::SetThirdStageMesh (double offset)
 	SetView(23.1 + offset, false);
 }
 
+//
+// Apply a stack configuration, keeping the meshes it shares with the
+// current one, then set up the CM meshes whose visibility follows the
+// crew, hatch, optics cover and probe state.
+//
+
+void SaturnV::ApplyStageMeshes (StageConfig &config)
+
+{
+	config.ApplyMeshes(this);
+
+	SetCrewMesh();
+	SetSideHatchMesh();
+	SetOpticsCoverMesh();
+	SetDockingProbeMesh();
+}
+
 void SaturnV::SetThirdStageEngines (double offset)
 {
 	DelThrusterGroup(THGROUP_MAIN, true);
@@ -86,11 +86,12 @@ protected:
 	void AttitudeLaunch4();
 	void AutoPilot(double autoT);
 	void SetFirstStage ();
-	void SetFirstStageMeshes(double offset);
+	void SetFirstStageMeshes(StageConfig &config, double offset);
 	void SetFirstStageEngines ();
 	void SetSecondStage ();
-	void SetSecondStageMeshes(double offset);
+	void SetSecondStageMeshes(StageConfig &config, double offset);
 	void SetSecondStageEngines ();
+	void ApplyStageMeshes(StageConfig &config);
 
 	void ConfigureStageMeshes(int stage_state);
 	void ConfigureStageEngines(int stage_state);
@@ -93,11 +93,12 @@ private:
 	void SetFirstStage ();
 	void SetFirstStageEngines ();
 	void SetSecondStage ();
-	void SetSecondStageMesh (double offset);
+	void SetSecondStageMesh (StageConfig &config, double offset);
 	void SetSecondStageEngines (double offset);
 	void SetThirdStage ();
-	void SetThirdStageMesh (double offset);
+	void SetThirdStageMesh (StageConfig &config, double offset);
 	void SetThirdStageEngines (double offset);
+	void ApplyStageMeshes (StageConfig &config);
 	MESHHANDLE GetInterstageMesh();
 	void AttitudeLaunch1();
 	void AttitudeLaunch2();
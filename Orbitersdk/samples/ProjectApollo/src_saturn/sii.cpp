@@ -28,6 +28,7 @@
 
 #include "nasspdefs.h"
 #include "sii.h"
+#include "stagemesh.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -103,32 +104,31 @@ void SII::InitSII()
 void SII::SetSII()
 
 {
-	ClearMeshes();
-	VECTOR3 mesh_dir=_V(0,0,0);
-
 	double mass = EmptyMass;
 
+	//
+	// Both variants are built once and shared by every SII. Applying one
+	// keeps the stage mesh if it's already there.
+	//
+	StageConfig &config = StageConfigRegistry::Get(LowRes ? "SII/LowRes" : "SII");
+	if (config.IsEmpty())
+	{
+		config.AddMesh(LowRes ? hsat5stg2low : hsat5stg2, _V(0, 0, 0));
+		config.SetFigures(10, _V(374, 374, 97), _V(524, 524, 97), 2.0);
+	}
+
 	ClearThrusterDefinitions();
 	
-	SetSize (10);
-	SetPMI (_V(374, 374, 97));
-	SetCOG_elev (2.0);
-	SetCrossSections (_V(524, 524, 97));
+	config.ApplyFigures(this);
 	SetCW (0.5, 1.1, 2, 2.4);
 	SetRotDrag (_V(2,2,2));
 	SetPitchMomentScale (0);
 	SetBankMomentScale (0);
 	SetLiftCoeffFunc (0);
-    ClearMeshes();
     ClearExhaustRefs();
     ClearAttExhaustRefs();
 
-	if (LowRes) {
-		AddMesh (hsat5stg2low, &mesh_dir);
-	}
-	else {
-		AddMesh (hsat5stg2, &mesh_dir);
-	}
+	config.ApplyMeshes(this);
 
 	SetEmptyMass (mass);
 
@@ -444,11 +444,7 @@ DLLCLBK void ovcExit (VESSEL *vessel)
 
 	if (!refcount)
 	{
-
-		//
-		// This code could tidy up allocations when refcount == 0
-		//
-
+		StageConfigRegistry::Clear();
 	}
 
 	if (vessel) 
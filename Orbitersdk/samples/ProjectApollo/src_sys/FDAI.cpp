@@ -55,115 +55,76 @@ FDAI::FDAI() {
 	DCSource = NULL;
 	ACSource = NULL;
 	noAC = false;
+
+	ballValid = false;
+	ballBits = NULL;
+	hDC2 = 0;
+	hBMP = 0;
+	hBMP_old = 0;
 }
 
-void FDAI::InitGL() {
+//
+// One worker thread renders the balls of all FDAIs.
+//
+
+static JobScheduler *ballJobs = NULL;
+static int ballJobUsers = 0;
+
+void FDAI::InitBall() {
 
-	GLuint      PixelFormat;
 	BITMAPINFOHEADER BIH;
-	int iSize = sizeof(BITMAPINFOHEADER);
-	BIH.biSize = iSize;
-	BIH.biWidth = 180;				//size of the sphere is 180x180
-	BIH.biHeight = 180;
+	memset(&BIH, 0, sizeof(BIH));
+	BIH.biSize = sizeof(BITMAPINFOHEADER);
+	BIH.biWidth = FDAIBALL_SIZE;
+	BIH.biHeight = -FDAIBALL_SIZE;	// top row first, like FDAIBall renders
 	BIH.biPlanes = 1;
-	BIH.biBitCount = 16;//default is 16.
+	BIH.biBitCount = 32;
 	BIH.biCompression = BI_RGB;
-	BIH.biSizeImage = 0;
-	void* m_pBits;
-	hDC2 = CreateCompatibleDC(NULL);//we make a new DC and DIbitmap for OpenGL to draw onto
-	static  PIXELFORMATDESCRIPTOR pfd2;
-	DescribePixelFormat(hDC2, 1, sizeof(PIXELFORMATDESCRIPTOR), &pfd2);//just get a random pixel format.. 
-	BIH.biBitCount = pfd2.cColorBits;//to get the current bit depth.. !?
-	hBMP = CreateDIBSection(hDC2, (BITMAPINFO*)&BIH, DIB_RGB_COLORS, &m_pBits, NULL, 0);
+
+	void *bits = NULL;
+	hDC2 = CreateCompatibleDC(NULL);//we make a new DC and DIbitmap to render the ball into
+	hBMP = CreateDIBSection(hDC2, (BITMAPINFO*)&BIH, DIB_RGB_COLORS, &bits, NULL, 0);
 	hBMP_old = (HBITMAP)SelectObject(hDC2, hBMP);
-	static  PIXELFORMATDESCRIPTOR pfd = {                             // pfd Tells Windows How We Want Things To Be
-		sizeof(PIXELFORMATDESCRIPTOR),                              // Size Of This Pixel Format Descriptor
-		1,                                                          // Version Number
-		PFD_DRAW_TO_BITMAP |                                        // Format Must Support Bitmap Rendering
-		PFD_SUPPORT_OPENGL |
-		PFD_SUPPORT_GDI,											// Format Must Support OpenGL,                                           
-		0,//        PFD_TYPE_RGBA,                                              // Request An RGBA Format
-		16,															// Select Our Color Depth
-		0, 0, 0, 0, 0, 0,                                           // Color Bits Ignored
-		0,//1,                                                          // No Alpha Buffer
-		0,                                                          // Shift Bit Ignored
-		0,                                                          // No Accumulation Buffer
-		0, 0, 0, 0,                                                 // Accumulation Bits Ignored
-		0,//16,                                                         // 16Bit Z-Buffer (Depth Buffer)  
-		0,                                                          // No Stencil Buffer
-		0,                                                          // No Auxiliary Buffer
-		0,//PFD_MAIN_PLANE,                                             // Main Drawing Layer
-		0,                                                          // Reserved
-		0, 0, 0                                                     // Layer Masks Ignored
-	};
-	pfd.cColorBits = pfd2.cColorBits;//same color depth needed.
-	DWORD code;
-	code = GetLastError();
-	PixelFormat = ChoosePixelFormat(hDC2, &pfd);// now pretend we want a new format
-	int ret;
-	ret = SetPixelFormat(hDC2, PixelFormat, &pfd);
-	code = GetLastError();
-	hRC = wglCreateContext(hDC2);
-	ret = wglMakeCurrent(hDC2, hRC);				//all standard OpenGL init so far
+	ballBits = (unsigned int *)bits;
+	if (ballBits)
+		memset(ballBits, 0, FDAIBALL_SIZE * FDAIBALL_SIZE * sizeof(unsigned int));
 
 	//We load the texture
-	int texture_index;
 	if (LM_FDAI)
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
+		ball.LoadTexture("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
 	}
 	else
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball.dds");
+		ball.LoadTexture("Textures\\ProjectApollo\\FDAI_Ball.dds");
 	}
-	if (texture_index > 0) glEnable(GL_TEXTURE_2D);
-
-	glShadeModel(GL_SMOOTH);                        // Enable Smooth Shading
-	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);           // Panel Background color
-	glClearDepth(1.0f);                             // Depth Buffer Setup
-	glEnable(GL_DEPTH_TEST);                        // Enables Depth Testing
-	glDepthFunc(GL_LESS);                           // The Type Of Depth Testing To Do
-	glViewport(0, 0, 180, 180);                     // Reset The Current Viewport
-	glMatrixMode(GL_PROJECTION);                    // Select The Projection Matrix
-	glLoadIdentity();                               // Reset The Projection Matrix
-	gluPerspective(45.0f, 1.0, 1.0f, 1000.0f);
-	glMatrixMode(GL_MODELVIEW);                     // Select The Modelview Matrix          
-	glLoadIdentity();                               // Reset The Projection Matrix
-
-	//some ambiental setup
-	GLfloat light_position[] = { -10.0,10.0,10.0,0.0 };
-	GLfloat light_diffuse[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat light_ambient[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat mat_specular[] = { (float) 0.5, (float) 0.5, (float) 0.5, 1.0 };
-	GLfloat mat_shin[] = { 5.0 };
-	glMaterialfv(GL_FRONT, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHTING);
-	glLightfv(GL_LIGHT0, GL_DIFFUSE, light_diffuse);
-	glLightfv(GL_LIGHT0, GL_POSITION, light_position);
-	glLightfv(GL_LIGHT0, GL_AMBIENT, light_ambient);
-	glLightfv(GL_LIGHT0, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHT0);
-
-	//defining our geometry and composing a display list;
-	list_name = glGenLists(1);
-	glNewList(list_name, GL_COMPILE);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);             // Clear The Screen And The Depth Buffer        
-	glColor3f(1.0, 1.0, 1.0);
-	quadObj = gluNewQuadric();
-	gluQuadricTexture(quadObj, GL_TRUE);
-	gluSphere(quadObj, 12, 24, 24);
-	glEndList();
-
-	init = 1;		//that's it. If we made it so far, we can use OpenGL
+
+	ballBuffer.resize(FDAIBALL_SIZE * FDAIBALL_SIZE);
+	ballValid = false;
+
+	if (ballJobUsers++ == 0)
+		ballJobs = new JobScheduler(1);
+
+	init = 1;
 }
 
 FDAI::~FDAI() {
 
 	if (init) {
-		gluDeleteQuadric(quadObj);
-		wglMakeCurrent(NULL, NULL);	//standard OpenGL release
-		BOOL ret = wglDeleteContext(hRC);
-		hRC = NULL;
+		//
+		// The render job writes into this object, so it has to be finished.
+		//
+		if (ballJob) {
+			ballJob->Cancel();
+			ballJob->GetFuture().wait();
+			ballJob.reset();
+		}
+
+		if (--ballJobUsers == 0) {
+			delete ballJobs;
+			ballJobs = NULL;
+		}
+
 		SelectObject(hDC2, hBMP_old);//remember to delete DC and bitmap memory we created
 		DeleteObject(hBMP);
 		DeleteDC(hDC2);
@@ -267,37 +228,77 @@ void FDAI::MoveBall() {
 		else
 			now.x += delta;
 	}
+}
+
+void FDAI::UpdateBall() {
+
+	//
+	// Pick up the last render if it's finished.
+	//
+	if (ballJob) {
+		if (!ballJob->IsDone())
+			return;
+
+		if (ballJob->GetStatus() == JOB_DONE && ballBits) {
+			GdiFlush();
+			memcpy(ballBits, &ballBuffer[0], FDAIBALL_SIZE * FDAIBALL_SIZE * sizeof(unsigned int));
+		}
+		else {
+			ballValid = false;
+		}
+		ballJob.reset();
+	}
 
-	glLoadIdentity();
-	gluLookAt(0.0, -35.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+	int att[3];
+	att[0] = (int)floor(now.y / FDAI_BALL_STEP + 0.5);	//attitude.x
+	att[1] = (int)floor(now.z / FDAI_BALL_STEP + 0.5);	//attitude.y
+	att[2] = (int)floor(now.x / FDAI_BALL_STEP + 0.5);	//attitude.z
 
-	glRotatef(90.0, 0.0, 1.0, 0.0);
+	if (ballValid && att[0] == ballAttitude[0] && att[1] == ballAttitude[1] && att[2] == ballAttitude[2])
+		return;
+
+	double roll = now.y, pitch = now.z, yaw = now.x;
 
-	glRotated(now.y / PI * 180.0, 0.0, 1.0, 0.0);	//attitude.x
-	glRotated(now.x / PI * 180.0, 1.0, 0.0, 0.0);	//attitude.z
-	glRotated(now.z / PI * 180.0, 0.0, 0.0, 1.0);	//attitude.y
+	//
+	// The first picture is rendered right away, so we don't show an empty ball.
+	//
+	if (!ballValid || !ballJobs) {
+		if (ballBits) {
+			GdiFlush();
+			ball.Render(roll, pitch, yaw, ballBits);
+		}
+	}
+	else {
+		ballJob = ballJobs->Submit(0, JOB_PRIORITY_NORMAL, [this, roll, pitch, yaw](JobState &job) {
+			ball.Render(roll, pitch, yaw, &ballBuffer[0]);
+			return 0;
+		});
+	}
+
+	ballAttitude[0] = att[0];
+	ballAttitude[1] = att[1];
+	ballAttitude[2] = att[2];
+	ballValid = true;
 }
 
 void FDAI::PaintMe(VECTOR3 attitude, int no_att, VECTOR3 rates, VECTOR3 errors, int ratescale, SURFHANDLE surf, SURFHANDLE hFDAI,
 	SURFHANDLE hFDAIRoll, SURFHANDLE hFDAIOff, SURFHANDLE hFDAINeedles, HBITMAP hBmpRoll, int smooth) {
 
-	if (!init) InitGL();
+	if (!init) InitBall();
 
 	SetAttitude(attitude);
 
-	// Don't do the OpenGL calculations every timestep
+	// Don't move the ball every timestep
 	if (smooth || lastPaintTime == -1 || ((length(now - target) > 0.005 || oapiGetSysTime() > lastPaintTime + 2.0) && oapiGetSysTime() > lastPaintTime + 0.1)) {
-		int ret = wglMakeCurrent(hDC2, hRC);
 		MoveBall();
-		glCallList(list_name);	//render
-		glFlush();
-		glFinish();
 
 		lastPaintTime = oapiGetSysTime();
 	}
 
+	UpdateBall();
+
 	HDC hDC = oapiGetDC(surf);
-	BitBlt(hDC, 43, 43, 150, 150, hDC2, 10, 10, SRCCOPY);//then we bitblt onto the panel.
+	BitBlt(hDC, 43, 43, FDAIBALL_SIZE, FDAIBALL_SIZE, hDC2, 0, 0, SRCCOPY);//then we bitblt onto the panel.
 
 	// roll indicator
 	HDC hDCRotate;
@@ -482,52 +483,6 @@ void FDAI::SystemTimestep(double simdt) {
 	}
 }
 
-int FDAI::LoadOGLBitmap(char *filename) {
-
-	unsigned char *l_texture;
-	int l_index, l_index2 = 0;
-	FILE *file;
-	BITMAPFILEHEADER fileheader;
-	BITMAPINFOHEADER infoheader;
-	RGBTRIPLE rgb;
-	int num_texture = 1; //we only use one OGL texture ,so...
-
-
-	if ((file = fopen(filename, "rb")) == NULL) return (-1);
-	fread(&fileheader, sizeof(fileheader), 1, file);
-	fseek(file, sizeof(fileheader), SEEK_SET);
-	fread(&infoheader, sizeof(infoheader), 1, file);
-
-	l_texture = (byte *)malloc(infoheader.biWidth * infoheader.biHeight * 4);
-	memset(l_texture, 0, infoheader.biWidth * infoheader.biHeight * 4);
-
-	for (l_index = 0; l_index < infoheader.biWidth*infoheader.biHeight; l_index++)
-	{
-		fread(&rgb, sizeof(rgb), 1, file);
-
-		l_texture[l_index2 + 0] = rgb.rgbtRed; // Red component
-		l_texture[l_index2 + 1] = rgb.rgbtGreen; // Green component
-		l_texture[l_index2 + 2] = rgb.rgbtBlue; // Blue component
-		l_texture[l_index2 + 3] = 255; // Alpha value
-		l_index2 += 4; // Go to the next position
-	}
-
-	fclose(file); // Closes the file stream
-
-	glBindTexture(GL_TEXTURE_2D, num_texture);
-
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	//glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-	glTexImage2D(GL_TEXTURE_2D, 0, 4, infoheader.biWidth, infoheader.biHeight,
-		0, GL_RGBA, GL_UNSIGNED_BYTE, l_texture);
-	free(l_texture);
-
-	return (num_texture);
-}
-
 void DrawTransparentBitmap(HDC hdc, HBITMAP hBitmap, short xStart,
 	short yStart, COLORREF cTransparentColor) {
 
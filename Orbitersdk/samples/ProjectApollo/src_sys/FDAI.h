@@ -25,8 +25,8 @@
 /// \bug Avoids bug in VC++
 #pragma once
 
-#include < GL\gl.h >                                
-#include < GL\glu.h >
+#include "FDAIBall.h"
+#include "jobscheduler.h"
 
 class FDAI {
 
@@ -53,27 +53,37 @@ protected:
 	int ScrY;			//coords on screen
 	int idx;			//index on the panel list 
 	int init;
-	int list_name; //we store the rendering into a display list
 	VECTOR3 now, target, lastRates, lastErrors;
 	double lastPaintTime;
 	bool newRegistered;
 
-	//some stuff for OpenGL
+	//
+	// The ball is rendered on a worker thread into ballBuffer, then copied into
+	// the bitmap we blit from. It's only rendered again when the attitude has
+	// changed by more than FDAI_BALL_STEP since the last render.
+	//
+	FDAIBall ball;
+	std::vector<unsigned int> ballBuffer;
+	JobHandle ballJob;
+	bool ballValid;
+	int ballAttitude[3];
+
 	HDC hDC2;
-	HGLRC hRC;
 	HBITMAP hBMP;
 	HBITMAP hBMP_old;
-	GLUquadricObj *quadObj;
+	unsigned int *ballBits;
 
 	e_object *DCSource, *ACSource;
 	bool noAC;
 
-	void InitGL();
+	void InitBall();
+	void UpdateBall();
 	void MoveBall();
 	void SetAttitude(VECTOR3 attitude);
-	int LoadOGLBitmap(char *filename);
 };
 
+#define FDAI_BALL_STEP	(0.25 * RAD)	///< Attitude resolution of the ball, well below a pixel.
+
 //
 // Strings for state saving.
 //
@@ -0,0 +1,341 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Software renderer for the 2D panel FDAI ball
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1300) //Microsoft Visual Studio Version 2003 and higher
+#define _CRT_SECURE_NO_DEPRECATE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "FDAIBall.h"
+
+//
+// The scene the OpenGL FDAI used: a radius 12 sphere 35 units in front of the
+// eye, a 45 degree field of view over a 180x180 viewport, and one white
+// directional light. The panel showed the FDAIBALL_SIZE pixels from 10,10 in
+// window coordinates, so the ball centre is at 80,80 in the image.
+//
+
+#define BALL_VIEWPORT	180
+#define BALL_BORDER		10
+#define BALL_RADIUS		12.0
+#define BALL_DISTANCE	35.0
+#define BALL_FOV		45.0
+
+static const double BallPi = 3.14159265358979323846;
+
+///
+/// One pixel covered by the ball.
+///
+struct FDAIBallPixel
+{
+	int index;			///< Offset in the output image.
+	float x, y, z;		///< Sphere normal before the ball rotations.
+	unsigned int shade;	///< Lighting, 256 is full brightness.
+};
+
+///
+/// The ray cast, done once for all FDAIs.
+///
+struct FDAIBallTable
+{
+	FDAIBallTable();
+	std::vector<FDAIBallPixel> pixels;
+};
+
+FDAIBallTable::FDAIBallTable()
+
+{
+	const double tanHalfFov = tan(BALL_FOV * BallPi / 360.0);
+
+	//
+	// OpenGL fixed function lighting with the default material: global and
+	// light ambient (0.2 + 1.0) * 0.2, diffuse 0.8, and specular 0.5 * 0.5 with
+	// shininess 5. The light is at (-10, 10, 10) in eye space, the viewer at
+	// infinity.
+	//
+	double l[3] = { -1.0, 1.0, 1.0 };
+	double ll = sqrt(l[0] * l[0] + l[1] * l[1] + l[2] * l[2]);
+	l[0] /= ll; l[1] /= ll; l[2] /= ll;
+
+	double h[3] = { l[0], l[1], l[2] + 1.0 };
+	double hl = sqrt(h[0] * h[0] + h[1] * h[1] + h[2] * h[2]);
+	h[0] /= hl; h[1] /= hl; h[2] /= hl;
+
+	for (int row = 0; row < FDAIBALL_SIZE; row++)
+	{
+		for (int col = 0; col < FDAIBALL_SIZE; col++)
+		{
+			//
+			// Eye space ray through the pixel centre. The image is top row first,
+			// the viewport bottom row first.
+			//
+			double vx = (BALL_BORDER + col + 0.5) / (BALL_VIEWPORT / 2.0) - 1.0;
+			double vy = (BALL_VIEWPORT - 1 - BALL_BORDER - row + 0.5) / (BALL_VIEWPORT / 2.0) - 1.0;
+			double d[3] = { vx * tanHalfFov, vy * tanHalfFov, -1.0 };
+
+			double a = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+			double b = BALL_DISTANCE;
+			double c = BALL_DISTANCE * BALL_DISTANCE - BALL_RADIUS * BALL_RADIUS;
+			double disc = b * b - a * c;
+
+			if (disc < 0.0)
+				continue;
+
+			double t = (b - sqrt(disc)) / a;
+			double n[3] = { t * d[0] / BALL_RADIUS, t * d[1] / BALL_RADIUS, (t * d[2] + BALL_DISTANCE) / BALL_RADIUS };
+
+			double ndotl = n[0] * l[0] + n[1] * l[1] + n[2] * l[2];
+			double light = 0.24;
+
+			if (ndotl > 0.0)
+			{
+				double ndoth = n[0] * h[0] + n[1] * h[1] + n[2] * h[2];
+
+				light += 0.8 * ndotl;
+				if (ndoth > 0.0)
+					light += 0.25 * pow(ndoth, 5.0);
+			}
+			if (light > 1.0)
+				light = 1.0;
+
+			//
+			// The camera looks along +y with +z up, so eye (x, y, z) is (x, -z, y)
+			// in the frame the ball rotations apply to.
+			//
+			FDAIBallPixel p;
+
+			p.index = row * FDAIBALL_SIZE + col;
+			p.x = (float)n[0];
+			p.y = (float)-n[2];
+			p.z = (float)n[1];
+			p.shade = (unsigned int)(light * 256.0 + 0.5);
+
+			pixels.push_back(p);
+		}
+	}
+}
+
+static const FDAIBallTable &GetBallTable()
+
+{
+	static const FDAIBallTable table;
+	return table;
+}
+
+FDAIBall::FDAIBall()
+
+{
+	texWidth = 0;
+	texHeight = 0;
+
+	//
+	// Build the table now, rather than on whatever thread renders first.
+	//
+	GetBallTable();
+}
+
+static unsigned int ReadLE(const unsigned char *p, int bytes)
+
+{
+	unsigned int v = 0;
+
+	for (int i = bytes - 1; i >= 0; i--)
+		v = (v << 8) | p[i];
+
+	return v;
+}
+
+bool FDAIBall::LoadTexture(const char *filename)
+
+{
+	texture.clear();
+	texWidth = 0;
+	texHeight = 0;
+
+	FILE *fp = fopen(filename, "rb");
+	if (!fp)
+		return false;
+
+	unsigned char header[54];
+
+	if (fread(header, 1, sizeof(header), fp) != sizeof(header) || header[0] != 'B' || header[1] != 'M')
+	{
+		fclose(fp);
+		return false;
+	}
+
+	unsigned int offset = ReadLE(header + 10, 4);
+	int width = (int)ReadLE(header + 18, 4);
+	int height = (int)ReadLE(header + 22, 4);
+	int bpp = (int)ReadLE(header + 28, 2);
+	unsigned int compression = ReadLE(header + 30, 4);
+
+	bool topDown = (height < 0);
+	if (topDown)
+		height = -height;
+
+	if (width <= 0 || height <= 0 || (bpp != 24 && bpp != 32) || compression != 0 || fseek(fp, offset, SEEK_SET))
+	{
+		fclose(fp);
+		return false;
+	}
+
+	int bytes = bpp / 8;
+	std::vector<unsigned char> line(((width * bytes) + 3) & ~3);
+
+	texture.resize(width * height);
+
+	for (int row = 0; row < height; row++)
+	{
+		if (fread(&line[0], 1, line.size(), fp) != line.size())
+		{
+			texture.clear();
+			fclose(fp);
+			return false;
+		}
+
+		unsigned int *dst = &texture[(topDown ? height - 1 - row : row) * width];
+		for (int col = 0; col < width; col++)
+		{
+			const unsigned char *src = &line[col * bytes];
+			dst[col] = (src[2] << 16) | (src[1] << 8) | src[0];
+		}
+	}
+
+	fclose(fp);
+
+	texWidth = width;
+	texHeight = height;
+	return true;
+}
+
+//
+// Channel arithmetic on packed 0x00RRGGBB pixels: red and blue are done together
+// in one word and green in another, with weights from 0 to 256.
+//
+
+static inline unsigned int BlendPixels(unsigned int a, unsigned int b, unsigned int w)
+
+{
+	unsigned int rb = ((((a & 0xFF00FF) * (256 - w)) + ((b & 0xFF00FF) * w)) >> 8) & 0xFF00FF;
+	unsigned int g = ((((a & 0x00FF00) * (256 - w)) + ((b & 0x00FF00) * w)) >> 8) & 0x00FF00;
+
+	return rb | g;
+}
+
+static inline unsigned int ScalePixel(unsigned int a, unsigned int w)
+
+{
+	return ((((a & 0xFF00FF) * w) >> 8) & 0xFF00FF) | ((((a & 0x00FF00) * w) >> 8) & 0x00FF00);
+}
+
+void FDAIBall::Render(double roll, double pitch, double yaw, unsigned int *pixels)
+
+{
+	//
+	// The OpenGL model view was Ry(90 + roll) * Rx(yaw) * Rz(pitch), so texture
+	// space is Rz(-pitch) * Rx(-yaw) * Ry(-90 - roll) of the table normals.
+	//
+	double cr = cos(-(roll + BallPi / 2.0)), sr = sin(-(roll + BallPi / 2.0));
+	double cy = cos(-yaw), sy = sin(-yaw);
+	double cp = cos(-pitch), sp = sin(-pitch);
+
+	double ry[3][3] = { { cr, 0.0, sr }, { 0.0, 1.0, 0.0 }, { -sr, 0.0, cr } };
+	double rx[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, cy, -sy }, { 0.0, sy, cy } };
+	double rz[3][3] = { { cp, -sp, 0.0 }, { sp, cp, 0.0 }, { 0.0, 0.0, 1.0 } };
+	double rzx[3][3];
+	float m[3][3];
+
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			rzx[i][j] = rz[i][0] * rx[0][j] + rz[i][1] * rx[1][j] + rz[i][2] * rx[2][j];
+
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			m[i][j] = (float)(rzx[i][0] * ry[0][j] + rzx[i][1] * ry[1][j] + rzx[i][2] * ry[2][j]);
+
+	memset(pixels, 0, FDAIBALL_SIZE * FDAIBALL_SIZE * sizeof(unsigned int));
+
+	const std::vector<FDAIBallPixel> &table = GetBallTable().pixels;
+	const size_t count = table.size();
+
+	if (texture.empty())
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			const FDAIBallPixel &p = table[i];
+			pixels[p.index] = ScalePixel(0xFFFFFF, p.shade);
+		}
+		return;
+	}
+
+	//
+	// gluSphere texture coordinates: s runs around the z axis from +y towards -x,
+	// t from 0 at -z to 1 at +z. Texels are filtered bilinearly, wrapping in s.
+	//
+	const float sScale = (float)texWidth / (float)(2.0 * BallPi);
+	const float tScale = (float)texHeight / (float)BallPi;
+	const unsigned int *tex = &texture[0];
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const FDAIBallPixel &p = table[i];
+
+		float x = m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z;
+		float y = m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z;
+		float z = m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z;
+
+		if (z > 1.0f) z = 1.0f;
+		else if (z < -1.0f) z = -1.0f;
+
+		float u = atan2f(-x, y) * sScale - 0.5f;
+		float v = (float)texHeight - acosf(z) * tScale - 0.5f;
+
+		u += (float)(2 * texWidth);
+		if (v < 0.0f) v = 0.0f;
+
+		int u0 = (int)u;
+		int v0 = (int)v;
+		unsigned int fu = (unsigned int)((u - (float)u0) * 256.0f);
+		unsigned int fv = (unsigned int)((v - (float)v0) * 256.0f);
+
+		u0 %= texWidth;
+		int u1 = (u0 + 1 < texWidth) ? u0 + 1 : 0;
+		if (v0 >= texHeight - 1)
+		{
+			v0 = texHeight - 1;
+			fv = 0;
+		}
+		int v1 = (v0 + 1 < texHeight) ? v0 + 1 : v0;
+
+		const unsigned int *r0 = tex + v0 * texWidth;
+		const unsigned int *r1 = tex + v1 * texWidth;
+
+		unsigned int c = BlendPixels(BlendPixels(r0[u0], r0[u1], fu), BlendPixels(r1[u0], r1[u1], fu), fv);
+		pixels[p.index] = ScalePixel(c, p.shade);
+	}
+}
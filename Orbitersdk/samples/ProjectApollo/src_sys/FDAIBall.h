@@ -0,0 +1,68 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Software renderer for the 2D panel FDAI ball
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_FDAIBALL_H)
+#define _PA_FDAIBALL_H
+
+#include <vector>
+
+#define FDAIBALL_SIZE	150		///< Width and height of the rendered ball image in pixels.
+
+///
+/// \brief Textured FDAI ball, rendered on the CPU.
+///
+/// This draws the same picture the panel FDAI used to get from OpenGL: a lit,
+/// textured sphere seen through a fixed camera. As only the ball rotates, the
+/// ray cast for every pixel is done once and kept in a table of sphere normals
+/// and lighting; rendering an attitude is then a rotation and a texture lookup
+/// per pixel.
+///
+/// It has no Orbiter or Windows dependencies, and an instance can render on
+/// any thread as long as only one thread uses it at a time.
+///
+class FDAIBall
+{
+public:
+	FDAIBall();
+
+	///
+	/// Load the ball texture, an uncompressed 24 or 32 bit BMP file.
+	/// \return False if the file is missing or not in a format we read.
+	///
+	bool LoadTexture(const char *filename);
+	bool HasTexture() { return !texture.empty(); };
+
+	///
+	/// Render the ball with the FDAI's three ball rotations, in radians.
+	/// \param pixels FDAIBALL_SIZE * FDAIBALL_SIZE pixels, top row first, 0x00RRGGBB.
+	///
+	void Render(double roll, double pitch, double yaw, unsigned int *pixels);
+
+protected:
+	std::vector<unsigned int> texture;	///< Bottom row first, like the BMP file.
+	int texWidth;
+	int texHeight;
+};
+
+#endif // _PA_FDAIBALL_H
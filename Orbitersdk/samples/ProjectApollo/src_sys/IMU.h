@@ -76,7 +76,6 @@ protected:
 	// Logging.
 	//
 
-	void LogInit();
 	void LogState(int channel, char *device, int value);
 	void LogTimeStep(long time);
 	void LogVector(char* message, VECTOR3 v);
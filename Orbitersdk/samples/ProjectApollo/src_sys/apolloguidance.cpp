@@ -42,6 +42,7 @@
 #include "papi.h"
 
 #include "tracer.h"
+#include "tracelog.h"
 
 char TwoSpaceTwoFormat[7] = "XXX XX";
 char RegFormat[7] = "XXXXXX";
@@ -4323,13 +4324,17 @@ void ApolloGuidance::SetInputChannel(int channel, std::bitset<16> val)
 
 	if (Yaagc) {
 
-#ifdef _DEBUG
 	//
-	// Don't print debug for IMU channels or we get a multi-gigabyte log file!
+	// Don't trace the IMU counter channels, they'd swamp everything else.
 	//
-	if (!(channel & 0x80))
-		fprintf(out_file, "Wrote %05o to input channel %04o\n", channel, val);
-#endif
+	if (!(channel & 0x80) && TraceLog::Enabled(TRACE_AGC)) {
+		TraceChannel tc;
+
+		tc.channel = channel;
+		tc.value = (int)val.to_ulong();
+		tc.bit = 0;
+		TraceLog::Write(TRACE_AGC, TRACEEV_AGC_INPUT, &tc, sizeof(tc));
+	}
 
 		if (channel & 0x80) {
 			// In this case we're dealing with a counter increment.
@@ -4386,9 +4391,14 @@ void ApolloGuidance::SetInputChannelBit(int channel, int bit, bool val)
 		if ((channel >= 030) && (channel <= 034))
 			data ^= 077777;
 
-#ifdef _DEBUG
-		fprintf(out_file, "Set bit %d of input channel %04o to %d\n", bit, channel, val ? 1 : 0); 
-#endif
+		if (TraceLog::Enabled(TRACE_AGC)) {
+			TraceChannel tc;
+
+			tc.channel = channel;
+			tc.value = val ? 1 : 0;
+			tc.bit = bit;
+			TraceLog::Write(TRACE_AGC, TRACEEV_AGC_INPUT_BIT, &tc, sizeof(tc));
+		}
 	}
 
 	if (channel < 0 || channel > MAX_INPUT_CHANNELS)
@@ -4473,8 +4483,7 @@ void ApolloGuidance::SetOutputChannel(int channel, ChannelValue val)
 
 	OutputChannel[channel] = val.to_ulong();
 
-#ifdef _DEBUG
-	if (Yaagc) {
+	if (Yaagc && TraceLog::Enabled(TRACE_AGC)) {
 		switch (channel) {
 		case 010:
 		case 034:
@@ -4484,11 +4493,17 @@ void ApolloGuidance::SetOutputChannel(int channel, ChannelValue val)
 			break;
 
 		default:
-			fprintf(out_file, "AGC write %05o to %04o\n", val, channel);
+			{
+				TraceChannel tc;
+
+				tc.channel = channel;
+				tc.value = (int)val.to_ulong();
+				tc.bit = 0;
+				TraceLog::Write(TRACE_AGC, TRACEEV_AGC_OUTPUT, &tc, sizeof(tc));
+			}
 			break;
 		}
 	}
-#endif
 
 	//
 	// Special-case processing.
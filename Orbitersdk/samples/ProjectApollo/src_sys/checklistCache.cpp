@@ -0,0 +1,399 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Compiled checklist cache
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1300) //Microsoft Visual Studio Version 2003 and higher
+#define _CRT_SECURE_NO_DEPRECATE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+
+#include "checklistCache.h"
+#include "BasicExcelVC6.hpp"
+
+using namespace YExcel;
+
+//
+// Workbooks that are open, so that the CSM and LM share one mapping.
+//
+static std::vector<ChecklistCache *> openCaches;
+
+ChecklistCache::ChecklistCache()
+
+{
+	refs = 0;
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+	view = NULL;
+	data = NULL;
+	header = NULL;
+	numbers = NULL;
+	sheets = NULL;
+	cells = NULL;
+	strings = NULL;
+}
+
+ChecklistCache::~ChecklistCache()
+
+{
+	Unmap();
+}
+
+ChecklistCache *ChecklistCache::Acquire(const char *xlsFile)
+
+{
+	for (unsigned int i = 0; i < openCaches.size(); i++)
+	{
+		if (!stricmp(openCaches[i]->path.c_str(), xlsFile))
+		{
+			openCaches[i]->refs++;
+			return openCaches[i];
+		}
+	}
+
+	std::string cacheFile = std::string(xlsFile) + CHECKLIST_CACHE_EXT;
+
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+	bool haveSource = (GetFileAttributesExA(xlsFile, GetFileExInfoStandard, &attr) != 0);
+	unsigned long long sourceTime = 0;
+	unsigned int sourceSize = 0;
+
+	if (haveSource)
+	{
+		sourceTime = ((unsigned long long)attr.ftLastWriteTime.dwHighDateTime << 32) | attr.ftLastWriteTime.dwLowDateTime;
+		sourceSize = attr.nFileSizeLow;
+	}
+
+	ChecklistCache *cache = new ChecklistCache();
+
+	if (!cache->Map(cacheFile.c_str()) || (haveSource && !cache->Matches(sourceTime, sourceSize)))
+	{
+		cache->Unmap();
+
+		if (!haveSource || !Compile(xlsFile, sourceTime, sourceSize, cache->memory))
+		{
+			delete cache;
+			return NULL;
+		}
+
+		//
+		// Map what we wrote rather than keep the image, so the next vessel and
+		// the next session share it. If the directory isn't writable, use the
+		// image in memory.
+		//
+		if (WriteImage(cacheFile.c_str(), cache->memory) && cache->Map(cacheFile.c_str()) && cache->Matches(sourceTime, sourceSize))
+		{
+			std::vector<unsigned char>().swap(cache->memory);
+		}
+		else
+		{
+			cache->Unmap();
+			cache->data = &cache->memory[0];
+			cache->Valid(cache->memory.size());
+		}
+	}
+
+	cache->path = xlsFile;
+	cache->refs = 1;
+	openCaches.push_back(cache);
+
+	return cache;
+}
+
+void ChecklistCache::Release(ChecklistCache *cache)
+
+{
+	if (!cache || --cache->refs > 0)
+		return;
+
+	for (unsigned int i = 0; i < openCaches.size(); i++)
+	{
+		if (openCaches[i] == cache)
+		{
+			openCaches.erase(openCaches.begin() + i);
+			break;
+		}
+	}
+	delete cache;
+}
+
+bool ChecklistCache::Map(const char *cacheFile)
+
+{
+	file = CreateFileA(cacheFile, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	DWORD size = GetFileSize(file, NULL);
+	if (size == INVALID_FILE_SIZE || size < sizeof(ChecklistCacheHeader))
+		return false;
+
+	mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping)
+		return false;
+
+	view = (const unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+		return false;
+
+	data = view;
+	return Valid(size);
+}
+
+void ChecklistCache::Unmap()
+
+{
+	if (view)
+		UnmapViewOfFile(view);
+	if (mapping)
+		CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+	view = NULL;
+	data = NULL;
+	header = NULL;
+	numbers = NULL;
+	sheets = NULL;
+	cells = NULL;
+	strings = NULL;
+}
+
+//
+// Check the header against the size of the data, and set up the table pointers.
+//
+bool ChecklistCache::Valid(size_t size)
+
+{
+	const ChecklistCacheHeader *h = (const ChecklistCacheHeader *)data;
+
+	if (size < sizeof(*h) || memcmp(h->magic, CHECKLIST_CACHE_MAGIC, 8) || h->version != CHECKLIST_CACHE_VERSION)
+		return false;
+
+	size_t need = sizeof(*h) + (size_t)h->numbers * sizeof(double) + (size_t)h->sheets * sizeof(ChecklistCacheSheet) +
+		(size_t)h->cells * sizeof(ChecklistCacheCell) + h->strings;
+
+	if (need != size || h->strings == 0 || data[size - 1] != 0)
+		return false;
+
+	header = h;
+	numbers = (const double *)(data + sizeof(*h));
+	sheets = (const ChecklistCacheSheet *)(numbers + h->numbers);
+	cells = (const ChecklistCacheCell *)(sheets + h->sheets);
+	strings = (const char *)(cells + h->cells);
+
+	return true;
+}
+
+bool ChecklistCache::Matches(unsigned long long sourceTime, unsigned int sourceSize)
+
+{
+	return header && header->sourceTime == sourceTime && header->sourceSize == sourceSize;
+}
+
+int ChecklistCache::FindSheet(const char *name)
+
+{
+	for (unsigned int i = 0; i < header->sheets; i++)
+	{
+		if (!strcmp(strings + sheets[i].name, name))
+			return i;
+	}
+	return -1;
+}
+
+int ChecklistCache::Rows(int sheet)
+
+{
+	if (sheet < 0 || sheet >= (int)header->sheets)
+		return 0;
+
+	return sheets[sheet].rows;
+}
+
+void ChecklistCache::GetRow(int sheet, int row, ChecklistCell *out)
+
+{
+	const ChecklistCacheCell *c = cells + sheets[sheet].firstCell + row * CHECKLIST_CACHE_COLUMNS;
+
+	for (int i = 0; i < CHECKLIST_CACHE_COLUMNS; i++)
+	{
+		out[i].type = c[i].type;
+		out[i].ivalue = (c[i].type == CHECKCELL_INT) ? c[i].value : 0;
+		out[i].dvalue = (c[i].type == CHECKCELL_DOUBLE) ? numbers[c[i].value] : 0.0;
+		out[i].svalue = (c[i].type == CHECKCELL_STRING) ? strings + c[i].value : 0;
+	}
+}
+
+static unsigned int AddString(std::vector<char> &table, std::map<std::string, unsigned int> &index, const char *s)
+
+{
+	std::map<std::string, unsigned int>::iterator it = index.find(s);
+
+	if (it != index.end())
+		return it->second;
+
+	unsigned int offset = (unsigned int)table.size();
+	table.insert(table.end(), s, s + strlen(s) + 1);
+	index[s] = offset;
+
+	return offset;
+}
+
+bool ChecklistCache::Compile(const char *xlsFile, unsigned long long sourceTime, unsigned int sourceSize, std::vector<unsigned char> &image)
+
+{
+	BasicExcel xls;
+
+	if (!xls.Load(xlsFile))
+		return false;
+
+	std::vector<double> numberTable;
+	std::vector<ChecklistCacheSheet> sheetTable;
+	std::vector<ChecklistCacheCell> cellTable;
+	std::vector<char> stringTable;
+	std::map<std::string, unsigned int> stringIndex;
+
+	AddString(stringTable, stringIndex, "");
+
+	for (size_t s = 0; s < xls.GetTotalWorkSheets(); s++)
+	{
+		//
+		// The checklist code looks sheets up by ANSI name only.
+		//
+		const char *name = xls.GetAnsiSheetName(s);
+		if (!name)
+			continue;
+
+		BasicExcelWorksheet *sheet = xls.GetWorksheet(s);
+		ChecklistCacheSheet cs;
+
+		cs.name = AddString(stringTable, stringIndex, name);
+		cs.rows = 0;
+		cs.firstCell = (unsigned int)cellTable.size();
+		cs.reserved = 0;
+
+		size_t rows = sheet->GetTotalRows();
+		for (size_t i = 1; i < rows; i++)
+		{
+			// Ignore empty texts
+			if (sheet->Cell(i, 0)->GetString() == 0)
+				continue;
+
+			for (int c = 0; c < CHECKLIST_CACHE_COLUMNS; c++)
+			{
+				BasicExcelCell *cell = sheet->Cell(i, c);
+				ChecklistCacheCell cc;
+
+				cc.type = CHECKCELL_UNDEFINED;
+				cc.value = 0;
+
+				switch (cell->Type())
+				{
+				case BasicExcelCell::INT:
+					cc.type = CHECKCELL_INT;
+					cc.value = cell->GetInteger();
+					break;
+
+				case BasicExcelCell::DOUBLE:
+					cc.type = CHECKCELL_DOUBLE;
+					cc.value = (int)numberTable.size();
+					numberTable.push_back(cell->GetDouble());
+					break;
+
+				case BasicExcelCell::STRING:
+					//
+					// An empty string cell reads as no string at all.
+					//
+					if (cell->GetString())
+					{
+						cc.type = CHECKCELL_STRING;
+						cc.value = AddString(stringTable, stringIndex, cell->GetString());
+					}
+					break;
+				}
+				cellTable.push_back(cc);
+			}
+			cs.rows++;
+		}
+		sheetTable.push_back(cs);
+	}
+
+	ChecklistCacheHeader h;
+
+	memcpy(h.magic, CHECKLIST_CACHE_MAGIC, 8);
+	h.version = CHECKLIST_CACHE_VERSION;
+	h.sourceSize = sourceSize;
+	h.sourceTime = sourceTime;
+	h.numbers = (unsigned int)numberTable.size();
+	h.sheets = (unsigned int)sheetTable.size();
+	h.cells = (unsigned int)cellTable.size();
+	h.strings = (unsigned int)stringTable.size();
+
+	image.clear();
+	image.reserve(sizeof(h) + numberTable.size() * sizeof(double) + sheetTable.size() * sizeof(ChecklistCacheSheet) +
+		cellTable.size() * sizeof(ChecklistCacheCell) + stringTable.size());
+
+	const unsigned char *p = (const unsigned char *)&h;
+	image.insert(image.end(), p, p + sizeof(h));
+	if (!numberTable.empty())
+	{
+		p = (const unsigned char *)&numberTable[0];
+		image.insert(image.end(), p, p + numberTable.size() * sizeof(double));
+	}
+	if (!sheetTable.empty())
+	{
+		p = (const unsigned char *)&sheetTable[0];
+		image.insert(image.end(), p, p + sheetTable.size() * sizeof(ChecklistCacheSheet));
+	}
+	if (!cellTable.empty())
+	{
+		p = (const unsigned char *)&cellTable[0];
+		image.insert(image.end(), p, p + cellTable.size() * sizeof(ChecklistCacheCell));
+	}
+	image.insert(image.end(), stringTable.begin(), stringTable.end());
+
+	return true;
+}
+
+bool ChecklistCache::WriteImage(const char *cacheFile, const std::vector<unsigned char> &image)
+
+{
+	FILE *fp = fopen(cacheFile, "wb");
+	if (!fp)
+		return false;
+
+	bool ok = (fwrite(&image[0], 1, image.size(), fp) == image.size());
+	if (fclose(fp) != 0)
+		ok = false;
+
+	if (!ok)
+		remove(cacheFile);
+
+	return ok;
+}
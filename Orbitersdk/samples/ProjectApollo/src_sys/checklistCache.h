@@ -0,0 +1,166 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Compiled checklist cache
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_CHECKLISTCACHE_H)
+#define _PA_CHECKLISTCACHE_H
+
+#include <windows.h>
+
+#include <string>
+#include <vector>
+
+#define CHECKLIST_CACHE_MAGIC		"PACHKLST"
+#define CHECKLIST_CACHE_VERSION		1
+#define CHECKLIST_CACHE_EXT			".cache"	///< Appended to the workbook file name.
+#define CHECKLIST_CACHE_COLUMNS		13			///< Columns kept per row, enough for the item sheets.
+
+///
+/// Cell types, the same values BasicExcelCell uses.
+///
+enum ChecklistCellType
+{
+	CHECKCELL_UNDEFINED = 0,
+	CHECKCELL_INT,
+	CHECKCELL_DOUBLE,
+	CHECKCELL_STRING
+};
+
+///
+/// \brief Read-only view of one spreadsheet cell.
+///
+/// The accessors behave like BasicExcelCell's, so the checklist code reads the
+/// same values whether they came from the workbook or from the cache.
+///
+struct ChecklistCell
+{
+	int type;
+	int ivalue;
+	double dvalue;
+	const char *svalue;
+
+	const char *GetString() const { return (type == CHECKCELL_STRING) ? svalue : 0; };
+	double GetDouble() const { return (type == CHECKCELL_DOUBLE) ? dvalue : ((type == CHECKCELL_INT) ? (double)ivalue : 0.0); };
+	int GetInteger() const { return (type == CHECKCELL_INT) ? ivalue : ((type == CHECKCELL_DOUBLE) ? (int)dvalue : 0); };
+};
+
+//
+// File layout: header, number table, sheet table, cell table, string table.
+// Strings are NUL terminated and referenced by offset; identical strings are
+// stored once. Doubles (mostly times) go in the number table to keep cells small.
+//
+
+struct ChecklistCacheHeader
+{
+	char magic[8];
+	unsigned int version;
+	unsigned int sourceSize;			///< Size of the workbook it was compiled from.
+	unsigned long long sourceTime;		///< Last write time of that workbook.
+	unsigned int numbers;
+	unsigned int sheets;
+	unsigned int cells;
+	unsigned int strings;				///< Bytes in the string table.
+};
+
+struct ChecklistCacheSheet
+{
+	unsigned int name;					///< String offset.
+	unsigned int rows;
+	unsigned int firstCell;				///< Index of the sheet's first cell.
+	unsigned int reserved;
+};
+
+struct ChecklistCacheCell
+{
+	int type;
+	int value;							///< Integer value, number index or string offset.
+};
+
+///
+/// \brief Checklist workbook compiled into a flat, memory mapped file.
+///
+/// Parsing the checklist .xls takes a noticeable part of vessel creation, and the
+/// parsed workbook used to be kept by every checklist controller. The cache only
+/// keeps the rows the checklists use (the heading row and rows with an empty
+/// first column are dropped), is mapped read-only, and is shared by all vessels
+/// using the same workbook.
+///
+/// The cache file lives next to the workbook. It's rebuilt whenever the
+/// workbook's size or time stamp differ from the ones recorded in it, and used
+/// on its own if the workbook is missing.
+///
+class ChecklistCache
+{
+public:
+	///
+	/// Get the cache for a workbook, compiling it if needed. Returns NULL if
+	/// neither a usable cache nor the workbook exists. Every successful call
+	/// needs a Release().
+	///
+	static ChecklistCache *Acquire(const char *xlsFile);
+	static void Release(ChecklistCache *cache);
+
+	///
+	/// Sheet index by name, or -1.
+	///
+	int FindSheet(const char *name);
+	int Rows(int sheet);
+
+	///
+	/// Fill cells[0..CHECKLIST_CACHE_COLUMNS-1] with the given row.
+	///
+	void GetRow(int sheet, int row, ChecklistCell *cells);
+
+protected:
+	ChecklistCache();
+	~ChecklistCache();
+
+	bool Map(const char *cacheFile);
+	void Unmap();
+	bool Valid(size_t size);
+	bool Matches(unsigned long long sourceTime, unsigned int sourceSize);
+
+	static bool Compile(const char *xlsFile, unsigned long long sourceTime, unsigned int sourceSize, std::vector<unsigned char> &image);
+	static bool WriteImage(const char *cacheFile, const std::vector<unsigned char> &image);
+
+	std::string path;
+	int refs;
+
+	HANDLE file;
+	HANDLE mapping;
+	const unsigned char *view;
+
+	///
+	/// The compiled image, if it couldn't be written out and mapped.
+	///
+	std::vector<unsigned char> memory;
+
+	const unsigned char *data;
+	const ChecklistCacheHeader *header;
+	const double *numbers;
+	const ChecklistCacheSheet *sheets;
+	const ChecklistCacheCell *cells;
+	const char *strings;
+};
+
+#endif // _PA_CHECKLISTCACHE_H
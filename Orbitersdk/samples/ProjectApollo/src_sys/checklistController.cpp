@@ -37,16 +37,17 @@
 
 using namespace std;
 // Todo: Verify
-ChecklistController::ChecklistController(SoundLib sound)
+ChecklistController::ChecklistController(SoundLib &sound) : soundLib(sound)
 {
 	initCalled = false;
-	soundLib = sound;
 	FileName[0] = 0;
+	cache = NULL;
 	init(false);
 }
 // Todo: Verify
 ChecklistController::~ChecklistController()
 {
+	ChecklistCache::Release(cache);
 }
 // Todo: Verify
 ChecklistItem *ChecklistController::getChecklistItem(int group, int index)
@@ -135,36 +136,26 @@ bool ChecklistController::init(char *checkFile)
 	if (!init(true))
 		return false;
 
-	if (*checkFile == '\0') {
-		if (!file.Load(DefaultChecklistFile)) {
-			return false;
-		}
-	} else if (!file.Load(checkFile)) {
-		if (!file.Load(DefaultChecklistFile)) {
-			return false;
-		}
-	}
+	// The cache is compiled from the .xls on first use, and again when the .xls changes.
+	if (*checkFile != '\0')
+		cache = ChecklistCache::Acquire(checkFile);
+	if (!cache)
+		cache = ChecklistCache::Acquire(DefaultChecklistFile);
+	if (!cache)
+		return false;
 
-	BasicExcelWorksheet* sheet;
-	vector<BasicExcelCell> cells;
+	ChecklistCell cells[CHECKLIST_CACHE_COLUMNS];
 	ChecklistGroup temp;
 
-	sheet = file.GetWorksheet("GROUPS");
-	if (sheet)
+	int sheet = cache->FindSheet("GROUPS");
+	int rows = cache->Rows(sheet);
+	for (int i = 0; i < rows; i++)
 	{
-		for (int i = 1; i < sheet->GetTotalRows(); i++)
-		{
-			// Ignore empty texts
-			if (sheet->Cell(i,0)->GetString() != 0) {
-				for (int ii = 0; ii < 10 /* Number of columns in accepted sheet */; ii++)
-					cells.push_back(*sheet->Cell(i,ii));
-				temp.init(cells);
-				temp.group = groups.size();
-				groups.push_back(temp);
-				temp = ChecklistGroup();
-				cells = vector<BasicExcelCell>();
-			}
-		}
+		cache->GetRow(sheet, i, cells);
+		temp.init(cells);
+		temp.group = groups.size();
+		groups.push_back(temp);
+		temp = ChecklistGroup();
 	}
 	return true;
 }
@@ -47,10 +47,9 @@
 #include "orbiterSDK.h"
 #include "nasspdefs.h"
 #include "connector.h"
-#include "BasicExcelVC6.hpp"
+#include "checklistCache.h"
 #include "soundlib.h"
 using namespace std;
-using namespace YExcel;
 
 #define ChecklistControllerStartString "<checklist>"
 #define ChecklistControllerEndString "</checklist>"
@@ -124,9 +123,9 @@ struct ChecklistGroup
 		called = false;
 	}
 /// -------------------------------------------------------------
-/// Load this checklist group up from a file.
+/// Load this checklist group up from a row of the GROUPS sheet.
 /// -------------------------------------------------------------
-	void init(vector<BasicExcelCell> &);
+	void init(const ChecklistCell *);
 /// -------------------------------------------------------------
 /// Scenario handling.
 /// -------------------------------------------------------------
@@ -229,9 +228,9 @@ struct ChecklistItem
 /// -------------------------------------------------------------
 	ChecklistItem();
 /// -------------------------------------------------------------
-/// Load ChecklistItem from excel file
+/// Load ChecklistItem from a row of its group's sheet
 /// -------------------------------------------------------------
-	void init(vector<BasicExcelCell> &, const vector<ChecklistGroup> &);
+	void init(const ChecklistCell *, const vector<ChecklistGroup> &);
 /// -------------------------------------------------------------
 /// Scenario load/save.
 /// -------------------------------------------------------------
@@ -426,7 +425,7 @@ struct SaturnEvents
 class ChecklistController
 {
 public:
-	ChecklistController(SoundLib);
+	ChecklistController(SoundLib &);
 	~ChecklistController();
 /// -------------------------------------------------------------
 /// Pass in a ChecklistItem with group and index initialized.
@@ -594,13 +593,13 @@ private:
 
 protected:	
 	/// Access to the vessels sound handler
-	SoundLib soundLib;
+	SoundLib &soundLib;
 	/// Sound that needs to be played.
 	Sound checkSound;
 	/// Whether we have a sound cued up to be played.
 	bool playSound;
-	/// The actual file.
-	BasicExcel file;
+	/// The compiled checklist file, shared with other vessels.
+	ChecklistCache *cache;
 	///The list of all available checklist groups.
 	vector<ChecklistGroup> groups;
 public:
@@ -115,7 +115,7 @@ bool ChecklistItem::operator==(ChecklistItem input)
 	return false;
 }
 // Todo: Verify
-void ChecklistItem::init(vector<BasicExcelCell> &cells, const vector<ChecklistGroup> &groups)
+void ChecklistItem::init(const ChecklistCell *cells, const vector<ChecklistGroup> &groups)
 {
 	if (cells[0].GetString())
 		strncpy(text,cells[0].GetString(),100);
@@ -532,7 +532,7 @@ void DSKYChecklistItem::init(char *k) {
 
 //ChecklistGroup methods.
 
-void ChecklistGroup::init(std::vector<BasicExcelCell> &cells)
+void ChecklistGroup::init(const ChecklistCell *cells)
 {
 	if (cells[0].GetString())
 		strncpy(name,cells[0].GetString(),100);
@@ -746,26 +746,24 @@ void ChecklistContainer::operator=(const ChecklistContainer &input)
 // Todo: Verify
 void ChecklistContainer::initSet(const ChecklistGroup &program,vector<ChecklistItem> &set,ChecklistController &controller)
 {
-	BasicExcelWorksheet* sheet;
-	vector<BasicExcelCell> vec_temp;
-	sheet = controller.file.GetWorksheet(program.name);
-	int rows = sheet->GetTotalRows();
+	if (!controller.cache)
+		return;
+
+	ChecklistCell cells[CHECKLIST_CACHE_COLUMNS];
+	int sheet = controller.cache->FindSheet(program.name);
+	int rows = controller.cache->Rows(sheet);
 	ChecklistItem temp;
-	for (int i = 1; i < rows; i++)
+
+	// The cache only holds the rows with a text in the first column.
+	set.reserve(rows);
+	for (int i = 0; i < rows; i++)
 	{
-		// Ignore empty texts
-		if (sheet->Cell(i,0)->GetString() != 0) {
-			for (int ii = 0; ii < 13; ii++)
-			{
-				vec_temp.push_back(*(sheet->Cell(i,ii)));
-			}
-			temp.init(vec_temp,controller.groups);
-			temp.group = program.group;
-			temp.index = set.size();
-			set.push_back(temp);
-			vec_temp = vector<BasicExcelCell>();
-			temp = ChecklistItem();		
-		}
+		controller.cache->GetRow(sheet, i, cells);
+		temp.init(cells,controller.groups);
+		temp.group = program.group;
+		temp.index = set.size();
+		set.push_back(temp);
+		temp = ChecklistItem();		
 	}
 }
 // Todo: Verify
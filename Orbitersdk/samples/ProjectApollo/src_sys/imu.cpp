@@ -98,8 +98,6 @@ void IMU::Init()
 
 	DoZeroIMUCDUs();
 	LastTime = -1;
-	
-	LogInit();
 }
 
 void IMU::SetVessel(VESSEL *v, bool LEMFlag) 
@@ -26,9 +26,6 @@
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "Orbitersdk.h"
 #include <string.h>
-#include <time.h>
-#include <sys/timeb.h>
-#include <windows.h>
 #include <stdio.h>
 #include <math.h>
 #include "soundlib.h"
@@ -39,128 +36,87 @@
 
 #include "ioChannels.h"
 #include "IMU.h"
+#include "tracelog.h"
 
-static FILE *logFile = NULL;
-static long lastTime = -1;
-
-char *intToBinaryString(char *buffer, int i);
-
-
-void IMU::LogInit() 
-
-{
-#ifdef _DEBUG
-	if (!logFile)
-#ifdef SAT5_LMPKD_EXPORTS
-		logFile = fopen("ProjectApollo LM IMU.log", "w");
-#else
-		logFile = fopen("ProjectApollo IMU.log", "w");
-#endif
-#endif
-}
+//
+// These go to the TRACE_IMU category of the trace log as binary records, so
+// they cost nothing when the category is off and a memcpy when it's on. The
+// decoder prints them in the format of the old ProjectApollo IMU.log.
+//
 
 void IMU::LogState(int channel, char *device, int value) 
 
 {
-#ifdef _DEBUG
-	struct _timeb tstruct;
-	char *timeline;
-	char buffer[100];	
-	char buffer1[100];
-	
-	_ftime(&tstruct);
-	timeline = ctime(&(tstruct.time));
-	strcpy(buffer, timeline + 11);
-	
-	intToBinaryString(buffer1, value);
-
-		fprintf(logFile, "%.8s.%03hu Ch %03o %s %s PIPA %o %o %o CDUCMD %o %o %o GYRO %o IMU %.2f %.2f %.2f\n", buffer, tstruct.millitm, channel, device, buffer1,
-		    agc.GetErasable(0, RegPIPAX), 
-		    agc.GetErasable(0, RegPIPAY), 
-			agc.GetErasable(0, RegPIPAZ), 
-			agc.GetErasable(0, RegCDUXCMD),
-			agc.GetErasable(0, RegCDUYCMD),
-			agc.GetErasable(0, RegCDUZCMD),
-			//state->Erasable[0][RegCDUX],
-			//state->Erasable[0][RegCDUY],
-			//state->Erasable[0][RegCDUZ],			
-			agc.GetErasable(0, RegGYROCTR),
-			radToDeg(Gimbal.X),
-			radToDeg(Gimbal.Y),
-			radToDeg(Gimbal.Z));
-			
-	fflush(logFile);
-#endif
+	if (!TraceLog::Enabled(TRACE_IMU))
+		return;
+
+	TraceIMUState s;
+
+	s.channel = channel;
+	s.value = value;
+	s.pipa[0] = agc.GetErasable(0, RegPIPAX);
+	s.pipa[1] = agc.GetErasable(0, RegPIPAY);
+	s.pipa[2] = agc.GetErasable(0, RegPIPAZ);
+	s.cducmd[0] = agc.GetErasable(0, RegCDUXCMD);
+	s.cducmd[1] = agc.GetErasable(0, RegCDUYCMD);
+	s.cducmd[2] = agc.GetErasable(0, RegCDUZCMD);
+	s.gyro = agc.GetErasable(0, RegGYROCTR);
+	s.gimbal[0] = (float)Gimbal.X;
+	s.gimbal[1] = (float)Gimbal.Y;
+	s.gimbal[2] = (float)Gimbal.Z;
+	strncpy(s.device, device, sizeof(s.device) - 1);
+	s.device[sizeof(s.device) - 1] = 0;
+
+	TraceLog::Write(TRACE_IMU, TRACEEV_IMU_STATE, &s, sizeof(s));
 }
 
 void IMU::LogTimeStep(long simt) 
 
 {
-#ifdef _DEBUG
-	struct _timeb tstruct;
-	char *timeline;
-	char buffer[100];	
-	
-	_ftime(&tstruct);
-	timeline = ctime(&(tstruct.time));
-	strcpy(buffer, timeline + 11);
-		
-	fprintf(logFile, "%.8s.%03hu TimeStep                   Orbiter %.2f %.2f %.2f   IMU %.2f %.2f %.2f\n", buffer, tstruct.millitm, 
-			radToDeg(Orbiter.Attitude.X),
-			radToDeg(Orbiter.Attitude.Y),
-			radToDeg(Orbiter.Attitude.Z),
-			radToDeg(Gimbal.X),
-			radToDeg(Gimbal.Y),
-			radToDeg(Gimbal.Z));
-
-	fflush(logFile);
-#endif
+	if (!TraceLog::Enabled(TRACE_IMU))
+		return;
+
+	TraceIMUStep s;
+
+	s.orbiter[0] = (float)Orbiter.Attitude.X;
+	s.orbiter[1] = (float)Orbiter.Attitude.Y;
+	s.orbiter[2] = (float)Orbiter.Attitude.Z;
+	s.gimbal[0] = (float)Gimbal.X;
+	s.gimbal[1] = (float)Gimbal.Y;
+	s.gimbal[2] = (float)Gimbal.Z;
+
+	TraceLog::Write(TRACE_IMU, TRACEEV_IMU_STEP, &s, sizeof(s));
 }
 
 
 void IMU::LogVector(char* message, VECTOR3 v) 
 
 {
-#ifdef _DEBUG
-	struct _timeb tstruct;
-	char *timeline;
-	char buffer[100];
-	
-	_ftime(&tstruct);
-	timeline = ctime(&(tstruct.time));
-	strcpy(buffer, timeline + 11);
-		
-	fprintf(logFile, "%.8s.%03hu %s Vector %f %f %f\n", buffer, tstruct.millitm, 
-			message, v.x, v.y, v.z);
-#endif
-}
+	if (!TraceLog::Enabled(TRACE_IMU))
+		return;
 
-void IMU::LogMessage(char* s) 
+	unsigned char buffer[sizeof(TraceVector) + 256];
+	TraceVector tv;
+	int n = (int)strlen(message);
 
-{
-#ifdef _DEBUG
-	struct _timeb tstruct;
-	char *timeline;
-	char buffer[100];	
-	
-	_ftime(&tstruct);
-	timeline = ctime(&(tstruct.time));
-	strcpy(buffer, timeline + 11);
-		
-	fprintf(logFile, "%.8s.%03hu Message %s\n", buffer, tstruct.millitm, 
-			s);	
-#endif
+	if (n > 255)
+		n = 255;
+
+	tv.v[0] = v.x;
+	tv.v[1] = v.y;
+	tv.v[2] = v.z;
+	memcpy(buffer, &tv, sizeof(tv));
+	memcpy(buffer + sizeof(tv), message, n);
+	buffer[sizeof(tv) + n] = 0;
+
+	TraceLog::Write(TRACE_IMU, TRACEEV_IMU_VECTOR, buffer, sizeof(tv) + n + 1);
 }
 
-char *intToBinaryString(char *buffer, int i) {
+void IMU::LogMessage(char* s) 
 
-	unsigned int base = 0x4000; /* Assuming 15 bits */
-	int pos = 0;
+{
+	if (!TraceLog::Enabled(TRACE_IMU))
+		return;
 
-	while (base) {
-		sprintf(&(buffer[pos]), "%c", (base & i) ? '1' : '0');
-		base = base >> 1;
-		pos++;
-	}
-	return(buffer);
+	TraceLog::Write(TRACE_IMU, TRACEEV_IMU_MESSAGE, s, (int)strlen(s));
 }
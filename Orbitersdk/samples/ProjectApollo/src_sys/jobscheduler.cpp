@@ -0,0 +1,238 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Persistent worker pool for RTCC and MCC calculations
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <algorithm>
+
+#include "jobscheduler.h"
+
+JobState::JobState(int type, int priority, unsigned long sequence) :
+	type(type), priority(priority), sequence(sequence)
+{
+	status = JOB_QUEUED;
+	cancelled = false;
+	progress = 0.0;
+	future = promise.get_future().share();
+}
+
+int JobState::GetResult()
+{
+	if (!IsDone())
+		return 0;
+
+	return future.get();
+}
+
+bool JobScheduler::QueueOrder::operator()(const QueuedJob &a, const QueuedJob &b) const
+{
+	//
+	// priority_queue puts the "largest" element on top, so a job is "less" than
+	// another if it has lower priority or was submitted later.
+	//
+	if (a.state->priority != b.state->priority)
+		return a.state->priority < b.state->priority;
+
+	return a.state->sequence > b.state->sequence;
+}
+
+JobScheduler::JobScheduler(int nthreads)
+{
+	nextSequence = 0;
+	stopping = false;
+
+	if (nthreads < 1)
+		nthreads = 1;
+
+	for (int i = 0; i < nthreads; i++)
+	{
+		workers.push_back(std::thread(&JobScheduler::WorkerLoop, this));
+	}
+}
+
+JobScheduler::~JobScheduler()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+
+		for (std::vector<JobHandle>::iterator it = running.begin(); it != running.end(); ++it)
+		{
+			(*it)->Cancel();
+		}
+	}
+
+	wakeup.notify_all();
+
+	//
+	// Running jobs are allowed to finish, so the objects they write their
+	// results into must still exist at this point.
+	//
+	for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+	{
+		if (it->joinable())
+			it->join();
+	}
+
+	//
+	// Anything still queued never ran.
+	//
+	while (!queue.empty())
+	{
+		JobHandle state = queue.top().state;
+		queue.pop();
+		state->status = JOB_CANCELLED;
+		state->promise.set_value(-1);
+	}
+}
+
+JobHandle JobScheduler::Submit(int type, int priority, JobFunction fn)
+{
+	JobHandle state;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		state = std::make_shared<JobState>(type, priority, nextSequence++);
+
+		if (stopping)
+		{
+			state->status = JOB_CANCELLED;
+			state->promise.set_value(-1);
+			return state;
+		}
+
+		QueuedJob job;
+		job.state = state;
+		job.fn = fn;
+		queue.push(job);
+	}
+
+	wakeup.notify_one();
+	return state;
+}
+
+bool JobScheduler::IsBusy(int type)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	for (std::vector<JobHandle>::iterator it = running.begin(); it != running.end(); ++it)
+	{
+		if (type < 0 || (*it)->type == type)
+			return true;
+	}
+
+	//
+	// priority_queue has no iterators; copy the (short) queue to look through it.
+	//
+	std::priority_queue<QueuedJob, std::vector<QueuedJob>, QueueOrder> q = queue;
+	while (!q.empty())
+	{
+		if (type < 0 || q.top().state->type == type)
+			return true;
+		q.pop();
+	}
+
+	return false;
+}
+
+int JobScheduler::QueuedJobs()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return (int)queue.size();
+}
+
+void JobScheduler::CancelType(int type)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	std::priority_queue<QueuedJob, std::vector<QueuedJob>, QueueOrder> remaining;
+
+	while (!queue.empty())
+	{
+		QueuedJob job = queue.top();
+		queue.pop();
+
+		if (type < 0 || job.state->type == type)
+		{
+			job.state->Cancel();
+			job.state->status = JOB_CANCELLED;
+			job.state->promise.set_value(-1);
+		}
+		else
+		{
+			remaining.push(job);
+		}
+	}
+
+	queue = remaining;
+
+	for (std::vector<JobHandle>::iterator it = running.begin(); it != running.end(); ++it)
+	{
+		if (type < 0 || (*it)->type == type)
+			(*it)->Cancel();
+	}
+}
+
+void JobScheduler::CancelAll()
+{
+	CancelType(-1);
+}
+
+void JobScheduler::WorkerLoop()
+{
+	for (;;)
+	{
+		QueuedJob job;
+
+		{
+			std::unique_lock<std::mutex> guard(lock);
+
+			wakeup.wait(guard, [this] { return stopping || !queue.empty(); });
+
+			if (stopping)
+				return;
+
+			job = queue.top();
+			queue.pop();
+
+			job.state->status = JOB_RUNNING;
+			running.push_back(job.state);
+		}
+
+		int result = -1;
+
+		if (!job.state->IsCancelled())
+		{
+			result = job.fn(*job.state);
+			job.state->progress = 1.0;
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			running.erase(std::remove(running.begin(), running.end(), job.state), running.end());
+		}
+
+		job.state->status = job.state->IsCancelled() ? JOB_CANCELLED : JOB_DONE;
+		job.state->promise.set_value(result);
+	}
+}
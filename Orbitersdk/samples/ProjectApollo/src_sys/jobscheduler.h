@@ -0,0 +1,164 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Persistent worker pool for RTCC and MCC calculations
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_JOBSCHEDULER_H)
+#define _PA_JOBSCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+///
+/// Job priorities. Higher priorities are taken off the queue first, jobs of the
+/// same priority run in the order they were submitted.
+///
+enum JobPriority
+{
+	JOB_PRIORITY_LOW = 0,
+	JOB_PRIORITY_NORMAL = 1,
+	JOB_PRIORITY_HIGH = 2
+};
+
+///
+/// Job states as seen by the caller.
+///
+enum JobStatus
+{
+	JOB_QUEUED = 0,
+	JOB_RUNNING,
+	JOB_DONE,
+	JOB_CANCELLED
+};
+
+///
+/// \brief Shared state of a single scheduled job.
+///
+/// The scheduler and the caller both hold a reference to this. The caller (usually
+/// an MFD or the MCC time step) polls it; the job function uses it to report
+/// progress and to check for cancellation.
+///
+class JobState
+{
+public:
+	JobState(int type, int priority, unsigned long sequence);
+
+	int GetType() { return type; };
+	int GetPriority() { return priority; };
+	int GetStatus() { return status; };
+	bool IsDone() { return (status == JOB_DONE || status == JOB_CANCELLED); };
+
+	///
+	/// Request cancellation. Queued jobs are dropped without running, running
+	/// jobs see IsCancelled() return true and may stop early.
+	///
+	void Cancel() { cancelled = true; };
+	bool IsCancelled() { return cancelled; };
+
+	///
+	/// Progress in the range 0.0 to 1.0, set by the job function.
+	///
+	void SetProgress(double p) { progress = p; };
+	double GetProgress() { return progress; };
+
+	///
+	/// Result of the job function. Only valid once IsDone() returns true;
+	/// cancelled jobs that never ran return -1.
+	///
+	int GetResult();
+
+	std::shared_future<int> GetFuture() { return future; };
+
+protected:
+	friend class JobScheduler;
+
+	int type;
+	int priority;
+	unsigned long sequence;
+	std::atomic<int> status;
+	std::atomic<bool> cancelled;
+	std::atomic<double> progress;
+	std::promise<int> promise;
+	std::shared_future<int> future;
+};
+
+typedef std::shared_ptr<JobState> JobHandle;
+typedef std::function<int(JobState &)> JobFunction;
+
+///
+/// \brief Fixed pool of worker threads running prioritised jobs.
+///
+/// The worker threads are created once and stay idle between jobs, so starting a
+/// calculation from a button press only costs a queue insertion.
+///
+class JobScheduler
+{
+public:
+	JobScheduler(int nthreads = 1);
+	virtual ~JobScheduler();
+
+	///
+	/// Queue a job. The type is an arbitrary caller-defined tag (e.g. the RTCC
+	/// calculation number) that can be used with IsBusy() and CancelType().
+	///
+	JobHandle Submit(int type, int priority, JobFunction fn);
+
+	///
+	/// True if any job of the given type (or any job at all for type -1) is
+	/// queued or running.
+	///
+	bool IsBusy(int type = -1);
+	int QueuedJobs();
+	void CancelType(int type);
+	void CancelAll();
+
+protected:
+	struct QueuedJob
+	{
+		JobHandle state;
+		JobFunction fn;
+	};
+
+	struct QueueOrder
+	{
+		bool operator()(const QueuedJob &a, const QueuedJob &b) const;
+	};
+
+	void WorkerLoop();
+
+	std::mutex lock;
+	std::condition_variable wakeup;
+	std::priority_queue<QueuedJob, std::vector<QueuedJob>, QueueOrder> queue;
+	std::vector<JobHandle> running;
+	std::vector<std::thread> workers;
+	unsigned long nextSequence;
+	bool stopping;
+};
+
+#endif // _PA_JOBSCHEDULER_H
@@ -0,0 +1,79 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Table driven PCM telemetry frame formats
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <string.h>
+
+#include "pcmformat.h"
+
+PCMFrameProgram::PCMFrameProgram()
+{
+	words = 0;
+	frames = 0;
+}
+
+void PCMFrameProgram::Build(const PCMMeasurement *table, int size, int nwords, int nframes)
+{
+	PCMMeasurement zero;
+
+	memset(&zero, 0, sizeof(zero));
+	zero.op = PCMOP_CONST;
+
+	words = nwords;
+	frames = nframes;
+	program.assign(words * frames, zero);
+
+	for (int f = 0; f < frames; f++)
+	{
+		for (int w = 0; w < words; w++)
+		{
+			program[f * words + w].word = w;
+			program[f * words + w].frame = f;
+		}
+	}
+
+	//
+	// Words sent in all frames first, so an entry for one subframe overrides them.
+	//
+
+	for (int pass = 0; pass < 2; pass++)
+	{
+		for (int i = 0; i < size; i++)
+		{
+			const PCMMeasurement &m = table[i];
+			bool all = (m.frame == PCM_ALL_FRAMES);
+
+			if (all != (pass == 0) || m.word < 0 || m.word >= words)
+				continue;
+
+			for (int f = 0; f < frames; f++)
+			{
+				if (all || m.frame == f)
+				{
+					program[f * words + m.word] = m;
+					program[f * words + m.word].frame = f;
+				}
+			}
+		}
+	}
+}
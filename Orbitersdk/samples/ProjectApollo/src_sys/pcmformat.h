@@ -0,0 +1,97 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Table driven PCM telemetry frame formats
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_PCMFORMAT_H)
+#define _PA_PCMFORMAT_H
+
+#include <vector>
+
+///
+/// What a PCM word carries.
+///
+enum PCMWordOp
+{
+	PCMOP_CONST = 0,			///< Fixed value in ccode (sync words, spares).
+	PCMOP_FRAMECOUNT,			///< 0300 | frame count.
+	PCMOP_FRAMEADDR,			///< 0300 | frame address.
+	PCMOP_MEASURE,				///< Measurement channel/type/ccode.
+	PCMOP_MEASURE_FRAMEADDR,	///< Measurement ccode + step * frame address.
+	PCMOP_CMC_A,				///< Computer digital data, first word (with word order bit).
+	PCMOP_CMC_B,
+	PCMOP_CMC_C,
+	PCMOP_CMC_D,
+	PCMOP_CMC_E
+};
+
+#define PCMFLAG_DOWNRUPT_BEFORE	1	///< Send the computer a downrupt before the word.
+#define PCMFLAG_DOWNRUPT_AFTER	2	///< Send the computer a downrupt after the word.
+
+#define PCM_ALL_FRAMES	-1
+
+///
+/// \brief One entry of a PCM format table.
+///
+/// A format is a list of these, one for each word position, or one for each
+/// subframe for subcommutated words. Words not listed are sent as zero.
+///
+struct PCMMeasurement
+{
+	short word;					///< Word position in the frame, from 0.
+	short frame;				///< Subframe (frame count) it's sent in, or PCM_ALL_FRAMES.
+	unsigned char op;			///< PCMWordOp.
+	unsigned char flags;		///< PCMFLAG_ values.
+	unsigned char channel;		///< Measurement channel, e.g. 11 for 11A1.
+	unsigned char type;			///< Measurement type (TLM_A etc.), vessel specific.
+	unsigned short ccode;		///< Measurement number, or the value of a PCMOP_CONST word.
+	short step;					///< ccode step per frame address for PCMOP_MEASURE_FRAMEADDR.
+};
+
+///
+/// \brief A PCM format compiled into a flat table.
+///
+/// Build() expands a format table into one entry per word for every subframe, so
+/// generating a word is a single array lookup rather than a walk through the format.
+///
+class PCMFrameProgram
+{
+public:
+	PCMFrameProgram();
+
+	void Build(const PCMMeasurement *table, int size, int words, int frames);
+
+	int Words() { return words; };
+	int Frames() { return frames; };
+
+	///
+	/// The words of one subframe.
+	///
+	const PCMMeasurement *Frame(int frame) { return &program[(frame % frames) * words]; };
+
+protected:
+	std::vector<PCMMeasurement> program;
+	int words;
+	int frames;
+};
+
+#endif // _PA_PCMFORMAT_H
@@ -0,0 +1,333 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  PCM telemetry recorder and replay
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <windows.h>
+#include <string.h>
+
+#include "pcmrecorder.h"
+
+static const unsigned int PCMREC_MAGIC = 0x4D435050;	// "PPCM"
+static const unsigned int PCMREC_VERSION = 1;
+
+//
+// Map a recording file. A writer creates or resizes it to hold the given number of
+// slots, a reader maps whatever is there.
+//
+
+static PCMRecordHeader *MapRecording(const char *filename, unsigned int slots, bool write, void *&file, void *&mapping)
+{
+	size_t size = sizeof(PCMRecordHeader) + (size_t)slots * sizeof(PCMRecordSlot);
+
+	HANDLE f = CreateFileA(filename, write ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+		NULL, write ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (f == INVALID_HANDLE_VALUE)
+		return 0;
+
+	if (!write)
+	{
+		LARGE_INTEGER len;
+		if (!GetFileSizeEx(f, &len) || len.QuadPart < (LONGLONG) sizeof(PCMRecordHeader))
+		{
+			CloseHandle(f);
+			return 0;
+		}
+		size = (size_t)len.QuadPart;
+	}
+
+	HANDLE m = CreateFileMappingA(f, NULL, write ? PAGE_READWRITE : PAGE_READONLY, (DWORD)((unsigned __int64)size >> 32), (DWORD)(size & 0xFFFFFFFF), NULL);
+	if (!m)
+	{
+		CloseHandle(f);
+		return 0;
+	}
+
+	void *view = MapViewOfFile(m, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+	if (!view)
+	{
+		CloseHandle(m);
+		CloseHandle(f);
+		return 0;
+	}
+
+	file = f;
+	mapping = m;
+	return (PCMRecordHeader *)view;
+}
+
+static void UnmapRecording(PCMRecordHeader *header, void *file, void *mapping)
+{
+	if (header)
+		UnmapViewOfFile(header);
+	if (mapping)
+		CloseHandle((HANDLE)mapping);
+	if (file)
+		CloseHandle((HANDLE)file);
+}
+
+PCMRecorder::PCMRecorder()
+{
+	file = 0;
+	mapping = 0;
+	header = 0;
+	slots = 0;
+	current = 0;
+	fileName[0] = 0;
+}
+
+PCMRecorder::~PCMRecorder()
+{
+	Close();
+}
+
+bool PCMRecorder::Open(const char *filename, unsigned int nslots)
+{
+	Close();
+
+	if (nslots < 1)
+		return false;
+
+	header = MapRecording(filename, nslots, true, file, mapping);
+	if (!header)
+		return false;
+
+	slots = (PCMRecordSlot *)(header + 1);
+
+	//
+	// Start a new ring unless this is a recording we can carry on.
+	//
+
+	if (header->magic != PCMREC_MAGIC || header->version != PCMREC_VERSION || header->slots != nslots ||
+		header->slotSize != sizeof(PCMRecordSlot) || header->next >= nslots || header->count > nslots)
+	{
+		header->magic = PCMREC_MAGIC;
+		header->version = PCMREC_VERSION;
+		header->slots = nslots;
+		header->slotSize = sizeof(PCMRecordSlot);
+		header->next = 0;
+		header->count = 0;
+		header->sequence = 0;
+		header->reserved = 0;
+	}
+
+	strncpy(fileName, filename, 255);
+	fileName[255] = 0;
+
+	StartFrame();
+	return true;
+}
+
+void PCMRecorder::Close()
+{
+	if (header)
+		FlushViewOfFile(header, 0);
+
+	UnmapRecording(header, file, mapping);
+
+	file = 0;
+	mapping = 0;
+	header = 0;
+	slots = 0;
+	current = 0;
+	fileName[0] = 0;
+}
+
+void PCMRecorder::StartFrame()
+{
+	//
+	// With a full ring the slot we're about to fill holds the oldest frame, which
+	// stops being part of the recording before we write over it.
+	//
+
+	if (header->count >= header->slots)
+	{
+		header->count = header->slots - 1;
+		MemoryBarrier();
+	}
+
+	current = &slots[header->next];
+	current->words = 0;
+	current->flags = 0;
+}
+
+void PCMRecorder::EndFrame(double simt, int rate)
+{
+	if (!current)
+		return;
+
+	current->simt = simt;
+	current->rate = (unsigned char)rate;
+	current->sequence = header->sequence++;
+
+	//
+	// The frame is complete before the head moves on, so a reader never sees a
+	// half written frame.
+	//
+
+	MemoryBarrier();
+
+	header->next = (header->next + 1) % header->slots;
+	if (header->count < header->slots)
+		header->count++;
+
+	StartFrame();
+}
+
+PCMReplay::PCMReplay()
+{
+	file = 0;
+	mapping = 0;
+	header = 0;
+	slots = 0;
+	position = 0;
+	positionSequence = 0;
+	wordOffset = 0;
+}
+
+PCMReplay::~PCMReplay()
+{
+	Close();
+}
+
+bool PCMReplay::Open(const char *filename)
+{
+	Close();
+
+	header = MapRecording(filename, 0, false, file, mapping);
+	if (!header)
+		return false;
+
+	if (header->magic != PCMREC_MAGIC || header->version != PCMREC_VERSION || header->slotSize != sizeof(PCMRecordSlot) || header->slots < 1)
+	{
+		Close();
+		return false;
+	}
+
+	slots = (PCMRecordSlot *)(header + 1);
+	position = 0;
+	wordOffset = 0;
+
+	const PCMRecordSlot *s = GetFrame(0);
+	positionSequence = s ? s->sequence : 0;
+
+	return true;
+}
+
+void PCMReplay::Close()
+{
+	UnmapRecording(header, file, mapping);
+
+	file = 0;
+	mapping = 0;
+	header = 0;
+	slots = 0;
+}
+
+unsigned int PCMReplay::Frames()
+{
+	if (!header)
+		return 0;
+
+	return header->count;
+}
+
+const PCMRecordSlot *PCMReplay::GetFrame(unsigned int n)
+{
+	if (!header || n >= header->count)
+		return 0;
+
+	unsigned int oldest = (header->next + header->slots - header->count) % header->slots;
+	return &slots[(oldest + n) % header->slots];
+}
+
+bool PCMReplay::Seek(double simt)
+{
+	unsigned int lo = 0, hi = Frames();
+
+	while (lo < hi)
+	{
+		unsigned int mid = (lo + hi) / 2;
+
+		if (GetFrame(mid)->simt < simt)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo >= Frames())
+		return false;
+
+	position = lo;
+	positionSequence = GetFrame(lo)->sequence;
+	wordOffset = 0;
+	return true;
+}
+
+int PCMReplay::Read(unsigned char *buf, int size)
+{
+	int n = 0;
+
+	while (n < size)
+	{
+		const PCMRecordSlot *s = GetFrame(position);
+		if (!s)
+			break;
+
+		//
+		// If the recorder has overwritten our position in the meantime, the frame we
+		// wanted is gone and the oldest one is the best we can do.
+		//
+
+		if (s->sequence != positionSequence)
+		{
+			unsigned int behind = positionSequence - GetFrame(0)->sequence;
+
+			if (behind < Frames())
+				position = behind;
+			else
+				position = 0;
+
+			s = GetFrame(position);
+			positionSequence = s->sequence;
+			wordOffset = 0;
+		}
+
+		int words = s->words - wordOffset;
+		if (words > size - n)
+			words = size - n;
+
+		memcpy(buf + n, s->data + wordOffset, words);
+		n += words;
+		wordOffset += words;
+
+		if (wordOffset >= s->words)
+		{
+			position++;
+			positionSequence++;
+			wordOffset = 0;
+		}
+	}
+
+	return n;
+}
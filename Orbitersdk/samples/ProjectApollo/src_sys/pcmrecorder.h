@@ -0,0 +1,166 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  PCM telemetry recorder and replay
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_PCMRECORDER_H)
+#define _PA_PCMRECORDER_H
+
+///
+/// Largest frame we can record. CSM HBR frames are 128 words, LM LBR frames 200.
+///
+#define PCMREC_MAX_WORDS	256
+
+///
+/// Default recording size: one hour of CSM HBR telemetry. At 272 bytes a slot that
+/// is about 49 MB, which has to fit into a 32-bit Orbiter's address space once per
+/// recording vessel.
+///
+#define PCMREC_DEFAULT_SLOTS	(50 * 3600)
+
+enum PCMRecordRate
+{
+	PCMREC_LBR = 0,
+	PCMREC_HBR = 1
+};
+
+///
+/// One recorded frame. The file is a PCMRecordHeader followed by a fixed number of
+/// these, used as a ring. Frames are stored in time order starting at the oldest one,
+/// so the slots double as the time index.
+///
+struct PCMRecordSlot
+{
+	double simt;						///< Sim time at the end of the frame.
+	unsigned int sequence;				///< Running frame number.
+	unsigned short words;				///< Valid words in data.
+	unsigned char rate;					///< PCMRecordRate.
+	unsigned char flags;
+	unsigned char data[PCMREC_MAX_WORDS];
+};
+
+struct PCMRecordHeader
+{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int slots;					///< Number of slots in the ring.
+	unsigned int slotSize;				///< sizeof(PCMRecordSlot) when written.
+	unsigned int next;					///< Slot the next frame goes into.
+	unsigned int count;					///< Valid slots, at most slots.
+	unsigned int sequence;				///< Sequence number of the next frame.
+	unsigned int reserved;
+};
+
+///
+/// \brief Flight-recorder style PCM telemetry recorder.
+///
+/// Frames are written straight into a memory-mapped ring file of fixed size, so
+/// recording a word is a store into mapped memory: no system call and no allocation
+/// on the sim thread. A frame only becomes visible to readers when EndFrame() moves
+/// the ring head on. Reopening an existing recording of the same size carries on
+/// where it stopped.
+///
+class PCMRecorder
+{
+public:
+	PCMRecorder();
+	virtual ~PCMRecorder();
+
+	bool Open(const char *filename, unsigned int slots = PCMREC_DEFAULT_SLOTS);
+	void Close();
+	bool IsOpen() { return (header != 0); };
+	const char *GetFileName() { return fileName; };
+
+	///
+	/// Add a word to the frame being recorded. Words past PCMREC_MAX_WORDS are dropped.
+	///
+	void AddWord(unsigned char word)
+	{
+		if (current && current->words < PCMREC_MAX_WORDS)
+			current->data[current->words++] = word;
+	};
+
+	///
+	/// Finish the current frame and make it part of the recording.
+	///
+	void EndFrame(double simt, int rate);
+
+protected:
+	void StartFrame();
+
+	void *file;
+	void *mapping;
+	PCMRecordHeader *header;
+	PCMRecordSlot *slots;
+	PCMRecordSlot *current;
+	char fileName[256];
+};
+
+///
+/// \brief Reads a recording back as a continuous word stream.
+///
+/// The recording is mapped read-only and may still be written by a PCMRecorder in the
+/// same or another process.
+///
+class PCMReplay
+{
+public:
+	PCMReplay();
+	virtual ~PCMReplay();
+
+	bool Open(const char *filename);
+	void Close();
+	bool IsOpen() { return (header != 0); };
+
+	///
+	/// Number of recorded frames.
+	///
+	unsigned int Frames();
+
+	///
+	/// Frame by age, 0 is the oldest one in the ring.
+	///
+	const PCMRecordSlot *GetFrame(unsigned int n);
+
+	///
+	/// Position the stream at the first frame at or after simt. Binary search over
+	/// the time ordered ring. Returns false if there is no such frame.
+	///
+	bool Seek(double simt);
+
+	///
+	/// Copy up to size words of the stream to buf, starting where the last call
+	/// stopped. Returns the number of words copied, 0 at the end of the recording.
+	///
+	int Read(unsigned char *buf, int size);
+
+protected:
+	void *file;
+	void *mapping;
+	PCMRecordHeader *header;
+	PCMRecordSlot *slots;
+	unsigned int position;				///< Next frame to read, by age.
+	unsigned int positionSequence;		///< Its sequence number, to notice overwrites.
+	int wordOffset;						///< Next word in that frame.
+};
+
+#endif // _PA_PCMRECORDER_H
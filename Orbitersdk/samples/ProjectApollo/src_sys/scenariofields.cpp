@@ -0,0 +1,215 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Table driven scenario loading and saving of plain data members
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include "Orbitersdk.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "papi.h"
+#include "scenariofields.h"
+
+ScenarioFieldTable::ScenarioFieldTable()
+{
+	base = 0;
+	built = false;
+}
+
+void ScenarioFieldTable::Begin(void *obj)
+{
+	fields.clear();
+	sorted.clear();
+	base = (char *)obj;
+	built = false;
+}
+
+void ScenarioFieldTable::AddField(const char *name, int type, void *member)
+{
+	Field f;
+
+	f.name = name;
+	f.type = type;
+	f.offset = (char *)member - base;
+
+	fields.push_back(f);
+}
+
+void ScenarioFieldTable::Add(const char *name, bool &b)
+{
+	AddField(name, SCNFIELD_BOOL, &b);
+}
+
+void ScenarioFieldTable::Add(const char *name, int &i)
+{
+	AddField(name, SCNFIELD_INT, &i);
+}
+
+void ScenarioFieldTable::Add(const char *name, double &d)
+{
+	AddField(name, SCNFIELD_DOUBLE, &d);
+}
+
+void ScenarioFieldTable::Add(const char *name, VECTOR3 &v)
+{
+	AddField(name, SCNFIELD_VEC, &v);
+}
+
+void ScenarioFieldTable::Add(const char *name, MATRIX3 &m)
+{
+	AddField(name, SCNFIELD_MX, &m);
+}
+
+void ScenarioFieldTable::End()
+{
+	sorted.resize(fields.size());
+	for (size_t i = 0; i < fields.size(); i++)
+	{
+		sorted[i] = (int)i;
+	}
+
+	std::sort(sorted.begin(), sorted.end(), [this](int a, int b) { return strcmp(fields[a].name, fields[b].name) < 0; });
+
+	base = 0;
+	built = true;
+}
+
+int ScenarioFieldTable::Find(const char *name)
+{
+	int lo = 0, hi = (int)sorted.size() - 1;
+
+	while (lo <= hi)
+	{
+		int mid = (lo + hi) / 2;
+		int c = strcmp(name, fields[sorted[mid]].name);
+
+		if (c == 0)
+			return sorted[mid];
+		if (c < 0)
+			hi = mid - 1;
+		else
+			lo = mid + 1;
+	}
+
+	return -1;
+}
+
+void ScenarioFieldTable::Save(FILEHANDLE scn, void *obj)
+{
+	char *p = (char *)obj;
+
+	for (std::vector<Field>::iterator it = fields.begin(); it != fields.end(); ++it)
+	{
+		char *name = (char *)it->name;
+		void *member = p + it->offset;
+
+		switch (it->type)
+		{
+		case SCNFIELD_BOOL:
+			papiWriteScenario_bool(scn, name, *(bool *)member);
+			break;
+
+		case SCNFIELD_INT:
+			oapiWriteScenario_int(scn, name, *(int *)member);
+			break;
+
+		case SCNFIELD_DOUBLE:
+			papiWriteScenario_double(scn, name, *(double *)member);
+			break;
+
+		case SCNFIELD_VEC:
+			papiWriteScenario_vec(scn, name, *(VECTOR3 *)member);
+			break;
+
+		case SCNFIELD_MX:
+			papiWriteScenario_mx(scn, name, *(MATRIX3 *)member);
+			break;
+		}
+	}
+}
+
+bool ScenarioFieldTable::Load(char *line, void *obj)
+{
+	char name[256];
+	int n;
+
+	if (sscanf(line, "%255s%n", name, &n) != 1)
+		return false;
+
+	int i = Find(name);
+	if (i < 0)
+		return false;
+
+	void *member = (char *)obj + fields[i].offset;
+	char *value = line + n;
+
+	switch (fields[i].type)
+	{
+	case SCNFIELD_BOOL:
+		{
+			int j;
+			if (sscanf(value, "%d", &j) != 1)
+				return false;
+			*(bool *)member = (j != 0);
+		}
+		break;
+
+	case SCNFIELD_INT:
+		{
+			int j;
+			if (sscanf(value, "%d", &j) != 1)
+				return false;
+			*(int *)member = j;
+		}
+		break;
+
+	case SCNFIELD_DOUBLE:
+		{
+			double d;
+			if (sscanf(value, "%lf", &d) != 1)
+				return false;
+			*(double *)member = d;
+		}
+		break;
+
+	case SCNFIELD_VEC:
+		{
+			VECTOR3 v;
+			if (sscanf(value, "%lf %lf %lf", &v.x, &v.y, &v.z) != 3)
+				return false;
+			*(VECTOR3 *)member = v;
+		}
+		break;
+
+	case SCNFIELD_MX:
+		{
+			MATRIX3 m;
+			if (sscanf(value, "%lf %lf %lf %lf %lf %lf %lf %lf %lf", &m.m11, &m.m12, &m.m13, &m.m21, &m.m22, &m.m23, &m.m31, &m.m32, &m.m33) != 9)
+				return false;
+			*(MATRIX3 *)member = m;
+		}
+		break;
+	}
+
+	return true;
+}
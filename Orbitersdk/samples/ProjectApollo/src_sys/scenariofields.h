@@ -0,0 +1,93 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Table driven scenario loading and saving of plain data members
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_SCENARIOFIELDS_H)
+#define _PA_SCENARIOFIELDS_H
+
+#include <vector>
+
+enum ScenarioFieldType
+{
+	SCNFIELD_BOOL = 0,
+	SCNFIELD_INT,
+	SCNFIELD_DOUBLE,
+	SCNFIELD_VEC,
+	SCNFIELD_MX
+};
+
+///
+/// \brief List of the plain data members a class saves to and loads from the scenario.
+///
+/// The list is filled once per class, between Begin() and End(), with the members of
+/// one instance. Only their offsets are stored, so the same list then works for every
+/// instance of the class. Save() writes the fields in the order they were added, Load()
+/// finds the field for a scenario line with a binary search over the sorted names.
+///
+/// Because loading and saving use the same list, a field can't be saved without being
+/// loaded again or the other way round.
+///
+class ScenarioFieldTable
+{
+public:
+	ScenarioFieldTable();
+
+	bool IsBuilt() { return built; };
+
+	void Begin(void *obj);
+	void Add(const char *name, bool &b);
+	void Add(const char *name, int &i);
+	void Add(const char *name, double &d);
+	void Add(const char *name, VECTOR3 &v);
+	void Add(const char *name, MATRIX3 &m);
+	void End();
+
+	///
+	/// Write all fields of obj to the scenario, same format as the papiWriteScenario functions.
+	///
+	void Save(FILEHANDLE scn, void *obj);
+
+	///
+	/// Set the field named by the first word of the line. Returns false if the line
+	/// doesn't belong to any field or its value can't be read.
+	///
+	bool Load(char *line, void *obj);
+
+protected:
+	struct Field
+	{
+		const char *name;
+		int type;
+		size_t offset;
+	};
+
+	void AddField(const char *name, int type, void *member);
+	int Find(const char *name);
+
+	std::vector<Field> fields;		// In save order
+	std::vector<int> sorted;		// Indices into fields, sorted by name
+	char *base;
+	bool built;
+};
+
+#endif // _PA_SCENARIOFIELDS_H
@@ -0,0 +1,64 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Rate limited sampling of systems status
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_SENSORSAMPLE_H)
+#define _PA_SENSORSAMPLE_H
+
+///
+/// \brief One sampled copy of a systems status structure.
+///
+/// The status is rebuilt at most rate times a second; consumers in between get
+/// the last sample. Going back in time (a scenario reload) always resamples.
+///
+template <class T> class SensorSample
+{
+public:
+	SensorSample(double rate = 10.0) { SetRate(rate); Invalidate(); };
+
+	///
+	/// \param rate Samples per second.
+	///
+	void SetRate(double rate) { interval = (rate > 0.0) ? 1.0 / rate : 0.0; };
+	void Invalidate() { last = -1.0e10; };
+
+	///
+	/// \return true if value needs sampling at simt; the sample is then taken to be fresh.
+	///
+	bool Due(double simt)
+	{
+		if (simt >= last && simt - last < interval)
+			return false;
+
+		last = simt;
+		return true;
+	};
+
+	T value;
+
+protected:
+	double interval;
+	double last;
+};
+
+#endif // _PA_SENSORSAMPLE_H
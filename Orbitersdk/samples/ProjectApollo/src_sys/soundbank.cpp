@@ -0,0 +1,293 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Sound file index and memory mapped wave files
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1300) //Microsoft Visual Studio Version 2003 and higher
+#define _CRT_SECURE_NO_DEPRECATE
+#endif
+
+#include <string.h>
+#include <ctype.h>
+
+#include <map>
+#include <mutex>
+#include <unordered_set>
+
+#include "soundbank.h"
+#include "jobscheduler.h"
+
+//
+// Directory listings and live mappings, keyed by lower case path with forward
+// slashes.
+//
+
+static std::mutex bankLock;
+static std::map<std::string, std::unordered_set<std::string> > directories;
+static std::map<std::string, std::weak_ptr<const SoundWave> > waves;
+
+SoundWave::SoundWave()
+
+{
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+	view = NULL;
+	size = 0;
+	data = NULL;
+	dataSize = 0;
+}
+
+SoundWave::~SoundWave()
+
+{
+	if (view)
+		UnmapViewOfFile(view);
+	if (mapping)
+		CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+}
+
+bool SoundWave::Map(const char *path)
+
+{
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	size = GetFileSize(file, NULL);
+	if (size == INVALID_FILE_SIZE || size < 12)
+		return false;
+
+	mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping)
+		return false;
+
+	view = (const unsigned char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+		return false;
+
+	return Parse();
+}
+
+static DWORD ReadDWord(const unsigned char *p)
+
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((DWORD) p[3] << 24);
+}
+
+bool SoundWave::Parse()
+
+{
+	if (memcmp(view, "RIFF", 4) || memcmp(view + 8, "WAVE", 4))
+		return false;
+
+	//
+	// Walk the chunks for 'fmt ' and 'data'. Chunks are padded to an even
+	// size, and a truncated data chunk is played as far as it goes.
+	//
+	DWORD pos = 12;
+
+	while (pos + 8 <= size && (format.empty() || !data))
+	{
+		const unsigned char *chunk = view + pos;
+		DWORD chunkSize = ReadDWord(chunk + 4);
+		DWORD avail = size - (pos + 8);
+
+		if (!memcmp(chunk, "fmt ", 4))
+		{
+			if (chunkSize < sizeof(PCMWAVEFORMAT) || chunkSize > avail)
+				return false;
+
+			const WAVEFORMATEX *wfx = (const WAVEFORMATEX *) (chunk + 8);
+			DWORD extra = 0;
+
+			if (wfx->wFormatTag != WAVE_FORMAT_PCM && chunkSize >= sizeof(WAVEFORMATEX))
+			{
+				extra = wfx->cbSize;
+				if (extra > chunkSize - sizeof(WAVEFORMATEX))
+					extra = chunkSize - sizeof(WAVEFORMATEX);
+			}
+
+			format.assign(sizeof(WAVEFORMATEX) + extra, 0);
+			memcpy(&format[0], chunk + 8, (extra ? sizeof(WAVEFORMATEX) + extra : sizeof(PCMWAVEFORMAT)));
+			((WAVEFORMATEX *) &format[0])->cbSize = (WORD) extra;
+		}
+		else if (!memcmp(chunk, "data", 4))
+		{
+			data = chunk + 8;
+			dataSize = (chunkSize > avail) ? avail : chunkSize;
+		}
+
+		if (chunkSize > avail)
+			break;
+
+		pos += 8 + chunkSize + (chunkSize & 1);
+	}
+
+	return !format.empty() && data != NULL;
+}
+
+void SoundWave::Touch() const
+
+{
+	volatile unsigned char sum = 0;
+
+	for (DWORD i = 0; i < dataSize; i += 4096)
+		sum += data[i];
+}
+
+std::string SoundBank::Key(const char *path)
+
+{
+	std::string key(path);
+
+	for (size_t i = 0; i < key.size(); i++)
+	{
+		if (key[i] == '\\')
+			key[i] = '/';
+		else
+			key[i] = (char) tolower((unsigned char) key[i]);
+	}
+
+	return key;
+}
+
+bool SoundBank::FileExists(const char *path)
+
+{
+	std::string key = Key(path);
+	std::string dir, name;
+
+	size_t slash = key.rfind('/');
+	if (slash == std::string::npos)
+	{
+		dir = ".";
+		name = key;
+	}
+	else
+	{
+		dir = key.substr(0, slash);
+		name = key.substr(slash + 1);
+	}
+
+	std::lock_guard<std::mutex> lock(bankLock);
+
+	std::map<std::string, std::unordered_set<std::string> >::iterator it = directories.find(dir);
+	if (it == directories.end())
+	{
+		std::unordered_set<std::string> &files = directories[dir];
+		WIN32_FIND_DATAA data;
+
+		HANDLE find = FindFirstFileA((dir + "/*").c_str(), &data);
+		if (find != INVALID_HANDLE_VALUE)
+		{
+			do
+			{
+				if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+					files.insert(Key(data.cFileName));
+			} while (FindNextFileA(find, &data));
+
+			FindClose(find);
+		}
+
+		return files.count(name) != 0;
+	}
+
+	return it->second.count(name) != 0;
+}
+
+SoundWaveHandle SoundBank::GetWave(const char *path)
+
+{
+	std::string key = Key(path);
+	std::lock_guard<std::mutex> lock(bankLock);
+
+	SoundWaveHandle wave = waves[key].lock();
+	if (wave)
+		return wave;
+
+	std::shared_ptr<SoundWave> w(new SoundWave());
+	if (!w->Map(path))
+	{
+		waves.erase(key);
+		return SoundWaveHandle();
+	}
+
+	waves[key] = w;
+	return w;
+}
+
+void SoundBank::Rescan()
+
+{
+	std::lock_guard<std::mutex> lock(bankLock);
+
+	directories.clear();
+}
+
+SoundPrefetch::SoundPrefetch()
+
+{
+	jobs = NULL;
+}
+
+SoundPrefetch::~SoundPrefetch()
+
+{
+	if (job)
+	{
+		job->Cancel();
+		job->GetFuture().wait();
+	}
+
+	delete jobs;
+}
+
+void SoundPrefetch::Prefetch(const char *path)
+
+{
+	if (!jobs)
+		jobs = new JobScheduler(1);
+
+	//
+	// A prefetch that hasn't started yet is no longer needed.
+	//
+	if (job)
+		job->Cancel();
+
+	std::shared_ptr<SoundWaveHandle> slot(new SoundWaveHandle());
+	std::string file(path);
+
+	pinned = slot;
+	job = jobs->Submit(0, JOB_PRIORITY_LOW, [slot, file](JobState &state) {
+		if (state.IsCancelled())
+			return 0;
+
+		SoundWaveHandle wave = SoundBank::GetWave(file.c_str());
+		if (wave)
+			wave->Touch();
+
+		*slot = wave;
+		return 0;
+	});
+}
@@ -0,0 +1,131 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Sound file index and memory mapped wave files
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_SOUNDBANK_H)
+#define _PA_SOUNDBANK_H
+
+#include <windows.h>
+#include <mmsystem.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class JobScheduler;
+class JobState;
+
+///
+/// \brief A WAV file mapped read-only into memory.
+/// \ingroup Sound
+///
+/// The RIFF chunks are parsed once when the file is mapped; GetData() points
+/// straight into the mapping, so playing the sound copies the samples only
+/// into the DirectSound buffer.
+///
+class SoundWave
+{
+public:
+	~SoundWave();
+
+	const WAVEFORMATEX *GetFormat() const { return (const WAVEFORMATEX *) &format[0]; };
+	const unsigned char *GetData() const { return data; };
+	DWORD GetDataSize() const { return dataSize; };
+
+	///
+	/// Read every page of the samples, so playing them doesn't wait for the disk.
+	///
+	void Touch() const;
+
+protected:
+	SoundWave();
+
+	bool Map(const char *path);
+	bool Parse();
+
+	HANDLE file;
+	HANDLE mapping;
+	const unsigned char *view;
+	DWORD size;
+
+	///
+	/// The 'fmt ' chunk as a complete WAVEFORMATEX: PCM files leave out cbSize.
+	///
+	std::vector<unsigned char> format;
+	const unsigned char *data;
+	DWORD dataSize;
+
+	friend class SoundBank;
+};
+
+typedef std::shared_ptr<const SoundWave> SoundWaveHandle;
+
+///
+/// \brief Shared index of the sound directories and the wave files in use.
+/// \ingroup Sound
+///
+/// Each directory is listed once, the first time a file in it is looked for,
+/// so checking the language, mission and generic directories for a sound no
+/// longer opens files. Files added to a directory while Orbiter is running are
+/// not seen until Rescan().
+///
+/// Wave files are mapped once and shared: GetWave() returns the existing
+/// mapping for as long as anyone holds a handle to it. All calls are thread
+/// safe.
+///
+class SoundBank
+{
+public:
+	static bool FileExists(const char *path);
+	static SoundWaveHandle GetWave(const char *path);
+	static void Rescan();
+
+protected:
+	static std::string Key(const char *path);
+};
+
+///
+/// \brief Background loading of the next sounds to be played.
+/// \ingroup Sound
+///
+/// OrbiterSound reads its own copy of a sound when it's loaded, and the timed
+/// sounds are loaded just before they're due. Prefetch() maps the file and
+/// reads it on a worker thread well before that, so the load is served from
+/// the file cache rather than stalling the frame on the disk. The last
+/// prefetched file stays mapped until the next Prefetch().
+///
+class SoundPrefetch
+{
+public:
+	SoundPrefetch();
+	~SoundPrefetch();
+
+	void Prefetch(const char *path);
+
+protected:
+	JobScheduler *jobs;
+	std::shared_ptr<JobState> job;
+	std::shared_ptr<SoundWaveHandle> pinned;
+};
+
+#endif // _PA_SOUNDBANK_H
@@ -30,10 +30,13 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <vector>
+
 #include "resource.h"
 
 #include "soundlib.h"
 #include "soundevents.h"
+#include "soundbank.h"
 
 #include "tracer.h"
 #include "nasspdefs.h"
@@ -53,6 +56,24 @@ static int nSoundsLoaded = 0;
 static SoundEvent soundevents[MAX_SOUND_EVENT];
 static int SoundEventLoaded = false;
 
+//
+// The loaded sounds, kept mapped so playing one doesn't have to open it.
+//
+static std::vector<SoundWaveHandle> soundEventWaves;
+
+static void MapSoundEvents(int count)
+
+{
+	soundEventWaves.clear();
+
+	for (int i = 0; i < count; i++)
+	{
+		SoundWaveHandle wave = SoundBank::GetWave(soundevents[i].filenames);
+		if (wave)
+			soundEventWaves.push_back(wave);
+	}
+}
+
 // MODIF x15 to manage landing mission sound
 SoundEvent::SoundEvent()
 
@@ -90,7 +111,7 @@ int SoundEvent::makeInvalid()
 
 
 
-int SoundEvent::play(SoundLib soundlib,
+int SoundEvent::play(SoundLib &soundlib,
 					 VESSEL   *Vessel,
 					  char    *names ,
 					  double  *offset,
@@ -320,7 +341,7 @@ int SoundEvent::play(SoundLib soundlib,
 }
 
 
-int SoundEvent::LoadMissionLandingSoundArray(SoundLib soundlib,char *soundname)
+int SoundEvent::LoadMissionLandingSoundArray(SoundLib &soundlib,char *soundname)
 
 {
 	char	SoundPath[256];
@@ -605,6 +626,8 @@ TRACE(SoundPath);
 		done = (kk >= indice);
 	}
 
+	MapSoundEvents(indice);
+
     SoundEventLoaded = true;
 	return true;
 	
@@ -616,7 +639,7 @@ TRACE(SoundPath);
 // This uses only the MET.
 //
 
-int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, double MissionTime)
+int SoundEvent::LoadMissionTimeSoundArray(SoundLib &soundlib, char *soundname, double MissionTime)
 
 {
 	char	SoundPath[256];
@@ -652,12 +675,19 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 
  	_snprintf(rootfilenames, 255, "%s/%s/", soundlib.basepath, soundlib.missionpath);
 
+	//
+	// Read the whole script into a timeline, then keep as many sounds as fit from the
+	// mission time on.
+	//
+	SoundTimeline timeline;
+
 	while (fgets(lines, 255, fp) != NULL && lines[0])
     {
-		if (lines[0] != '#' && indice < MAX_SOUND_EVENT)
+		if (lines[0] != '#')
 		{
 			buff = lines;
 			bool negative = false;
+			double met;
 
 			buff2 = strchr(buff,';');
 
@@ -681,18 +711,18 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 				/* first decode MET */
 				memset(hours,0,sizeof(hours));
 				strncpy(hours,buffers,3);
-				soundevents[indice].met = atoi(hours)*3600.0;
+				met = atoi(hours)*3600.0;
 
 				memset(mins,0,sizeof(mins));
 				strncpy(mins,buffers+4,2);
-				soundevents[indice].met += atoi(mins)*60.0;
+				met += atoi(mins)*60.0;
 
 				memset(secs,0,sizeof(secs));
 				strncpy(secs,buffers+7,2);
-				soundevents[indice].met += (double) atoi(secs);
+				met += (double) atoi(secs);
 
 				if (negative)
-					soundevents[indice].met = -soundevents[indice].met;
+					met = -met;
 
 				/* generate filenames */
 				buff = buff2 + 1;
@@ -709,42 +739,56 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 
 				*buff2 = 0;
 
-				strcpy(soundevents[indice].filenames, rootfilenames);
+				_snprintf(buffers, 254, "%s%s.wav", rootfilenames, buff);
+				buffers[254] = 0;
 
-				strcat(soundevents[indice].filenames, buff);
-				strcat(soundevents[indice].filenames, ".wav");
+				TimedSound t;
 
-				soundevents[indice].altitude = 0.0;
-				soundevents[indice].mode = 3;
-				soundevents[indice].timetoignition = 0.0;
-				soundevents[indice].mandatory = true;
-				soundevents[indice].timetoapproach = 0.0;
-
-				sprintf(buffers,"LOADED %d %f %f %s ",indice,
-							soundevents[indice].timetoignition,
-							soundevents[indice].timeafterignition,
-							soundevents[indice].filenames);
-				TRACE(buffers);
-		
-				//
-				// Just reuse this slot if the MET is less than the mission time.
-				//
-				if (soundevents[indice].met >= MissionTime)
-					indice++;
+				t.SetFilename(buffers);
+				t.SetPlayTime(met);
+				timeline.Add(t);
 			}
 		}
 	}
 
 	fclose(fp);
+
+	timeline.Sort();
+	timeline.Seek(MissionTime);
+
+	TimedSound *t;
+
+	while ((t = timeline.Current()) != 0 && indice < MAX_SOUND_EVENT - 1)
+	{
+		soundevents[indice].met = t->GetPlayTime();
+		strcpy(soundevents[indice].filenames, t->GetFilename());
+
+		soundevents[indice].altitude = 0.0;
+		soundevents[indice].mode = 3;
+		soundevents[indice].timetoignition = 0.0;
+		soundevents[indice].mandatory = true;
+		soundevents[indice].timetoapproach = 0.0;
+
+		sprintf(buffers,"LOADED %d %f %f %s ",indice,
+					soundevents[indice].timetoignition,
+					soundevents[indice].timeafterignition,
+					soundevents[indice].filenames);
+		TRACE(buffers);
+
+		indice++;
+		timeline.Next();
+	}
+
     soundevents[indice].met = MINUS_INFINITY;
 
 	nSoundsLoaded = indice;
+	MapSoundEvents(indice);
 
     SoundEventLoaded = true;
 	return true;
 }
 
-int SoundEvent::InitDirectSound(SoundLib soundlib)
+int SoundEvent::InitDirectSound(SoundLib &soundlib)
 {
 
 //    LPDIRECTSOUND8  m_pDS;
@@ -801,7 +845,6 @@ int SoundEvent::InitDirectSound(SoundLib soundlib)
 
 int SoundEvent::PlaySound(char *filenames,int newbuffer, double offset)
 {
-    HMMIO m_hmmio;
     HRESULT hr;
 
     TRACESETUP("PLAYSOUND");
@@ -809,172 +852,18 @@ int SoundEvent::PlaySound(char *filenames,int newbuffer, double offset)
 	if(newbuffer)
 	{
 
-	m_hmmio = mmioOpen( filenames, NULL, MMIO_ALLOCBUF | MMIO_READ );
-
-	if( NULL == m_hmmio )
-	{
-		TRACE ("DIRECT SOUND ERROR MMIOOPEN");
-		return (false);
-	}
-
-    MMCKINFO        ckIn;           // chunk info. for general use.
-    PCMWAVEFORMAT   pcmWaveFormat;  // Temp PCM structure to load in.
-
-	WAVEFORMATEX* m_pwfx;        // Pointer to WAVEFORMATEX structure
-    MMCKINFO      m_ck;          // Multimedia RIFF chunk
-    MMCKINFO      m_ckRiff;      // Use in opening a WAVE file
-    DWORD         m_dwSize;      // The size of the wave file
-    MMIOINFO      m_mmioinfoOut;
-    DWORD         m_dwFlags;
-
-#define WAVEFILE_READ   1
-#define WAVEFILE_WRITE  2
-	
-	
-	   m_pwfx = NULL;
-
-    if( ( 0 != mmioDescend( m_hmmio, &m_ckRiff, NULL, 0 ) ) )
+	//
+	// The wave is parsed once and mapped by the sound bank, and the landing sounds
+	// are already mapped when the array is loaded.
+	//
+	SoundWaveHandle wave = SoundBank::GetWave(filenames);
+	if (!wave)
 	{
-        TRACE ("DIRECT SOUND ERROR MMIODESCEND");
+		TRACE ("DIRECT SOUND ERROR OPENING WAVE");
 		return (false);
 	}
 
-    // Check to make sure this is a valid wave file
-    if( (m_ckRiff.ckid != FOURCC_RIFF) ||
-        (m_ckRiff.fccType != mmioFOURCC('W', 'A', 'V', 'E') ) )
-	{
-		return(false);
-        TRACE ("DIRECT SOUND ERROR MMIOFOURCC");
-	}
-
-    // Search the input file for for the 'fmt ' chunk.
-    ckIn.ckid = mmioFOURCC('f', 'm', 't', ' ');
-    if( 0 != mmioDescend( m_hmmio, &ckIn, &m_ckRiff, MMIO_FINDCHUNK ) )
-	{
-        TRACE("DIRECT SOUND ERROR MMIDESCENT FIND CHUNK");
-		return(false);
-	}
-
-    // Expect the 'fmt' chunk to be at least as large as <PCMWAVEFORMAT>;
-    // if there are extra parameters at the end, we'll ignore them
-    if( ckIn.cksize < (LONG) sizeof(PCMWAVEFORMAT) )
-	{
-        TRACE ("DIRECT SOUND ERROR CHUNKSIZE");
-		return(false);
-	}
-
-    // Read the 'fmt ' chunk into <pcmWaveFormat>.
-    if( mmioRead( m_hmmio, (HPSTR) &pcmWaveFormat,
-                  sizeof(pcmWaveFormat)) != sizeof(pcmWaveFormat) )
-	{
-        TRACE ("DIRECT SOUND ERROR MMIOREAD");
-		return(false);
-	}
-
-    // Allocate the waveformatex, but if its not pcm format, read the next
-    // word, and thats how many extra bytes to allocate.
-    if( pcmWaveFormat.wf.wFormatTag == WAVE_FORMAT_PCM )
-    {
-        m_pwfx = (WAVEFORMATEX*)new CHAR[ sizeof(WAVEFORMATEX) ];
-        if( NULL == m_pwfx )
-		{
-            TRACE("DIRECT SOUND ERROR ALLOC");
-			return(false);
-		}
-
-        // Copy the bytes from the pcm structure to the waveformatex structure
-        memcpy( m_pwfx, &pcmWaveFormat, sizeof(pcmWaveFormat) );
-        m_pwfx->cbSize = 0;
-    }
-    else
-    {
-        // Read in length of extra bytes.
-        WORD cbExtraBytes = 0L;
-        if( mmioRead( m_hmmio, (CHAR*)&cbExtraBytes, sizeof(WORD)) != sizeof(WORD) )
-		{
-            TRACE ("DIRECT SOUND ERROR M_HMMIO");
-			return(false);
-		}
-
-        m_pwfx = (WAVEFORMATEX*)new CHAR[ sizeof(WAVEFORMATEX) + cbExtraBytes ];
-        if( NULL == m_pwfx )
-		{
-            TRACE("DIRECT SOUND ERREOR ALLOC 2");
-			return(false);
-		}
-
-        // Copy the bytes from the pcm structure to the waveformatex structure
-        memcpy( m_pwfx, &pcmWaveFormat, sizeof(pcmWaveFormat) );
-        m_pwfx->cbSize = cbExtraBytes;
-
-        // Now, read those extra bytes into the structure, if cbExtraAlloc != 0.
-        if( mmioRead( m_hmmio, (CHAR*)(((BYTE*)&(m_pwfx->cbSize))+sizeof(WORD)),
-                      cbExtraBytes ) != cbExtraBytes )
-        {
-            //SAFE_DELETE( m_pwfx );
-            TRACE("DIRECT SOUND ERROR MMIOREAD2");
-			return(false);
-        }
-    }
-
-    // Ascend the input file out of the 'fmt ' chunk.
-    if( 0 != mmioAscend( m_hmmio, &ckIn, 0 ) )
-    {
-        //SAFE_DELETE( m_pwfx );
-        TRACE("DIRECT SOUND ERROR MMIOASCEND");
-		return(false);
-    }
-
-	TRACE("DIRECTSOUND READMMIO OK");
-
-
-
-    m_dwFlags = WAVEFILE_READ;
-
-        if( m_dwFlags == WAVEFILE_READ )
-        {
-            // Seek to the data
-            if( -1 == mmioSeek( m_hmmio, m_ckRiff.dwDataOffset + sizeof(FOURCC),
-                            SEEK_SET ) )
-			{
-                TRACE ("DIRECT SOUND ERROR MMIOSEEK");
-				return(false);
-			}
-
-            // Search the input file for the 'data' chunk.
-            m_ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
-            if( 0 != mmioDescend( m_hmmio, &m_ck, &m_ckRiff, MMIO_FINDCHUNK ) )
-			{
-                 TRACE ("DIRECT SOUND ERROR MMIODESCEND");
-				 return(false);
-			}
-        }
-        else
-        {
-            // Create the 'data' chunk that holds the waveform samples.
-            m_ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
-            m_ck.cksize = 0;
-
-            if( 0 != mmioCreateChunk( m_hmmio, &m_ck, 0 ) )
-			{
-                TRACE("DIRECT SOUND ERROR MMIOCREATECHUNK");
-				return(false);
-			}
-
-            if( 0 != mmioGetInfo( m_hmmio, &m_mmioinfoOut, 0 ) )
-			{
-                TRACE ("DIRECT SOUND ERROR MMMIOGETINFO");
-				return(false);
-			}
-		}
-  
-
-	TRACE("DIRECTSOUND RESETFILE OK");
-
- 
-    // After the reset, the size of the wav file is m_ck.cksize so store it now
-    m_dwSize = m_ck.cksize;
-
+    DWORD m_dwSize = wave->GetDataSize();
 
     char buffers[80];
 
@@ -982,11 +871,6 @@ int SoundEvent::PlaySound(char *filenames,int newbuffer, double offset)
 	sprintf(buffers,"%d", m_dwSize);
 	TRACE (buffers);
 
-
-    DWORD                dwDSBufferSize = NULL;
-
-
-
     apDSBuffer = new LPDIRECTSOUNDBUFFER[1];
     if( apDSBuffer == NULL )
     {
@@ -994,19 +878,16 @@ int SoundEvent::PlaySound(char *filenames,int newbuffer, double offset)
 		return(false);
     }
 
-    // Make the DirectSound buffer the same size as the wav file
-    dwDSBufferSize = m_dwSize;
-
-    // Create the direct sound buffer, and only request the flags needed
-    // since each requires some overhead and limits if the buffer can
-    // be hardware accelerated
+    // Create the direct sound buffer, the same size as the wave data, and only
+    // request the flags needed since each requires some overhead and limits if
+    // the buffer can be hardware accelerated
     DSBUFFERDESC dsbd2;
     ZeroMemory( &dsbd2, sizeof(DSBUFFERDESC) );
     dsbd2.dwSize          = sizeof(DSBUFFERDESC);
     dsbd2.dwFlags         = 0;
-    dsbd2.dwBufferBytes   = dwDSBufferSize;
+    dsbd2.dwBufferBytes   = m_dwSize;
     dsbd2.guid3DAlgorithm = GUID_NULL;
-    dsbd2.lpwfxFormat     = m_pwfx;
+    dsbd2.lpwfxFormat     = (LPWAVEFORMATEX) wave->GetFormat();
 
 TRACE ("APPEL CREATE SOUND BUFFER");
 
@@ -1014,21 +895,13 @@ TRACE ("APPEL CREATE SOUND BUFFER");
     // formats may or may not work depending the sound card driver.
     hr = m_pDS->CreateSoundBuffer( &dsbd2, &apDSBuffer[0], NULL );
     if (hr != DS_OK)
-	    TRACE ("ERROR DIRECTSOUND CREATE SOUND BUFFER")
-	else TRACE("DIRECTSOUND CREATE SOUND BUFFER OK");
-
-
-	
-
-    // Make sure we have focus, and we didn't just switch in from
-    // an app which had a DirectSound device
-
-//    hr = RestoreBuffer( &apDSBuffer[0], NULL );
-//    if (hr != DS_OK)
-//	    TRACE ("ERROR DIRECTSOUND RESTORE SOUND BUFFER")
-//	else TRACE("DIRECTSOUND RESTORE SOUND BUFFER OK");
-
-
+	{
+	    TRACE ("ERROR DIRECTSOUND CREATE SOUND BUFFER");
+		delete [] apDSBuffer;
+		apDSBuffer = 0;
+		return(false);
+	}
+	TRACE("DIRECTSOUND CREATE SOUND BUFFER OK");
 
     // Lock the buffer down
     hr = apDSBuffer[0]->Lock( 0, m_dwSize,
@@ -1036,69 +909,13 @@ TRACE ("APPEL CREATE SOUND BUFFER");
                      NULL, NULL, 0L );
     if (hr != DS_OK)
 		 TRACE ("ERROR DIRECTSOUND LOCK")
-	else TRACE ("DIRECTSOUND LOCK OK");
-
-    // Reset the wave file to the beginning
-
-
-    // Seek to the data
-    if( -1 == mmioSeek( m_hmmio, m_ckRiff.dwDataOffset + sizeof(FOURCC),
-                            SEEK_SET ) )
-         TRACE ("ERROR DIRECTSOUND MMIOSEEK")
-	else TRACE ("DIRECTSOUND MMIOSSEEK OK");
-
-    // Search the input file for the 'data' chunk.
-    m_ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
-    if( 0 != mmioDescend( m_hmmio, &m_ck, &m_ckRiff, MMIO_FINDCHUNK ) )
-         TRACE ("ERROR DIRECTSOUND MMIODESCEND")
-	else TRACE ("DIRECTSOUND MMIODESCEND OK");
-
-
-
-    MMIOINFO mmioinfoIn; // current status of m_hmmio
-    DWORD   dwWavDataRead        = 0;    // Amount of data read from the wav file
-
-
-    dwWavDataRead = 0;
-
-    if( 0 != mmioGetInfo( m_hmmio, &mmioinfoIn, 0 ) )
-         TRACE ("ERROR DIRECTSOUND MMIOGETINFO")
-	else TRACE ("DIRECTSOUND MMIOGETINFO OK");
-        
-
-    UINT cbDataIn = m_dwSize;
-    if( cbDataIn > m_ck.cksize )
-        cbDataIn = m_ck.cksize;
-
-    m_ck.cksize -= cbDataIn;
-
-    for( DWORD cT = 0; cT < cbDataIn; cT++ )
-    {
-            // Copy the bytes from the io to the buffer.
-            if( mmioinfoIn.pchNext == mmioinfoIn.pchEndRead )
-            {
-                if( 0 != mmioAdvance( m_hmmio, &mmioinfoIn, MMIO_READ ) )
-                         TRACE ("ERROR DIRECTSOUND MMIOADVANCE")
-                  	else /* TRACE ("DIRECTSOUND MMIOADVANCE OK")*/;
-
-
-                if( mmioinfoIn.pchNext == mmioinfoIn.pchEndRead )
-                     TRACE ("ERROR DIRECTSOUND READ FIC")
-	            else /* TRACE ("DIRECTSOUND READ FIC OK") */;
-            }
-
-            // Actual copy.
-            *((BYTE*)pDSLockedBuffer+cT) = *((BYTE*)mmioinfoIn.pchNext);
-            mmioinfoIn.pchNext++;
-    }
-
-    if( 0 != mmioSetInfo( m_hmmio, &mmioinfoIn, 0 ) )
-           TRACE ("ERROR DIRECTSOUND MMIOSETINFO")
-	  else TRACE ("DIRECTSOUND MMIOSETINFO OK");
-
-    mmioClose( m_hmmio, 0 );
+	else
+	{
+		TRACE ("DIRECTSOUND LOCK OK");
 
-    dwWavDataRead = cbDataIn;
+		// Copy the samples straight from the mapped file.
+		memcpy(pDSLockedBuffer, wave->GetData(), (dwDSLockedBufferSize < m_dwSize) ? dwDSLockedBufferSize : m_dwSize);
+	}
     } // end of newbuffer part
 
 
@@ -51,7 +51,7 @@ public:
 	int  makeInvalid();
 
 	bool AlreadyPlayed();
-	int  play(SoundLib soundlib,
+	int  play(SoundLib &soundlib,
 		      VESSEL   *vessel,
 			  char     *names,
 			  double   *offset,
@@ -62,9 +62,9 @@ public:
 		      int flags = NOLOOP, int volume = 255);
 	int  Stop();
 	int  Done();
-    int  LoadMissionLandingSoundArray(SoundLib soundlib,char *soundname);
-    int  LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, double MissionTime);
-    int  InitDirectSound(SoundLib soundlib);
+    int  LoadMissionLandingSoundArray(SoundLib &soundlib,char *soundname);
+    int  LoadMissionTimeSoundArray(SoundLib &soundlib, char *soundname, double MissionTime);
+    int  InitDirectSound(SoundLib &soundlib);
     int  PlaySound(char *filenames,int newbuffer,double offset);
     int	IsPlaying();
 	int	Finish(double offsetfinish);
@@ -82,7 +82,6 @@ protected:
 	double timetoapproach;
 	int    mandatory ;
 	
-	SoundLib soundlib;
 	LPDIRECTSOUND8  m_pDS;
 	LPDIRECTSOUNDBUFFER pDSBPrimary;
     LPDIRECTSOUNDBUFFER* apDSBuffer;
@@ -30,9 +30,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include "resource.h"
 
 #include "soundlib.h"
+#include "soundbank.h"
 #include "tracer.h"
 #include "nasspdefs.h"
 
@@ -184,21 +187,14 @@ void SoundLib::SetSoundLibMissionPath(char *mission)
 }
 
 //
-// access() doesn't seem to exist on Windows, so we have to do this
-// manky thing instead, of opening and then closing.
+// The sound bank lists each directory once, rather than us opening every
+// candidate file to see if it's there.
 //
 
 static bool IsFile(char *path)
 
 {
-	FILE	*fp;
-
-	fp = fopen(path, "rb");
-	if (!fp)
-		return false;
-
-	fclose(fp);
-	return true;
+	return SoundBank::FileExists(path);
 }
 
 SoundData *SoundLib::CheckForMatch(char *s)
@@ -354,22 +350,7 @@ void SoundLib::LoadMissionSound(Sound &s, char *soundname, char *genericname, EX
 
 	s.SetSoundLib(this);
 
-	//
-	// First check for a language-specific sound.
-	//
-
-	_snprintf(SoundPath, 255, "%s/%s/%s/%s", basepath, languagepath, missionpath, soundname);
-	if (IsFile(SoundPath)) {
-		s.SetSoundData(DoLoadSound(SoundPath, extended));
-		return;
-	}
-
-	//
-	// Then check for the generic file.
-	//
-
-	_snprintf(SoundPath, 255, "%s/%s/%s", basepath, missionpath, soundname);
-	if (IsFile(SoundPath)) {
+	if (FindMissionSound(SoundPath, soundname)) {
 		s.SetSoundData(DoLoadSound(SoundPath, extended));
 		return;
 	}
@@ -390,6 +371,24 @@ void SoundLib::LoadMissionSound(Sound &s, char *soundname, char *genericname, EX
 	s.SetSoundData(0);
 }
 
+//
+// Find a mission-specific sound file, first in the language-specific mission directory and
+// then in the generic NCPP mission directory. SoundPath must hold 256 characters.
+//
+
+bool SoundLib::FindMissionSound(char *SoundPath, char *soundname)
+
+{
+	_snprintf(SoundPath, 255, "%s/%s/%s/%s", basepath, languagepath, missionpath, soundname);
+	SoundPath[255] = 0;
+	if (IsFile(SoundPath))
+		return true;
+
+	_snprintf(SoundPath, 255, "%s/%s/%s", basepath, missionpath, soundname);
+	SoundPath[255] = 0;
+	return IsFile(SoundPath);
+}
+
 //
 // Load a sound from the generic Vessel directory. You shouldn't call this without a good reason.
 //
@@ -662,9 +661,6 @@ TimedSound::TimedSound()
 	priority = 5;
 	triggerTime = 0.0;
 	soundname[0] = 0;
-
-	next = 0;
-	prev = 0;
 }
 
 TimedSound::~TimedSound()
@@ -672,61 +668,72 @@ TimedSound::~TimedSound()
 {
 }
 
-void TimedSound::AddToSoundQueue(TimedSound *previous)
+void TimedSound::SetFilename(char *s)
 
 {
-	if (previous)
-	{
-		if (previous->next) {
-			next = previous->next;
-			next->prev = this;
-		}
-		previous->next = this;
-	}
+	strncpy (soundname, s, 255);
+}
+
+void TimedSound::SetPriority(int n)
+
+{
+	if (n < 0)
+		n = 0;
 
-	prev = previous;
+	if (n > 9)
+		n = 9;
+
+	priority = n;
 }
 
-void TimedSound::RemoveFromQueue()
+SoundTimeline::SoundTimeline()
 
 {
-	if (prev)
-	{
-		prev->next = next;
-	}
+	cursor = 0;
+}
 
-	if (next)
-	{
-		next->prev = prev;
-	}
+void SoundTimeline::Clear()
 
-	prev = 0;
-	next = 0;
+{
+	sounds.clear();
+	cursor = 0;
 }
 
-void TimedSound::SetFilename(char *s)
+void SoundTimeline::Add(const TimedSound &s)
 
 {
-	strncpy (soundname, s, 255);
+	sounds.push_back(s);
 }
 
-void TimedSound::SetPriority(int n)
+static bool PlaysBefore(const TimedSound &a, const TimedSound &b)
 
 {
-	if (n < 0)
-		n = 0;
+	return a.GetPlayTime() < b.GetPlayTime();
+}
 
-	if (n > 9)
-		n = 9;
+void SoundTimeline::Sort()
 
-	priority = n;
+{
+	std::stable_sort(sounds.begin(), sounds.end(), PlaysBefore);
+	cursor = 0;
+}
+
+static bool PlaysBeforeTime(const TimedSound &s, double t)
+
+{
+	return s.GetPlayTime() < t;
+}
+
+void SoundTimeline::Seek(double t)
+
+{
+	cursor = std::lower_bound(sounds.begin(), sounds.end(), t, PlaysBeforeTime) - sounds.begin();
 }
 
 TimedSoundManager::TimedSoundManager(SoundLib &s) : soundlib(s)
 
 {
-	launchRelativeList = 0;
-	reentryRelativeList = 0;
+	prefetch = 0;
 
 	LaunchSoundsLoaded = false;
 	SoundToPlay = false;
@@ -734,21 +741,10 @@ TimedSoundManager::TimedSoundManager(SoundLib &s) : soundlib(s)
 	TimeToPlay = MINUS_INFINITY;
 }
 
-//
-// When deleted, delete all the timed sounds too.
-//
 TimedSoundManager::~TimedSoundManager()
 
 {
-	TimedSound *s = launchRelativeList;
-	while (s)
-	{
-		TimedSound *n = s->GetNext();
-
-		delete s;
-
-		s = n;
-	}
+	delete prefetch;
 }
 
 void TimedSoundManager::Timestep(double simt, double simdt, bool autoslow)
@@ -796,27 +792,57 @@ void TimedSoundManager::Timestep(double simt, double simdt, bool autoslow)
 			SoundToPlay = false;
 		}
 
+		//
+		// At time acceleration, sounds that are already due but would only be skipped
+		// when played aren't worth loading: step straight past them.
+		//
+
+		TimedSound *t;
+
+		if (timeaccel > 1.0)
+		{
+			while ((t = launchRelative.Current()) != 0 && t->GetPlayTime() <= simt &&
+				(t->IsInformational() || (!t->IsMandatory() && !autoslow)))
+			{
+				launchRelative.Next();
+			}
+		}
+
 		//
 		// Now load the next sound.
 		//
 
-		if (launchRelativeList)
+		t = launchRelative.Current();
+		if (t)
 		{
 			nextSound.done();
 
-			soundlib.LoadMissionSound(nextSound, launchRelativeList->GetFilename(), launchRelativeList->GetFilename());
+			soundlib.LoadMissionSound(nextSound, t->GetFilename(), t->GetFilename());
 
 			SoundToPlay = true;
-			TimeToPlay = launchRelativeList->GetPlayTime();
-			SoundIsMandatory = launchRelativeList->IsMandatory();
-			SoundIsInformational = launchRelativeList->IsInformational();
+			TimeToPlay = t->GetPlayTime();
+			SoundIsMandatory = t->IsMandatory();
+			SoundIsInformational = t->IsInformational();
 
-			TimedSound *n = launchRelativeList->GetNext();
-			launchRelativeList->RemoveFromQueue();
+			launchRelative.Next();
 
-			delete launchRelativeList;
+			//
+			// Start reading the one after, so loading it next time doesn't wait on the disk.
+			//
+
+			t = launchRelative.Current();
+			if (t)
+			{
+				char SoundPath[256];
 
-			launchRelativeList = n;
+				if (soundlib.FindMissionSound(SoundPath, t->GetFilename()))
+				{
+					if (!prefetch)
+						prefetch = new SoundPrefetch();
+
+					prefetch->Prefetch(SoundPath);
+				}
+			}
 		}
 		else
 		{
@@ -862,8 +888,9 @@ void TimedSoundManager::LoadFromFile(char *dataFile, double MissionTime)
 	char line[256];
 	bool copying;
 	int i, c;
-	TimedSound *lastLRSound = 0;
-	TimedSound *lastRRSound = 0;
+
+	launchRelative.Clear();
+	reentryRelative.Clear();
 
 	while (!feof(fp))
 	{
@@ -944,66 +971,61 @@ void TimedSoundManager::LoadFromFile(char *dataFile, double MissionTime)
 				simt = (-simt);
 			}
 
-			if (simt >= MissionTime)
-			{
-				if (!line[i++])
-					continue;
-
-				bool launchRelative = (line[i] == 'l' || line[i] == 'L');
+			//
+			// Every sound is kept, and the timeline is moved to the mission time once
+			// it's sorted.
+			//
 
-				if (!line[i++])
-					continue;
+			if (!line[i++])
+				continue;
 
-				if (line[i++] != ';')
-					continue;
+			bool isLaunchRelative = (line[i] == 'l' || line[i] == 'L');
 
-				int priority = CharToInt(line[i]);
+			if (!line[i++])
+				continue;
 
-				if (!line[i++])
-					continue;
+			if (line[i++] != ';')
+				continue;
 
-				if (line[i++] != ';')
-					continue;
+			int priority = CharToInt(line[i]);
 
-				char filename[256];
+			if (!line[i++])
+				continue;
 
-				strncpy(filename, line + i, 250);
-				strcat(filename, ".wav");
+			if (line[i++] != ';')
+				continue;
 
-				TimedSound *t = new TimedSound;
+			char filename[256];
 
-				t->SetFilename(filename);
-				t->SetPriority(priority);
-				t->SetPlayTime(simt);
+			strncpy(filename, line + i, 250);
+			strcat(filename, ".wav");
 
-				if (launchRelative)
-				{
-					t->AddToSoundQueue(lastLRSound);
-					lastLRSound = t;
+			TimedSound t;
 
-					if (!launchRelativeList)
-					{
-						launchRelativeList = t;
-					}
-				}
-				else
-				{
-					t->AddToSoundQueue(lastRRSound);
-					lastRRSound = t;
+			t.SetFilename(filename);
+			t.SetPriority(priority);
+			t.SetPlayTime(simt);
 
-					if (!reentryRelativeList)
-					{
-						reentryRelativeList = t;
-					}
-				}
+			if (isLaunchRelative)
+			{
+				launchRelative.Add(t);
+			}
+			else
+			{
+				reentryRelative.Add(t);
 			}
 		}
 	}
 
-	if (launchRelativeList || reentryRelativeList)
-		LaunchSoundsLoaded = true;
-
 	fclose(fp);
+
+	launchRelative.Sort();
+	launchRelative.Seek(MissionTime);
+	reentryRelative.Sort();
+	reentryRelative.Seek(MissionTime);
+
+	if (!launchRelative.IsEmpty() || !reentryRelative.IsEmpty())
+		LaunchSoundsLoaded = true;
 }
 
 //
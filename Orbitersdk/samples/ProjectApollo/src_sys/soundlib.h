@@ -27,6 +27,8 @@
 
 #include "OrbiterSoundSDK40.h"
 
+#include <vector>
+
 ///
 /// \ingroup Sound
 ///
@@ -157,6 +159,7 @@ protected:
 
 	SoundData *DoLoadSound(char *SoundPath, EXTENDEDPLAY extended);
 	SoundData *CheckForMatch(char *s);
+	bool FindMissionSound(char *SoundPath, char *soundname);
 	int FindSlot();
 
 #define N_VOLUMES	10
@@ -198,6 +201,13 @@ protected:
 	int SoundlibId;
 	int NextSlot;
 
+private:
+	///
+	/// \brief Not copyable: there is one sound library per vessel, and everything else refers to it.
+	///
+	SoundLib(const SoundLib &);
+	SoundLib &operator=(const SoundLib &);
+
 	friend class TimedSound;
 	friend class TimedSoundManager;
 	friend class SoundEvent;
@@ -214,6 +224,8 @@ protected:
 // Timed sound sequencing.
 //
 
+class SoundPrefetch;
+
 ///
 /// \brief Single timed sound.
 /// \ingroup Sound
@@ -224,34 +236,11 @@ public:
 	TimedSound();
 	~TimedSound();
 
-	///
-	/// \brief Add a sound to the queue.
-	/// \param prev Previous TimedSound in the queue (may be NULL).
-	///
-	void AddToSoundQueue(TimedSound *prev);
-
-	///
-	/// \brief Remove this sound from the queue.
-	///
-	void RemoveFromQueue();
-
-	///
-	/// \brief Get the next sound in the queue.
-	/// \return Pointer to next sound.
-	///
-	TimedSound *GetNext() { return next; };
-
-	///
-	/// \brief Get the previous sound in the queue.
-	/// \return Pointer to previous sound.
-	///
-	TimedSound *GetPrev() { return prev; };
-
 	///
 	/// \brief Get the time at which this should be played.
 	/// \return Time to play the sound, relative to the appropriate event (launch, re-entry, etc).
 	///
-	double GetPlayTime() { return triggerTime; };
+	double GetPlayTime() const { return triggerTime; };
 
 	///
 	/// \brief Get the sound file name.
@@ -311,16 +300,43 @@ protected:
 	/// \brief Sound file name.
 	///
 	char soundname[256];
+};
+
+///
+/// Sounds are added in any order and sorted once, keeping the file order for sounds with
+/// the same time. Seek() finds the first sound due at or after a given time with a binary
+/// search, so jumping to the mission time of a scenario doesn't walk the whole list, and
+/// Next() steps forward one sound at a time from there.
+///
+/// \brief Timed sounds sorted by play time, with a cursor at the next one due.
+/// \ingroup Sound
+///
+class SoundTimeline
+{
+public:
+	SoundTimeline();
+
+	void Clear();
+	void Add(const TimedSound &s);
+	void Sort();
 
 	///
-	/// \brief Pointer to next sound in queue.
+	/// \brief Move the cursor to the first sound to play at or after time t.
 	///
-	TimedSound *next;
+	void Seek(double t);
+
+	bool AtEnd() { return cursor >= sounds.size(); };
+	bool IsEmpty() { return sounds.empty(); };
 
 	///
-	/// \brief Pointer to previous sound in queue.
+	/// \brief The sound at the cursor, or NULL at the end of the timeline.
 	///
-	TimedSound *prev;
+	TimedSound *Current() { return AtEnd() ? 0 : &sounds[cursor]; };
+	void Next() { if (!AtEnd()) cursor++; };
+
+protected:
+	std::vector<TimedSound> sounds;
+	size_t cursor;
 };
 
 ///
@@ -354,14 +370,14 @@ public:
 
 protected:
 	///
-	/// \brief List of sounds that are launch-relative.
+	/// \brief Sounds that are launch-relative.
 	///
-	TimedSound *launchRelativeList;
+	SoundTimeline launchRelative;
 
 	///
-	/// \brief List of sounds that are re-entry relative.
+	/// \brief Sounds that are re-entry relative.
 	///
-	TimedSound *reentryRelativeList;
+	SoundTimeline reentryRelative;
 
 	///
 	/// \brief Current sound playing.
@@ -398,6 +414,11 @@ protected:
 	///
 	bool LaunchSoundsLoaded;
 
+	///
+	/// \brief Reads the sound after the next one ahead of time, created on first use.
+	///
+	SoundPrefetch *prefetch;
+
 	///
 	/// \brief Sound library to use for playback.
 	///
@@ -0,0 +1,142 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Precomputed vessel mesh configurations
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+
+#include <map>
+#include <string>
+
+#include "stagemesh.h"
+
+StageConfig::StageConfig()
+
+{
+	hasFigures = false;
+	size = 0.0;
+	pmi = _V(0, 0, 0);
+	crossSections = _V(0, 0, 0);
+	cogElev = 0.0;
+}
+
+void StageConfig::Clear()
+
+{
+	meshes.clear();
+	hasFigures = false;
+}
+
+UINT StageConfig::AddMesh(MESHHANDLE mesh, const VECTOR3 &ofs, WORD visibility)
+
+{
+	StageMesh m;
+
+	m.mesh = mesh;
+	m.ofs = ofs;
+	m.visibility = visibility;
+
+	meshes.push_back(m);
+	return (UINT) (meshes.size() - 1);
+}
+
+void StageConfig::SetMeshVisibility(UINT idx, WORD visibility)
+
+{
+	if (idx < meshes.size())
+		meshes[idx].visibility = visibility;
+}
+
+void StageConfig::SetFigures(double sz, const VECTOR3 &p, const VECTOR3 &cs, double cog)
+
+{
+	hasFigures = true;
+	size = sz;
+	pmi = p;
+	crossSections = cs;
+	cogElev = cog;
+}
+
+void StageConfig::ApplyMeshes(VESSEL *v) const
+
+{
+	UINT current = v->GetMeshCount();
+	UINT wanted = (UINT) meshes.size();
+	UINT i;
+
+	for (i = 0; i < wanted; i++)
+	{
+		const StageMesh &m = meshes[i];
+
+		if (i < current && v->GetMeshTemplate(i) == m.mesh)
+		{
+			VECTOR3 ofs;
+
+			if (v->GetMeshOffset(i, ofs) && ofs.x == m.ofs.x && ofs.y == m.ofs.y && ofs.z == m.ofs.z)
+			{
+				v->SetMeshVisibilityMode(i, m.visibility);
+				continue;
+			}
+		}
+
+		v->InsertMesh(m.mesh, i, &m.ofs);
+		v->SetMeshVisibilityMode(i, m.visibility);
+	}
+
+	//
+	// Drop what the configuration doesn't have. Like ClearMeshes(), this keeps
+	// the animations.
+	//
+	for (i = wanted; i < current; i++)
+	{
+		if (v->GetMeshTemplate(i))
+			v->DelMesh(i, true);
+	}
+}
+
+void StageConfig::ApplyFigures(VESSEL *v) const
+
+{
+	if (!hasFigures)
+		return;
+
+	v->SetSize(size);
+	v->SetPMI(pmi);
+	v->SetCrossSections(crossSections);
+	v->SetCOG_elev(cogElev);
+}
+
+static std::map<std::string, StageConfig> stageConfigs;
+
+StageConfig &StageConfigRegistry::Get(const char *name)
+
+{
+	return stageConfigs[name];
+}
+
+void StageConfigRegistry::Clear()
+
+{
+	stageConfigs.clear();
+}
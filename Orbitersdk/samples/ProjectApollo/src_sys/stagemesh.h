@@ -0,0 +1,104 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Precomputed vessel mesh configurations
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_STAGEMESH_H)
+#define _PA_STAGEMESH_H
+
+#include <vector>
+
+///
+/// One mesh of a vessel configuration.
+///
+struct StageMesh
+{
+	MESHHANDLE mesh;
+	VECTOR3 ofs;
+	WORD visibility;
+};
+
+///
+/// \brief The meshes and physical figures of one vessel configuration.
+///
+/// Meshes are listed in mesh index order. Applying a configuration only
+/// changes what differs from the vessel's current meshes: a mesh already at
+/// its index with the same template and offset is kept, and only its
+/// visibility is set. Going from one stage to the next, or setting up a
+/// spawned stage twice, then no longer deletes and recreates every mesh.
+///
+/// The current meshes are read back from the vessel, so it doesn't matter
+/// if other code has added or cleared meshes in between.
+///
+class StageConfig
+{
+public:
+	StageConfig();
+
+	void Clear();
+
+	///
+	/// Add a mesh at the next index.
+	/// \return The mesh index it will have on the vessel.
+	///
+	UINT AddMesh(MESHHANDLE mesh, const VECTOR3 &ofs, WORD visibility = MESHVIS_EXTERNAL);
+	void SetMeshVisibility(UINT idx, WORD visibility);
+
+	///
+	/// Size, principal moments of inertia, cross sections and height of the
+	/// centre of gravity for the configuration.
+	///
+	void SetFigures(double size, const VECTOR3 &pmi, const VECTOR3 &crossSections, double cogElev);
+
+	void ApplyMeshes(VESSEL *v) const;
+	void ApplyFigures(VESSEL *v) const;
+
+	bool IsEmpty() const { return meshes.empty() && !hasFigures; };
+
+protected:
+	std::vector<StageMesh> meshes;
+
+	bool hasFigures;
+	double size;
+	VECTOR3 pmi;
+	VECTOR3 crossSections;
+	double cogElev;
+};
+
+///
+/// \brief Configurations shared by all vessels of a class, built once by name.
+///
+/// The meshes are global meshes, so the configurations stay valid until the
+/// last vessel of the class goes away and the module calls Clear().
+///
+class StageConfigRegistry
+{
+public:
+	///
+	/// The configuration with the given name. A new one is empty, and is
+	/// filled in by the caller.
+	///
+	static StageConfig &Get(const char *name);
+	static void Clear();
+};
+
+#endif // _PA_STAGEMESH_H
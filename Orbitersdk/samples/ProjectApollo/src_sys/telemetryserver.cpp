@@ -0,0 +1,560 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Multi-client telemetry server
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "telemetryserver.h"
+
+TelemetryQueue::TelemetryQueue(int size)
+{
+	head = count = 0;
+	Resize(size);
+}
+
+void TelemetryQueue::Resize(int size)
+{
+	buffer.assign(size, 0);
+	head = count = 0;
+}
+
+int TelemetryQueue::Push(const unsigned char *data, int n)
+{
+	int size = (int)buffer.size();
+
+	if (n > size - count)
+		n = size - count;
+
+	for (int i = 0; i < n; i++)
+	{
+		buffer[(head + count + i) % size] = data[i];
+	}
+
+	count += n;
+	return n;
+}
+
+int TelemetryQueue::PushOverwrite(const unsigned char *data, int n)
+{
+	int size = (int)buffer.size();
+	int lost = 0;
+
+	if (size < 1)
+		return n;
+
+	//
+	// Only the newest size bytes can fit at all.
+	//
+	if (n > size)
+	{
+		lost += n - size;
+		data += n - size;
+		n = size;
+	}
+
+	if (n > size - count)
+	{
+		int drop = n - (size - count);
+		Drop(drop);
+		lost += drop;
+	}
+
+	Push(data, n);
+	return lost;
+}
+
+int TelemetryQueue::Pop(unsigned char *data, int n)
+{
+	int size = (int)buffer.size();
+
+	if (n > count)
+		n = count;
+
+	for (int i = 0; i < n; i++)
+	{
+		data[i] = buffer[(head + i) % size];
+	}
+
+	Drop(n);
+	return n;
+}
+
+int TelemetryQueue::Peek(const unsigned char **data)
+{
+	int size = (int)buffer.size();
+
+	if (count < 1)
+		return 0;
+
+	*data = &buffer[head];
+
+	if (head + count > size)
+		return size - head;
+
+	return count;
+}
+
+void TelemetryQueue::Drop(int n)
+{
+	if (n > count)
+		n = count;
+
+	count -= n;
+
+	if (count == 0)
+		head = 0;
+	else
+		head = (head + n) % (int)buffer.size();
+}
+
+TelemetryServer::TelemetryServer() : uplink(TLMSRV_UPLINK_SIZE)
+{
+	listenSocket = INVALID_SOCKET;
+	stopping = false;
+	running = false;
+	wsaStarted = false;
+	maxClients = TLMSRV_MAX_CLIENTS;
+	queueSize = TLMSRV_QUEUE_SIZE;
+	dropped = 0;
+	uplinkClient = NULL;
+	uplinkTime = 0;
+	error[0] = 0;
+	errorSet = false;
+}
+
+TelemetryServer::~TelemetryServer()
+{
+	Stop();
+}
+
+bool TelemetryServer::Start(int port, int nclients, int qsize)
+{
+	WSADATA wsaData;
+	sockaddr_in service;
+	u_long mode = 1;
+
+	Stop();
+
+	maxClients = nclients < 1 ? 1 : nclients;
+	queueSize = qsize < 1 ? TLMSRV_QUEUE_SIZE : qsize;
+	dropped = 0;
+
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != NO_ERROR)
+	{
+		SetError("TELECOM: Error at WSAStartup()", 0);
+		return false;
+	}
+	wsaStarted = true;
+
+	listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listenSocket == INVALID_SOCKET)
+	{
+		SetError("TELECOM: Error at socket(): %ld", WSAGetLastError());
+		Stop();
+		return false;
+	}
+
+	// Be nonblocking
+	if (ioctlsocket(listenSocket, FIONBIO, &mode) != 0)
+	{
+		SetError("TELECOM: ioctlsocket() failed: %ld", WSAGetLastError());
+		Stop();
+		return false;
+	}
+
+	service.sin_family = AF_INET;
+	service.sin_addr.s_addr = htonl(INADDR_ANY);
+	service.sin_port = htons(port);
+
+	if (::bind(listenSocket, (SOCKADDR*)&service, sizeof(service)) == SOCKET_ERROR)
+	{
+		SetError("TELECOM: bind() failed: %ld", WSAGetLastError());
+		Stop();
+		return false;
+	}
+
+	if (listen(listenSocket, maxClients) == SOCKET_ERROR)
+	{
+		SetError("TELECOM: listen() failed: %ld", WSAGetLastError());
+		Stop();
+		return false;
+	}
+
+	stopping = false;
+	running = true;
+	ioThread = std::thread(&TelemetryServer::IOLoop, this);
+	return true;
+}
+
+void TelemetryServer::Stop()
+{
+	stopping = true;
+
+	if (ioThread.joinable())
+		ioThread.join();
+
+	running = false;
+
+	for (int i = (int)clients.size() - 1; i >= 0; i--)
+	{
+		CloseClient(i);
+	}
+
+	if (listenSocket != INVALID_SOCKET)
+	{
+		closesocket(listenSocket);
+		listenSocket = INVALID_SOCKET;
+	}
+
+	if (wsaStarted)
+	{
+		WSACleanup();
+		wsaStarted = false;
+	}
+
+	uplink.Clear();
+	uplinkClient = NULL;
+}
+
+void TelemetryServer::Send(const unsigned char *data, int size)
+{
+	if (size < 1)
+		return;
+
+	std::lock_guard<std::mutex> guard(lock);
+
+	for (unsigned int i = 0; i < clients.size(); i++)
+	{
+		dropped += clients[i]->downlink.PushOverwrite(data, size);
+	}
+}
+
+int TelemetryServer::Receive(unsigned char *data, int size)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return uplink.Pop(data, size);
+}
+
+int TelemetryServer::Clients()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return (int)clients.size();
+}
+
+unsigned long TelemetryServer::DroppedBytes()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return dropped;
+}
+
+bool TelemetryServer::GetError(char *msg, int size)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (!errorSet)
+		return false;
+
+	strncpy(msg, error, size - 1);
+	msg[size - 1] = 0;
+	errorSet = false;
+	return true;
+}
+
+void TelemetryServer::SetError(const char *fmt, long code)
+{
+	//
+	// Called with the lock held, or before the I/O thread runs.
+	//
+	sprintf(error, fmt, code);
+	errorSet = true;
+}
+
+void TelemetryServer::IOLoop()
+{
+	while (!stopping)
+	{
+		fd_set readSet, writeSet;
+		std::vector<Client *> polled;
+		int sockets = 0;
+
+		FD_ZERO(&readSet);
+		FD_ZERO(&writeSet);
+
+		{
+			std::lock_guard<std::mutex> guard(lock);
+
+			if ((int)clients.size() < maxClients)
+			{
+				FD_SET(listenSocket, &readSet);
+				sockets++;
+			}
+
+			if (uplinkClient && GetTickCount() - uplinkTime > TLMSRV_UPLINK_IDLE)
+				uplinkClient = NULL;
+
+			//
+			// Only this thread adds or removes clients, so the copy stays
+			// valid while the sockets are serviced without the lock.
+			//
+			polled = clients;
+
+			for (unsigned int i = 0; i < clients.size(); i++)
+			{
+				//
+				// Only read uplink while there is room for it and nobody else
+				// is uplinking; TCP then holds the client back rather than us
+				// dropping or mixing up commands.
+				//
+				if (uplink.Free() > 0 && (uplinkClient == NULL || uplinkClient == clients[i]))
+				{
+					FD_SET(clients[i]->sock, &readSet);
+					sockets++;
+				}
+				if (clients[i]->downlink.Count() > 0 || !clients[i]->pending.empty())
+				{
+					FD_SET(clients[i]->sock, &writeSet);
+					sockets++;
+				}
+			}
+		}
+
+		if (sockets == 0)
+		{
+			Sleep(10);
+			continue;
+		}
+
+		//
+		// The timeout is how long new downlink data can wait before we
+		// notice it, so keep it short.
+		//
+		timeval timeout;
+		timeout.tv_sec = 0;
+		timeout.tv_usec = 10000;
+
+		int ready = select(0, &readSet, &writeSet, NULL, &timeout);
+		if (ready == SOCKET_ERROR)
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			SetError("TELECOM: select() failed: %ld", WSAGetLastError());
+			Sleep(10);
+			continue;
+		}
+		if (ready == 0)
+			continue;
+
+		//
+		// Clients are in the order they connected, so when nobody owns the
+		// uplink the longest connected client with data gets it, and the
+		// others aren't read until the next pass.
+		//
+		std::vector<Client *> closed;
+
+		for (unsigned int i = 0; i < polled.size(); i++)
+		{
+			Client &client = *polled[i];
+			bool ok = true;
+
+			if (FD_ISSET(client.sock, &writeSet))
+				ok = FlushClient(client);
+
+			if (ok && FD_ISSET(client.sock, &readSet))
+				ok = ReadClient(client);
+
+			if (!ok)
+				closed.push_back(&client);
+		}
+
+		std::lock_guard<std::mutex> guard(lock);
+
+		for (unsigned int i = 0; i < closed.size(); i++)
+		{
+			for (unsigned int j = 0; j < clients.size(); j++)
+			{
+				if (clients[j] == closed[i])
+				{
+					CloseClient(j);
+					break;
+				}
+			}
+		}
+
+		if (FD_ISSET(listenSocket, &readSet))
+			AcceptClient();
+	}
+}
+
+void TelemetryServer::AcceptClient()
+{
+	SOCKET sock = accept(listenSocket, NULL, NULL);
+	u_long mode = 1;
+
+	if (sock == INVALID_SOCKET)
+		return;
+
+	if (ioctlsocket(sock, FIONBIO, &mode) != 0)
+	{
+		SetError("TELECOM: ioctlsocket() failed: %ld", WSAGetLastError());
+		closesocket(sock);
+		return;
+	}
+
+	Client *client = new Client;
+	client->sock = sock;
+	client->downlink.Resize(queueSize);
+	clients.push_back(client);
+}
+
+void TelemetryServer::CloseClient(int i)
+{
+	//
+	// Anything it uplinked before it went stays queued for the computer.
+	//
+	if (uplinkClient == clients[i])
+		uplinkClient = NULL;
+
+	closesocket(clients[i]->sock);
+	delete clients[i];
+	clients.erase(clients.begin() + i);
+}
+
+//
+// FlushClient() and ReadClient() run without the lock, and only take it to
+// move data between the queues and their own buffers.
+//
+
+bool TelemetryServer::FlushClient(Client &client)
+{
+	for (;;)
+	{
+		//
+		// Data taken off the queue waits in pending until it has all been
+		// sent, since Send() may drop the oldest queued bytes meanwhile.
+		//
+		if (client.pending.empty())
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			const unsigned char *data;
+			int n = client.downlink.Peek(&data);
+
+			if (n < 1)
+				return true;
+
+			client.pending.assign(data, data + n);
+			client.downlink.Drop(n);
+		}
+
+		int n = (int)client.pending.size();
+		int sent = send(client.sock, (const char *)&client.pending[0], n, 0);
+
+		if (sent == SOCKET_ERROR)
+		{
+			long errnumber = WSAGetLastError();
+
+			switch (errnumber)
+			{
+			case WSAEWOULDBLOCK:
+				// Client is full, try again next time round.
+				return true;
+
+			case WSAENOTSOCK:
+			case WSAECONNABORTED:
+			case WSAECONNRESET:
+				return false;
+
+			default:
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					SetError("TELECOM: send() failed: %ld", errnumber);
+				}
+				return false;
+			}
+		}
+
+		client.pending.erase(client.pending.begin(), client.pending.begin() + sent);
+
+		if (sent < n)
+			return true;
+	}
+}
+
+bool TelemetryServer::ReadClient(Client &client)
+{
+	unsigned char buffer[TLMSRV_UPLINK_SIZE];
+	int n;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		//
+		// Another client may have claimed the uplink earlier in this pass.
+		//
+		if (uplinkClient != NULL && uplinkClient != &client)
+			return true;
+
+		//
+		// Receive() only takes bytes out, so this much room is still there
+		// when the data is pushed.
+		//
+		n = uplink.Free();
+	}
+
+	if (n < 1)
+		return true;
+
+	int got = recv(client.sock, (char *)buffer, n, 0);
+
+	if (got == 0)
+		return false; // Closed
+
+	if (got == SOCKET_ERROR)
+	{
+		long errnumber = WSAGetLastError();
+
+		switch (errnumber)
+		{
+		case WSAEWOULDBLOCK:
+			return true;
+
+		case WSAENOTSOCK:
+		case WSAECONNABORTED:
+		case WSAECONNRESET:
+			return false;
+
+		default:
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				SetError("TELECOM: recv() failed: %ld", errnumber);
+			}
+			return false;
+		}
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+
+	uplink.Push(buffer, got);
+	uplinkClient = &client;
+	uplinkTime = GetTickCount();
+	return true;
+}
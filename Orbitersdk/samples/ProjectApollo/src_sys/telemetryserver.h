@@ -0,0 +1,165 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Multi-client telemetry server
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_TELEMETRYSERVER_H)
+#define _PA_TELEMETRYSERVER_H
+
+#include <winsock.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define TLMSRV_MAX_CLIENTS	4			///< Default number of ground clients.
+#define TLMSRV_QUEUE_SIZE	65536		///< Default downlink bytes queued per client (10 s of HBR).
+#define TLMSRV_UPLINK_SIZE	1024		///< Uplink bytes buffered for the simulation.
+#define TLMSRV_UPLINK_IDLE	1000		///< ms without data before another client may uplink.
+
+///
+/// \brief Fixed size byte FIFO.
+///
+class TelemetryQueue
+{
+public:
+	TelemetryQueue(int size = 0);
+
+	void Resize(int size);
+	void Clear() { head = count = 0; };
+
+	int Size() { return (int)buffer.size(); };
+	int Count() { return count; };
+	int Free() { return (int)buffer.size() - count; };
+
+	///
+	/// Append up to n bytes; returns how many fit.
+	///
+	int Push(const unsigned char *data, int n);
+
+	///
+	/// Append n bytes, dropping the oldest bytes if they don't fit; returns how many were dropped.
+	///
+	int PushOverwrite(const unsigned char *data, int n);
+
+	///
+	/// Remove up to n bytes into data; returns how many.
+	///
+	int Pop(unsigned char *data, int n);
+
+	///
+	/// The oldest bytes in one contiguous block, for send(); returns its length.
+	///
+	int Peek(const unsigned char **data);
+	void Drop(int n);
+
+protected:
+	std::vector<unsigned char> buffer;
+	int head;
+	int count;
+};
+
+///
+/// \brief TCP server for the PCM downlink and the up-data link.
+///
+/// The server accepts several ground clients (displays, recorders, the uplink
+/// console) and runs all socket I/O on its own thread. The simulation only
+/// queues downlink data and picks up uplink bytes, so a slow or stalled client
+/// never holds up a timestep: each client has a bounded queue, and when it
+/// falls behind the oldest downlink data is dropped (the ground station resyncs
+/// on the frame sync words).
+///
+/// Uplink is taken from one client at a time so commands from different clients
+/// are never interleaved: the first client to send owns the uplink until it
+/// disconnects or goes quiet, and the others are held back by TCP until then.
+/// If several send at once, the one that has been connected longest wins.
+///
+class TelemetryServer
+{
+public:
+	TelemetryServer();
+	virtual ~TelemetryServer();
+
+	///
+	/// Start listening on port and start the I/O thread.
+	/// \return false on failure; GetError() says why.
+	///
+	bool Start(int port, int maxClients = TLMSRV_MAX_CLIENTS, int queueSize = TLMSRV_QUEUE_SIZE);
+	void Stop();
+	bool IsRunning() { return running; };
+
+	///
+	/// Queue downlink data for every connected client.
+	///
+	void Send(const unsigned char *data, int size);
+
+	///
+	/// Take up to size uplink bytes.
+	/// \return Number of bytes copied.
+	///
+	int Receive(unsigned char *data, int size);
+
+	int Clients();
+	unsigned long DroppedBytes();
+
+	///
+	/// Copy the last error message into msg and clear it.
+	/// \return true if there was an error.
+	///
+	bool GetError(char *msg, int size);
+
+protected:
+	struct Client
+	{
+		SOCKET sock;
+		TelemetryQueue downlink;
+		std::vector<unsigned char> pending;		///< Downlink taken off the queue and not yet sent.
+	};
+
+	void IOLoop();
+	void AcceptClient();
+	bool FlushClient(Client &client);
+	bool ReadClient(Client &client);
+	void CloseClient(int i);
+	void SetError(const char *fmt, long code);
+
+	SOCKET listenSocket;
+	std::thread ioThread;
+	std::mutex lock;
+	std::atomic<bool> stopping;
+	bool running;
+	bool wsaStarted;
+
+	std::vector<Client *> clients;
+	TelemetryQueue uplink;
+	Client *uplinkClient;				///< Client that owns the uplink, if any.
+	unsigned long uplinkTime;			///< Tick count of its last uplink data.
+	int maxClients;
+	int queueSize;
+	unsigned long dropped;
+
+	char error[256];
+	bool errorSet;
+};
+
+#endif // _PA_TELEMETRYSERVER_H
@@ -29,6 +29,7 @@
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "Orbitersdk.h"
 #include <stdio.h>
+#include <ctype.h>
 #include <math.h>
 #include "soundlib.h"
 
@@ -328,6 +329,18 @@ void ToggleSwitch::DrawSwitch(SURFHANDLE DrawSurface)
 		DoDrawSwitch(DrawSurface);
 }
 
+bool ToggleSwitch::GetDrawState(unsigned int &drawState)
+
+{
+	unsigned int h = MixDrawState(DRAWSTATE_SEED, (unsigned int)state);
+	h = MixDrawState(h, (unsigned int)IsUp());
+	h = MixDrawState(h, (unsigned int)visible);
+	h = MixDrawState(h, (unsigned int)((x << 16) ^ y));
+	h = MixDrawState(h, (unsigned int)((xOffset << 16) ^ yOffset));
+	drawState = MixDrawState(h, SwitchSurface);
+	return true;
+}
+
 //
 // Generic function to draw a flashing box around the switch. This is only called if the
 // flashing is currently active.
@@ -975,6 +988,10 @@ SwitchRow::SwitchRow() {
 	PanelArea = (-1);
 
 	RowPower = 0;
+
+	drawn = false;
+	lastDrawState = 0;
+	lastDrawSurface = 0;
 }
 
 SwitchRow::~SwitchRow() {
@@ -1052,16 +1069,52 @@ void SwitchRow::Init(int area, PanelSwitches &panel, e_object *p) {
 
 bool SwitchRow::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn) {
 
+	bool redrawn;
+	return DrawRow(id, DrawSurface, FlashOn, redrawn, true);
+}
+
+bool SwitchRow::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn, bool &redrawn, bool force) {
+
 	if (id != PanelArea)
 		return false;
 
+	//
+	// Most rows don't change from one frame to the next, so only draw them if
+	// an item has changed, including whether its flash box is showing.
+	//
+	bool known = true;
+	unsigned int drawState = DRAWSTATE_SEED;
+	unsigned int itemState;
+
 	PanelSwitchItem *s = SwitchList;
+	while (s && known) {
+		if (s->GetDrawState(itemState)) {
+			drawState = MixDrawState(drawState, itemState);
+			drawState = MixDrawState(drawState, (unsigned int)(FlashOn && s->IsFlashing()));
+		}
+		else {
+			known = false;
+		}
+		s = s->GetNext();
+	}
+
+	if (!force && known && drawn && drawState == lastDrawState && DrawSurface == lastDrawSurface) {
+		redrawn = false;
+		return true;
+	}
+
+	s = SwitchList;
 	while (s) {
 		s->DrawSwitch(DrawSurface);
 		if (FlashOn && s->IsFlashing())
 			s->DrawFlash(DrawSurface);
 		s = s->GetNext();
 	}
+
+	drawn = known;
+	lastDrawState = drawState;
+	lastDrawSurface = DrawSurface;
+	redrawn = true;
 	return true;
 }
 
@@ -1071,15 +1124,36 @@ bool SwitchRow::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn) {
 // switches.
 //
 
+void PanelSwitches::AddRow(SwitchRow *s)
+
+{
+	s->SetNext(RowList);
+	RowList = s;
+
+	//
+	// Rows are added to the front of the list, so the latest row for an
+	// area is the one that used to be found first.
+	//
+	areaIndex[s->GetPanelArea()] = s;
+}
+
+SwitchRow *PanelSwitches::GetRow(int id)
+
+{
+	std::unordered_map<int, SwitchRow *>::iterator it = areaIndex.find(id);
+
+	if (it == areaIndex.end())
+		return 0;
+
+	return it->second;
+}
+
 bool PanelSwitches::CheckMouseClick(int id, int event, int mx, int my) {
 
-	SwitchRow *row = RowList;
+	SwitchRow *row = GetRow(id);
 
-	while (row) {
-		if (row->CheckMouseClick(id, event, mx, my))
-			return true;
-		row = row->GetNext();
-	}
+	if (row)
+		return row->CheckMouseClick(id, event, mx, my);
 
 	return false;
 }
@@ -1102,17 +1176,25 @@ void PanelSwitches::timestep(double missionTime)
 
 bool PanelSwitches::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn) {
 
-	SwitchRow *row = RowList;
+	SwitchRow *row = GetRow(id);
 
-	while (row) {
-		if (row->DrawRow(id, DrawSurface, FlashOn))
-			return true;
-		row = row->GetNext();
-	}
+	if (row)
+		return row->DrawRow(id, DrawSurface, FlashOn);
 
 	return false;
 }
 
+bool PanelSwitches::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn, bool &redrawn, bool force) {
+
+	SwitchRow *row = GetRow(id);
+
+	if (row)
+		return row->DrawRow(id, DrawSurface, FlashOn, redrawn, force);
+
+	redrawn = false;
+	return false;
+}
+
 bool PanelSwitches::SetFlashing(const char *n, bool flash)
 
 {
@@ -1254,6 +1336,14 @@ void GuardedToggleSwitch::InitGuard(int xp, int yp, int w, int h, SURFHANDLE sur
 		switchRow->panelSwitches->soundlib->LoadSound(guardClick, GUARD_SOUND, INTERNAL_ONLY);
 }
 
+bool GuardedToggleSwitch::GetDrawState(unsigned int &drawState)
+
+{
+	ToggleSwitch::GetDrawState(drawState);
+	drawState = MixDrawState(drawState, (unsigned int)guardState);
+	return true;
+}
+
 void GuardedToggleSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 
 	if (!visible) return;
@@ -1423,6 +1513,15 @@ void GuardedPushSwitch::DoDrawSwitch(SURFHANDLE DrawSurface)
 		ToggleSwitch::DoDrawSwitch(DrawSurface);
 }
 
+bool GuardedPushSwitch::GetDrawState(unsigned int &drawState)
+
+{
+	ToggleSwitch::GetDrawState(drawState);
+	drawState = MixDrawState(drawState, (unsigned int)guardState);
+	drawState = MixDrawState(drawState, (unsigned int)lit);
+	return true;
+}
+
 void GuardedPushSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 
 	if (!visible) return;
@@ -1552,6 +1651,14 @@ void GuardedThreePosSwitch::InitGuard(int xp, int yp, int w, int h, SURFHANDLE s
 		switchRow->panelSwitches->soundlib->LoadSound(guardClick, GUARD_SOUND, INTERNAL_ONLY);
 }
 
+bool GuardedThreePosSwitch::GetDrawState(unsigned int &drawState)
+
+{
+	ToggleSwitch::GetDrawState(drawState);
+	drawState = MixDrawState(drawState, (unsigned int)guardState);
+	return true;
+}
+
 void GuardedThreePosSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 
 	if (!visible) return;
@@ -1836,6 +1943,15 @@ void RotationalSwitch::DrawSwitch(SURFHANDLE drawSurface) {
 	}
 }
 
+bool RotationalSwitch::GetDrawState(unsigned int &drawState)
+
+{
+	unsigned int h = MixDrawState(DRAWSTATE_SEED, position);
+	h = MixDrawState(h, (unsigned int)((x << 16) ^ y));
+	drawState = MixDrawState(h, switchSurface);
+	return true;
+}
+
 void RotationalSwitch::DrawFlash(SURFHANDLE DrawSurface)
 
 {
@@ -2164,6 +2280,15 @@ void ThumbwheelSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 	oapiBlt(DrawSurface, switchSurface, x, y, state * width, 0, width, height, SURF_PREDEF_CK);
 }
 
+bool ThumbwheelSwitch::GetDrawState(unsigned int &drawState)
+
+{
+	unsigned int h = MixDrawState(DRAWSTATE_SEED, (unsigned int)state);
+	h = MixDrawState(h, (unsigned int)((x << 16) ^ y));
+	drawState = MixDrawState(h, switchSurface);
+	return true;
+}
+
 void ThumbwheelSwitch::DrawFlash(SURFHANDLE DrawSurface)
 
 {
@@ -2594,10 +2719,23 @@ double DCAmpMeter::QueryValue()
 // Panel Switch Scenario Handler
 //
 
+std::string PanelSwitchScenarioHandler::SwitchKey(const char *name) {
+
+	std::string key(name);
+
+	for (std::string::iterator it = key.begin(); it != key.end(); ++it)
+		*it = tolower((unsigned char) *it);
+
+	return key;
+}
+
 void PanelSwitchScenarioHandler::RegisterSwitch(PanelSwitchItem *s) {
 
 	s->SetNextForScenario(switchList); 
 	switchList = s; 
+
+	if (s->GetName())
+		switchIndex[SwitchKey(s->GetName())].push_back(s);
 }
 
 void PanelSwitchScenarioHandler::SaveState(FILEHANDLE scn) {
@@ -2621,6 +2759,24 @@ void PanelSwitchScenarioHandler::LoadState(FILEHANDLE scn) {
 		if (!strnicmp(line, PANELSWITCH_END_STRING, strlen(PANELSWITCH_END_STRING)))
 			return;
 
+		//
+		// Switches save their state as "name values...", so the first word tells us
+		// which switch the line is for.
+		//
+		char buffer[256];
+		if (sscanf(line, "%255s", buffer) == 1) {
+			std::unordered_map<std::string, std::vector<PanelSwitchItem *> >::iterator it = switchIndex.find(SwitchKey(buffer));
+			if (it != switchIndex.end()) {
+				for (std::vector<PanelSwitchItem *>::iterator s = it->second.begin(); s != it->second.end(); ++s)
+					(*s)->LoadState(line);
+				continue;
+			}
+		}
+
+		//
+		// Not a known switch name. Offer the line to everyone, the switches themselves
+		// only compare the start of the name, which older scenarios may rely on.
+		//
 		PanelSwitchItem *s = switchList;
 		while (s) {
 			s->LoadState(line);
@@ -2631,12 +2787,10 @@ void PanelSwitchScenarioHandler::LoadState(FILEHANDLE scn) {
 
 PanelSwitchItem* PanelSwitchScenarioHandler::GetSwitch(char *name) {
 
-	PanelSwitchItem *s = switchList;
-	while (s) {
-		if (!stricmp(s->GetName(), name)) 
-			return s;
-		s = s->GetNextForScenario();
-	}
+	std::unordered_map<std::string, std::vector<PanelSwitchItem *> >::iterator it = switchIndex.find(SwitchKey(name));
+	if (it != switchIndex.end() && !it->second.empty())
+		return it->second.back();
+
 	return 0;
 }
 
@@ -29,6 +29,10 @@
 #include "powersource.h"
 #include "nasspdefs.h"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 //
 // Switch states. Only use positive numbers.
 //
@@ -63,6 +67,16 @@
 #define TIME_UPDATE_MINUTES 1
 #define TIME_UPDATE_HOURS	2
 
+#define DRAWSTATE_SEED		2166136261u	///< Starting value for PanelSwitchItem::GetDrawState().
+
+///
+/// Draw states are built by folding everything that decides what an item looks
+/// like into one value, FNV style.
+/// \brief Fold a value into a draw state.
+///
+inline unsigned int MixDrawState(unsigned int h, unsigned int v) { return (h ^ v) * 16777619u; }
+inline unsigned int MixDrawState(unsigned int h, const void *p) { return MixDrawState(h, (unsigned int)(size_t)p); }
+
 class SwitchRow;
 class PanelSwitchScenarioHandler;
 class PanelSwitchCallbackInterface;
@@ -135,6 +149,15 @@ public:
 	virtual void LoadState(char *line) = 0;
 	virtual void DrawFlash(SURFHANDLE DrawSurface) {};
 
+	///
+	/// Used to skip redrawing panel areas that haven't changed. The value only has
+	/// to change whenever what DrawSwitch() would draw changes.
+	/// \brief Get a value describing what the item currently looks like.
+	/// \param drawState Set to the value.
+	/// \return False if the item can't tell, so it must be redrawn every time.
+	///
+	virtual bool GetDrawState(unsigned int &drawState) { return false; };
+
 	///
 	/// Each object has a human-readable displayable name. Normally this will be a
 	/// pre-initialised string rather than a dynamic name, so we just copy the pointer
@@ -305,6 +328,7 @@ public:
 
 	virtual bool SwitchTo(int newState, bool dontspring = false);
 	virtual void DrawSwitch(SURFHANDLE DrawSurface);
+	virtual bool GetDrawState(unsigned int &drawState);
 	virtual bool CheckMouseClick(int event, int mx, int my);
 	virtual void SaveState(FILEHANDLE scn);
 	virtual void LoadState(char *line);
@@ -368,6 +392,7 @@ class AttitudeToggle: public ToggleSwitch {
 
 public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(unsigned int &drawState) { return false; };
 	virtual bool SwitchTo(int newState, bool dontspring = false);
 
 };
@@ -380,6 +405,7 @@ class NavModeToggle: public ToggleSwitch {
 
 public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(unsigned int &drawState) { return false; };
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row, VESSEL *v, int mode, SoundLib &s);
 	virtual bool SwitchTo(int newState, bool dontspring = false);
 
@@ -395,6 +421,7 @@ class HUDToggle: public ToggleSwitch {
 
 public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(unsigned int &drawState) { return false; };
 	bool CheckMouseClick(int event, int mx, int my);
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row, int mode, SoundLib &s);
 	virtual bool SwitchTo(int newState,bool dontspring = false);
@@ -822,6 +849,7 @@ public:
 				   int xOffset = 0, int yOffset = 0);
 	void DrawSwitch(SURFHANDLE DrawSurface);
 	void DrawFlash(SURFHANDLE DrawSurface);
+	bool GetDrawState(unsigned int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
@@ -927,6 +955,7 @@ public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
 	void DrawFlash(SURFHANDLE DrawSurface);
 	void DoDrawSwitch(SURFHANDLE drawSurface);
+	bool GetDrawState(unsigned int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
@@ -970,6 +999,7 @@ public:
 	void InitGuard(int xp, int yp, int w, int h, SURFHANDLE surf,
 				   int xOffset = 0, int yOffset = 0);
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(unsigned int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
@@ -1030,6 +1060,7 @@ public:
 	void AddPosition(int value, double angle);
 	void DrawSwitch(SURFHANDLE drawSurface);
 	void DrawFlash(SURFHANDLE drawSurface);
+	bool GetDrawState(unsigned int &drawState);
 	virtual bool CheckMouseClick(int event, int mx, int my);
 	virtual bool SwitchTo(int newValue);
 	virtual void SaveState(FILEHANDLE scn);
@@ -1150,6 +1181,7 @@ public:
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row);
 	void DrawSwitch(SURFHANDLE drawSurface);
 	void DrawFlash(SURFHANDLE drawSurface);
+	bool GetDrawState(unsigned int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
 	virtual bool SwitchTo(int newState);
 	void SaveState(FILEHANDLE scn);
@@ -1227,10 +1259,22 @@ public:
 
 	bool CheckMouseClick(int id, int event, int mx, int my);
 	bool DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn);
+
+	///
+	/// Draw the row only if it looks different from the last time it was drawn into
+	/// the same surface. Rows with an item that can't report its draw state are always
+	/// drawn.
+	/// \brief Draw the row if it has changed.
+	/// \param redrawn Set to true if the row was drawn.
+	/// \param force Draw it even if it hasn't changed.
+	/// \return True if the row is for this panel area.
+	///
+	bool DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn, bool &redrawn, bool force);
 	void AddSwitch(PanelSwitchItem *s);
 	void Init(int area, PanelSwitches &panel, e_object *p = 0);
 	SwitchRow *GetNext() { return RowList; };
 	void SetNext(SwitchRow *s) { RowList = s; };
+	int GetPanelArea() { return PanelArea; };
 	void timestep(double missionTime);
 
 	///
@@ -1249,6 +1293,13 @@ protected:
 
 	e_object *RowPower;
 
+	///
+	/// \brief What the row looked like, and where, when it was last drawn.
+	///
+	bool drawn;
+	unsigned int lastDrawState;
+	SURFHANDLE lastDrawSurface;
+
 	friend class ToggleSwitch;
 	friend class ThreePosSwitch;
 	friend class FivePosSwitch;
@@ -1277,8 +1328,9 @@ public:
 	PanelSwitches() { PanelID = 0; RowList = 0; Realism = 0; lastexecutedtime=MINUS_INFINITY;};
 	bool CheckMouseClick(int id, int event, int mx, int my);
 	bool DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn);
-	void AddRow(SwitchRow *s) { s->SetNext(RowList); RowList = s; };
-	void Init(int id, VESSEL *v, SoundLib *s, PanelSwitchListener *l) { PanelID = id; RowList = 0; vessel = v; soundlib = s; listener = l; };
+	bool DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn, bool &redrawn, bool force);
+	void AddRow(SwitchRow *s);
+	void Init(int id, VESSEL *v, SoundLib *s, PanelSwitchListener *l) { PanelID = id; RowList = 0; areaIndex.clear(); vessel = v; soundlib = s; listener = l; };
 	void SetRealism(int r) { Realism = r; };
 	void timestep(double missionTime);
 
@@ -1305,6 +1357,15 @@ protected:
 	int Realism;
 	double lastexecutedtime;
 
+	///
+	/// Redraw and mouse events come in by panel area, so look the row up
+	/// directly rather than walking the list.
+	/// \brief Row for each panel area.
+	///
+	std::unordered_map<int, SwitchRow *> areaIndex;
+
+	SwitchRow *GetRow(int id);
+
 	friend class ToggleSwitch;
 	friend class ThreePosSwitch;
 	friend class FivePosSwitch;
@@ -1330,7 +1391,15 @@ public:
 	void LoadState(FILEHANDLE scn);
 
 protected:
+	static std::string SwitchKey(const char *name);
+
 	PanelSwitchItem *switchList;
+
+	///
+	/// Switches by lower case name, so a scenario line can be handed straight to its switch.
+	/// Usually one switch per name, the most recently registered one last.
+	///
+	std::unordered_map<std::string, std::vector<PanelSwitchItem *> > switchIndex;
 };
 
 ///
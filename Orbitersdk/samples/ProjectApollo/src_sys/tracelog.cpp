@@ -0,0 +1,555 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Binary event trace log
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1300) //Microsoft Visual Studio Version 2003 and higher
+#define _CRT_SECURE_NO_DEPRECATE
+#endif
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tracelog.h"
+
+//
+// Single producer, single consumer byte ring. The owning thread only moves head,
+// the writer thread only moves tail; both count up and wrap naturally.
+//
+struct TraceRing
+{
+	std::atomic<unsigned int> head;
+	std::atomic<unsigned int> tail;
+	std::atomic<unsigned int> dropped;
+	std::atomic<bool> retired;
+	unsigned int sequence;
+	unsigned short thread;
+	unsigned char data[TRACE_RING_SIZE];
+};
+
+std::atomic<unsigned int> TraceLog::mask(TRACE_DEFAULT_MASK);
+std::atomic<bool> TraceLog::active(false);
+
+static std::mutex traceLock;
+static std::condition_variable traceWakeup;
+static std::vector<TraceRing *> traceRings;
+static unsigned short traceThreads = 0;
+static std::thread traceWriter;
+static FILE *traceFile = NULL;
+static int traceUsers = 0;
+static bool traceStopping = false;
+static std::chrono::steady_clock::time_point traceStart;
+
+//
+// Marks the thread's ring as retired when the thread exits. Once the writer has
+// emptied it, the next new thread takes it over, and the last Close() frees it,
+// so the rings only ever number as many as the threads tracing at once.
+//
+struct TraceRingOwner
+{
+	TraceRing *ring;
+
+	TraceRingOwner() : ring(NULL) {};
+	~TraceRingOwner() { if (ring) ring->retired = true; };
+};
+
+static thread_local TraceRingOwner localRing;
+
+static TraceRing *LocalRing()
+
+{
+	if (!localRing.ring)
+	{
+		std::lock_guard<std::mutex> guard(traceLock);
+		TraceRing *r = NULL;
+
+		for (TraceRing *f : traceRings)
+		{
+			if (f->retired && f->head == f->tail)
+			{
+				r = f;
+				break;
+			}
+		}
+
+		if (!r)
+		{
+			r = new TraceRing;
+			r->head = r->tail = r->dropped = 0;
+			r->thread = traceThreads++;
+			traceRings.push_back(r);
+		}
+
+		r->sequence = 0;
+		r->retired = false;
+		localRing.ring = r;
+	}
+	return localRing.ring;
+}
+
+static void RingCopy(TraceRing *r, unsigned int pos, const void *src, unsigned int n)
+
+{
+	unsigned int i = pos & (TRACE_RING_SIZE - 1);
+	unsigned int first = TRACE_RING_SIZE - i;
+
+	if (first > n)
+		first = n;
+
+	memcpy(r->data + i, src, first);
+	memcpy(r->data, (const unsigned char *)src + first, n - first);
+}
+
+bool TraceLog::Open(const char *filename)
+
+{
+	std::lock_guard<std::mutex> guard(traceLock);
+
+	if (traceUsers++ > 0)
+		return traceFile != NULL;
+
+	traceFile = fopen(filename, "wb");
+	if (!traceFile)
+		return false;
+
+	fwrite(TRACE_FILE_MAGIC, 1, 8, traceFile);
+	traceStart = std::chrono::steady_clock::now();
+	traceStopping = false;
+	traceWriter = std::thread(&TraceLog::WriterLoop);
+	active = true;
+
+	return true;
+}
+
+void TraceLog::Close()
+
+{
+	std::unique_lock<std::mutex> guard(traceLock);
+
+	if (traceUsers == 0 || --traceUsers > 0)
+		return;
+
+	active = false;
+	if (!traceFile)
+		return;
+
+	traceStopping = true;
+	guard.unlock();
+	traceWakeup.notify_all();
+	if (traceWriter.joinable())
+		traceWriter.join();
+
+	//
+	// Anything written between the writer's last pass and active going false.
+	//
+	Drain();
+
+	guard.lock();
+	fclose(traceFile);
+	traceFile = NULL;
+
+	//
+	// Threads that have gone won't write again. Rings of live threads stay, as
+	// those threads still hold them.
+	//
+	for (int i = (int)traceRings.size() - 1; i >= 0; i--)
+	{
+		if (traceRings[i]->retired)
+		{
+			delete traceRings[i];
+			traceRings.erase(traceRings.begin() + i);
+		}
+	}
+}
+
+void TraceLog::Write(unsigned int category, int event, const void *data, int size, int level)
+
+{
+	if (!Enabled(category))
+		return;
+
+	TraceRing *r = LocalRing();
+
+	if (size > TRACE_MAX_PAYLOAD)
+		size = TRACE_MAX_PAYLOAD;
+
+	TraceRecord rec;
+	rec.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - traceStart).count();
+	rec.category = category;
+	rec.event = (unsigned short)event;
+	rec.size = (unsigned short)size;
+	rec.thread = r->thread;
+	rec.level = (unsigned short)level;
+	rec.sequence = r->sequence++;
+
+	unsigned int need = sizeof(rec) + size;
+	unsigned int head = r->head.load(std::memory_order_relaxed);
+	unsigned int tail = r->tail.load(std::memory_order_acquire);
+
+	if (TRACE_RING_SIZE - (head - tail) < need)
+	{
+		r->dropped++;
+		return;
+	}
+
+	RingCopy(r, head, &rec, sizeof(rec));
+	RingCopy(r, head + sizeof(rec), data, size);
+	r->head.store(head + need, std::memory_order_release);
+}
+
+void TraceLog::Printf(unsigned int category, const char *fmt, ...)
+
+{
+	if (!Enabled(category))
+		return;
+
+	char buffer[TRACE_MAX_PAYLOAD];
+	va_list args;
+
+	va_start(args, fmt);
+	int n = vsnprintf(buffer, sizeof(buffer), fmt, args);
+	va_end(args);
+
+	if (n < 0)
+		return;
+	if (n >= (int)sizeof(buffer))
+		n = sizeof(buffer) - 1;
+
+	Write(category, TRACEEV_TEXT, buffer, n);
+}
+
+//
+// Move everything in the rings to the file. Called by the writer thread, or by
+// Close() once the writer has stopped.
+//
+void TraceLog::Drain()
+
+{
+	std::vector<TraceRing *> rings;
+	{
+		std::lock_guard<std::mutex> guard(traceLock);
+		rings = traceRings;
+	}
+
+	for (TraceRing *r : rings)
+	{
+		unsigned int tail = r->tail.load(std::memory_order_relaxed);
+		unsigned int head = r->head.load(std::memory_order_acquire);
+
+		if (head != tail)
+		{
+			unsigned int n = head - tail;
+			unsigned int i = tail & (TRACE_RING_SIZE - 1);
+			unsigned int first = TRACE_RING_SIZE - i;
+
+			if (first > n)
+				first = n;
+
+			fwrite(r->data + i, 1, first, traceFile);
+			fwrite(r->data, 1, n - first, traceFile);
+			r->tail.store(head, std::memory_order_release);
+		}
+
+		unsigned int dropped = r->dropped.exchange(0);
+		if (dropped && (mask & TRACE_SYSTEM))
+		{
+			TraceRecord rec;
+			TraceDropped d;
+
+			d.thread = r->thread;
+			d.count = dropped;
+
+			rec.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - traceStart).count();
+			rec.category = TRACE_SYSTEM;
+			rec.event = TRACEEV_DROPPED;
+			rec.size = sizeof(d);
+			rec.thread = r->thread;
+			rec.level = 0;
+			rec.sequence = 0;
+
+			fwrite(&rec, 1, sizeof(rec), traceFile);
+			fwrite(&d, 1, sizeof(d), traceFile);
+		}
+	}
+
+	fflush(traceFile);
+}
+
+void TraceLog::WriterLoop()
+
+{
+	std::unique_lock<std::mutex> guard(traceLock);
+
+	while (!traceStopping)
+	{
+		traceWakeup.wait_for(guard, std::chrono::milliseconds(TRACE_FLUSH_MS));
+
+		guard.unlock();
+		Drain();
+		guard.lock();
+	}
+}
+
+//
+// Decoder.
+//
+
+static const char *CategoryName(unsigned int category)
+
+{
+	switch (category)
+	{
+	case TRACE_SYSTEM:
+		return "SYS";
+	case TRACE_FUNC:
+		return "FUNC";
+	case TRACE_LVDC:
+		return "LVDC";
+	case TRACE_IMU:
+		return "IMU";
+	case TRACE_AGC:
+		return "AGC";
+	case TRACE_PERF:
+		return "PERF";
+	}
+	return "?";
+}
+
+static void BinaryString(char *buffer, int value)
+
+{
+	//
+	// 15 bit AGC word.
+	//
+	for (int i = 0; i < 15; i++)
+		buffer[i] = (value & (0x4000 >> i)) ? '1' : '0';
+	buffer[15] = 0;
+}
+
+static const double TraceDeg = 57.29577951308232;
+
+bool TraceLog::Decode(FILE *in, FILE *out, unsigned int categories, bool raw)
+
+{
+	char magic[8];
+	unsigned char payload[TRACE_MAX_PAYLOAD + 1];
+	TraceRecord rec;
+
+	if (fread(magic, 1, 8, in) != 8 || memcmp(magic, TRACE_FILE_MAGIC, 8))
+		return false;
+
+	while (fread(&rec, sizeof(rec), 1, in) == 1)
+	{
+		if (rec.size > TRACE_MAX_PAYLOAD || fread(payload, 1, rec.size, in) != rec.size)
+			return false;
+		payload[rec.size] = 0;
+
+		if (!(rec.category & categories))
+			continue;
+
+		if (raw)
+		{
+			if (rec.event == TRACEEV_TEXT)
+				fwrite(payload, 1, rec.size, out);
+			continue;
+		}
+
+		fprintf(out, "%12.6f %-4s %2d ", rec.time, CategoryName(rec.category), rec.thread);
+
+		switch (rec.event)
+		{
+		case TRACEEV_TEXT:
+			//
+			// Text records carry their own line ends, and may be partial lines.
+			//
+			fwrite(payload, 1, rec.size, out);
+			if (rec.size == 0 || payload[rec.size - 1] != '\n')
+				fputc('\n', out);
+			break;
+
+		case TRACEEV_FUNC_ENTER:
+		case TRACEEV_FUNC_EXIT:
+		case TRACEEV_FUNC_MESSAGE:
+			{
+				const char *func = (const char *)payload;
+				const char *msg = "Starting";
+
+				if (rec.event == TRACEEV_FUNC_EXIT)
+					msg = "Done";
+				else if (rec.event == TRACEEV_FUNC_MESSAGE)
+					msg = strlen(func) < rec.size ? func + strlen(func) + 1 : "";
+
+				fprintf(out, "%*s%s: %s\n", rec.level, "", func, msg);
+			}
+			break;
+
+		case TRACEEV_IMU_STATE:
+			if (rec.size >= sizeof(TraceIMUState))
+			{
+				TraceIMUState s;
+				char bits[16];
+
+				memcpy(&s, payload, sizeof(s));
+				s.device[3] = 0;
+				BinaryString(bits, s.value);
+
+				fprintf(out, "Ch %03o %s %s PIPA %o %o %o CDUCMD %o %o %o GYRO %o IMU %.2f %.2f %.2f\n",
+					s.channel, s.device, bits, s.pipa[0], s.pipa[1], s.pipa[2],
+					s.cducmd[0], s.cducmd[1], s.cducmd[2], s.gyro,
+					s.gimbal[0] * TraceDeg, s.gimbal[1] * TraceDeg, s.gimbal[2] * TraceDeg);
+			}
+			break;
+
+		case TRACEEV_IMU_STEP:
+			if (rec.size >= sizeof(TraceIMUStep))
+			{
+				TraceIMUStep s;
+
+				memcpy(&s, payload, sizeof(s));
+				fprintf(out, "TimeStep                   Orbiter %.2f %.2f %.2f   IMU %.2f %.2f %.2f\n",
+					s.orbiter[0] * TraceDeg, s.orbiter[1] * TraceDeg, s.orbiter[2] * TraceDeg,
+					s.gimbal[0] * TraceDeg, s.gimbal[1] * TraceDeg, s.gimbal[2] * TraceDeg);
+			}
+			break;
+
+		case TRACEEV_IMU_VECTOR:
+			if (rec.size >= sizeof(TraceVector))
+			{
+				TraceVector v;
+
+				memcpy(&v, payload, sizeof(v));
+				fprintf(out, "%s Vector %f %f %f\n", (const char *)payload + sizeof(v), v.v[0], v.v[1], v.v[2]);
+			}
+			break;
+
+		case TRACEEV_IMU_MESSAGE:
+			fprintf(out, "Message %s\n", (const char *)payload);
+			break;
+
+		case TRACEEV_AGC_OUTPUT:
+		case TRACEEV_AGC_INPUT:
+		case TRACEEV_AGC_INPUT_BIT:
+			if (rec.size >= sizeof(TraceChannel))
+			{
+				TraceChannel c;
+
+				memcpy(&c, payload, sizeof(c));
+				if (rec.event == TRACEEV_AGC_OUTPUT)
+					fprintf(out, "AGC write %05o to %04o\n", c.value, c.channel);
+				else if (rec.event == TRACEEV_AGC_INPUT)
+					fprintf(out, "Wrote %05o to input channel %04o\n", c.value, c.channel);
+				else
+					fprintf(out, "Set bit %d of input channel %04o to %d\n", c.bit, c.channel, c.value);
+			}
+			break;
+
+		case TRACEEV_DROPPED:
+			if (rec.size >= sizeof(TraceDropped))
+			{
+				TraceDropped d;
+
+				memcpy(&d, payload, sizeof(d));
+				fprintf(out, "%u records dropped by thread %u\n", d.count, d.thread);
+			}
+			break;
+
+		case TRACEEV_TIMING:
+			if (rec.size >= sizeof(TraceTiming))
+			{
+				TraceTiming t;
+
+				memcpy(&t, payload, sizeof(t));
+				t.name[7] = 0;
+				fprintf(out, "%-7s %8.3f s simulated, %9.3f ms used, %7.3f ms/s, %u calls\n", t.name, t.simTime, t.cpuTime * 1000.0,
+					t.simTime > 0.0 ? t.cpuTime * 1000.0 / t.simTime : 0.0, t.calls);
+			}
+			break;
+
+		default:
+			fprintf(out, "Event %d, %d bytes\n", rec.event, rec.size);
+			break;
+		}
+	}
+
+	return true;
+}
+
+TraceTimer::TraceTimer(const char *timerName, double timerInterval)
+
+{
+	memset(name, 0, sizeof(name));
+	strncpy(name, timerName, sizeof(name) - 1);
+	interval = timerInterval;
+	simTime = 0.0;
+	cpuTime = 0.0;
+	calls = 0;
+	running = false;
+}
+
+void TraceTimer::Start()
+
+{
+	if (TraceLog::Enabled(TRACE_PERF))
+	{
+		start = std::chrono::steady_clock::now();
+		running = true;
+	}
+}
+
+void TraceTimer::Stop(double simdt, unsigned int n)
+
+{
+	if (running)
+	{
+		cpuTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		running = false;
+	}
+
+	simTime += simdt;
+	calls += n;
+
+	if (simTime < interval)
+		return;
+
+	if (TraceLog::Enabled(TRACE_PERF))
+	{
+		TraceTiming t;
+
+		memset(&t, 0, sizeof(t));
+		memcpy(t.name, name, sizeof(t.name));
+		t.simTime = simTime;
+		t.cpuTime = cpuTime;
+		t.calls = calls;
+		TraceLog::Write(TRACE_PERF, TRACEEV_TIMING, &t, sizeof(t));
+	}
+
+	simTime = 0.0;
+	cpuTime = 0.0;
+	calls = 0;
+}
@@ -0,0 +1,207 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2017
+
+  Binary event trace log
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#if !defined(_PA_TRACELOG_H)
+#define _PA_TRACELOG_H
+
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+
+///
+/// Trace categories. Each record belongs to one category, and only the categories
+/// set in the mask are recorded.
+///
+#define TRACE_SYSTEM		0x00000001		///< Trace log housekeeping (dropped records).
+#define TRACE_FUNC			0x00000002		///< Tracer function entry/exit.
+#define TRACE_LVDC			0x00000004		///< LVDC guidance log (was lvlog.txt).
+#define TRACE_IMU			0x00000008		///< IMU channel and gimbal log.
+#define TRACE_AGC			0x00000010		///< AGC I/O channel writes.
+#define TRACE_PERF			0x00000020		///< Time spent in simulation code, per simulated time.
+#define TRACE_ALL			0xffffffff
+
+//
+// Release builds record nothing unless TRACEMASK asks for it, as they didn't
+// log before the trace log either.
+//
+#ifdef _DEBUG
+#define TRACE_DEFAULT_MASK	TRACE_ALL
+#else
+#define TRACE_DEFAULT_MASK	TRACE_SYSTEM
+#endif
+
+#define TRACE_RING_SIZE		65536			///< Bytes buffered per writing thread.
+#define TRACE_MAX_PAYLOAD	1024			///< Largest record payload.
+#define TRACE_FLUSH_MS		50				///< Background writer period.
+
+#define TRACE_FILE_MAGIC	"PATRACE1"
+
+///
+/// Record types.
+///
+enum TraceEvent
+{
+	TRACEEV_TEXT = 0,				///< Free text, written verbatim.
+	TRACEEV_FUNC_ENTER,				///< Function name.
+	TRACEEV_FUNC_EXIT,				///< Function name.
+	TRACEEV_FUNC_MESSAGE,			///< Function name, NUL, message.
+	TRACEEV_IMU_STATE,				///< TraceIMUState.
+	TRACEEV_IMU_STEP,				///< TraceIMUStep.
+	TRACEEV_IMU_VECTOR,				///< TraceVector followed by the message.
+	TRACEEV_IMU_MESSAGE,			///< Message text.
+	TRACEEV_AGC_OUTPUT,				///< TraceChannel.
+	TRACEEV_AGC_INPUT,				///< TraceChannel.
+	TRACEEV_AGC_INPUT_BIT,			///< TraceChannel.
+	TRACEEV_DROPPED,				///< TraceDropped.
+	TRACEEV_TIMING					///< TraceTiming.
+};
+
+///
+/// Header of each record in the ring buffers and in the trace file. The payload
+/// follows immediately, with no padding.
+///
+struct TraceRecord
+{
+	double time;					///< Seconds since the trace was opened.
+	unsigned int category;			///< TRACE_* category.
+	unsigned short event;			///< TRACEEV_* type.
+	unsigned short size;			///< Payload bytes.
+	unsigned short thread;			///< Index of the writing thread.
+	unsigned short level;			///< Tracer nesting level, otherwise zero.
+	unsigned int sequence;			///< Per-thread record number, gaps are dropped records.
+};
+
+struct TraceIMUState
+{
+	int channel;
+	int value;
+	int pipa[3];
+	int cducmd[3];
+	int gyro;
+	float gimbal[3];				///< Radians.
+	char device[4];
+};
+
+struct TraceIMUStep
+{
+	float orbiter[3];				///< Radians.
+	float gimbal[3];				///< Radians.
+};
+
+struct TraceVector
+{
+	double v[3];
+};
+
+struct TraceChannel
+{
+	int channel;
+	int value;
+	int bit;
+};
+
+struct TraceDropped
+{
+	unsigned int thread;
+	unsigned int count;
+};
+
+struct TraceTiming
+{
+	char name[8];
+	double simTime;					///< Simulated seconds covered.
+	double cpuTime;					///< Seconds spent in the timed code.
+	unsigned int calls;
+	unsigned int reserved;
+};
+
+///
+/// \brief Process-wide binary trace log.
+///
+/// Each thread that writes gets its own lock-free ring buffer, so recording a
+/// record is a mask test and a memcpy. A background thread moves the rings to
+/// disk every TRACE_FLUSH_MS; records that don't fit in a full ring are counted
+/// and reported as TRACEEV_DROPPED instead of blocking the simulation.
+///
+/// Use TraceLog::Decode() (or the tracedump tool) to turn the file into text.
+///
+class TraceLog
+{
+public:
+	///
+	/// Start tracing to the given file. Calls nest: the first one opens the file and
+	/// starts the writer, later ones only count. Every Open() needs a Close().
+	///
+	static bool Open(const char *filename);
+	static void Close();
+
+	static void SetMask(unsigned int m) { mask = m; };
+	static unsigned int GetMask() { return mask; };
+	static bool Enabled(unsigned int category) { return active && (mask & category) != 0; };
+
+	static void Write(unsigned int category, int event, const void *data, int size, int level = 0);
+	static void Printf(unsigned int category, const char *fmt, ...);
+
+	///
+	/// Print the records of the given categories from a trace file. With raw set, only
+	/// the payload of text records is printed, which reproduces the old text logs.
+	///
+	static bool Decode(FILE *in, FILE *out, unsigned int categories = TRACE_ALL, bool raw = false);
+
+protected:
+	static void WriterLoop();
+	static void Drain();
+
+	static std::atomic<unsigned int> mask;
+	static std::atomic<bool> active;
+};
+
+///
+/// \brief Time spent in a piece of code per simulated second.
+///
+/// Bracket the code with Start() and Stop(); every interval seconds of simulated time a
+/// TRACE_PERF record gives the time spent in it and the number of calls. Frames that
+/// skip the code should still call Stop() (without Start()) so their time is counted.
+/// Costs a mask test when TRACE_PERF is off.
+///
+class TraceTimer
+{
+public:
+	TraceTimer(const char *name, double interval = 10.0);
+
+	void Start();
+	void Stop(double simdt, unsigned int calls = 1);
+
+protected:
+	char name[8];
+	double interval;
+	double simTime;
+	double cpuTime;
+	unsigned int calls;
+	bool running;
+	std::chrono::steady_clock::time_point start;
+};
+
+#endif // _PA_TRACELOG_H